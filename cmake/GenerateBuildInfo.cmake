@@ -0,0 +1,53 @@
+# Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Generates the build info header; run in script mode (cmake -P) on every build.
+#
+# Expects: SOURCE_DIR, INPUT, OUTPUT, DALI_VERSION and, optionally, GIT_SHA.
+# The release builds pass GIT_SHA explicitly; otherwise it's taken from the source tree and,
+# if there are uncommitted changes to the tracked files, it's suffixed with a hash of the diff,
+# so that every state of a dirty tree gets a different stamp.
+# The output is rewritten only when its contents change, so an unchanged stamp doesn't trigger
+# any recompilation.
+
+set(DALI_BUILD_GIT_SHA "${GIT_SHA}")
+if (NOT DALI_BUILD_GIT_SHA)
+  execute_process(COMMAND git rev-parse HEAD
+                  WORKING_DIRECTORY ${SOURCE_DIR}
+                  OUTPUT_VARIABLE DALI_BUILD_GIT_SHA
+                  OUTPUT_STRIP_TRAILING_WHITESPACE
+                  ERROR_QUIET)
+  if (DALI_BUILD_GIT_SHA)
+    execute_process(COMMAND git status --porcelain --untracked-files=no
+                    WORKING_DIRECTORY ${SOURCE_DIR}
+                    OUTPUT_VARIABLE GIT_STATUS
+                    OUTPUT_STRIP_TRAILING_WHITESPACE
+                    ERROR_QUIET)
+    if (GIT_STATUS)
+      execute_process(COMMAND git diff HEAD
+                      COMMAND git hash-object --stdin
+                      WORKING_DIRECTORY ${SOURCE_DIR}
+                      OUTPUT_VARIABLE GIT_DIFF_HASH
+                      OUTPUT_STRIP_TRAILING_WHITESPACE
+                      ERROR_QUIET)
+      string(SUBSTRING "${GIT_DIFF_HASH}" 0 12 GIT_DIFF_HASH)
+      set(DALI_BUILD_GIT_SHA "${DALI_BUILD_GIT_SHA}-dirty-${GIT_DIFF_HASH}")
+    endif()
+  endif()
+endif()
+if (NOT DALI_BUILD_GIT_SHA)
+  set(DALI_BUILD_GIT_SHA "unknown")
+endif()
+
+configure_file("${INPUT}" "${OUTPUT}" @ONLY)
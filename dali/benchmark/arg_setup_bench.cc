@@ -0,0 +1,157 @@
+// Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include "dali/benchmark/dali_bench.h"
+#include "dali/pipeline/operator/arg_slot.h"
+#include "dali/pipeline/operator/operator.h"
+
+namespace dali {
+
+/**
+ * @brief Measures the cost of acquiring per-sample arguments in the operator setup,
+ *        for large batches of small images.
+ */
+class ArgSetupBench : public DALIBenchmark {
+ public:
+  /**
+   * @brief Adds an argument input with a random value in [lo, hi] for each sample
+   */
+  template <typename T>
+  void AddArgInput(OpSpec &spec, Workspace &ws, const std::string &name, int batch_size,
+                   float lo, float hi) {
+    std::mt19937 rng(batch_size);
+    std::uniform_real_distribution<float> dist(lo, hi);
+    auto arg = std::make_shared<TensorList<CPUBackend>>();
+    arg->set_pinned(false);
+    arg->Resize(uniform_list_shape(batch_size, TensorShape<>{}), type2id<T>::value);
+    for (int i = 0; i < batch_size; i++)
+      *arg->template mutable_tensor<T>(i) = static_cast<T>(dist(rng));
+    ws.AddArgumentInput(name, arg);
+    spec.AddArgumentInput(name, name);
+  }
+
+  void AddImages(OpSpec &spec, Workspace &ws, int batch_size, int size) {
+    auto data = std::make_shared<TensorList<CPUBackend>>();
+    data->set_pinned(false);
+    data->Resize(uniform_list_shape(batch_size, TensorShape<>{size, size, 3}), DALI_UINT8);
+    data->SetLayout("HWC");
+    ws.AddInput(data);
+    spec.AddInput("data", StorageDevice::CPU);
+    spec.AddOutput("out", StorageDevice::CPU);
+  }
+
+  void RunSetup(benchmark::State &st, OpSpec &spec, Workspace &ws) {
+    auto op = InstantiateOperator(spec);
+    std::vector<OutputDesc> outputs;
+    for (auto _ : st) {
+      op->Setup(outputs, ws);
+      benchmark::DoNotOptimize(outputs.data());
+    }
+    int batch_size = ws.GetInputBatchSize(0);
+    st.counters["samples/s"] = benchmark::Counter(st.iterations() * batch_size,
+                                                  benchmark::Counter::kIsRate);
+  }
+};
+
+static void ArgSetupArgs(benchmark::Benchmark *b) {
+  for (int batch_size : { 64, 1024 })
+    b->Args({ batch_size, 32 });
+}
+
+BENCHMARK_DEFINE_F(ArgSetupBench, PerSampleGetArgument)(benchmark::State& st) {
+  int batch_size = st.range(0);
+  OpSpec spec("CropMirrorNormalize");
+  spec.AddArg("max_batch_size", batch_size);
+  Workspace ws;
+  AddArgInput<float>(spec, ws, "crop_pos_x", batch_size, 0, 1);
+  AddArgInput<float>(spec, ws, "crop_pos_y", batch_size, 0, 1);
+  AddArgInput<int>(spec, ws, "mirror", batch_size, 0, 1);
+  for (auto _ : st) {
+    for (int i = 0; i < batch_size; i++) {
+      benchmark::DoNotOptimize(spec.GetArgument<float>("crop_pos_x", &ws, i));
+      benchmark::DoNotOptimize(spec.GetArgument<float>("crop_pos_y", &ws, i));
+      benchmark::DoNotOptimize(spec.GetArgument<int>("mirror", &ws, i));
+    }
+  }
+}
+
+BENCHMARK_REGISTER_F(ArgSetupBench, PerSampleGetArgument)->Unit(benchmark::kMicrosecond)
+->Apply(ArgSetupArgs);
+
+BENCHMARK_DEFINE_F(ArgSetupBench, ArgSlotAcquire)(benchmark::State& st) {
+  int batch_size = st.range(0);
+  OpSpec spec("CropMirrorNormalize");
+  spec.AddArg("max_batch_size", batch_size);
+  Workspace ws;
+  AddArgInput<float>(spec, ws, "crop_pos_x", batch_size, 0, 1);
+  AddArgInput<float>(spec, ws, "crop_pos_y", batch_size, 0, 1);
+  AddArgInput<int>(spec, ws, "mirror", batch_size, 0, 1);
+  ArgSlot<float> crop_pos_x("crop_pos_x", spec), crop_pos_y("crop_pos_y", spec);
+  ArgSlot<int> mirror("mirror", spec);
+  for (auto _ : st) {
+    benchmark::DoNotOptimize(crop_pos_x.Acquire(ws, batch_size).data());
+    benchmark::DoNotOptimize(crop_pos_y.Acquire(ws, batch_size).data());
+    benchmark::DoNotOptimize(mirror.Acquire(ws, batch_size).data());
+  }
+}
+
+BENCHMARK_REGISTER_F(ArgSetupBench, ArgSlotAcquire)->Unit(benchmark::kMicrosecond)
+->Apply(ArgSetupArgs);
+
+BENCHMARK_DEFINE_F(ArgSetupBench, CropMirrorNormalizeSetup)(benchmark::State& st) {
+  int batch_size = st.range(0);
+  int size = st.range(1);
+  OpSpec spec("CropMirrorNormalize");
+  spec.AddArg("max_batch_size", batch_size)
+      .AddArg("num_threads", 1)
+      .AddArg("device", "cpu")
+      .AddArg("crop", std::vector<float>{ size * 0.75f, size * 0.75f })
+      .AddArg("mean", std::vector<float>{ 128, 128, 128 })
+      .AddArg("std", std::vector<float>{ 64, 64, 64 });
+  Workspace ws;
+  AddImages(spec, ws, batch_size, size);
+  AddArgInput<float>(spec, ws, "crop_pos_x", batch_size, 0, 1);
+  AddArgInput<float>(spec, ws, "crop_pos_y", batch_size, 0, 1);
+  AddArgInput<int>(spec, ws, "mirror", batch_size, 0, 1);
+  RunSetup(st, spec, ws);
+}
+
+BENCHMARK_REGISTER_F(ArgSetupBench, CropMirrorNormalizeSetup)->Unit(benchmark::kMicrosecond)
+->Apply(ArgSetupArgs);
+
+BENCHMARK_DEFINE_F(ArgSetupBench, ColorTwistSetup)(benchmark::State& st) {
+  int batch_size = st.range(0);
+  int size = st.range(1);
+  OpSpec spec("ColorTwist");
+  spec.AddArg("max_batch_size", batch_size)
+      .AddArg("num_threads", 1)
+      .AddArg("device", "cpu");
+  Workspace ws;
+  AddImages(spec, ws, batch_size, size);
+  AddArgInput<float>(spec, ws, "brightness", batch_size, 0.5f, 1.5f);
+  AddArgInput<float>(spec, ws, "contrast", batch_size, 0.5f, 1.5f);
+  AddArgInput<float>(spec, ws, "hue", batch_size, -30, 30);
+  AddArgInput<float>(spec, ws, "saturation", batch_size, 0.5f, 1.5f);
+  RunSetup(st, spec, ws);
+}
+
+BENCHMARK_REGISTER_F(ArgSetupBench, ColorTwistSetup)->Unit(benchmark::kMicrosecond)
+->Apply(ArgSetupArgs);
+
+}  // namespace dali
@@ -0,0 +1,76 @@
+// Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+#include "dali/benchmark/operator_bench.h"
+#include "dali/benchmark/dali_bench.h"
+
+namespace dali {
+
+// Latency of CPU operators processing a single large image, as a function of the number of
+// threads. With one sample in the batch, the speedup comes only from splitting the sample into
+// bands (slabs) - compare the times for different numbers of threads.
+
+static void BandTilingArgs(benchmark::Benchmark *b) {
+  for (int num_threads : {1, 2, 4, 8, 16}) {
+    int H = 2160, W = 3840, C = 3;
+    b->Args({num_threads, H, W, C});
+  }
+}
+
+BENCHMARK_DEFINE_F(OperatorBench, ResizeCPULatency)(benchmark::State& st) {
+  int num_threads = st.range(0);
+  int H = st.range(1);
+  int W = st.range(2);
+  int C = st.range(3);
+
+  this->RunCPU<uint8_t>(
+    st,
+    OpSpec("Resize")
+      .AddArg("max_batch_size", 1)
+      .AddArg("num_threads", num_threads)
+      .AddArg("device", "cpu")
+      .AddArg("interp_type", DALI_INTERP_CUBIC)
+      .AddArg("resize_x", W * 2.0f / 3)
+      .AddArg("resize_y", H * 2.0f / 3),
+    1, H, W, C, true, num_threads);
+}
+
+BENCHMARK_REGISTER_F(OperatorBench, ResizeCPULatency)->Iterations(20)
+->Unit(benchmark::kMillisecond)
+->UseRealTime()
+->Apply(BandTilingArgs);
+
+BENCHMARK_DEFINE_F(OperatorBench, GaussianBlurCPULatency)(benchmark::State& st) {
+  int num_threads = st.range(0);
+  int H = st.range(1);
+  int W = st.range(2);
+  int C = st.range(3);
+
+  this->RunCPU<uint8_t>(
+    st,
+    OpSpec("GaussianBlur")
+      .AddArg("max_batch_size", 1)
+      .AddArg("num_threads", num_threads)
+      .AddArg("device", "cpu")
+      .AddArg("sigma", 3.0f),
+    1, H, W, C, true, num_threads);
+}
+
+BENCHMARK_REGISTER_F(OperatorBench, GaussianBlurCPULatency)->Iterations(20)
+->Unit(benchmark::kMillisecond)
+->UseRealTime()
+->Apply(BandTilingArgs);
+
+}  // namespace dali
@@ -156,4 +156,54 @@ BENCHMARK_REGISTER_F(CheckpointingOverhead, Reader)->Iterations(100)
 ->Unit(benchmark::kMillisecond)
 ->Apply(Args);
 
+/**
+ * @brief Measures the time needed to restore a reader from a serialized checkpoint,
+ *        depending on how many batches were read before the checkpoint was taken.
+ *
+ * The restored reader only reads the samples that are in its shuffling buffer,
+ * so the time should not grow with the position in the epoch.
+ */
+class CheckpointRestore : public DALIBenchmark {
+ protected:
+  std::unique_ptr<Pipeline> createPipeline() {
+    auto pipe = std::make_unique<Pipeline>(32, 4, 0, -1, true, 2, true);
+    pipe->AddOperator(OpSpec("FileReader")
+        .AddArg("device", "cpu")
+        .AddArg("files", jpeg_names_)
+        .AddArg("initial_fill", 64)
+        .AddArg("random_shuffle", true)
+        .AddOutput("output", StorageDevice::CPU)
+        .AddOutput("labels", StorageDevice::CPU));
+    pipe->EnableCheckpointing();
+    pipe->Build({{"output", "cpu"}});
+    return pipe;
+  }
+};
+
+BENCHMARK_DEFINE_F(CheckpointRestore, Reader)(benchmark::State& st) {
+  int iters_before_checkpoint = st.range(0);
+  std::string checkpoint;
+  {
+    auto pipe = createPipeline();
+    Workspace ws;
+    for (int i = 0; i < iters_before_checkpoint; i++) {
+      pipe->Run();
+      pipe->Outputs(&ws);
+    }
+    checkpoint = pipe->GetSerializedCheckpoint({});
+  }
+
+  for (auto _ : st) {
+    st.PauseTiming();
+    auto pipe = createPipeline();
+    st.ResumeTiming();
+    pipe->RestoreFromSerializedCheckpoint(checkpoint);
+  }
+  st.SetLabel(make_string(iters_before_checkpoint, " batches read"));
+}
+
+BENCHMARK_REGISTER_F(CheckpointRestore, Reader)->Iterations(20)
+->Unit(benchmark::kMillisecond)
+->Arg(0)->Arg(10)->Arg(100)->Arg(1000);
+
 }  // namespace dali
@@ -0,0 +1,121 @@
+// Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "dali/benchmark/dali_bench.h"
+#include "dali/pipeline/operator/eager_operator.h"
+#include "dali/pipeline/util/thread_pool.h"
+
+namespace dali {
+
+/**
+ * @brief Measures the per-call latency of a chain of 10 eager CPU operators,
+ *        for small batches of small images.
+ */
+class EagerChainBench : public DALIBenchmark {
+ public:
+  static constexpr int kChainLength = 10;
+  static constexpr int kNumThreads = 2;
+
+  void SetUp(benchmark::State &st) override {
+    int batch_size = st.range(0);
+    int size = st.range(1);
+    input_ = std::make_shared<TensorList<CPUBackend>>();
+    input_->set_pinned(false);
+    input_->Resize(uniform_list_shape(batch_size, TensorShape<>{size, size, 3}), DALI_UINT8);
+    input_->SetLayout("HWC");
+    specs_.clear();
+    for (int i = 0; i < kChainLength; i++) {
+      specs_.push_back(OpSpec("Flip")
+          .AddArg("max_batch_size", batch_size)
+          .AddArg("device", "cpu")
+          .AddArg("horizontal", i % 2)
+          .AddArg("vertical", 1 - i % 2)
+          .AddInput("data", StorageDevice::CPU)
+          .AddOutput("out", StorageDevice::CPU));
+    }
+  }
+
+  void TearDown(benchmark::State &st) override {
+    input_.reset();
+    specs_.clear();
+  }
+
+  template <typename RunOp>
+  void RunChain(benchmark::State &st, RunOp &&run_op) {
+    for (auto _ : st) {
+      auto data = input_;
+      for (int i = 0; i < kChainLength; i++)
+        data = run_op(i, { data })[0];
+      benchmark::DoNotOptimize(data.get());
+    }
+    st.counters["op calls/s"] = benchmark::Counter(st.iterations() * kChainLength,
+                                                   benchmark::Counter::kIsRate);
+  }
+
+  using Inputs = std::vector<std::shared_ptr<TensorList<CPUBackend>>>;
+  const std::unordered_map<std::string, std::shared_ptr<TensorList<CPUBackend>>> kwargs_;
+  std::shared_ptr<TensorList<CPUBackend>> input_;
+  std::vector<OpSpec> specs_;
+};
+
+static void EagerChainArgs(benchmark::Benchmark *b) {
+  for (int batch_size : { 1, 8 })
+    b->Args({ batch_size, 64 });
+}
+
+// An operator instantiated for each call, as in a dynamic-mode call without a cache
+BENCHMARK_DEFINE_F(EagerChainBench, NewInstancePerCall)(benchmark::State& st) {
+  OldThreadPool tp(kNumThreads, CPU_ONLY_DEVICE_ID, false, "EagerChainBench");
+  RunChain(st, [&](int i, const Inputs &inputs) {
+    EagerOperator<CPUBackend> op(specs_[i], specs_[i].SchemaName(), kNumThreads);
+    return op.Run(inputs, kwargs_, &tp);
+  });
+}
+
+BENCHMARK_REGISTER_F(EagerChainBench, NewInstancePerCall)->Unit(benchmark::kMicrosecond)
+->Apply(EagerChainArgs);
+
+BENCHMARK_DEFINE_F(EagerChainBench, CachedInstance)(benchmark::State& st) {
+  OldThreadPool tp(kNumThreads, CPU_ONLY_DEVICE_ID, false, "EagerChainBench");
+  EagerOperatorCache<CPUBackend> cache(64, kNumThreads);
+  RunChain(st, [&](int i, const Inputs &inputs) {
+    return cache.Get(specs_[i], inputs, kwargs_).Run(inputs, kwargs_, &tp);
+  });
+  st.counters["hit rate"] = static_cast<double>(cache.hits()) / (cache.hits() + cache.misses());
+}
+
+BENCHMARK_REGISTER_F(EagerChainBench, CachedInstance)->Unit(benchmark::kMicrosecond)
+->Apply(EagerChainArgs);
+
+// The spec part of the key is computed once, as the callers holding the spec can do
+BENCHMARK_DEFINE_F(EagerChainBench, CachedInstancePrecomputedKey)(benchmark::State& st) {
+  OldThreadPool tp(kNumThreads, CPU_ONLY_DEVICE_ID, false, "EagerChainBench");
+  EagerOperatorCache<CPUBackend> cache(64, kNumThreads);
+  std::vector<std::string> keys;
+  for (auto &spec : specs_)
+    keys.push_back(EagerOperatorCache<CPUBackend>::SpecKey(spec));
+  RunChain(st, [&](int i, const Inputs &inputs) {
+    return cache.Run(specs_[i], keys[i], inputs, kwargs_, &tp);
+  });
+}
+
+BENCHMARK_REGISTER_F(EagerChainBench, CachedInstancePrecomputedKey)
+->Unit(benchmark::kMicrosecond)->Apply(EagerChainArgs);
+
+}  // namespace dali
@@ -0,0 +1,161 @@
+// Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+#include <opencv2/core.hpp>
+#include <opencv2/imgproc.hpp>
+#include <vector>
+#include "dali/kernels/imgproc/filter/median_blur_cpu.h"
+#include "dali/kernels/imgproc/morphology/morphology_cpu.h"
+#include "dali/pipeline/util/thread_pool.h"
+
+namespace dali {
+
+namespace {
+
+static TensorShape<3> shapes[] = {
+    {480, 640, 3},
+    {1080, 1920, 3},
+    {1080, 1920, 1},
+};
+
+static constexpr int kNumShapes = sizeof(shapes) / sizeof(*shapes);
+
+static void CaseArguments(benchmark::Benchmark *b) {
+  for (int i = 0; i < kNumShapes; i++)
+    for (int window : {3, 5, 7, 9, 15, 31})
+      b->Args({i, window});
+}
+
+}  // namespace
+
+class MorphologyCPUFixture : public benchmark::Fixture {
+ public:
+  void SetUp(benchmark::State &st) override {
+    shape_ = shapes[st.range(0)];
+    window_ = st.range(1);
+    in_mem_.resize(volume(shape_));
+    out_mem_.resize(in_mem_.size());
+    for (int64_t i = 0; i < static_cast<int64_t>(in_mem_.size()); i++)
+      in_mem_[i] = (i * 2654435761u) >> 24;
+  }
+
+  void TearDown(benchmark::State &st) override {
+    in_mem_.clear();
+    in_mem_.shrink_to_fit();
+    out_mem_.clear();
+    out_mem_.shrink_to_fit();
+  }
+
+  template <typename RunFunc>
+  void Run(benchmark::State &st, int num_threads, RunFunc &&run) {
+    auto in = make_tensor_cpu<3>(in_mem_.data(), shape_);
+    auto out = make_tensor_cpu<3>(out_mem_.data(), shape_);
+    if (num_threads > 1) {
+      OldThreadPool thread_pool(num_threads, CPU_ONLY_DEVICE_ID, false, "MorphologyBench");
+      for (auto _ : st) {
+        run(thread_pool, out, in);
+        thread_pool.RunAll();
+        benchmark::DoNotOptimize(out_mem_.data());
+      }
+    } else {
+      SequentialExecutionEngine engine;
+      for (auto _ : st) {
+        run(engine, out, in);
+        benchmark::DoNotOptimize(out_mem_.data());
+      }
+    }
+    st.SetBytesProcessed(st.iterations() * in_mem_.size());
+  }
+
+  void RunMedian(benchmark::State &st, int num_threads) {
+    kernels::MedianBlurCPU<uint8_t> kernel;
+    kernels::KernelContext ctx;
+    Run(st, num_threads, [&](auto &engine, auto &out, auto &in) {
+      kernel.Schedule(engine, ctx, out, in, { window_, window_ });
+    });
+  }
+
+  void RunMorphology(benchmark::State &st, int num_threads, kernels::MorphologyOp op) {
+    kernels::MorphologyCPU<uint8_t> kernel;
+    kernels::KernelContext ctx;
+    Run(st, num_threads, [&](auto &engine, auto &out, auto &in) {
+      kernel.Schedule(engine, ctx, out, in, op, { window_, window_ });
+    });
+  }
+
+  /**
+   * @brief Runs the OpenCV counterpart of the kernel, single-threaded, as a baseline
+   */
+  template <typename RunFunc>
+  void RunOpenCV(benchmark::State &st, RunFunc &&run) {
+    int prev_threads = cv::getNumThreads();
+    cv::setNumThreads(1);
+    cv::Mat in(shape_[0], shape_[1], CV_8UC(shape_[2]), in_mem_.data());
+    cv::Mat out(shape_[0], shape_[1], CV_8UC(shape_[2]), out_mem_.data());
+    for (auto _ : st) {
+      run(out, in);
+      benchmark::DoNotOptimize(out_mem_.data());
+    }
+    st.SetBytesProcessed(st.iterations() * in_mem_.size());
+    cv::setNumThreads(prev_threads);
+  }
+
+  TensorShape<3> shape_;
+  int window_ = 3;
+  std::vector<uint8_t> in_mem_, out_mem_;
+};
+
+BENCHMARK_DEFINE_F(MorphologyCPUFixture, MedianBlur)(benchmark::State &st) {
+  RunMedian(st, 1);
+}
+
+BENCHMARK_DEFINE_F(MorphologyCPUFixture, Erode)(benchmark::State &st) {
+  RunMorphology(st, 1, kernels::MorphologyOp::Erode);
+}
+
+BENCHMARK_DEFINE_F(MorphologyCPUFixture, Dilate)(benchmark::State &st) {
+  RunMorphology(st, 1, kernels::MorphologyOp::Dilate);
+}
+
+BENCHMARK_DEFINE_F(MorphologyCPUFixture, ThreadedMedianBlur)(benchmark::State &st) {
+  RunMedian(st, 4);
+}
+
+BENCHMARK_DEFINE_F(MorphologyCPUFixture, ThreadedErode)(benchmark::State &st) {
+  RunMorphology(st, 4, kernels::MorphologyOp::Erode);
+}
+
+BENCHMARK_DEFINE_F(MorphologyCPUFixture, OpenCVMedianBlur)(benchmark::State &st) {
+  RunOpenCV(st, [&](cv::Mat &out, const cv::Mat &in) {
+    cv::medianBlur(in, out, window_);
+  });
+}
+
+BENCHMARK_DEFINE_F(MorphologyCPUFixture, OpenCVErode)(benchmark::State &st) {
+  cv::Mat kernel = cv::getStructuringElement(cv::MORPH_RECT, {window_, window_});
+  RunOpenCV(st, [&](cv::Mat &out, const cv::Mat &in) {
+    cv::erode(in, out, kernel);
+  });
+}
+
+BENCHMARK_REGISTER_F(MorphologyCPUFixture, MedianBlur)->Apply(CaseArguments);
+BENCHMARK_REGISTER_F(MorphologyCPUFixture, Erode)->Apply(CaseArguments);
+BENCHMARK_REGISTER_F(MorphologyCPUFixture, Dilate)->Apply(CaseArguments);
+BENCHMARK_REGISTER_F(MorphologyCPUFixture, ThreadedMedianBlur)->Apply(CaseArguments)->UseRealTime();
+BENCHMARK_REGISTER_F(MorphologyCPUFixture, ThreadedErode)->Apply(CaseArguments)->UseRealTime();
+BENCHMARK_REGISTER_F(MorphologyCPUFixture, OpenCVMedianBlur)->Apply(CaseArguments);
+BENCHMARK_REGISTER_F(MorphologyCPUFixture, OpenCVErode)->Apply(CaseArguments);
+
+}  // namespace dali
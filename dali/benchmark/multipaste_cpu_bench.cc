@@ -0,0 +1,162 @@
+// Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+#include <cstring>
+#include <vector>
+#include "dali/kernels/imgproc/paste/paste_cpu.h"
+#include "dali/pipeline/util/thread_pool.h"
+
+namespace dali {
+
+namespace {
+
+// canvas sizes of a 4-image mosaic (as in YOLO-style augmentation)
+static int canvas_sizes[] = { 640, 1280 };
+
+static constexpr int kNumSizes = sizeof(canvas_sizes) / sizeof(*canvas_sizes);
+
+static void CaseArguments(benchmark::Benchmark *b) {
+  for (int i = 0; i < kNumSizes; i++)
+    b->Args({i});
+}
+
+}  // namespace
+
+class MultiPasteCPUFixture : public benchmark::Fixture {
+ public:
+  using Patch = kernels::paste::MultiPasteSampleInput<2>::InputPatch;
+
+  void SetUp(benchmark::State &st) override {
+    int S = canvas_sizes[st.range(0)];
+    out_shape_ = { S, S, 3 };
+    // the mosaic center is off the middle, so that the quadrants have different sizes
+    int cy = S * 11 / 20, cx = S * 9 / 20;
+    int tiles[4][4] = {  // y0, x0, h, w
+      { 0, 0, cy, cx },
+      { 0, cx, cy, S - cx },
+      { cy, 0, S - cy, cx },
+      { cy, cx, S - cy, S - cx },
+    };
+    in_mem_.resize(4);
+    inputs_.resize(4);
+    patches_.resize(4);
+    for (int i = 0; i < 4; i++) {
+      // the source images are larger than the tiles and are cropped
+      TensorShape<3> in_shape = { S * 3 / 4, S * 3 / 4 + i * 16, 3 };
+      in_mem_[i].resize(volume(in_shape));
+      for (int64_t j = 0; j < static_cast<int64_t>(in_mem_[i].size()); j++)
+        in_mem_[i][j] = (j * 2654435761u + i) >> 24;
+      inputs_[i] = make_tensor_cpu<3>(in_mem_[i].data(), in_shape);
+      auto &p = patches_[i];
+      p.out_anchor = { tiles[i][0], tiles[i][1] };
+      p.size = { std::min<int>(tiles[i][2], in_shape[0]), std::min<int>(tiles[i][3], in_shape[1]) };
+      p.in_anchor = { static_cast<int>(in_shape[0]) - p.size[0], 0 };
+    }
+  }
+
+  void TearDown(benchmark::State &st) override {
+    in_mem_.clear();
+    inputs_.clear();
+    patches_.clear();
+  }
+
+  template <typename Out>
+  void RunPaste(benchmark::State &st, int num_threads) {
+    std::vector<Out> out_mem(volume(out_shape_));
+    auto out = make_tensor_cpu<3>(out_mem.data(), out_shape_);
+    kernels::MultiPasteCPU<Out, uint8_t> kernel;
+    kernels::KernelContext ctx;
+    Out fill[] = { 114, 114, 114 };
+    if (num_threads > 1) {
+      OldThreadPool thread_pool(num_threads, CPU_ONLY_DEVICE_ID, false, "MultiPasteBench");
+      for (auto _ : st) {
+        kernel.Schedule(thread_pool, out, make_cspan(inputs_), make_cspan(patches_),
+                        make_cspan(fill));
+        thread_pool.RunAll();
+        benchmark::DoNotOptimize(out_mem.data());
+      }
+    } else {
+      for (auto _ : st) {
+        kernel.Run(ctx, out, make_cspan(inputs_), make_cspan(patches_), make_cspan(fill));
+        benchmark::DoNotOptimize(out_mem.data());
+      }
+    }
+    st.SetBytesProcessed(st.iterations() * out_mem.size() * sizeof(Out));
+  }
+
+  /**
+   * @brief The baseline: fill the whole canvas, then convert the patches element by element
+   */
+  template <typename Out>
+  void RunNaive(benchmark::State &st) {
+    std::vector<Out> out_mem(volume(out_shape_));
+    int W = out_shape_[1], C = out_shape_[2];
+    for (auto _ : st) {
+      for (int64_t i = 0; i < static_cast<int64_t>(out_mem.size()); i++)
+        out_mem[i] = 114;
+      for (int i = 0; i < 4; i++) {
+        auto &p = patches_[i];
+        int in_W = inputs_[i].shape[1];
+        for (int y = 0; y < p.size[0]; y++) {
+          const uint8_t *in_row =
+              inputs_[i].data + ((p.in_anchor[0] + y) * in_W + p.in_anchor[1]) * C;
+          Out *out_row = out_mem.data() + ((p.out_anchor[0] + y) * W + p.out_anchor[1]) * C;
+          for (int x = 0; x < p.size[1] * C; x++)
+            out_row[x] = ConvertSat<Out>(in_row[x]);
+        }
+      }
+      benchmark::DoNotOptimize(out_mem.data());
+    }
+    st.SetBytesProcessed(st.iterations() * out_mem.size() * sizeof(Out));
+  }
+
+  TensorShape<3> out_shape_;
+  std::vector<std::vector<uint8_t>> in_mem_;
+  std::vector<kernels::InTensorCPU<uint8_t, 3>> inputs_;
+  std::vector<Patch> patches_;
+};
+
+BENCHMARK_DEFINE_F(MultiPasteCPUFixture, NaiveU8)(benchmark::State &st) {
+  RunNaive<uint8_t>(st);
+}
+
+BENCHMARK_DEFINE_F(MultiPasteCPUFixture, MosaicU8)(benchmark::State &st) {
+  RunPaste<uint8_t>(st, 1);
+}
+
+BENCHMARK_DEFINE_F(MultiPasteCPUFixture, ThreadedMosaicU8)(benchmark::State &st) {
+  RunPaste<uint8_t>(st, 4);
+}
+
+BENCHMARK_DEFINE_F(MultiPasteCPUFixture, NaiveF32)(benchmark::State &st) {
+  RunNaive<float>(st);
+}
+
+BENCHMARK_DEFINE_F(MultiPasteCPUFixture, MosaicF32)(benchmark::State &st) {
+  RunPaste<float>(st, 1);
+}
+
+BENCHMARK_DEFINE_F(MultiPasteCPUFixture, ThreadedMosaicF32)(benchmark::State &st) {
+  RunPaste<float>(st, 4);
+}
+
+BENCHMARK_REGISTER_F(MultiPasteCPUFixture, NaiveU8)->Apply(CaseArguments);
+BENCHMARK_REGISTER_F(MultiPasteCPUFixture, MosaicU8)->Apply(CaseArguments);
+BENCHMARK_REGISTER_F(MultiPasteCPUFixture, ThreadedMosaicU8)->Apply(CaseArguments)->UseRealTime();
+BENCHMARK_REGISTER_F(MultiPasteCPUFixture, NaiveF32)->Apply(CaseArguments);
+BENCHMARK_REGISTER_F(MultiPasteCPUFixture, MosaicF32)->Apply(CaseArguments);
+BENCHMARK_REGISTER_F(MultiPasteCPUFixture, ThreadedMosaicF32)->Apply(CaseArguments)->UseRealTime();
+
+}  // namespace dali
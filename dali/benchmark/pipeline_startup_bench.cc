@@ -0,0 +1,153 @@
+// Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+#include <stdlib.h>
+
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "dali/benchmark/dali_bench.h"
+#include "dali/pipeline/build_cache.h"
+#include "dali/pipeline/pipeline.h"
+
+namespace dali {
+
+enum class BuildCacheMode {Disabled, Memory, Disk};
+
+/** Measures the time it takes to deserialize and build a pipeline. */
+class PipelineStartup : public DALIBenchmark {
+ public:
+  void run(benchmark::State& st) {
+    auto mode = static_cast<BuildCacheMode>(st.range(0));
+    int num_chains = st.range(1);
+    std::string serialized = createSerializedPipeline(num_chains);
+
+    auto &cache = BuildCache::instance();
+    bool was_enabled = cache.Enabled();
+    std::string directory = cache.Directory();
+    std::string tmp_dir;
+    cache.Clear();
+    cache.SetEnabled(mode != BuildCacheMode::Disabled);
+    if (mode == BuildCacheMode::Disk) {
+      std::string tmpl =
+          (std::filesystem::temp_directory_path() / "dali_build_cache_XXXXXX").string();
+      tmp_dir = mkdtemp(&tmpl[0]);
+      cache.SetDirectory(tmp_dir);
+    } else {
+      cache.SetDirectory("");
+    }
+
+    // Warmup - populates the cache
+    {
+      Pipeline pipe(serialized);
+      pipe.Build();
+    }
+
+    while (st.KeepRunning()) {
+      if (mode == BuildCacheMode::Disk) {
+        // Simulate a new process - the entry must be read from the disk
+        st.PauseTiming();
+        cache.Clear();
+        st.ResumeTiming();
+      }
+      auto pipe = std::make_unique<Pipeline>(serialized);
+      pipe->Build();
+      st.PauseTiming();
+      // Don't count the destruction of the pipeline
+      pipe.reset();
+      st.ResumeTiming();
+    }
+
+    if (mode == BuildCacheMode::Disabled) {
+      st.SetLabel("disabled");
+    } else if (mode == BuildCacheMode::Memory) {
+      st.SetLabel("memory");
+    } else if (mode == BuildCacheMode::Disk) {
+      st.SetLabel("disk");
+    }
+
+    cache.Clear();
+    cache.SetEnabled(was_enabled);
+    cache.SetDirectory(directory);
+    if (!tmp_dir.empty())
+      std::filesystem::remove_all(tmp_dir);
+  }
+
+ protected:
+  /** Creates a pipeline with `num_chains` chains of operators with constant inputs, which are
+   *  folded at build time, and a random operator.
+   */
+  std::string createSerializedPipeline(int num_chains) {
+    const int batch_size = 32;
+    const int num_thread = 4;
+    const int64_t seed = 42;
+
+    Pipeline pipe(batch_size, num_thread, CPU_ONLY_DEVICE_ID, seed);
+    std::vector<std::pair<string, string>> outputs;
+    for (int i = 0; i < num_chains; i++) {
+      std::string c = make_string("c", i);
+      pipe.AddOperator(OpSpec("Constant")
+                       .AddArg("device", "cpu")
+                       .AddArg("idata", std::vector<int>{ i, i + 1, i + 2 })
+                       .AddOutput(c, StorageDevice::CPU), c);
+      std::string f = make_string("f", i);
+      pipe.AddOperator(OpSpec("Cast")
+                       .AddArg("device", "cpu")
+                       .AddArg("dtype", DALI_FLOAT)
+                       .AddInput(c, StorageDevice::CPU)
+                       .AddOutput(f, StorageDevice::CPU), f);
+      std::string u = make_string("u", i);
+      pipe.AddOperator(OpSpec("Cast")
+                       .AddArg("device", "cpu")
+                       .AddArg("dtype", DALI_UINT8)
+                       .AddInput(f, StorageDevice::CPU)
+                       .AddOutput(u, StorageDevice::CPU), u);
+      outputs.emplace_back(u, "cpu");
+    }
+    pipe.AddOperator(OpSpec("CoinFlip")
+                     .AddArg("device", "cpu")
+                     .AddOutput("flip", StorageDevice::CPU), "flip");
+    outputs.emplace_back("flip", "cpu");
+    pipe.SetOutputDescs(outputs);
+    return pipe.SerializeToProtobuf();
+  }
+};
+
+static void StartupArgs(benchmark::Benchmark *b) {
+  const std::vector<BuildCacheMode> modes = {
+    BuildCacheMode::Disabled,
+    BuildCacheMode::Memory,
+    BuildCacheMode::Disk,
+  };
+  for (int num_chains : {10, 100}) {
+    for (auto m : modes) {
+      b->Args({static_cast<int>(m), num_chains});
+    }
+  }
+}
+
+BENCHMARK_DEFINE_F(PipelineStartup, ConstantChains)(benchmark::State& st) {
+  this->run(st);
+}
+
+BENCHMARK_REGISTER_F(PipelineStartup, ConstantChains)->Iterations(20)
+->Unit(benchmark::kMillisecond)
+->UseRealTime()
+->Apply(StartupArgs);
+
+}  // namespace dali
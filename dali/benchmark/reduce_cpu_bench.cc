@@ -0,0 +1,127 @@
+// Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+#include <tuple>
+#include <vector>
+#include "dali/kernels/reduce/reduce_cpu.h"
+#include "dali/pipeline/util/thread_pool.h"
+
+namespace dali {
+
+namespace {
+
+using CaseData = std::tuple<TensorShape<>, std::vector<int>>;
+
+static CaseData cases[] = {
+    CaseData{{1 << 24}, {0}},                 // 1D
+    CaseData{{1080, 1920, 3}, {0, 1}},        // per-channel, HWC
+    CaseData{{3, 1080, 1920}, {1, 2}},        // per-channel, CHW
+    CaseData{{1080, 1920, 3}, {0, 1, 2}},     // full, image
+    CaseData{{1080, 1920, 3}, {2}},           // innermost
+    CaseData{{256, 256, 256}, {0, 1, 2}},     // full, volume
+    CaseData{{256, 256, 256}, {0}},           // outermost
+    CaseData{{256, 256, 256}, {1, 2}},
+    CaseData{{256, 256, 256}, {0, 1}},
+    CaseData{{128, 256, 256, 2}, {0, 1, 2}},  // per-channel, DHWC
+};
+
+static constexpr int kNumCases = sizeof(cases) / sizeof(*cases);
+
+static void CaseArguments(benchmark::Benchmark* b) {
+  for (int i = 0; i < kNumCases; i++)
+    b->Args({i});
+}
+
+}  // namespace
+
+class ReduceCPUFixture : public benchmark::Fixture {
+ public:
+  void SetUp(benchmark::State& st) override {
+    std::tie(in_shape_, axes_) = cases[st.range(0)];
+    out_shape_ = in_shape_;
+    for (int a : axes_)
+      out_shape_[a] = 1;
+    in_mem_.resize(volume(in_shape_));
+    out_mem_.resize(volume(out_shape_));
+    for (int64_t i = 0; i < static_cast<int64_t>(in_mem_.size()); i++)
+      in_mem_[i] = (i % 1000) * 0.01f;
+    mean_mem_.resize(out_mem_.size(), 5.0f);
+  }
+
+  void TearDown(benchmark::State& st) override {
+    in_mem_.clear();
+    in_mem_.shrink_to_fit();
+    out_mem_.clear();
+    out_mem_.shrink_to_fit();
+  }
+
+  template <typename Kernel, typename... Extra>
+  void Run(benchmark::State& st, int num_threads, const Extra &...extra) {
+    auto in = make_tensor_cpu(in_mem_.data(), in_shape_);
+    auto out = make_tensor_cpu(out_mem_.data(), out_shape_);
+    Kernel kernel;
+    kernel.Setup(out, in, make_cspan(axes_), extra...);
+    if (num_threads > 1) {
+      OldThreadPool thread_pool(num_threads, CPU_ONLY_DEVICE_ID, false, "ReduceBench");
+      for (auto _ : st) {
+        kernel.Schedule(thread_pool);
+        thread_pool.RunAll();
+        benchmark::DoNotOptimize(out_mem_.data());
+      }
+    } else {
+      for (auto _ : st) {
+        kernel.Run();
+        benchmark::DoNotOptimize(out_mem_.data());
+      }
+    }
+    st.SetBytesProcessed(st.iterations() * in_mem_.size() * sizeof(float));
+  }
+
+  auto mean() const {
+    return make_tensor_cpu(mean_mem_.data(), out_shape_);
+  }
+
+  TensorShape<> in_shape_, out_shape_;
+  std::vector<int> axes_;
+  std::vector<float> in_mem_, out_mem_, mean_mem_;
+};
+
+BENCHMARK_DEFINE_F(ReduceCPUFixture, Sum)(benchmark::State& st) {
+  Run<kernels::SumCPU<float, float>>(st, 1);
+}
+
+BENCHMARK_DEFINE_F(ReduceCPUFixture, Max)(benchmark::State& st) {
+  Run<kernels::MaxCPU<float, float>>(st, 1);
+}
+
+BENCHMARK_DEFINE_F(ReduceCPUFixture, StdDev)(benchmark::State& st) {
+  Run<kernels::StdDevCPU<float, float>>(st, 1, mean());
+}
+
+BENCHMARK_DEFINE_F(ReduceCPUFixture, ThreadedSum)(benchmark::State& st) {
+  Run<kernels::SumCPU<float, float>>(st, 4);
+}
+
+BENCHMARK_DEFINE_F(ReduceCPUFixture, ThreadedStdDev)(benchmark::State& st) {
+  Run<kernels::StdDevCPU<float, float>>(st, 4, mean());
+}
+
+BENCHMARK_REGISTER_F(ReduceCPUFixture, Sum)->Apply(CaseArguments);
+BENCHMARK_REGISTER_F(ReduceCPUFixture, Max)->Apply(CaseArguments);
+BENCHMARK_REGISTER_F(ReduceCPUFixture, StdDev)->Apply(CaseArguments);
+BENCHMARK_REGISTER_F(ReduceCPUFixture, ThreadedSum)->Apply(CaseArguments)->UseRealTime();
+BENCHMARK_REGISTER_F(ReduceCPUFixture, ThreadedStdDev)->Apply(CaseArguments)->UseRealTime();
+
+}  // namespace dali
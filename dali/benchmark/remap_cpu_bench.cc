@@ -0,0 +1,150 @@
+// Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <vector>
+#include "dali/kernels/imgproc/geom/remap_cpu.h"
+#include "dali/pipeline/util/thread_pool.h"
+
+namespace dali {
+
+namespace {
+
+static TensorShape<3> shapes[] = {
+    {480, 640, 3},
+    {1080, 1920, 3},
+    {1080, 1920, 1},
+};
+
+static constexpr int kNumShapes = sizeof(shapes) / sizeof(*shapes);
+
+static void CaseArguments(benchmark::Benchmark *b) {
+  for (int i = 0; i < kNumShapes; i++)
+    for (int interp : {DALI_INTERP_NN, DALI_INTERP_LINEAR})
+      b->Args({i, interp});
+}
+
+}  // namespace
+
+class RemapCPUFixture : public benchmark::Fixture {
+ public:
+  void SetUp(benchmark::State &st) override {
+    shape_ = shapes[st.range(0)];
+    interp_ = static_cast<DALIInterpType>(st.range(1));
+    in_mem_.resize(volume(shape_));
+    out_mem_.resize(in_mem_.size());
+    for (int64_t i = 0; i < static_cast<int64_t>(in_mem_.size()); i++)
+      in_mem_[i] = (i * 2654435761u) >> 24;
+    // a lens-like distortion
+    int H = shape_[0], W = shape_[1];
+    mapx_.resize(H * W);
+    mapy_.resize(H * W);
+    for (int y = 0; y < H; y++) {
+      for (int x = 0; x < W; x++) {
+        float dx = (x - W * 0.5f) / W, dy = (y - H * 0.5f) / H;
+        float k = 1 + 0.2f * (dx * dx + dy * dy);
+        mapx_[y * W + x] = W * 0.5f + dx * k * W;
+        mapy_[y * W + x] = H * 0.5f + dy * k * H;
+      }
+    }
+  }
+
+  void TearDown(benchmark::State &st) override {
+    in_mem_.clear();
+    in_mem_.shrink_to_fit();
+    out_mem_.clear();
+    out_mem_.shrink_to_fit();
+    mapx_.clear();
+    mapx_.shrink_to_fit();
+    mapy_.clear();
+    mapy_.shrink_to_fit();
+  }
+
+  TensorShape<2> map_shape() const {
+    return { shape_[0], shape_[1] };
+  }
+
+  ivec2 in_size() const {
+    return { shape_[1], shape_[0] };
+  }
+
+  void RunApply(benchmark::State &st, int num_threads) {
+    kernels::remap::FixedPointMap map;
+    kernels::remap::ConvertMap(map, mapx_.data(), mapy_.data(), map_shape(), in_size(), interp_);
+    kernels::RemapCPU<uint8_t> kernel;
+    kernels::KernelContext ctx;
+    auto in = make_tensor_cpu<3>(in_mem_.data(), shape_);
+    auto out = make_tensor_cpu<3>(out_mem_.data(), shape_);
+    if (num_threads > 1) {
+      OldThreadPool thread_pool(num_threads, CPU_ONLY_DEVICE_ID, false, "RemapBench");
+      for (auto _ : st) {
+        kernel.Schedule(thread_pool, ctx, out, in, map);
+        thread_pool.RunAll();
+        benchmark::DoNotOptimize(out_mem_.data());
+      }
+    } else {
+      for (auto _ : st) {
+        kernel.Run(ctx, out, in, map);
+        benchmark::DoNotOptimize(out_mem_.data());
+      }
+    }
+    st.SetBytesProcessed(st.iterations() * in_mem_.size());
+  }
+
+  TensorShape<3> shape_;
+  DALIInterpType interp_ = DALI_INTERP_LINEAR;
+  std::vector<uint8_t> in_mem_, out_mem_;
+  std::vector<float> mapx_, mapy_;
+};
+
+BENCHMARK_DEFINE_F(RemapCPUFixture, ConvertMap)(benchmark::State &st) {
+  kernels::remap::FixedPointMap map;
+  for (auto _ : st) {
+    kernels::remap::ConvertMap(map, mapx_.data(), mapy_.data(), map_shape(), in_size(), interp_);
+    benchmark::DoNotOptimize(map.xy.data());
+  }
+  st.SetBytesProcessed(st.iterations() * 2 * mapx_.size() * sizeof(float));
+}
+
+BENCHMARK_DEFINE_F(RemapCPUFixture, CachedMapLookup)(benchmark::State &st) {
+  kernels::remap::FixedPointMapCache cache;
+  // a copy of the map in a different buffer - the contents must be hashed
+  std::vector<float> mapx_copy = mapx_;
+  bool flip = false;
+  for (auto _ : st) {
+    cache.BeginBatch();
+    auto map = cache.Get(flip ? mapx_copy.data() : mapx_.data(), mapy_.data(), map_shape(),
+                         in_size(), interp_, 0);
+    cache.EndBatch();
+    flip = !flip;
+    benchmark::DoNotOptimize(map.get());
+  }
+  st.SetBytesProcessed(st.iterations() * 2 * mapx_.size() * sizeof(float));
+}
+
+BENCHMARK_DEFINE_F(RemapCPUFixture, Apply)(benchmark::State &st) {
+  RunApply(st, 1);
+}
+
+BENCHMARK_DEFINE_F(RemapCPUFixture, ThreadedApply)(benchmark::State &st) {
+  RunApply(st, 4);
+}
+
+BENCHMARK_REGISTER_F(RemapCPUFixture, ConvertMap)->Apply(CaseArguments);
+BENCHMARK_REGISTER_F(RemapCPUFixture, CachedMapLookup)->Apply(CaseArguments);
+BENCHMARK_REGISTER_F(RemapCPUFixture, Apply)->Apply(CaseArguments);
+BENCHMARK_REGISTER_F(RemapCPUFixture, ThreadedApply)->Apply(CaseArguments)->UseRealTime();
+
+}  // namespace dali
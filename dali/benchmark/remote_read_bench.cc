@@ -0,0 +1,122 @@
+// Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "dali/util/range_reader.h"
+
+namespace dali {
+
+namespace {
+
+/** An object in a simulated remote store, with a fixed per-request latency and bandwidth. */
+class SimulatedObject {
+ public:
+  SimulatedObject(size_t size, std::chrono::microseconds latency, double bytes_per_us)
+  : data_(size), latency_(latency), bytes_per_us_(bytes_per_us) {
+    std::iota(data_.begin(), data_.end(), 0);
+  }
+
+  RangeReader::FetchFunc Fetcher() {
+    return [this](void *buf, size_t n, size_t offset) -> size_t {
+      n = std::min(n, data_.size() - offset);
+      requests_++;
+      fetched_bytes_ += n;
+      std::this_thread::sleep_for(latency_ + std::chrono::microseconds(
+          static_cast<int64_t>(n / bytes_per_us_)));
+      std::memcpy(buf, data_.data() + offset, n);
+      return n;
+    };
+  }
+
+  size_t size() const { return data_.size(); }
+
+  std::atomic<int64_t> requests_{0}, fetched_bytes_{0};
+
+ private:
+  std::vector<uint8_t> data_;
+  std::chrono::microseconds latency_;
+  double bytes_per_us_;
+};
+
+enum class CacheMode {
+  PerStream,   // each stream has its own cache
+  Shared,      // the streams share the cache
+  SharedDetectSequential,  // ...and the isolated reads bypass it
+};
+
+}  // namespace
+
+/**
+ * Reads the records of a 16 MB TFRecord-like object, opening a new reader for every record (as
+ * the readers with deferred remote reads do). Simulates an S3 object with 0.5 ms latency and
+ * 1 GB/s bandwidth and a cache (4 MB) smaller than the object; reports the amplification of
+ * the traffic and the number of requests per record.
+ */
+static void BM_RemoteRecordRead(benchmark::State &st) {
+  auto mode = static_cast<CacheMode>(st.range(0));
+  bool shuffled = st.range(1);
+  const size_t record_size = st.range(2);
+  const int num_records = (16 << 20) / record_size;
+
+  SimulatedObject obj(num_records * record_size, std::chrono::microseconds(500), 1000.0);
+  RangeReader::Options opts;  // 256 kB blocks
+  opts.max_cached_blocks = 16;
+  opts.detect_sequential = mode == CacheMode::SharedDetectSequential;
+
+  std::vector<int> order(num_records);
+  std::iota(order.begin(), order.end(), 0);
+  if (shuffled)
+    std::shuffle(order.begin(), order.end(), std::mt19937(1234));
+  std::vector<uint8_t> out(record_size);
+
+  int64_t records_read = 0;
+  for (auto _ : st) {
+    std::shared_ptr<BlockCache> cache;
+    if (mode != CacheMode::PerStream)
+      cache = std::make_shared<BlockCache>(opts.block_size, opts.max_cached_blocks);
+    for (int r : order) {
+      RangeReader reader(obj.Fetcher(), obj.size(), opts, cache, "object");
+      reader.Read(out.data(), record_size, r * record_size);
+    }
+    records_read += num_records;
+  }
+  st.SetBytesProcessed(records_read * record_size);
+  st.counters["requests/record"] = static_cast<double>(obj.requests_) / records_read;
+  st.counters["amplification"] =
+      static_cast<double>(obj.fetched_bytes_) / (records_read * record_size);
+}
+
+static void RemoteRecordReadArgs(benchmark::Benchmark *b) {
+  for (int mode = 0; mode < 3; mode++)
+    for (int shuffled = 0; shuffled < 2; shuffled++)
+      for (int record_size : {4 << 10, 64 << 10})
+        b->Args({mode, shuffled, record_size});
+}
+
+BENCHMARK(BM_RemoteRecordRead)->Iterations(1)
+->Unit(benchmark::kMillisecond)
+->UseRealTime()
+->Apply(RemoteRecordReadArgs);
+
+}  // namespace dali
@@ -0,0 +1,140 @@
+// Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <string>
+#include <vector>
+#include "dali/benchmark/dali_bench.h"
+#include "dali/pipeline/operator/operator.h"
+#include "dali/pipeline/operator/sequence_shape.h"
+
+namespace dali {
+
+/**
+ * @brief Measures the cost of expanding batches of sequences into batches of frames,
+ *        as done by the SequenceOperator in every iteration.
+ */
+class SequenceExpandBench : public DALIBenchmark {
+ public:
+  void SetUp(benchmark::State &st) override {
+    batch_size_ = st.range(0);
+    num_frames_ = st.range(1);
+    sequences_ = std::make_shared<TensorList<CPUBackend>>();
+    sequences_->set_pinned(false);
+    sequences_->Resize(uniform_list_shape(batch_size_, TensorShape<>{num_frames_, 16, 16, 3}),
+                       DALI_UINT8);
+    sequences_->SetLayout("FHWC");
+    frames_shape_ = uniform_list_shape(batch_size_, TensorShape<>{num_frames_});
+  }
+
+  void TearDown(benchmark::State &st) override {
+    sequences_.reset();
+  }
+
+  /**
+   * @brief Creates a per-sample (or per-frame, if `per_frame` is true) float argument
+   */
+  std::shared_ptr<TensorList<CPUBackend>> MakeArg(float value, bool per_frame) {
+    auto arg = std::make_shared<TensorList<CPUBackend>>();
+    arg->set_pinned(false);
+    if (per_frame) {
+      arg->Resize(frames_shape_, DALI_FLOAT);
+      arg->SetLayout("F");
+    } else {
+      arg->Resize(uniform_list_shape(batch_size_, TensorShape<>{}), DALI_FLOAT);
+    }
+    for (int i = 0; i < batch_size_; i++) {
+      float *data = arg->mutable_tensor<float>(i);
+      for (int j = 0; j < volume(arg->tensor_shape_span(i)); j++)
+        data[j] = value;
+    }
+    return arg;
+  }
+
+  void SetFramesCounter(benchmark::State &st) {
+    st.counters["frames/s"] = benchmark::Counter(st.iterations() * batch_size_ * num_frames_,
+                                                 benchmark::Counter::kIsRate);
+  }
+
+  int batch_size_ = 0;
+  int num_frames_ = 0;
+  std::shared_ptr<TensorList<CPUBackend>> sequences_;
+  TensorListShape<> frames_shape_;
+};
+
+static void SequenceExpandArgs(benchmark::Benchmark *b) {
+  for (int batch_size : { 8, 64 })
+    b->Args({ batch_size, 32 });
+}
+
+BENCHMARK_DEFINE_F(SequenceExpandBench, UnfoldFrames)(benchmark::State& st) {
+  auto expanded = sequence_utils::expanded_like(*sequences_);
+  int num_expanded = batch_size_ * num_frames_;
+  for (auto _ : st) {
+    sequence_utils::unfold_outer_dims(*expanded, *sequences_, 1, num_expanded);
+    benchmark::DoNotOptimize(expanded->raw_tensor(num_expanded - 1));
+  }
+  SetFramesCounter(st);
+}
+
+BENCHMARK_REGISTER_F(SequenceExpandBench, UnfoldFrames)->Unit(benchmark::kMicrosecond)
+->Apply(SequenceExpandArgs);
+
+BENCHMARK_DEFINE_F(SequenceExpandBench, BroadcastArgument)(benchmark::State& st) {
+  auto arg = MakeArg(0.5f, false);
+  auto expanded = sequence_utils::expanded_like(*arg);
+  int num_expanded = batch_size_ * num_frames_;
+  for (auto _ : st) {
+    sequence_utils::broadcast_samples(*expanded, *arg, num_expanded, frames_shape_);
+    benchmark::DoNotOptimize(expanded->raw_tensor(num_expanded - 1));
+  }
+  SetFramesCounter(st);
+}
+
+BENCHMARK_REGISTER_F(SequenceExpandBench, BroadcastArgument)->Unit(benchmark::kMicrosecond)
+->Apply(SequenceExpandArgs);
+
+// The setup of a sequence operator: the input, a per-frame and a per-sample argument are expanded
+BENCHMARK_DEFINE_F(SequenceExpandBench, HsvSetup)(benchmark::State& st) {
+  OpSpec spec("Hsv");
+  spec.AddArg("max_batch_size", batch_size_)
+      .AddArg("num_threads", 1)
+      .AddArg("device", "cpu")
+      .AddInput("data", StorageDevice::CPU)
+      .AddOutput("out", StorageDevice::CPU)
+      .AddArgumentInput("hue", "hue")
+      .AddArgumentInput("saturation", "saturation");
+  Workspace ws;
+  ws.AddInput(sequences_);
+  ws.AddArgumentInput("hue", MakeArg(30, true));
+  ws.AddArgumentInput("saturation", MakeArg(1.5f, false));
+  auto out = std::make_shared<TensorList<CPUBackend>>();
+  out->set_pinned(false);
+  ws.AddOutput(out);
+  ws.SetBatchSizes(batch_size_);
+
+  auto op = InstantiateOperator(spec);
+  std::vector<OutputDesc> outputs;
+  for (auto _ : st) {
+    op->Setup(outputs, ws);
+    benchmark::DoNotOptimize(outputs.data());
+  }
+  SetFramesCounter(st);
+}
+
+BENCHMARK_REGISTER_F(SequenceExpandBench, HsvSetup)->Unit(benchmark::kMicrosecond)
+->Apply(SequenceExpandArgs);
+
+}  // namespace dali
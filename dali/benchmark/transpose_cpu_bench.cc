@@ -16,6 +16,7 @@
 #include <numeric>
 #include "dali/kernels/transpose/transpose.h"
 #include "dali/core/mm/memory.h"
+#include "dali/pipeline/util/thread_pool.h"
 
 namespace dali {
 
@@ -48,18 +49,43 @@ static CaseData cases[] = {
     CaseData{{7, 2, 4, 6, 10, 8, 4, 2}, {7, 5, 3, 2, 4, 0, 1, 6}},
 };
 
+// Typical image and volume layout conversions, at their actual sizes
+static CaseData layout_cases[] = {
+    CaseData{{224, 224, 3}, {2, 0, 1}},        // HWC -> CHW
+    CaseData{{3, 224, 224}, {1, 2, 0}},        // CHW -> HWC
+    CaseData{{720, 1280, 3}, {2, 0, 1}},       // HWC -> CHW
+    CaseData{{3, 720, 1280}, {1, 2, 0}},       // CHW -> HWC
+    CaseData{{1080, 1920, 3}, {2, 0, 1}},      // HWC -> CHW
+    CaseData{{3, 1080, 1920}, {1, 2, 0}},      // CHW -> HWC
+    CaseData{{1080, 1920, 4}, {2, 0, 1}},      // HWC -> CHW, 4 channels
+    CaseData{{16, 224, 224, 3}, {0, 3, 1, 2}},  // NHWC -> NCHW
+    CaseData{{1080, 1920}, {1, 0}},            // HW -> WH
+    CaseData{{64, 128, 128, 1}, {3, 0, 1, 2}},  // DHWC -> CDHW
+    CaseData{{64, 128, 128, 3}, {3, 0, 1, 2}},  // DHWC -> CDHW
+    CaseData{{3, 64, 128, 128}, {1, 2, 3, 0}},  // CDHW -> DHWC
+    CaseData{{64, 128, 128}, {2, 1, 0}},       // DHW -> WHD
+};
+
+static constexpr int kNumCases = sizeof(cases) / sizeof(*cases);
+static constexpr int kNumLayoutCases = sizeof(layout_cases) / sizeof(*layout_cases);
+
 std::tuple<TensorShape<>, std::vector<int>> GetCase(int id) {
-  return cases[id];
+  return id < kNumCases ? cases[id] : layout_cases[id - kNumCases];
 }
 
 static void CustomArguments(benchmark::Benchmark* b) {
-  for (unsigned int i = 0; i < sizeof(cases) / sizeof(*cases); i++) {
+  for (int i = 0; i < kNumCases; i++) {
     for (int scale = 1; scale <= 8; scale *= 2) {
       b->Args({i, scale});
     }
   }
 }
 
+static void LayoutArguments(benchmark::Benchmark* b) {
+  for (int i = 0; i < kNumLayoutCases; i++)
+    b->Args({kNumCases + i, 1});
+}
+
 }  // namespace
 
 template <typename T>
@@ -168,4 +194,33 @@ BENCHMARK_REGISTER_F(TransposeFixture, CompactUint16Test)->Apply(CustomArguments
 BENCHMARK_REGISTER_F(TransposeFixture, CompactIntTest)->Apply(CustomArguments);
 BENCHMARK_REGISTER_F(TransposeFixture, CompactDoubleTest)->Apply(CustomArguments);
 
+BENCHMARK_REGISTER_F(TransposeFixture, CompactUint8Test)->Apply(LayoutArguments);
+BENCHMARK_REGISTER_F(TransposeFixture, CompactUint16Test)->Apply(LayoutArguments);
+BENCHMARK_REGISTER_F(TransposeFixture, CompactIntTest)->Apply(LayoutArguments);
+
+template <typename T>
+void RunThreaded(TransposeFixture<T> &fixture, benchmark::State& st) {
+  OldThreadPool thread_pool(4, CPU_ONLY_DEVICE_ID, false, "TransposeBench");
+  for (auto _ : st) {
+    benchmark::DoNotOptimize(fixture.src_mem_.data());
+    kernels::TransposeGrouped(thread_pool, fixture.dst_view_, fixture.src_view_,
+                              make_cspan(fixture.perm_));
+    thread_pool.RunAll();
+    benchmark::DoNotOptimize(fixture.dst_mem_.data());
+    benchmark::ClobberMemory();
+  }
+  st.SetBytesProcessed(st.iterations() * volume(fixture.src_shape_) * sizeof(T));
+}
+
+BENCHMARK_TEMPLATE_DEFINE_F(TransposeFixture, ThreadedUint8Test, uint8_t)(benchmark::State& st) {
+  RunThreaded(*this, st);
+}
+
+BENCHMARK_TEMPLATE_DEFINE_F(TransposeFixture, ThreadedIntTest, int)(benchmark::State& st) {
+  RunThreaded(*this, st);
+}
+
+BENCHMARK_REGISTER_F(TransposeFixture, ThreadedUint8Test)->Apply(LayoutArguments)->UseRealTime();
+BENCHMARK_REGISTER_F(TransposeFixture, ThreadedIntTest)->Apply(LayoutArguments)->UseRealTime();
+
 }  // namespace dali
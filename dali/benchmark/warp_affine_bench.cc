@@ -54,6 +54,29 @@ BENCHMARK_REGISTER_F(OperatorBench, WarpAffineCPU)->Iterations(50)
 ->UseRealTime()
 ->Apply(WarpAffineCPUArgs);
 
+BENCHMARK_DEFINE_F(OperatorBench, RotateCPU)(benchmark::State& st) {
+  int batch_size = st.range(0);
+  int H = st.range(1);
+  int W = st.range(2);
+  int C = st.range(3);
+
+  this->RunCPU<uint8_t>(
+    st,
+    OpSpec("Rotate")
+      .AddArg("max_batch_size", batch_size)
+      .AddArg("num_threads", 4)
+      .AddArg("device", "cpu")
+      .AddArg("angle", 17.0f)
+      .AddArg("keep_size", true)
+      .AddArg("fill_value", 42),
+    batch_size, H, W, C);
+}
+
+BENCHMARK_REGISTER_F(OperatorBench, RotateCPU)->Iterations(50)
+->Unit(benchmark::kMicrosecond)
+->UseRealTime()
+->Apply(WarpAffineCPUArgs);
+
 
 static void WarpAffineGPUArgs(benchmark::Benchmark *b) {
   for (int batch_size = 256; batch_size >= 1; batch_size /= 2) {
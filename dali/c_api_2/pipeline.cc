@@ -12,7 +12,11 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
+#include <chrono>
+#include <optional>
 #include <utility>
+#include <vector>
 #include "dali/c_api_2/pipeline.h"
 #include "dali/c_api_2/pipeline_outputs.h"
 #include "dali/c_api_2/checkpoint.h"
@@ -83,11 +87,47 @@ PipelineWrapper::~PipelineWrapper() = default;
 
 std::unique_ptr<PipelineOutputs>
 PipelineWrapper::PopOutputs(AccessOrder order) {
-  return std::make_unique<PipelineOutputs>(pipeline_.get(), order);
+  auto outputs = std::make_unique<PipelineOutputs>(pipeline_.get(), order, shm_arena_);
+  std::optional<LaunchedBatch> launched;
+  {
+    std::lock_guard<std::mutex> g(batching_mtx_);
+    if (!launched_batches_.empty()) {
+      launched = std::move(launched_batches_.front());
+      launched_batches_.pop_front();
+    }
+  }
+  if (launched) {
+    auto &batch = launched->batch;
+    launched->batcher->Complete(batch);
+    std::vector<daliRequestRange_t> requests;
+    requests.reserve(batch.requests.size());
+    for (auto &entry : batch.requests)
+      requests.push_back({ entry.request.id, entry.first_sample, entry.num_samples });
+    outputs->SetRequests(std::move(requests));
+  }
+  return outputs;
+}
+
+void PipelineWrapper::EnableSharedMemOutputs(size_t initial_capacity) {
+  if (shm_arena_)
+    return;
+  shm_arena_ = std::make_shared<SharedMemArena>(initial_capacity);
+  if (built_)
+    SetSharedMemOutputAllocator();
+}
+
+void PipelineWrapper::SetSharedMemOutputAllocator() {
+  // The outputs are allocated directly in the arena - no copy is necessary to share them
+  pipeline_->SetCPUOutputAllocator([arena = shm_arena_](size_t bytes) {
+    return arena->AllocateShared(bytes);
+  });
 }
 
 void PipelineWrapper::Build() {
   pipeline_->Build();
+  built_ = true;
+  if (shm_arena_)
+    SetSharedMemOutputAllocator();
 }
 
 void PipelineWrapper::Run() {
@@ -109,14 +149,19 @@ daliPipelineIODesc_t PipelineWrapper::GetInputDesc(int idx) const & {
     throw std::out_of_range(make_string(
         "The input index ", idx, " is out of range. The valid range is [0..", n-1, "]."));
 
-  if (input_names_.size() != n) {
+  return GetInputDesc(InputNames()[idx]);
+}
+
+span<const std::string_view> PipelineWrapper::InputNames() const {
+  auto &inputs = pipeline_->GetInputOperators();
+  if (input_names_.size() != inputs.size()) {
     input_names_.clear();
-    input_names_.reserve(n);
+    input_names_.reserve(inputs.size());
     for (auto it = inputs.begin(); it != inputs.end(); it++) {
       input_names_.push_back(it->first);
     }
   }
-  return GetInputDesc(input_names_[idx]);
+  return make_cspan(input_names_);
 }
 
 namespace {
@@ -278,6 +323,230 @@ void PipelineWrapper::RestoreFromCheckpoint(CheckpointWrapper &chk) {
   pipeline_->RestoreFromCheckpoint(*chk.Unwrap());
 }
 
+void PipelineWrapper::StartTimeline(int sampling_period) {
+  pipeline_->StartTimeline(sampling_period);
+}
+
+void PipelineWrapper::StopTimeline() {
+  pipeline_->StopTimeline();
+}
+
+std::string_view PipelineWrapper::GetTimeline() {
+  timeline_ = pipeline_->GetTimeline();
+  return timeline_;
+}
+
+void PipelineWrapper::EnableContinuousBatching(const daliContinuousBatchingParams_t &params) {
+  if (params.max_batch_size < 0)
+    throw std::invalid_argument(make_string(
+        "The maximum batch size cannot be negative. Got: ", params.max_batch_size));
+  if (params.max_wait_us < 0)
+    throw std::invalid_argument(make_string(
+        "The maximum wait time cannot be negative. Got: ", params.max_wait_us));
+  int pipeline_max_batch_size = pipeline_->max_batch_size();
+  if (params.max_batch_size > pipeline_max_batch_size)
+    throw std::invalid_argument(make_string(
+        "The maximum batch size for continuous batching (", params.max_batch_size, ") "
+        "exceeds the pipeline's max_batch_size (", pipeline_max_batch_size, ")."));
+  for (auto name : InputNames()) {
+    if (GetInputDesc(name).device != DALI_STORAGE_CPU)
+      throw std::invalid_argument(make_string(
+          "Continuous batching supports only CPU inputs. The input \"", name,
+          "\" is a GPU input."));
+  }
+
+  RequestBatchingPolicy policy;
+  policy.max_batch_size = params.max_batch_size ? params.max_batch_size : pipeline_max_batch_size;
+  policy.max_wait = std::chrono::microseconds(params.max_wait_us);
+
+  std::lock_guard<std::mutex> g(batching_mtx_);
+  if (batcher_) {
+    if (!batcher_->IsStopped())
+      throw std::runtime_error("Continuous batching is already enabled.");
+    if (batcher_->NumPendingSamples() > 0)
+      throw std::runtime_error(
+          "Continuous batching was stopped, but some of the requests haven't been run yet. "
+          "Call daliPipelineRunBatched until it reports no requests before enabling it again.");
+  }
+  input_signatures_.clear();
+  batcher_ = std::make_shared<Batcher>(policy);
+}
+
+std::shared_ptr<PipelineWrapper::Batcher> PipelineWrapper::GetBatcher() const {
+  std::lock_guard<std::mutex> g(batching_mtx_);
+  if (!batcher_)
+    throw std::runtime_error("Continuous batching is not enabled. "
+                             "Call daliPipelineEnableContinuousBatching first.");
+  return batcher_;
+}
+
+void PipelineWrapper::SubmitRequest(
+      int64_t request_id,
+      span<const char *const> input_names,
+      span<const daliTensorList_h> inputs) {
+  auto batcher = GetBatcher();
+  auto names = InputNames();
+  if (input_names.size() != names.size())
+    throw std::invalid_argument(make_string(
+        "The request must contain data for each of the ", names.size(), " inputs of the "
+        "pipeline. Got ", input_names.size(), " inputs."));
+
+  BatchingRequest request;
+  request.id = request_id;
+  request.inputs.resize(names.size());
+  int num_samples = -1;
+  for (int i = 0; i < input_names.size(); i++) {
+    NOT_NULL(input_names[i]);
+    std::string_view name = input_names[i];
+    auto it = std::find(names.begin(), names.end(), name);
+    if (it == names.end())
+      throw invalid_key(make_string("The input with the name \"", name, "\" was not found."));
+    auto *tl = ToPointer(inputs[i]);
+    if (tl->GetBufferPlacement().device_type != DALI_STORAGE_CPU)
+      throw std::invalid_argument(make_string(
+          "Continuous batching supports only CPU inputs. The data for the input \"", name,
+          "\" is in GPU memory."));
+    int n = tl->Unwrap<CPUBackend>()->num_samples();
+    if (num_samples >= 0 && n != num_samples)
+      throw std::invalid_argument(make_string(
+          "All inputs of a request must have the same number of samples. The input \"", name,
+          "\" has ", n, " samples; expected ", num_samples, "."));
+    num_samples = n;
+    request.inputs[it - names.begin()] = RefCountedPtr<ITensorList>(tl, true);
+  }
+  for (int i = 0; i < names.size(); i++) {
+    if (!request.inputs[i])
+      throw std::invalid_argument(make_string(
+          "The request doesn't contain data for the input \"", names[i], "\"."));
+  }
+  int max_batch_size = batcher->Policy().max_batch_size;
+  if (num_samples < 1 || num_samples > max_batch_size)
+    throw std::invalid_argument(make_string(
+        "A request must contain between 1 and ", max_batch_size, " samples. Got: ",
+        num_samples));
+
+  {
+    // All requests are concatenated - the properties of their data must agree
+    std::lock_guard<std::mutex> g(batching_mtx_);
+    if (batcher_ != batcher)
+      throw std::runtime_error("Continuous batching was restarted during the submission.");
+    bool first = input_signatures_.empty();
+    if (first)
+      input_signatures_.resize(names.size());
+    for (int i = 0; i < names.size(); i++) {
+      auto &tl = *request.inputs[i]->Unwrap<CPUBackend>();
+      InputSignature sig{ tl.type(), tl.sample_dim(), tl.GetLayout(), tl.is_pinned() };
+      if (first) {
+        input_signatures_[i] = sig;
+        continue;
+      }
+      auto &ref = input_signatures_[i];
+      if (sig.type != ref.type || sig.ndim != ref.ndim || sig.layout != ref.layout ||
+          sig.pinned != ref.pinned)
+        throw std::invalid_argument(make_string(
+            "The data for the input \"", names[i], "\" doesn't match that of the previous "
+            "requests. Got type ", sig.type, ", ", sig.ndim, " dimensions, layout \"",
+            sig.layout, "\"", sig.pinned ? ", pinned" : "", "; expected type ", ref.type, ", ",
+            ref.ndim, " dimensions, layout \"", ref.layout, "\"",
+            ref.pinned ? ", pinned" : "", "."));
+    }
+  }
+  batcher->Submit(std::move(request), num_samples);
+}
+
+void PipelineWrapper::FeedBatch(const Batcher::Batch &batch) {
+  auto names = InputNames();
+  for (int i = 0; i < names.size(); i++) {
+    auto &first = *batch.requests.front().request.inputs[i]->Unwrap<CPUBackend>();
+    // The samples of the requests are not copied - they're shared with the batch
+    TensorList<CPUBackend> tl;
+    tl.set_pinned(first.is_pinned());
+    tl.set_order(AccessOrder::host());
+    tl.SetSize(batch.num_samples);
+    tl.set_sample_dim(first.sample_dim());
+    tl.set_type(first.type());
+    tl.SetLayout(first.GetLayout());
+    for (auto &entry : batch.requests) {
+      auto &src = *entry.request.inputs[i]->Unwrap<CPUBackend>();
+      for (int s = 0; s < entry.num_samples; s++)
+        tl.SetSample(entry.first_sample + s, src, s);
+    }
+    pipeline_->SetExternalInput(std::string(names[i]), tl, AccessOrder::host(), false, false,
+                                InputOperatorCopyMode::FORCE_NO_COPY);
+  }
+}
+
+int PipelineWrapper::RunBatched() {
+  auto batcher = GetBatcher();
+  auto batch = batcher->WaitForBatch();
+  if (!batch)
+    return 0;
+  int num_requests = batch->requests.size();
+  FeedBatch(*batch);
+  // The data is now referenced by the input operators
+  for (auto &entry : batch->requests)
+    entry.request.inputs.clear();
+  {
+    // The batch is registered before the run, so the outputs can be popped by another thread
+    std::lock_guard<std::mutex> g(batching_mtx_);
+    launched_batches_.push_back({ std::move(batcher), std::move(*batch) });
+  }
+  try {
+    pipeline_->Run();
+  } catch (...) {
+    std::lock_guard<std::mutex> g(batching_mtx_);
+    launched_batches_.pop_back();
+    throw;
+  }
+  return num_requests;
+}
+
+void PipelineWrapper::StopContinuousBatching() {
+  GetBatcher()->Stop();
+}
+
+RequestBatchingStats PipelineWrapper::GetContinuousBatchingStats() const {
+  return GetBatcher()->GetStats();
+}
+
+static_assert(static_cast<int>(PipelineBound::Unknown) == DALI_PIPELINE_BOUND_UNKNOWN);
+static_assert(static_cast<int>(PipelineBound::Consumer) == DALI_PIPELINE_BOUND_CONSUMER);
+static_assert(static_cast<int>(PipelineBound::Reader) == DALI_PIPELINE_BOUND_READER);
+static_assert(static_cast<int>(PipelineBound::Decoder) == DALI_PIPELINE_BOUND_DECODER);
+static_assert(static_cast<int>(PipelineBound::Processing) == DALI_PIPELINE_BOUND_PROCESSING);
+
+const daliStallReport_t *PipelineWrapper::GetStallReport() {
+  stall_report_ = pipeline_->GetStallReport();
+  auto &r = stall_report_;
+  stall_report_ops_.clear();
+  stall_report_ops_.reserve(r.operators.size());
+  for (auto &op : r.operators) {
+    auto &c = stall_report_ops_.emplace_back();
+    c.name                      = op.name.c_str();
+    c.iterations                = op.iterations;
+    c.busy_ns                   = op.busy_ns;
+    c.blocked_ns                = op.blocked_ns;
+    c.idle_ns                   = op.idle_ns;
+    c.critical_path_iterations  = op.critical_path_iterations;
+    c.critical_path_ns          = op.critical_path_ns;
+    c.starved_iterations        = op.starved_iterations;
+    c.starvation_ns             = op.starvation_ns;
+  }
+  auto &c = stall_report_c_;
+  c.iterations                = r.iterations;
+  c.duration_ns               = r.duration_ns;
+  c.consumer_wait_ns          = r.consumer_wait_ns;
+  c.queue_empty_stalls        = r.queue_empty_stalls;
+  c.queue_full_stalls         = r.queue_full_stalls;
+  c.critical_path_ns          = r.critical_path_ns;
+  c.reader_starved_iterations = r.reader_starved_iterations;
+  c.bound                     = static_cast<daliPipelineBound_t>(r.bound);
+  c.bottleneck                = r.bottleneck.c_str();
+  c.num_operators             = stall_report_ops_.size();
+  c.operators                 = stall_report_ops_.data();
+  return &stall_report_c_;
+}
+
 
 
 }  // namespace dali::c_api
@@ -517,6 +786,120 @@ daliResult_t daliCheckpointDestroy(daliCheckpoint_h checkpoint) {
   DALI_EPILOG();
 }
 
+daliResult_t daliPipelineStartTimeline(daliPipeline_h pipeline, int sampling_period) {
+  DALI_PROLOG();
+  ToPointer(pipeline)->StartTimeline(sampling_period);
+  DALI_EPILOG();
+}
+
+daliResult_t daliPipelineStopTimeline(daliPipeline_h pipeline) {
+  DALI_PROLOG();
+  ToPointer(pipeline)->StopTimeline();
+  DALI_EPILOG();
+}
+
+daliResult_t daliPipelineGetStallReport(
+      daliPipeline_h pipeline,
+      const daliStallReport_t **out_report) {
+  DALI_PROLOG();
+  auto pipe = ToPointer(pipeline);
+  CHECK_OUTPUT(out_report);
+  *out_report = pipe->GetStallReport();
+  DALI_EPILOG();
+}
+
+daliResult_t daliPipelineEnableSharedMemOutputs(
+      daliPipeline_h pipeline,
+      size_t initial_capacity) {
+  DALI_PROLOG();
+  ToPointer(pipeline)->EnableSharedMemOutputs(initial_capacity);
+  DALI_EPILOG();
+}
+
+daliResult_t daliPipelineEnableContinuousBatching(
+      daliPipeline_h pipeline,
+      const daliContinuousBatchingParams_t *params) {
+  DALI_PROLOG();
+  auto pipe = ToPointer(pipeline);
+  NOT_NULL(params);
+  pipe->EnableContinuousBatching(*params);
+  DALI_EPILOG();
+}
+
+daliResult_t daliPipelineSubmitRequest(
+      daliPipeline_h pipeline,
+      int64_t request_id,
+      int num_inputs,
+      const char *const *input_names,
+      const daliTensorList_h *inputs) {
+  DALI_PROLOG();
+  auto pipe = ToPointer(pipeline);
+  if (num_inputs < 0)
+    throw std::invalid_argument(make_string(
+        "The number of inputs cannot be negative. Got: ", num_inputs));
+  if (num_inputs > 0) {
+    NOT_NULL(input_names);
+    NOT_NULL(inputs);
+  }
+  pipe->SubmitRequest(request_id,
+                      make_cspan(input_names, num_inputs),
+                      make_cspan(inputs, num_inputs));
+  DALI_EPILOG();
+}
+
+daliResult_t daliPipelineRunBatched(daliPipeline_h pipeline, int *out_num_requests) {
+  DALI_PROLOG();
+  auto pipe = ToPointer(pipeline);
+  int num_requests = pipe->RunBatched();
+  if (out_num_requests)
+    *out_num_requests = num_requests;
+  DALI_EPILOG();
+}
+
+daliResult_t daliPipelineStopContinuousBatching(daliPipeline_h pipeline) {
+  DALI_PROLOG();
+  ToPointer(pipeline)->StopContinuousBatching();
+  DALI_EPILOG();
+}
+
+daliResult_t daliPipelineGetContinuousBatchingStats(
+      daliPipeline_h pipeline,
+      daliContinuousBatchingStats_t *out_stats) {
+  DALI_PROLOG();
+  auto pipe = ToPointer(pipeline);
+  CHECK_OUTPUT(out_stats);
+  auto stats = pipe->GetContinuousBatchingStats();
+  daliContinuousBatchingStats_t result{};
+  result.num_requests        = stats.num_requests;
+  result.num_batches         = stats.num_batches;
+  result.num_samples         = stats.num_samples;
+  result.num_full_batches    = stats.num_full_batches;
+  result.mean_batch_size     = stats.mean_batch_size();
+  result.mean_queue_delay_us = stats.mean_queue_delay;
+  result.max_queue_delay_us  = stats.max_queue_delay;
+  result.mean_latency_us     = stats.mean_latency;
+  result.p50_latency_us      = stats.p50_latency;
+  result.p99_latency_us      = stats.p99_latency;
+  result.max_latency_us      = stats.max_latency;
+  result.throughput          = stats.throughput;
+  *out_stats = result;
+  DALI_EPILOG();
+}
+
+daliResult_t daliPipelineGetTimeline(
+      daliPipeline_h pipeline,
+      const char **out_json,
+      size_t *out_size) {
+  DALI_PROLOG();
+  auto pipe = ToPointer(pipeline);
+  CHECK_OUTPUT(out_json);
+  auto json = pipe->GetTimeline();
+  *out_json = json.data();
+  if (out_size)
+    *out_size = json.size();
+  DALI_EPILOG();
+}
+
 namespace {
 
 std::string_view BackendToString(daliBackend_t backend) {
@@ -15,13 +15,18 @@
 #ifndef DALI_C_API_2_PIPELINE_H_
 #define DALI_C_API_2_PIPELINE_H_
 
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <string_view>
+#include <utility>
 #include <vector>
 #include "dali/dali.h"
 #include "dali/c_api_2/checkpoint.h"
 #include "dali/c_api_2/pipeline_outputs.h"
+#include "dali/pipeline/executor/stall_report.h"
+#include "dali/pipeline/util/request_batcher.h"
 
 // A dummy base that the handle points to
 struct _DALIPipeline {
@@ -78,8 +83,60 @@ class PipelineWrapper : public _DALIPipeline {
 
   void RestoreFromCheckpoint(CheckpointWrapper &chk);
 
+  void StartTimeline(int sampling_period);
+
+  void StopTimeline();
+
+  /** Exports the timeline; the result is valid until the next call. */
+  std::string_view GetTimeline();
+
+  /** Gets the stall report; the result is valid until the next call. */
+  const daliStallReport_t *GetStallReport();
+
+  /** Creates the shared memory arena for the outputs popped from now on.
+   *
+   * The CPU outputs of the iterations which begin after this call are allocated in the arena.
+   */
+  void EnableSharedMemOutputs(size_t initial_capacity);
+
+  void EnableContinuousBatching(const daliContinuousBatchingParams_t &params);
+
+  void SubmitRequest(int64_t request_id,
+                     span<const char *const> input_names,
+                     span<const daliTensorList_h> inputs);
+
+  /** Waits for a batch of requests, feeds it to the input operators and runs an iteration.
+   *
+   * @return The number of requests in the batch; 0 if the batching was stopped and there are
+   *         no pending requests.
+   */
+  int RunBatched();
+
+  void StopContinuousBatching();
+
+  RequestBatchingStats GetContinuousBatchingStats() const;
 
  private:
+  /** The samples of a request - one tensor list for each input, in the order of input_names_ */
+  struct BatchingRequest {
+    int64_t id = 0;
+    std::vector<RefCountedPtr<ITensorList>> inputs;
+  };
+
+  using Batcher = RequestBatcher<BatchingRequest>;
+
+  /** Returns the current batcher; throws if continuous batching is not enabled */
+  std::shared_ptr<Batcher> GetBatcher() const;
+
+  /** Makes the pipeline allocate its CPU outputs in the shared memory arena */
+  void SetSharedMemOutputAllocator();
+
+  /** Feeds the concatenated samples of the requests to the input operators */
+  void FeedBatch(const Batcher::Batch &batch);
+
+  /** Gets the names of the input operators, in a stable order */
+  span<const std::string_view> InputNames() const;
+
   template <typename Backend>
   void FeedInputImpl(
         std::string_view input_name,
@@ -89,7 +146,38 @@ class PipelineWrapper : public _DALIPipeline {
         AccessOrder order);
 
   std::unique_ptr<Pipeline> pipeline_;
+  bool built_ = false;
+  std::shared_ptr<SharedMemArena> shm_arena_;
+
+  /** The properties of the input data, which must be the same in all requests */
+  struct InputSignature {
+    DALIDataType type = DALI_NO_TYPE;
+    int ndim = -1;
+    TensorLayout layout;
+    bool pinned = false;
+  };
+
+  /** A batch which was run, along with the batcher which formed it */
+  struct LaunchedBatch {
+    std::shared_ptr<Batcher> batcher;
+    Batcher::Batch batch;
+  };
+
+  /** Guards batcher_, input_signatures_ and launched_batches_ */
+  mutable std::mutex batching_mtx_;
+  /** Replaced when continuous batching is enabled again after having been stopped */
+  std::shared_ptr<Batcher> batcher_;
+  /** Established by the first request */
+  std::vector<InputSignature> input_signatures_;
+  /** The batches which were run, but whose outputs haven't been popped yet */
+  std::deque<LaunchedBatch> launched_batches_;
+
   mutable std::vector<std::string_view> input_names_;
+  std::string timeline_;
+
+  StallReport stall_report_;
+  std::vector<daliOperatorStallStats_t> stall_report_ops_;
+  daliStallReport_t stall_report_c_{};
 };
 
 PipelineWrapper *ToPointer(daliPipeline_h handle);
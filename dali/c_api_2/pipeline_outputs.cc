@@ -12,6 +12,9 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <memory>
+#include <optional>
+#include <utility>
 #include "dali/c_api_2/pipeline.h"
 #include "dali/c_api_2/pipeline_outputs.h"
 #include "dali/c_api_2/error_handling.h"
@@ -26,7 +29,9 @@ PipelineOutputs *ToPointer(daliPipelineOutputs_h handle) {
   return static_cast<PipelineOutputs *>(handle);
 }
 
-PipelineOutputs::PipelineOutputs(Pipeline *pipe, AccessOrder order) {
+PipelineOutputs::PipelineOutputs(Pipeline *pipe, AccessOrder order,
+                                 std::shared_ptr<SharedMemArena> shm_arena)
+: shm_arena_(std::move(shm_arena)) {
   ws_.set_output_order(order);
   pipe->ShareOutputs(&ws_);
   producer_ = pipe;
@@ -34,10 +39,85 @@ PipelineOutputs::PipelineOutputs(Pipeline *pipe, AccessOrder order) {
 }
 
 PipelineOutputs::~PipelineOutputs() {
+  for (auto &shm : shm_outputs_)
+    if (shm && shm->copied)
+      shm_arena_->Free(shm->desc.offset);
   if (producer_)
     producer_->ReleaseOutputs();
 }
 
+const daliSharedMemOutput_t *PipelineOutputs::GetSharedMem(int index) {
+  ValidateOutputIdx(index);
+  if (!shm_arena_)
+    throw std::runtime_error("The shared memory outputs are not enabled for this pipeline. "
+                             "Call daliPipelineEnableSharedMemOutputs first.");
+  if (!ws_.OutputIsType<CPUBackend>(index))
+    throw std::invalid_argument(make_string(
+        "Only CPU outputs can be placed in shared memory. The output ", index,
+        " is a GPU output."));
+
+  if (shm_outputs_.empty())
+    shm_outputs_.resize(ws_.NumOutput());
+  if (shm_outputs_[index])
+    return &shm_outputs_[index]->desc;
+
+  auto &out = ws_.Output<CPUBackend>(index);
+  auto shm = std::make_unique<SharedMemOutput>();
+  const auto &shape = out.shape();
+  int n = out.num_samples();
+  int ndim = out.sample_dim();
+  size_t type_size = out.type_info().size();
+  shm->shapes.assign(shape.shapes.begin(), shape.shapes.end());
+  shm->sample_offsets.resize(n);
+  size_t total_bytes = 0;
+  for (int i = 0; i < n; i++) {
+    shm->sample_offsets[i] = total_bytes;
+    total_bytes += shape.tensor_size(i) * type_size;
+  }
+  shm->layout = out.GetLayout().str();
+
+  std::optional<size_t> arena_offset;
+  if (n > 0 && out.IsContiguousInMemory())
+    arena_offset = shm_arena_->Offset(out.raw_tensor(0));
+
+  size_t offset;
+  if (arena_offset) {
+    // The output was allocated in the arena - it's owned by the output, not by this object
+    offset = *arena_offset;
+  } else {
+    offset = shm_arena_->Allocate(total_bytes);
+    shm->copied = true;
+    try {
+      if (out.IsContiguousInMemory()) {
+        if (total_bytes)
+          shm_arena_->Write(offset, out.raw_tensor(0), total_bytes);
+      } else {
+        for (int i = 0; i < n; i++) {
+          size_t sample_bytes = shape.tensor_size(i) * type_size;
+          shm_arena_->Write(offset + shm->sample_offsets[i], out.raw_tensor(i), sample_bytes);
+        }
+      }
+    } catch (...) {
+      shm_arena_->Free(offset);
+      throw;
+    }
+  }
+
+  auto &desc = shm->desc;
+  desc.arena_handle   = shm_arena_->Handle();
+  desc.arena_size     = shm_arena_->Capacity();
+  desc.offset         = offset;
+  desc.size           = total_bytes;
+  desc.num_samples    = n;
+  desc.ndim           = ndim;
+  desc.dtype          = out.type();
+  desc.layout         = shm->layout.c_str();
+  desc.shapes         = shm->shapes.data();
+  desc.sample_offsets = shm->sample_offsets.data();
+  shm_outputs_[index] = std::move(shm);
+  return &shm_outputs_[index]->desc;
+}
+
 span<daliOperatorTrace_t> PipelineOutputs::GetTraces() {
   if (!traces_.has_value()) {
     traces_.emplace();
@@ -77,6 +157,45 @@ RefCountedPtr<ITensorList> PipelineOutputs::Get(int index) {
   return output_wrappers_[index];
 }
 
+RefCountedPtr<ITensorList> PipelineOutputs::GetSamples(int index, int first_sample,
+                                                       int num_samples) {
+  ValidateOutputIdx(index);
+  if (ws_.OutputIsType<CPUBackend>(index))
+    return GetSamplesImpl<CPUBackend>(index, first_sample, num_samples);
+  else if (ws_.OutputIsType<GPUBackend>(index))
+    return GetSamplesImpl<GPUBackend>(index, first_sample, num_samples);
+  else
+    assert(!"Impossible output backend encountered.");
+  return {};
+}
+
+template <typename Backend>
+RefCountedPtr<ITensorList> PipelineOutputs::GetSamplesImpl(int index, int first_sample,
+                                                           int num_samples) {
+  auto &out = ws_.Output<Backend>(index);
+  if (first_sample < 0 || num_samples < 0 || first_sample + num_samples > out.num_samples()) {
+    throw std::out_of_range(make_string("The sample range [", first_sample, ", ",
+      first_sample + num_samples, ") is out of range. The output ", index, " has ",
+      out.num_samples(), " samples."));
+  }
+  if (first_sample == 0 && num_samples == out.num_samples())
+    return Get(index);
+
+  // The samples are shared with the output, along with the ownership
+  auto range = std::make_shared<TensorList<Backend>>();
+  range->set_pinned(out.is_pinned());
+  range->set_device_id(out.device_id());
+  range->set_order(out.order());
+  range->SetSize(num_samples);
+  range->set_sample_dim(out.sample_dim());
+  range->set_type(out.type());
+  range->SetLayout(out.GetLayout());
+  range->set_ready_event(out.ready_event());
+  for (int i = 0; i < num_samples; i++)
+    range->SetSample(i, out, first_sample + i);
+  return Wrap(std::move(range));
+}
+
 }  // namespace dali::c_api
 
 using namespace dali::c_api;  // NOLINT
@@ -97,6 +216,45 @@ daliResult_t daliPipelineOutputsGet(daliPipelineOutputs_h outputs, daliTensorLis
   DALI_EPILOG();
 }
 
+daliResult_t daliPipelineOutputsGetSamples(
+      daliPipelineOutputs_h outputs,
+      daliTensorList_h *out,
+      int index,
+      int first_sample,
+      int num_samples) {
+  DALI_PROLOG();
+  auto *outs = ToPointer(outputs);
+  CHECK_OUTPUT(out);
+  auto ptr = outs->GetSamples(index, first_sample, num_samples);
+  *out = ptr.release();  // no throwing beyond this point
+  DALI_EPILOG();
+}
+
+daliResult_t daliPipelineOutputsGetSharedMem(
+      daliPipelineOutputs_h outputs,
+      const daliSharedMemOutput_t **out_desc,
+      int index) {
+  DALI_PROLOG();
+  auto *outs = ToPointer(outputs);
+  CHECK_OUTPUT(out_desc);
+  *out_desc = outs->GetSharedMem(index);
+  DALI_EPILOG();
+}
+
+daliResult_t daliPipelineOutputsGetRequests(
+      daliPipelineOutputs_h outputs,
+      const daliRequestRange_t **out_requests,
+      int *out_count) {
+  DALI_PROLOG();
+  auto *outs = ToPointer(outputs);
+  CHECK_OUTPUT(out_requests);
+  CHECK_OUTPUT(out_count);
+  auto requests = outs->GetRequests();
+  *out_requests = requests.data();
+  *out_count = requests.size();
+  DALI_EPILOG();
+}
+
 daliResult_t daliPipelineOutputsGetTrace(
       daliPipelineOutputs_h outputs,
       const char **out_trace,
@@ -15,11 +15,14 @@
 #ifndef DALI_C_API_2_PIPELINE_OUTPUTS_H_
 #define DALI_C_API_2_PIPELINE_OUTPUTS_H_
 
+#include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 #include "dali/dali.h"
 #include "dali/pipeline/workspace/workspace.h"
 #include "dali/c_api_2/data_objects.h"
+#include "dali/c_api_2/shared_mem_arena.h"
 
 // A dummy base that the handle points to
 struct _DALIPipelineOutputs {
@@ -36,14 +39,34 @@ namespace dali::c_api {
 
 class PipelineOutputs : public _DALIPipelineOutputs {
  public:
-  explicit PipelineOutputs(Pipeline *pipe, AccessOrder order = AccessOrder::host());
+  explicit PipelineOutputs(Pipeline *pipe, AccessOrder order = AccessOrder::host(),
+                           std::shared_ptr<SharedMemArena> shm_arena = nullptr);
 
   ~PipelineOutputs();
 
   RefCountedPtr<ITensorList> Get(int index);
 
+  /** Gets a view of the samples [first_sample, first_sample + num_samples) of index-th output */
+  RefCountedPtr<ITensorList> GetSamples(int index, int first_sample, int num_samples);
+
+  /** Places index-th output in the shared memory arena and describes its location there.
+   *
+   * If the output wasn't allocated in the arena by the pipeline, it's copied on the first call
+   * and the block is freed when the outputs are released.
+   */
+  const daliSharedMemOutput_t *GetSharedMem(int index);
+
   span<daliOperatorTrace_t> GetTraces();
 
+  /** The requests processed in the iteration (see PipelineWrapper::RunBatched) */
+  span<const daliRequestRange_t> GetRequests() const {
+    return make_cspan(requests_);
+  }
+
+  void SetRequests(std::vector<daliRequestRange_t> requests) {
+    requests_ = std::move(requests);
+  }
+
   std::optional<std::string_view>
   GetTrace(std::string_view op_name, std::string_view trace_name) const;
 
@@ -55,8 +78,23 @@ class PipelineOutputs : public _DALIPipelineOutputs {
     }
   }
 
+  template <typename Backend>
+  RefCountedPtr<ITensorList> GetSamplesImpl(int index, int first_sample, int num_samples);
+
+  struct SharedMemOutput {
+    std::vector<int64_t> shapes;
+    std::vector<size_t> sample_offsets;
+    std::string layout;
+    daliSharedMemOutput_t desc{};
+    /** The output was copied to a block owned by this object */
+    bool copied = false;
+  };
+
   Workspace ws_;
   std::vector<RefCountedPtr<ITensorList>> output_wrappers_;
+  std::shared_ptr<SharedMemArena> shm_arena_;
+  std::vector<std::unique_ptr<SharedMemOutput>> shm_outputs_;
+  std::vector<daliRequestRange_t> requests_;
   // Use optional to implement lazy access with potentially empty result.
   std::optional<std::vector<daliOperatorTrace_t>> traces_;
   // Needed for the legacy executor
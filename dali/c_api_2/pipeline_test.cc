@@ -13,8 +13,16 @@
 // limitations under the License.
 
 #include <gtest/gtest.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <chrono>
+#include <cstring>
 #include <limits>
+#include <memory>
 #include <random>
+#include <string_view>
+#include <thread>
+#include <vector>
 #include "dali/c_api_2/pipeline.h"
 #include "dali/pipeline/pipeline.h"
 #include "dali/pipeline/executor/executor2/exec2_ops_for_test.h"
@@ -505,6 +513,407 @@ TEST(CAPI2_PipelineTest, FeedInputGPUAsync) {
   TestFeedInput<GPUBackend>({});
 }
 
+TEST(CAPI2_PipelineTest, OutputSampleRanges) {
+  auto proto = GetPipelineWithExternalSource(StorageDevice::CPU, 8, 4, 0);
+  daliPipelineParams_t params{};
+  params.exec_type_present = true;
+  params.exec_type = DALI_EXEC_DYNAMIC;
+  auto h = Deserialize(proto, params);
+  ASSERT_NE(h, nullptr);
+  CHECK_DALI(daliPipelineBuild(h));
+
+  // a batch made of 3 requests, of 2, 3 and 1 samples
+  std::mt19937_64 rng(4321);
+  auto cpp_tl = std::make_shared<TensorList<CPUBackend>>();
+  FillRandomTensorList<uint8_t>(*cpp_tl, rng, { 16, 16, 1 }, { 64, 64, 3 }, 6);
+  cpp_tl->SetLayout("HWC");
+  auto tl = Wrap(cpp_tl);
+  CHECK_DALI(daliPipelineFeedInput(h, "ext", tl.get(), "data", {}, nullptr));
+  CHECK_DALI(daliPipelineRun(h));
+  auto outs = PopOutputs(h);
+  ASSERT_NE(outs, nullptr);
+  auto full = GetOutput(outs, 0);
+  auto &full_tl = *Unwrap<CPUBackend>(full);
+
+  int first_sample = 0;
+  for (int num_samples : { 2, 3, 1 }) {
+    daliTensorList_h range_h = nullptr;
+    CHECK_DALI(daliPipelineOutputsGetSamples(outs, &range_h, 0, first_sample, num_samples));
+    TensorListHandle range(range_h);
+    auto &range_tl = *Unwrap<CPUBackend>(range_h);
+    ASSERT_EQ(range_tl.num_samples(), num_samples);
+    EXPECT_EQ(range_tl.GetLayout(), "HWC");
+    for (int i = 0; i < num_samples; i++) {
+      // the samples are not copied
+      EXPECT_EQ(range_tl.raw_tensor(i), full_tl.raw_tensor(first_sample + i));
+      EXPECT_EQ(range_tl.tensor_shape(i), full_tl.tensor_shape(first_sample + i));
+    }
+    first_sample += num_samples;
+  }
+
+  daliTensorList_h range_h = nullptr;
+  EXPECT_EQ(daliPipelineOutputsGetSamples(outs, &range_h, 0, 5, 2), DALI_ERROR_OUT_OF_RANGE);
+  EXPECT_EQ(daliPipelineOutputsGetSamples(outs, &range_h, 0, -1, 1), DALI_ERROR_OUT_OF_RANGE);
+  EXPECT_EQ(daliPipelineOutputsGetSamples(outs, &range_h, 1, 0, 1), DALI_ERROR_OUT_OF_RANGE);
+  daliClearLastError();
+}
+
+/** Submits requests with Poisson-distributed arrival times and processes them with
+ *  continuous batching, checking that each request gets its own data back.
+ *
+ * @param rate                  the mean number of requests per second
+ * @param max_request_samples   the requests have 1 to max_request_samples samples
+ */
+daliContinuousBatchingStats_t RunPoissonRequests(
+      int max_batch_size, int64_t max_wait_us, double rate, int max_request_samples,
+      int num_requests) {
+  auto proto = GetPipelineWithExternalSource(StorageDevice::CPU, max_batch_size, 2, 0);
+  daliPipelineParams_t params{};
+  params.exec_type_present = true;
+  params.exec_type = DALI_EXEC_DYNAMIC;
+  auto h = Deserialize(proto, params);
+  CHECK_DALI(daliPipelineBuild(h));
+  daliContinuousBatchingParams_t batching{};
+  batching.max_batch_size = max_batch_size;
+  batching.max_wait_us = max_wait_us;
+  CHECK_DALI(daliPipelineEnableContinuousBatching(h, &batching));
+
+  std::mt19937_64 rng(1234);
+  std::uniform_int_distribution<int> num_samples_dist(1, max_request_samples);
+  std::vector<std::shared_ptr<TensorList<CPUBackend>>> requests(num_requests);
+  for (int r = 0; r < num_requests; r++) {
+    int n = num_samples_dist(rng);
+    auto &tl = requests[r];
+    tl = std::make_shared<TensorList<CPUBackend>>();
+    tl->Resize(uniform_list_shape(n, TensorShape<>{ r % 7 + 1, 3 }), DALI_INT32);
+    tl->SetLayout("XY");
+    for (int i = 0; i < n; i++) {
+      auto *data = tl->mutable_tensor<int32_t>(i);
+      for (int64_t k = 0; k < volume(tl->tensor_shape(i)); k++)
+        data[k] = r * 1000 + i * 10 + k;
+    }
+  }
+
+  std::thread producer([&]() {
+    std::mt19937_64 arrival_rng(4321);
+    std::exponential_distribution<double> interarrival(rate);
+    auto t = std::chrono::steady_clock::now();
+    for (int r = 0; r < num_requests; r++) {
+      t += std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+          std::chrono::duration<double>(interarrival(arrival_rng)));
+      std::this_thread::sleep_until(t);
+      auto tl = Wrap(requests[r]);
+      const char *name = "ext";
+      daliTensorList_h tl_h = tl.get();
+      CHECK_DALI(daliPipelineSubmitRequest(h, r, 1, &name, &tl_h));
+    }
+    CHECK_DALI(daliPipelineStopContinuousBatching(h));
+  });
+
+  int next_request = 0;
+  for (;;) {
+    int num_requests_in_batch = -1;
+    CHECK_DALI(daliPipelineRunBatched(h, &num_requests_in_batch));
+    if (num_requests_in_batch <= 0)
+      break;
+    auto outs = PopOutputs(h);
+    const daliRequestRange_t *ranges = nullptr;
+    int count = 0;
+    CHECK_DALI(daliPipelineOutputsGetRequests(outs, &ranges, &count));
+    EXPECT_EQ(count, num_requests_in_batch);
+    int batch_samples = 0;
+    for (int i = 0; i < count; i++) {
+      // The requests are processed in the order of submission, without splitting
+      EXPECT_EQ(ranges[i].request_id, next_request++);
+      EXPECT_EQ(ranges[i].first_sample, batch_samples);
+      daliTensorList_h range_h = nullptr;
+      CHECK_DALI(daliPipelineOutputsGetSamples(
+          outs, &range_h, 0, ranges[i].first_sample, ranges[i].num_samples));
+      TensorListHandle range(range_h);
+      CompareTensorLists(*requests[ranges[i].request_id], *Unwrap<CPUBackend>(range_h));
+      batch_samples += ranges[i].num_samples;
+    }
+    EXPECT_LE(batch_samples, max_batch_size);
+    auto full = GetOutput(outs, 0);
+    EXPECT_EQ(Unwrap<CPUBackend>(full)->num_samples(), batch_samples);
+  }
+  producer.join();
+  EXPECT_EQ(next_request, num_requests);
+
+  daliContinuousBatchingStats_t stats{};
+  CHECK_DALI(daliPipelineGetContinuousBatchingStats(h, &stats));
+  EXPECT_EQ(stats.num_requests, num_requests);
+  int64_t total_samples = 0;
+  for (auto &tl : requests)
+    total_samples += tl->num_samples();
+  EXPECT_EQ(stats.num_samples, total_samples);
+  EXPECT_GE(stats.max_latency_us, stats.max_queue_delay_us);
+  EXPECT_GT(stats.throughput, 0);
+  return stats;
+}
+
+TEST(CAPI2_PipelineTest, ContinuousBatchingLowRate) {
+  // Sparse requests - the iterations are launched when the wait budget expires
+  const int64_t max_wait_us = 2000;
+  auto stats = RunPoissonRequests(8, max_wait_us, 100, 1, 50);
+  EXPECT_EQ(stats.num_full_batches, 0);
+  // The oldest request in each batch waits for the whole budget, but not much longer
+  EXPECT_GE(stats.max_queue_delay_us, max_wait_us);
+  EXPECT_LT(stats.mean_queue_delay_us, max_wait_us + 20000);
+  EXPECT_LT(stats.mean_batch_size, 2);
+}
+
+TEST(CAPI2_PipelineTest, ContinuousBatchingHighRate) {
+  // Dense requests - the batches are launched as soon as they're full
+  const int max_batch_size = 8;
+  auto stats = RunPoissonRequests(max_batch_size, 2000, 4000, 3, 400);
+  EXPECT_GT(stats.num_full_batches, stats.num_batches / 2);
+  EXPECT_GE(stats.mean_batch_size, 0.5 * max_batch_size);
+  EXPECT_LT(stats.num_batches, stats.num_requests);
+}
+
+TEST(CAPI2_PipelineTest, ContinuousBatchingErrors) {
+  auto proto = GetPipelineWithExternalSource(StorageDevice::CPU, 4, 2, 0);
+  daliPipelineParams_t params{};
+  params.exec_type_present = true;
+  params.exec_type = DALI_EXEC_DYNAMIC;
+  auto h = Deserialize(proto, params);
+  CHECK_DALI(daliPipelineBuild(h));
+
+  auto MakeRequestData = [](int num_samples, DALIDataType type) {
+    auto tl = std::make_shared<TensorList<CPUBackend>>();
+    tl->Resize(uniform_list_shape(num_samples, TensorShape<>{ 3 }), type);
+    return Wrap(std::move(tl));
+  };
+  auto tl = MakeRequestData(2, DALI_UINT8);
+  daliTensorList_h tl_h = tl.get();
+  const char *name = "ext";
+  EXPECT_EQ(daliPipelineSubmitRequest(h, 0, 1, &name, &tl_h), DALI_ERROR_INVALID_OPERATION);
+  EXPECT_EQ(daliPipelineRunBatched(h, nullptr), DALI_ERROR_INVALID_OPERATION);
+
+  daliContinuousBatchingParams_t batching{};
+  batching.max_batch_size = 5;
+  EXPECT_EQ(daliPipelineEnableContinuousBatching(h, &batching), DALI_ERROR_INVALID_ARGUMENT);
+  batching.max_batch_size = 0;  // use the pipeline's max_batch_size
+  CHECK_DALI(daliPipelineEnableContinuousBatching(h, &batching));
+  EXPECT_EQ(daliPipelineEnableContinuousBatching(h, &batching), DALI_ERROR_INVALID_OPERATION);
+
+  const char *wrong_name = "nonexistent";
+  EXPECT_EQ(daliPipelineSubmitRequest(h, 0, 1, &wrong_name, &tl_h), DALI_ERROR_INVALID_KEY);
+  EXPECT_EQ(daliPipelineSubmitRequest(h, 0, 0, nullptr, nullptr), DALI_ERROR_INVALID_ARGUMENT);
+  auto too_big = MakeRequestData(5, DALI_UINT8);
+  daliTensorList_h too_big_h = too_big.get();
+  EXPECT_EQ(daliPipelineSubmitRequest(h, 0, 1, &name, &too_big_h), DALI_ERROR_INVALID_ARGUMENT);
+
+  CHECK_DALI(daliPipelineSubmitRequest(h, 0, 1, &name, &tl_h));
+  auto other_type = MakeRequestData(1, DALI_INT16);
+  daliTensorList_h other_type_h = other_type.get();
+  EXPECT_EQ(daliPipelineSubmitRequest(h, 1, 1, &name, &other_type_h),
+            DALI_ERROR_INVALID_ARGUMENT);
+
+  CHECK_DALI(daliPipelineStopContinuousBatching(h));
+  EXPECT_EQ(daliPipelineSubmitRequest(h, 2, 1, &name, &tl_h), DALI_ERROR_INVALID_OPERATION);
+  // The pending request must be run before the batching is restarted
+  EXPECT_EQ(daliPipelineEnableContinuousBatching(h, &batching), DALI_ERROR_INVALID_OPERATION);
+  int num_requests = -1;
+  CHECK_DALI(daliPipelineRunBatched(h, &num_requests));
+  EXPECT_EQ(num_requests, 1);
+  auto outs = PopOutputs(h);
+  const daliRequestRange_t *ranges = nullptr;
+  int count = 0;
+  CHECK_DALI(daliPipelineOutputsGetRequests(outs, &ranges, &count));
+  ASSERT_EQ(count, 1);
+  EXPECT_EQ(ranges[0].request_id, 0);
+  EXPECT_EQ(ranges[0].num_samples, 2);
+  CHECK_DALI(daliPipelineRunBatched(h, &num_requests));
+  EXPECT_EQ(num_requests, 0);
+
+  // A restarted session starts with fresh statistics and input signatures
+  CHECK_DALI(daliPipelineEnableContinuousBatching(h, &batching));
+  CHECK_DALI(daliPipelineSubmitRequest(h, 3, 1, &name, &other_type_h));
+  CHECK_DALI(daliPipelineStopContinuousBatching(h));
+  CHECK_DALI(daliPipelineRunBatched(h, &num_requests));
+  EXPECT_EQ(num_requests, 1);
+  outs = PopOutputs(h);
+  CHECK_DALI(daliPipelineOutputsGetRequests(outs, &ranges, &count));
+  ASSERT_EQ(count, 1);
+  EXPECT_EQ(ranges[0].request_id, 3);
+  daliContinuousBatchingStats_t stats{};
+  CHECK_DALI(daliPipelineGetContinuousBatchingStats(h, &stats));
+  EXPECT_EQ(stats.num_requests, 1);
+  daliClearLastError();
+}
+
+TEST(CAPI2_PipelineTest, Timeline) {
+  auto proto = GetPipelineWithExternalSource(StorageDevice::CPU, 8, 4, 0);
+  daliPipelineParams_t params{};
+  params.exec_type_present = true;
+  params.exec_type = DALI_EXEC_DYNAMIC;
+  auto h = Deserialize(proto, params);
+  ASSERT_NE(h, nullptr);
+  CHECK_DALI(daliPipelineBuild(h));
+  EXPECT_EQ(daliPipelineStartTimeline(h, 0), DALI_ERROR_INVALID_ARGUMENT);
+  daliClearLastError();
+  CHECK_DALI(daliPipelineStartTimeline(h, 1));
+
+  std::mt19937_64 rng(1234);
+  for (int i = 0; i < 2; i++) {
+    auto cpp_tl = std::make_shared<TensorList<CPUBackend>>();
+    FillRandomTensorList<uint8_t>(*cpp_tl, rng, { 16, 16, 1 }, { 64, 64, 3 }, 4);
+    auto tl = Wrap(cpp_tl);
+    CHECK_DALI(daliPipelineFeedInput(h, "ext", tl.get(), nullptr, {}, nullptr));
+    CHECK_DALI(daliPipelineRun(h));
+    auto outs = PopOutputs(h);
+    ASSERT_NE(outs, nullptr);
+  }
+  CHECK_DALI(daliPipelineStopTimeline(h));
+
+  const char *json = nullptr;
+  size_t size = 0;
+  CHECK_DALI(daliPipelineGetTimeline(h, &json, &size));
+  ASSERT_NE(json, nullptr);
+  std::string_view timeline(json, size);
+  EXPECT_EQ(timeline.size(), strlen(json));
+  EXPECT_EQ(timeline.find("{\"traceEvents\":["), 0u);
+  EXPECT_NE(timeline.find("\"name\":\"ext\",\"cat\":\"operator\""), std::string_view::npos);
+  EXPECT_NE(timeline.find("\"cat\":\"executor\""), std::string_view::npos);
+  EXPECT_NE(timeline.find("\"iteration\":1}"), std::string_view::npos);
+  // the size is optional
+  CHECK_DALI(daliPipelineGetTimeline(h, &json, nullptr));
+}
+
+TEST(CAPI2_PipelineTest, SharedMemOutputs) {
+  auto proto = GetPipelineWithExternalSource(StorageDevice::CPU, 8, 4, 0);
+  daliPipelineParams_t params{};
+  params.exec_type_present = true;
+  params.exec_type = DALI_EXEC_DYNAMIC;
+  auto h = Deserialize(proto, params);
+  ASSERT_NE(h, nullptr);
+  CHECK_DALI(daliPipelineBuild(h));
+  CHECK_DALI(daliPipelineEnableSharedMemOutputs(h, 1000));
+
+  std::mt19937_64 rng(1234);
+  size_t first_offset = 0;
+  for (int iter = 0; iter < 2; iter++) {
+    auto cpp_tl = std::make_shared<TensorList<CPUBackend>>();
+    FillRandomTensorList<uint8_t>(*cpp_tl, rng, { 16, 16, 1 }, { 64, 64, 3 }, 5);
+    cpp_tl->SetLayout("HWC");
+    auto tl = Wrap(cpp_tl);
+    CHECK_DALI(daliPipelineFeedInput(h, "ext", tl.get(), "data", {}, nullptr));
+    CHECK_DALI(daliPipelineRun(h));
+    auto outs = PopOutputs(h);
+    ASSERT_NE(outs, nullptr);
+    auto out_h = GetOutput(outs, 0);
+    auto &out = *Unwrap<CPUBackend>(out_h);
+
+    const daliSharedMemOutput_t *desc = nullptr;
+    CHECK_DALI(daliPipelineOutputsGetSharedMem(outs, &desc, 0));
+    ASSERT_NE(desc, nullptr);
+    const daliSharedMemOutput_t *desc2 = nullptr;
+    CHECK_DALI(daliPipelineOutputsGetSharedMem(outs, &desc2, 0));
+    EXPECT_EQ(desc, desc2) << "The output should be placed in the arena only once";
+
+    ASSERT_EQ(desc->num_samples, out.num_samples());
+    ASSERT_EQ(desc->ndim, 3);
+    EXPECT_EQ(desc->dtype, DALI_UINT8);
+    EXPECT_STREQ(desc->layout, "HWC");
+    EXPECT_EQ(desc->size, static_cast<size_t>(out.shape().num_elements()));
+    EXPECT_GE(desc->arena_size, desc->offset + desc->size);
+    if (iter == 0)
+      first_offset = desc->offset;
+    else  // the block was released along with the previous outputs and is reused
+      EXPECT_EQ(desc->offset, first_offset);
+
+    // Access the data like a consumer would - through a separate mapping of the arena
+    int fd = dup(desc->arena_handle);
+    ASSERT_GE(fd, 0);
+    void *mapping = mmap(nullptr, desc->arena_size, PROT_READ, MAP_SHARED, fd, 0);
+    ASSERT_NE(mapping, MAP_FAILED);
+    auto *base = static_cast<const uint8_t *>(mapping) + desc->offset;
+    for (int i = 0; i < desc->num_samples; i++) {
+      TensorShape<> shape(desc->shapes + i * desc->ndim, desc->shapes + (i + 1) * desc->ndim);
+      ASSERT_EQ(shape, out.tensor_shape(i));
+      EXPECT_EQ(std::memcmp(base + desc->sample_offsets[i], out.raw_tensor(i),
+                            shape.num_elements()), 0) << "Sample " << i << " differs.";
+    }
+    munmap(mapping, desc->arena_size);
+    close(fd);
+  }
+}
+
+TEST(CAPI2_PipelineTest, SharedMemOutputsZeroCopy) {
+  auto proto = GetPipelineWithExternalSource(StorageDevice::CPU, 8, 4, 0);
+  daliPipelineParams_t params{};
+  params.exec_type_present = true;
+  params.exec_type = DALI_EXEC_DYNAMIC;
+  auto h = Deserialize(proto, params);
+  ASSERT_NE(h, nullptr);
+  CHECK_DALI(daliPipelineEnableSharedMemOutputs(h, 1000));
+  CHECK_DALI(daliPipelineBuild(h));
+
+  // A non-contiguous input must be copied to the (contiguous) output - in the arena
+  std::mt19937_64 rng(2345);
+  auto cpp_tl = std::make_shared<TensorList<CPUBackend>>();
+  cpp_tl->SetContiguity(BatchContiguity::Noncontiguous);
+  FillRandomTensorList<uint8_t>(*cpp_tl, rng, { 16, 16, 1 }, { 64, 64, 3 }, 5);
+  auto tl = Wrap(cpp_tl);
+  CHECK_DALI(daliPipelineFeedInput(h, "ext", tl.get(), "data", DALI_FEED_INPUT_NO_COPY, nullptr));
+  CHECK_DALI(daliPipelineRun(h));
+  auto outs = PopOutputs(h);
+  ASSERT_NE(outs, nullptr);
+  auto out_h = GetOutput(outs, 0);
+  auto &out = *Unwrap<CPUBackend>(out_h);
+  ASSERT_TRUE(out.IsContiguousInMemory());
+
+  const daliSharedMemOutput_t *desc = nullptr;
+  CHECK_DALI(daliPipelineOutputsGetSharedMem(outs, &desc, 0));
+  ASSERT_NE(desc, nullptr);
+  ASSERT_EQ(desc->num_samples, cpp_tl->num_samples());
+
+  int fd = dup(desc->arena_handle);
+  ASSERT_GE(fd, 0);
+  void *mapping = mmap(nullptr, desc->arena_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  ASSERT_NE(mapping, MAP_FAILED);
+  auto *base = static_cast<uint8_t *>(mapping) + desc->offset;
+  for (int i = 0; i < desc->num_samples; i++) {
+    EXPECT_EQ(std::memcmp(base + desc->sample_offsets[i], cpp_tl->raw_tensor(i),
+                          cpp_tl->tensor_shape(i).num_elements()), 0)
+        << "Sample " << i << " differs.";
+  }
+  // The output is not a copy - it's the very memory the consumer sees
+  auto *last = base + desc->sample_offsets[desc->num_samples - 1];
+  last[0] = ~last[0];
+  EXPECT_EQ(static_cast<const uint8_t *>(out.raw_tensor(desc->num_samples - 1))[0], last[0]);
+  munmap(mapping, desc->arena_size);
+  close(fd);
+}
+
+TEST(CAPI2_PipelineTest, SharedMemOutputsNotEnabled) {
+  auto proto = GetPipelineWithExternalSource(StorageDevice::CPU, 8, 4, 0);
+  daliPipelineParams_t params{};
+  params.exec_type_present = true;
+  params.exec_type = DALI_EXEC_DYNAMIC;
+  auto h = Deserialize(proto, params);
+  ASSERT_NE(h, nullptr);
+  CHECK_DALI(daliPipelineBuild(h));
+
+  std::mt19937_64 rng(4321);
+  auto cpp_tl = std::make_shared<TensorList<CPUBackend>>();
+  FillRandomTensorList<uint8_t>(*cpp_tl, rng, { 16, 16, 1 }, { 64, 64, 3 }, 5);
+  auto tl = Wrap(cpp_tl);
+  CHECK_DALI(daliPipelineFeedInput(h, "ext", tl.get(), "data", {}, nullptr));
+  CHECK_DALI(daliPipelineRun(h));
+  auto outs = PopOutputs(h);
+  ASSERT_NE(outs, nullptr);
+  const daliSharedMemOutput_t *desc = nullptr;
+  EXPECT_EQ(daliPipelineOutputsGetSharedMem(outs, &desc, 0), DALI_ERROR_INVALID_OPERATION);
+  CHECK_DALI(daliPipelineEnableSharedMemOutputs(h, 1000));
+  // the arena is used by the outputs popped after it was enabled
+  EXPECT_EQ(daliPipelineOutputsGetSharedMem(outs, &desc, 0), DALI_ERROR_INVALID_OPERATION);
+  EXPECT_EQ(daliPipelineOutputsGetSharedMem(outs, &desc, 1), DALI_ERROR_OUT_OF_RANGE);
+  daliClearLastError();
+}
+
 TEST(CAPI2_PipelineTest, InputDescSimple) {
   auto proto = GetPipelineWithExternalSource(dali::StorageDevice::GPU, 4, 4, 0, false);
   daliPipelineParams_t params{};
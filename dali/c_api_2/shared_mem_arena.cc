@@ -0,0 +1,167 @@
+// Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dali/c_api_2/shared_mem_arena.h"
+#include <unistd.h>
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+#include "dali/core/format.h"
+#include "dali/core/util.h"
+
+namespace dali::c_api {
+
+namespace {
+
+size_t AlignUp(size_t bytes) {
+  return align_up(bytes, SharedMemArena::kAlignment);
+}
+
+}  // namespace
+
+SharedMemArena::SharedMemArena(size_t initial_capacity)
+: shm_handle_(ShmHandle::CreateHandle())
+, capacity_(AlignUp(std::max<size_t>(initial_capacity, 1))) {
+  POSIX_CALL_EX(ftruncate(shm_handle_, capacity_), "Failed to resize shared memory.");
+  mapping_ = MemoryMapping(shm_handle_, capacity_);
+  handle_ = shm_handle_;
+  free_[0] = capacity_;
+}
+
+size_t SharedMemArena::Allocate(size_t bytes) {
+  bytes = AlignUp(std::max<size_t>(bytes, 1));
+  std::unique_lock lock(mtx_);
+  // First fit - the outputs are released roughly in the order of allocation, so the free space
+  // tends to form a single block that moves along the region.
+  auto it = std::find_if(free_.begin(), free_.end(), [&](auto &blk) {
+    return blk.second >= bytes;
+  });
+  if (it == free_.end()) {
+    Grow(bytes);
+    it = std::prev(free_.end());
+    assert(it->second >= bytes);
+  }
+  size_t offset = it->first;
+  size_t remaining = it->second - bytes;
+  free_.erase(it);
+  if (remaining)
+    free_[offset + bytes] = remaining;
+  used_[offset] = bytes;
+  allocated_ += bytes;
+  return offset;
+}
+
+void SharedMemArena::Free(size_t offset) {
+  std::unique_lock lock(mtx_);
+  auto used = used_.find(offset);
+  if (used == used_.end())
+    throw std::invalid_argument(make_string(
+        "The offset ", offset, " doesn't denote a block allocated from the arena."));
+  size_t size = used->second;
+  used_.erase(used);
+  allocated_ -= size;
+
+  auto next = free_.lower_bound(offset);
+  if (next != free_.end() && next->first == offset + size) {
+    size += next->second;
+    next = free_.erase(next);
+  }
+  if (next != free_.begin()) {
+    auto prev = std::prev(next);
+    if (prev->first + prev->second == offset) {
+      prev->second += size;
+      return;
+    }
+  }
+  free_[offset] = size;
+}
+
+void SharedMemArena::Grow(size_t bytes) {
+  // The free block at the end of the region (if any) is extended
+  size_t tail_free = 0;
+  if (!free_.empty()) {
+    auto last = std::prev(free_.end());
+    if (last->first + last->second == capacity_)
+      tail_free = last->second;
+  }
+  size_t new_capacity = std::max(capacity_ * 2, capacity_ - tail_free + bytes);
+  POSIX_CALL_EX(ftruncate(shm_handle_, new_capacity), "Failed to resize shared memory.");
+  // The old mapping is not moved (nor unmapped) - the blocks may be in use in this process
+  MemoryMapping new_mapping(shm_handle_, new_capacity);
+  old_mappings_.push_back(std::move(mapping_));
+  mapping_ = std::move(new_mapping);
+  size_t tail_start = capacity_ - tail_free;
+  free_[tail_start] = new_capacity - tail_start;
+  capacity_ = new_capacity;
+}
+
+std::shared_ptr<uint8_t> SharedMemArena::AllocateShared(size_t bytes) {
+  auto self = shared_from_this();
+  size_t offset = Allocate(bytes);
+  return std::shared_ptr<uint8_t>(Data(offset), [self, offset](uint8_t *) {
+    self->Free(offset);
+  });
+}
+
+uint8_t *SharedMemArena::Data(size_t offset) {
+  std::shared_lock lock(mtx_);
+  if (offset >= capacity_)
+    throw std::out_of_range(make_string(
+        "The offset ", offset, " is outside of the arena of size ", capacity_, "."));
+  return mapping_.get_raw_ptr() + offset;
+}
+
+std::optional<size_t> SharedMemArena::Offset(const void *ptr) const {
+  auto *p = static_cast<const uint8_t *>(ptr);
+  auto find = [p](const MappedMemoryChunk &m) -> std::optional<size_t> {
+    if (p >= m.ptr && p < m.ptr + m.size)
+      return static_cast<size_t>(p - m.ptr);
+    return std::nullopt;
+  };
+  std::shared_lock lock(mtx_);
+  if (auto offset = find(mapping_.get()))
+    return offset;
+  for (auto &m : old_mappings_)
+    if (auto offset = find(m.get()))
+      return offset;
+  return std::nullopt;
+}
+
+void SharedMemArena::Write(size_t offset, const void *data, size_t bytes) {
+  std::shared_lock lock(mtx_);
+  if (offset + bytes > capacity_)
+    throw std::out_of_range(make_string(
+        "Cannot write ", bytes, " bytes at offset ", offset, " to an arena of size ", capacity_,
+        "."));
+  std::memcpy(mapping_.get_raw_ptr() + offset, data, bytes);
+}
+
+shm_handle_t SharedMemArena::Handle() const {
+  return handle_;
+}
+
+size_t SharedMemArena::Capacity() const {
+  std::shared_lock lock(mtx_);
+  return capacity_;
+}
+
+size_t SharedMemArena::AllocatedBytes() const {
+  std::shared_lock lock(mtx_);
+  return allocated_;
+}
+
+}  // namespace dali::c_api
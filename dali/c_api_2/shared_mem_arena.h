@@ -0,0 +1,97 @@
+// Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DALI_C_API_2_SHARED_MEM_ARENA_H_
+#define DALI_C_API_2_SHARED_MEM_ARENA_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <optional>
+#include <shared_mutex>
+#include <vector>
+#include "dali/core/os/shared_mem.h"
+
+namespace dali::c_api {
+
+/** A growable shared memory region, from which blocks are suballocated.
+ *
+ * The blocks are identified by their offsets in the region. When the region grows, it's mapped
+ * anew, but the previous mappings are kept until the arena is destroyed - the addresses of the
+ * blocks in this process never change. The region never shrinks - a consumer which has mapped
+ * a part of the region can keep using it for as long as the blocks in that part are not freed.
+ */
+class SharedMemArena : public std::enable_shared_from_this<SharedMemArena> {
+ public:
+  /** The alignment of the blocks */
+  static constexpr size_t kAlignment = 256;
+
+  explicit SharedMemArena(size_t initial_capacity);
+
+  /** Allocates a block, growing the region if necessary.
+   *
+   * @return The offset of the block in the region
+   */
+  size_t Allocate(size_t bytes);
+
+  /** Returns a block obtained from Allocate to the arena. */
+  void Free(size_t offset);
+
+  /** Allocates a block, which is freed when the last copy of the returned pointer is destroyed.
+   *
+   * The pointer keeps the arena alive. The arena must be owned by a shared_ptr.
+   */
+  std::shared_ptr<uint8_t> AllocateShared(size_t bytes);
+
+  /** The address of the given offset in this process */
+  uint8_t *Data(size_t offset);
+
+  /** The offset of the address in the region or nullopt, if the address is not in the region. */
+  std::optional<size_t> Offset(const void *ptr) const;
+
+  /** Copies the data to the region, at the given offset. */
+  void Write(size_t offset, const void *data, size_t bytes);
+
+  /** The handle (file descriptor) of the shared memory object */
+  shm_handle_t Handle() const;
+
+  /** The current size of the region */
+  size_t Capacity() const;
+
+  /** The total size of the allocated blocks */
+  size_t AllocatedBytes() const;
+
+ private:
+  /** Grows the region, so that it has a free block of at least the given size at the end. */
+  void Grow(size_t bytes);
+
+  mutable std::shared_mutex mtx_;
+  ShmHandle shm_handle_;
+  /** The mapping of the whole region */
+  MemoryMapping mapping_;
+  /** The mappings made before the region grew - they still hold the blocks allocated then */
+  std::vector<MemoryMapping> old_mappings_;
+  shm_handle_t handle_ = -1;
+  size_t capacity_ = 0;
+  size_t allocated_ = 0;
+  /** Free blocks: offset -> size; adjacent blocks are always merged */
+  std::map<size_t, size_t> free_;
+  /** Allocated blocks: offset -> size */
+  std::map<size_t, size_t> used_;
+};
+
+}  // namespace dali::c_api
+
+#endif  // DALI_C_API_2_SHARED_MEM_ARENA_H_
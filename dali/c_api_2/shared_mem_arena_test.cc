@@ -0,0 +1,163 @@
+// Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dali/c_api_2/shared_mem_arena.h"
+#include <gtest/gtest.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <cstring>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace dali::c_api::test {
+
+namespace {
+
+/** Maps the arena like a consumer in another process would (through a duplicated handle). */
+class ConsumerMapping {
+ public:
+  ConsumerMapping(shm_handle_t handle, size_t size) : size_(size) {
+    fd_ = dup(handle);
+    EXPECT_GE(fd_, 0);
+    ptr_ = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd_, 0);
+    EXPECT_NE(ptr_, MAP_FAILED);
+  }
+
+  ~ConsumerMapping() {
+    munmap(ptr_, size_);
+    close(fd_);
+  }
+
+  const uint8_t *data() const {
+    return static_cast<const uint8_t *>(ptr_);
+  }
+
+ private:
+  int fd_ = -1;
+  void *ptr_ = nullptr;
+  size_t size_ = 0;
+};
+
+}  // namespace
+
+TEST(SharedMemArenaTest, AllocateFree) {
+  SharedMemArena arena(1000);
+  EXPECT_EQ(arena.Capacity(), 1024u);
+  EXPECT_GE(arena.Handle(), 0);
+
+  size_t a = arena.Allocate(100);
+  size_t b = arena.Allocate(300);
+  size_t c = arena.Allocate(256);
+  EXPECT_EQ(a, 0u);
+  EXPECT_EQ(b, 256u);
+  EXPECT_EQ(c, 768u);
+  EXPECT_EQ(arena.AllocatedBytes(), 1024u);
+
+  arena.Free(b);
+  EXPECT_EQ(arena.AllocatedBytes(), 512u);
+  // the freed space is reused
+  EXPECT_EQ(arena.Allocate(10), 256u);
+  EXPECT_EQ(arena.Allocate(200), 512u);
+
+  arena.Free(a);
+  arena.Free(256);
+  arena.Free(512);
+  arena.Free(c);
+  EXPECT_EQ(arena.AllocatedBytes(), 0u);
+  // all free blocks are merged
+  EXPECT_EQ(arena.Allocate(1024), 0u);
+  EXPECT_EQ(arena.Capacity(), 1024u);
+
+  EXPECT_THROW(arena.Free(12345), std::invalid_argument);
+}
+
+TEST(SharedMemArenaTest, GrowPreservesData) {
+  SharedMemArena arena(256);
+  std::vector<uint8_t> data1(200), data2(5000);
+  std::iota(data1.begin(), data1.end(), 0);
+  std::iota(data2.begin(), data2.end(), 7);
+
+  size_t a = arena.Allocate(data1.size());
+  arena.Write(a, data1.data(), data1.size());
+  size_t b = arena.Allocate(data2.size());
+  EXPECT_GE(arena.Capacity(), b + data2.size());
+  arena.Write(b, data2.data(), data2.size());
+
+  ConsumerMapping mapping(arena.Handle(), arena.Capacity());
+  EXPECT_EQ(std::memcmp(mapping.data() + a, data1.data(), data1.size()), 0);
+  EXPECT_EQ(std::memcmp(mapping.data() + b, data2.data(), data2.size()), 0);
+
+  EXPECT_THROW(arena.Write(arena.Capacity() - 1, data1.data(), 2), std::out_of_range);
+}
+
+TEST(SharedMemArenaTest, SharedBlockSurvivesGrowth) {
+  auto arena = std::make_shared<SharedMemArena>(256);
+  std::vector<uint8_t> data(200);
+  std::iota(data.begin(), data.end(), 3);
+
+  auto block = arena->AllocateShared(data.size());
+  std::memcpy(block.get(), data.data(), data.size());
+  auto offset = arena->Offset(block.get());
+  ASSERT_TRUE(offset.has_value());
+  EXPECT_EQ(arena->Data(*offset), block.get());
+
+  // Growing the region doesn't move the blocks allocated earlier
+  size_t big = arena->Allocate(10000);
+  EXPECT_GT(arena->Capacity(), 10000u);
+  EXPECT_EQ(arena->Offset(block.get()), offset);
+  EXPECT_EQ(std::memcmp(block.get(), data.data(), data.size()), 0);
+  EXPECT_EQ(std::memcmp(arena->Data(*offset), data.data(), data.size()), 0);
+  ConsumerMapping mapping(arena->Handle(), arena->Capacity());
+  EXPECT_EQ(std::memcmp(mapping.data() + *offset, data.data(), data.size()), 0);
+
+  int local = 0;
+  EXPECT_FALSE(arena->Offset(&local).has_value());
+
+  // The block is freed along with the last pointer
+  arena->Free(big);
+  EXPECT_EQ(arena->AllocatedBytes(), SharedMemArena::kAlignment);
+  block.reset();
+  EXPECT_EQ(arena->AllocatedBytes(), 0u);
+}
+
+TEST(SharedMemArenaTest, RandomAllocations) {
+  SharedMemArena arena(4096);
+  std::mt19937_64 rng(1234);
+  std::uniform_int_distribution<size_t> size_dist(1, 3000);
+  std::vector<std::pair<size_t, size_t>> live;  // offset, size
+  for (int iter = 0; iter < 1000; iter++) {
+    if (live.empty() || rng() % 3 != 0) {
+      size_t size = size_dist(rng);
+      size_t offset = arena.Allocate(size);
+      EXPECT_EQ(offset % SharedMemArena::kAlignment, 0u);
+      EXPECT_LE(offset + size, arena.Capacity());
+      for (auto &[o, s] : live)
+        EXPECT_TRUE(offset + size <= o || o + s <= offset) << "Overlapping blocks";
+      live.emplace_back(offset, size);
+    } else {
+      size_t idx = rng() % live.size();
+      arena.Free(live[idx].first);
+      live.erase(live.begin() + idx);
+    }
+  }
+  for (auto &[o, s] : live)
+    arena.Free(o);
+  EXPECT_EQ(arena.AllocatedBytes(), 0u);
+  EXPECT_EQ(arena.Allocate(arena.Capacity()), 0u);
+}
+
+}  // namespace dali::c_api::test
@@ -0,0 +1,293 @@
+// Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <cstdio>
+#include <sstream>
+#include <stdexcept>
+#include "dali/core/exec/timeline.h"
+#include "dali/core/format.h"
+#include "dali/core/spinlock.h"
+
+namespace dali {
+
+const char *TimelineCategoryName(TimelineCategory category) {
+  switch (category) {
+    case TimelineCategory::Executor:
+      return "executor";
+    case TimelineCategory::Operator:
+      return "operator";
+    case TimelineCategory::ThreadPool:
+      return "thread_pool";
+    case TimelineCategory::Reader:
+      return "reader";
+    case TimelineCategory::Decoder:
+      return "decoder";
+    default:
+      return "other";
+  }
+}
+
+struct TimelineTracer::ThreadBuffer {
+  explicit ThreadBuffer(int tid) : tid(tid) {}
+
+  const int tid;
+  /** Guards the contents against concurrent export; it's not contended while recording. */
+  spinlock lock;
+  std::string name;
+  /** A ring buffer - allocated when the first event is recorded. */
+  std::vector<TimelineEvent> events;
+  /** The total number of events written to the ring buffer */
+  int64_t count = 0;
+
+  int64_t size() const {
+    return std::min<int64_t>(count, events.size());
+  }
+
+  template <typename Func>
+  void ForEach(Func &&func) const {
+    int64_t n = size();
+    for (int64_t i = count - n; i < count; i++)
+      func(events[i % events.size()]);
+  }
+};
+
+std::atomic<bool> TimelineTracer::recording_{false};
+
+namespace {
+
+/** The name given with SetThisThreadName, applied when the thread's buffer is registered */
+thread_local std::string this_thread_name;
+
+}  // namespace
+
+TimelineTracer &TimelineTracer::instance() {
+  static TimelineTracer tracer;
+  return tracer;
+}
+
+void TimelineTracer::Start(int sampling_period, int capacity) {
+  if (sampling_period < 1)
+    throw std::invalid_argument(make_string(
+        "The sampling period must be positive. Got: ", sampling_period));
+  if (capacity < 1)
+    throw std::invalid_argument(make_string(
+        "The capacity of the timeline must be positive. Got: ", capacity));
+  {
+    std::lock_guard g(buffers_mutex_);
+    if (!time_origin_)
+      time_origin_ = Now();
+  }
+  sampling_period_.store(sampling_period, std::memory_order_relaxed);
+  capacity_.store(capacity, std::memory_order_relaxed);
+  enabled_.store(true, std::memory_order_relaxed);
+  recording_.store(sampling_period == 1, std::memory_order_relaxed);
+}
+
+void TimelineTracer::Stop() {
+  enabled_.store(false, std::memory_order_relaxed);
+  recording_.store(false, std::memory_order_relaxed);
+}
+
+int TimelineTracer::Intern(std::string_view name) {
+  std::lock_guard g(names_mutex_);
+  auto it = name_ids_.find(name);
+  if (it != name_ids_.end())
+    return it->second;
+  int id = names_.size();
+  // The deque doesn't move the existing elements, so the keys remain valid
+  auto &stored = names_.emplace_back(name);
+  name_ids_.emplace(stored, id);
+  return id;
+}
+
+std::shared_ptr<TimelineTracer::ThreadBuffer> &TimelineTracer::ThreadLocalBuffer() {
+  static thread_local std::shared_ptr<ThreadBuffer> buffer;
+  return buffer;
+}
+
+TimelineTracer::ThreadBuffer *TimelineTracer::ThisThreadBuffer() {
+  auto &buffer = ThreadLocalBuffer();
+  if (!buffer) {
+    std::lock_guard g(buffers_mutex_);
+    PruneExitedBuffers(kMaxExitedThreadBuffers);
+    buffer = std::make_shared<ThreadBuffer>(next_thread_id_++);
+    buffer->name = this_thread_name;
+    buffers_.push_back(buffer);
+  }
+  return buffer.get();
+}
+
+void TimelineTracer::PruneExitedBuffers(int keep) {
+  // The buffers of the threads which have exited are referenced only by the tracer
+  auto exited = [](const std::shared_ptr<ThreadBuffer> &buf) { return buf.use_count() == 1; };
+  int64_t to_remove = std::count_if(buffers_.begin(), buffers_.end(), exited) - keep;
+  if (to_remove <= 0)
+    return;
+  // The buffers are stored in the order of registration - the oldest ones are removed
+  size_t out = 0;
+  for (size_t i = 0; i < buffers_.size(); i++) {
+    if (to_remove > 0 && exited(buffers_[i]))
+      to_remove--;
+    else
+      buffers_[out++] = std::move(buffers_[i]);
+  }
+  buffers_.resize(out);
+}
+
+void TimelineTracer::Record(const TimelineEvent &event) {
+  auto *buf = ThisThreadBuffer();
+  std::lock_guard g(buf->lock);
+  if (buf->events.empty())
+    buf->events.resize(capacity_.load(std::memory_order_relaxed));
+  buf->events[buf->count % buf->events.size()] = event;
+  buf->count++;
+}
+
+void TimelineTracer::SetThisThreadName(std::string_view name) {
+  this_thread_name = name;
+  if (auto &buf = ThreadLocalBuffer()) {
+    std::lock_guard g(buf->lock);
+    buf->name = name;
+  }
+}
+
+void TimelineTracer::Clear() {
+  std::lock_guard g(buffers_mutex_);
+  PruneExitedBuffers(0);
+  for (auto &buf : buffers_) {
+    std::lock_guard bg(buf->lock);
+    buf->count = 0;
+    // The capacity may have changed
+    buf->events = {};
+  }
+}
+
+int64_t TimelineTracer::NumEvents() const {
+  std::lock_guard g(buffers_mutex_);
+  int64_t n = 0;
+  for (auto &buf : buffers_) {
+    std::lock_guard bg(buf->lock);
+    n += buf->size();
+  }
+  return n;
+}
+
+int TimelineTracer::NumThreadBuffers() const {
+  std::lock_guard g(buffers_mutex_);
+  return buffers_.size();
+}
+
+namespace {
+
+void WriteJSONString(std::ostream &os, std::string_view s) {
+  os << '"';
+  for (char c : s) {
+    switch (c) {
+      case '"':
+        os << "\\\"";
+        break;
+      case '\\':
+        os << "\\\\";
+        break;
+      case '\n':
+        os << "\\n";
+        break;
+      case '\t':
+        os << "\\t";
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          char buf[8];
+          snprintf(buf, sizeof(buf), "\\u%04x", c);
+          os << buf;
+        } else {
+          os << c;
+        }
+    }
+  }
+  os << '"';
+}
+
+/** Writes a time in nanoseconds as microseconds, with 3 decimal places */
+void WriteMicroseconds(std::ostream &os, int64_t ns) {
+  if (ns < 0) {
+    os << '-';
+    ns = -ns;
+  }
+  char frac[4];
+  snprintf(frac, sizeof(frac), "%03d", static_cast<int>(ns % 1000));
+  os << ns / 1000 << '.' << frac;
+}
+
+}  // namespace
+
+void TimelineTracer::ExportChromeTrace(std::ostream &os) const {
+  struct ThreadEvents {
+    int tid;
+    std::string name;
+    std::vector<TimelineEvent> events;
+  };
+  std::vector<ThreadEvents> threads;
+  int64_t origin;
+  {
+    std::lock_guard g(buffers_mutex_);
+    origin = time_origin_;
+    threads.reserve(buffers_.size());
+    for (auto &buf : buffers_) {
+      std::lock_guard bg(buf->lock);
+      auto &t = threads.emplace_back();
+      t.tid = buf->tid;
+      t.name = buf->name;
+      t.events.reserve(buf->size());
+      buf->ForEach([&](const TimelineEvent &e) { t.events.push_back(e); });
+    }
+  }
+
+  std::lock_guard g(names_mutex_);
+  os << "{\"traceEvents\":[\n";
+  os << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":0,\"args\":{\"name\":\"DALI\"}}";
+  for (auto &t : threads) {
+    if (t.events.empty())
+      continue;
+    if (!t.name.empty()) {
+      os << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << t.tid
+         << ",\"args\":{\"name\":";
+      WriteJSONString(os, t.name);
+      os << "}}";
+    }
+    for (auto &e : t.events) {
+      os << ",\n{\"name\":";
+      WriteJSONString(os, e.name >= 0 && e.name < static_cast<int>(names_.size())
+                          ? std::string_view(names_[e.name]) : std::string_view("<unknown>"));
+      os << ",\"cat\":\"" << TimelineCategoryName(e.category) << "\",\"ph\":\"X\",\"pid\":0"
+         << ",\"tid\":" << t.tid << ",\"ts\":";
+      WriteMicroseconds(os, e.start - origin);
+      os << ",\"dur\":";
+      WriteMicroseconds(os, e.end - e.start);
+      if (e.arg >= 0)
+        os << ",\"args\":{\"iteration\":" << e.arg << "}";
+      os << "}";
+    }
+  }
+  os << "\n],\"displayTimeUnit\":\"ms\"}\n";
+}
+
+std::string TimelineTracer::ExportChromeTrace() const {
+  std::stringstream ss;
+  ExportChromeTrace(ss);
+  return ss.str();
+}
+
+}  // namespace dali
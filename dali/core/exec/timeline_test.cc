@@ -0,0 +1,185 @@
+// Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include <vector>
+#include "dali/core/exec/timeline.h"
+
+namespace dali {
+namespace test {
+
+namespace {
+
+int CountOccurrences(const std::string &s, const std::string &pattern) {
+  int n = 0;
+  for (size_t pos = s.find(pattern); pos != std::string::npos; pos = s.find(pattern, pos + 1))
+    n++;
+  return n;
+}
+
+class TimelineTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    auto &tracer = TimelineTracer::instance();
+    tracer.Stop();
+    tracer.Clear();
+  }
+
+  void TearDown() override {
+    auto &tracer = TimelineTracer::instance();
+    tracer.Stop();
+    tracer.Clear();
+  }
+};
+
+}  // namespace
+
+TEST_F(TimelineTest, Intern) {
+  auto &tracer = TimelineTracer::instance();
+  int a = tracer.Intern("timeline_test_a");
+  int b = tracer.Intern("timeline_test_b");
+  EXPECT_NE(a, b);
+  EXPECT_EQ(tracer.Intern(std::string("timeline_test_a")), a);
+  EXPECT_EQ(tracer.Intern("timeline_test_b"), b);
+}
+
+TEST_F(TimelineTest, DisabledRecordsNothing) {
+  auto &tracer = TimelineTracer::instance();
+  int name = tracer.Intern("disabled");
+  EXPECT_FALSE(TimelineTracer::IsRecording());
+  {
+    TimelineScope scope(name, TimelineCategory::Other);
+  }
+  {
+    TimelineScope scope(name, TimelineCategory::Operator, 0);
+  }
+  EXPECT_EQ(tracer.NumEvents(), 0);
+}
+
+TEST_F(TimelineTest, MultipleThreads) {
+  auto &tracer = TimelineTracer::instance();
+  tracer.Start();
+  int name = tracer.Intern("work \"quoted\"");
+  const int kThreads = 4, kEvents = 100;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; t++) {
+    threads.emplace_back([&, t]() {
+      tracer.SetThisThreadName("worker" + std::to_string(t));
+      for (int i = 0; i < kEvents; i++) {
+        TimelineScope scope(name, TimelineCategory::ThreadPool);
+      }
+    });
+  }
+  for (auto &t : threads)
+    t.join();
+  tracer.Stop();
+  EXPECT_EQ(tracer.NumEvents(), kThreads * kEvents);
+
+  std::string json = tracer.ExportChromeTrace();
+  EXPECT_EQ(json.rfind("{\"traceEvents\":[", 0), 0u);
+  EXPECT_EQ(CountOccurrences(json, "\"ph\":\"X\""), kThreads * kEvents);
+  EXPECT_EQ(CountOccurrences(json, "\"name\":\"work \\\"quoted\\\"\""), kThreads * kEvents);
+  EXPECT_EQ(CountOccurrences(json, "\"cat\":\"thread_pool\""), kThreads * kEvents);
+  for (int t = 0; t < kThreads; t++)
+    EXPECT_EQ(CountOccurrences(json, "\"name\":\"worker" + std::to_string(t) + "\""), 1);
+
+  // The buffers of the threads that exited are released
+  tracer.Clear();
+  EXPECT_EQ(tracer.NumEvents(), 0);
+  EXPECT_EQ(CountOccurrences(tracer.ExportChromeTrace(), "\"ph\":\"X\""), 0);
+}
+
+TEST_F(TimelineTest, LazyThreadBuffers) {
+  auto &tracer = TimelineTracer::instance();
+  int buffers = tracer.NumThreadBuffers();
+  // Naming a thread doesn't register a buffer
+  std::thread([&]() {
+    tracer.SetThisThreadName("unused");
+  }).join();
+  EXPECT_EQ(tracer.NumThreadBuffers(), buffers);
+
+  // The buffers of the exited threads are pruned when new threads register
+  tracer.Start();
+  int name = tracer.Intern("short_lived");
+  const int kThreads = TimelineTracer::kMaxExitedThreadBuffers + 10;
+  for (int t = 0; t < kThreads; t++) {
+    std::thread([&, t]() {
+      tracer.SetThisThreadName("short_lived" + std::to_string(t));
+      TimelineScope scope(name, TimelineCategory::Other);
+    }).join();
+  }
+  tracer.Stop();
+  EXPECT_LE(tracer.NumThreadBuffers(), buffers + TimelineTracer::kMaxExitedThreadBuffers + 1);
+  // The most recent ones are kept and exported, with their names
+  std::string json = tracer.ExportChromeTrace();
+  EXPECT_EQ(CountOccurrences(json, "\"name\":\"short_lived" + std::to_string(kThreads - 1) +
+                                   "\""), 1);
+  EXPECT_EQ(CountOccurrences(json, "\"name\":\"short_lived0\""), 0);
+}
+
+TEST_F(TimelineTest, Sampling) {
+  auto &tracer = TimelineTracer::instance();
+  tracer.Start(4);
+  int op = tracer.Intern("op");
+  int job = tracer.Intern("job");
+  for (int64_t iter = 0; iter < 16; iter++) {
+    tracer.BeginIteration(iter);
+    TimelineScope op_scope(op, TimelineCategory::Operator, iter);
+    TimelineScope job_scope(job, TimelineCategory::ThreadPool);
+  }
+  tracer.Stop();
+  EXPECT_FALSE(TimelineTracer::IsRecording());
+  EXPECT_EQ(tracer.NumEvents(), 8);
+  std::string json = tracer.ExportChromeTrace();
+  for (int iter : { 0, 4, 8, 12 })
+    EXPECT_EQ(CountOccurrences(json, "\"iteration\":" + std::to_string(iter) + "}"), 1);
+  EXPECT_EQ(CountOccurrences(json, "\"iteration\":1}"), 0);
+  EXPECT_EQ(CountOccurrences(json, "\"cat\":\"operator\""), 4);
+  EXPECT_EQ(CountOccurrences(json, "\"cat\":\"thread_pool\""), 4);
+}
+
+TEST_F(TimelineTest, RingBufferKeepsNewestEvents) {
+  auto &tracer = TimelineTracer::instance();
+  tracer.Start(1, 10);
+  int name = tracer.Intern("ring");
+  for (int64_t i = 0; i < 25; i++) {
+    TimelineEvent e;
+    e.name = name;
+    e.start = TimelineTracer::Now();
+    e.end = e.start + 1000;
+    e.arg = i;
+    tracer.Record(e);
+  }
+  tracer.Stop();
+  EXPECT_EQ(tracer.NumEvents(), 10);
+  std::string json = tracer.ExportChromeTrace();
+  EXPECT_EQ(CountOccurrences(json, "\"iteration\":14}"), 0);
+  for (int i = 15; i < 25; i++)
+    EXPECT_EQ(CountOccurrences(json, "\"iteration\":" + std::to_string(i) + "}"), 1);
+  EXPECT_EQ(CountOccurrences(json, "\"dur\":1.000"), 10);
+  // The oldest remaining event comes first
+  EXPECT_LT(json.find("\"iteration\":15}"), json.find("\"iteration\":24}"));
+}
+
+TEST_F(TimelineTest, InvalidArguments) {
+  auto &tracer = TimelineTracer::instance();
+  EXPECT_THROW(tracer.Start(0), std::invalid_argument);
+  EXPECT_THROW(tracer.Start(1, 0), std::invalid_argument);
+  EXPECT_FALSE(tracer.IsEnabled());
+}
+
+}  // namespace test
+}  // namespace dali
@@ -16,6 +16,7 @@
 #include <pthread.h>
 #include <memory>
 #include "dali/core/nvtx.h"
+#include "dali/core/exec/timeline.h"
 
 namespace dali {
 
@@ -80,6 +81,7 @@ DLL_PUBLIC void SetThreadName(const char *name) {
     nvtxNameOsThreadA(syscall(SYS_gettid), name);
   #endif  // NVTX_ENABLED
   SetThreadNameInternal(name);
+  TimelineTracer::instance().SetThisThreadName(name);
 }
 
 
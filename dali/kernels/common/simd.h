@@ -298,7 +298,7 @@ struct multivec : float4x<num_vecs> {
       "Total number of lanes is not a multiple of storage lanes.");
     multivec m;
     for (int i = 0; i < num_vecs; i += load_vecs) {
-      auto tmp = simd::load_f(in + i * load_lanes);
+      auto tmp = simd::load_f(in + i * 4);  // 4 lanes per vector
       for (int j = 0; j < load_vecs; j++)
         m.v[i + j] = tmp.v[j];
     }
@@ -322,7 +322,7 @@ DALI_FORCEINLINE static void store(Out *out, multivec<num_vecs> m) noexcept {
     float4x<store_vecs> slice;
     for (int j = 0; j < store_vecs; j++)
       slice.v[j] = m.v[i + j];
-    store_f(out + i * store_lanes, slice);
+    store_f(out + i * 4, slice);  // 4 lanes per vector
   }
 }
 
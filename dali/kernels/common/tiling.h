@@ -0,0 +1,130 @@
+// Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DALI_KERNELS_COMMON_TILING_H_
+#define DALI_KERNELS_COMMON_TILING_H_
+
+#include <algorithm>
+#include <cstdint>
+#include "dali/core/math_util.h"
+#include "dali/core/tensor_view.h"
+
+namespace dali {
+namespace kernels {
+
+/**
+ * @brief Default number of bands per thread
+ *
+ * More bands than threads compensate for the uneven cost of the bands and for other work
+ * running concurrently in the same thread pool.
+ */
+constexpr int kBandsPerThread = 8;
+
+/// @brief Default minimum cost (typically: number of elements) of a band
+constexpr int64_t kMinBandCost = 1 << 16;
+
+/**
+ * @brief Minimum ratio of the band height to the halo
+ *
+ * Each band processes its halo in addition to its own rows; this limits the redundant work
+ * to `2 / kMinBandToHaloRatio` of the total.
+ */
+constexpr int kMinBandToHaloRatio = 8;
+
+/**
+ * @brief A range of rows (or other outermost slices) processed as one unit of work
+ */
+struct Band {
+  int64_t begin, end;
+
+  constexpr int64_t size() const { return end - begin; }
+
+  /**
+   * @brief The range of input rows needed to calculate this band, clamped to `[0, extent)`
+   */
+  constexpr Band extended(int64_t halo, int64_t extent) const {
+    return { std::max<int64_t>(begin - halo, 0), std::min<int64_t>(end + halo, extent) };
+  }
+};
+
+/**
+ * @brief Calculates the number of bands into which `extent` rows should be split
+ *
+ * @param extent         the number of rows (or outermost slices) to split
+ * @param row_cost       the cost of processing one row, e.g. its number of elements
+ * @param num_threads    the number of threads which will process the bands
+ * @param halo           the number of extra rows, on each side, which a band needs to read or
+ *                       calculate redundantly; wider halos result in taller bands
+ * @param req_nblocks    the requested number of bands; by default, `kBandsPerThread` per thread
+ * @param min_band_cost  bands are not made cheaper than that (unless the whole image is)
+ */
+inline int PlanBands(int64_t extent, int64_t row_cost, int num_threads, int halo = 0,
+                     int req_nblocks = -1, int64_t min_band_cost = kMinBandCost) {
+  if (extent <= 0)
+    return 0;
+  if (req_nblocks < 0)
+    req_nblocks = num_threads > 1 ? num_threads * kBandsPerThread : 1;
+  int64_t nbands = std::min<int64_t>(req_nblocks, extent * row_cost / min_band_cost);
+  if (halo > 0)
+    nbands = std::min<int64_t>(nbands, extent / (int64_t{halo} * kMinBandToHaloRatio));
+  return clamp<int64_t>(nbands, 1, extent);
+}
+
+/**
+ * @brief Returns the band `idx` out of `nbands` equal (up to rounding) bands
+ */
+constexpr Band GetBand(int64_t extent, int nbands, int idx) {
+  return { extent * idx / nbands, extent * (idx + 1) / nbands };
+}
+
+/**
+ * @brief Returns a view of the slices `[band.begin, band.end)` along the outermost dimension
+ */
+template <typename StorageBackend, typename T, int ndim>
+TensorView<StorageBackend, T, ndim> BandView(const TensorView<StorageBackend, T, ndim> &tv,
+                                             Band band) {
+  static_assert(ndim != 0, "Cannot take a band of a scalar");
+  auto shape = tv.shape;
+  shape[0] = band.size();
+  return { tv.data + band.begin * volume(shape.begin() + 1, shape.end()), shape };
+}
+
+/**
+ * @brief Splits `extent` rows into bands and adds the processing of each band to the engine
+ *
+ * The work is not run - the caller is responsible for calling `engine.RunAll()`.
+ * The parameters are the same as in `PlanBands`; the engine provides the number of threads.
+ *
+ * @param band_func  a callable with a signature `void(Band)`; it's copied to each work item
+ * @return the number of bands
+ */
+template <typename ExecutionEngine, typename BandFunc>
+int ScheduleBands(ExecutionEngine &engine, int64_t extent, int64_t row_cost,
+                  const BandFunc &band_func, int halo = 0, int req_nblocks = -1,
+                  int64_t min_band_cost = kMinBandCost) {
+  int nbands = PlanBands(extent, row_cost, engine.NumThreads(), halo, req_nblocks,
+                         min_band_cost);
+  for (int b = 0; b < nbands; b++) {
+    Band band = GetBand(extent, nbands, b);
+    engine.AddWork([band, band_func](int) {
+      band_func(band);
+    }, band.extended(halo, extent).size() * row_cost);
+  }
+  return nbands;
+}
+
+}  // namespace kernels
+}  // namespace dali
+
+#endif  // DALI_KERNELS_COMMON_TILING_H_
@@ -0,0 +1,114 @@
+// Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <functional>
+#include <utility>
+#include <vector>
+#include "dali/kernels/common/tiling.h"
+
+namespace dali {
+namespace kernels {
+
+namespace {
+
+struct RecordingEngine {
+  template <typename FunctionLike>
+  void AddWork(FunctionLike &&f, int64_t priority = 0) {
+    work.emplace_back(std::forward<FunctionLike>(f));
+    priorities.push_back(priority);
+  }
+
+  void RunAll() {
+    for (auto &w : work)
+      w(0);
+    work.clear();
+  }
+
+  int NumThreads() const {
+    return num_threads;
+  }
+
+  int num_threads = 4;
+  std::vector<std::function<void(int)>> work;
+  std::vector<int64_t> priorities;
+};
+
+}  // namespace
+
+TEST(Tiling, PlanBands) {
+  // small images are not split
+  EXPECT_EQ(PlanBands(100, 100, 4), 1);
+  EXPECT_EQ(PlanBands(0, 100, 4), 0);
+  // single thread
+  EXPECT_EQ(PlanBands(10000, 10000, 1), 1);
+  // by default, kBandsPerThread per thread
+  EXPECT_EQ(PlanBands(10000, 10000, 4), 4 * kBandsPerThread);
+  // requested number of bands, limited by the number of rows
+  EXPECT_EQ(PlanBands(10000, 10000, 4, 0, 5), 5);
+  EXPECT_EQ(PlanBands(10, 1 << 20, 4, 0, 100), 10);
+  // limited by the cost
+  EXPECT_EQ(PlanBands(1000, 1000, 4, 0, 100, 100000), 10);
+  // limited by the halo
+  EXPECT_EQ(PlanBands(1000, 1 << 20, 4, 10, 100), 1000 / (10 * kMinBandToHaloRatio));
+  EXPECT_EQ(PlanBands(10, 1 << 20, 4, 10, 100), 1);
+}
+
+TEST(Tiling, Band) {
+  Band b = GetBand(100, 3, 1);
+  EXPECT_EQ(b.begin, 33);
+  EXPECT_EQ(b.end, 66);
+  EXPECT_EQ(b.size(), 33);
+  Band e = b.extended(5, 100);
+  EXPECT_EQ(e.begin, 28);
+  EXPECT_EQ(e.end, 71);
+  e = GetBand(100, 3, 0).extended(5, 100);
+  EXPECT_EQ(e.begin, 0);
+  EXPECT_EQ(e.end, 38);
+  e = GetBand(100, 3, 2).extended(50, 100);
+  EXPECT_EQ(e.begin, 16);
+  EXPECT_EQ(e.end, 100);
+}
+
+TEST(Tiling, BandView) {
+  std::vector<int> data(5 * 4 * 3);
+  auto tv = make_tensor_cpu<3>(data.data(), { 5, 4, 3 });
+  auto band = BandView(tv, { 1, 3 });
+  EXPECT_EQ(band.data, data.data() + 12);
+  EXPECT_EQ(band.shape, (TensorShape<3>{ 2, 4, 3 }));
+}
+
+TEST(Tiling, ScheduleBands) {
+  for (int halo : { 0, 3 }) {
+    RecordingEngine engine;
+    int64_t extent = 1001;
+    std::vector<int> covered(extent);
+    int nbands = ScheduleBands(engine, extent, 1000, [&](Band band) {
+      for (int64_t i = band.begin; i < band.end; i++)
+        covered[i]++;
+    }, halo);
+    EXPECT_GT(nbands, 1);
+    ASSERT_EQ(static_cast<int>(engine.work.size()), nbands);
+    for (int b = 0; b < nbands; b++) {
+      Band band = GetBand(extent, nbands, b);
+      EXPECT_EQ(engine.priorities[b], band.extended(halo, extent).size() * 1000);
+    }
+    engine.RunAll();
+    for (int64_t i = 0; i < extent; i++)
+      ASSERT_EQ(covered[i], 1) << " at row " << i;
+  }
+}
+
+}  // namespace kernels
+}  // namespace dali
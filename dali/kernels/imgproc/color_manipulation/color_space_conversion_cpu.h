@@ -0,0 +1,504 @@
+// Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DALI_KERNELS_IMGPROC_COLOR_MANIPULATION_COLOR_SPACE_CONVERSION_CPU_H_
+#define DALI_KERNELS_IMGPROC_COLOR_MANIPULATION_COLOR_SPACE_CONVERSION_CPU_H_
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+#include "dali/core/common.h"
+#include "dali/core/convert.h"
+#include "dali/core/error_handling.h"
+#include "dali/core/format.h"
+#include "dali/kernels/imgproc/color_manipulation/color_space_conversion_impl.h"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+namespace dali {
+namespace kernels {
+namespace color {
+
+/**
+ * Row-wise color space conversion on the CPU.
+ *
+ * The functions below convert a row of `npixels` interleaved pixels.
+ * 8-bit conversions use fixed-point arithmetic with 16-bit coefficients and 32-bit
+ * accumulators; the results are within 1 of the floating point formulas from `itu_r_bt_601`
+ * and `jpeg`. On x86, blocks of 32 pixels are deinterleaved into planes, transformed and
+ * interleaved back with SSE2; the remaining pixels use the same arithmetic in scalar code, so
+ * the results don't depend on the position in the row.
+ * Other types use the floating point formulas directly.
+ */
+namespace cpu {
+
+namespace detail {
+
+/**
+ * @brief An affine transform of 3 channels of 8-bit data, in fixed-point
+ *
+ * out[k] = clamp((m[k][0] * in[0] + m[k][1] * in[1] + m[k][2] * in[2] + bias[k]) >> bits)
+ * The bias includes the rounding term.
+ */
+struct FixedPointTransform3 {
+  int16_t m[3][3];
+  int32_t bias[3];
+  int bits;
+};
+
+constexpr int32_t round_fixed(double x, int bits) {
+  double scaled = x * (1 << bits);
+  return static_cast<int32_t>(scaled < 0 ? scaled - 0.5 : scaled + 0.5);
+}
+
+/**
+ * @brief Converts a floating point transform to fixed-point
+ *
+ * The precision is the highest that lets the coefficients fit in 16 bits (at most 14 bits).
+ * The input channels are permuted by `in_perm` and the outputs by `out_perm`, which is used to
+ * handle BGR order.
+ */
+constexpr FixedPointTransform3 MakeFixedPointTransform(const double (&m)[3][3],
+                                                       const double (&offset)[3],
+                                                       const int (&in_perm)[3] = {0, 1, 2},
+                                                       const int (&out_perm)[3] = {0, 1, 2}) {
+  double max_coeff = 0;
+  for (int k = 0; k < 3; k++)
+    for (int j = 0; j < 3; j++)
+      max_coeff = m[k][j] > max_coeff ? m[k][j] : -m[k][j] > max_coeff ? -m[k][j] : max_coeff;
+  int bits = 14;
+  while (bits > 0 && max_coeff * (1 << bits) > 32767)
+    bits--;
+  FixedPointTransform3 t{};
+  t.bits = bits;
+  for (int k = 0; k < 3; k++) {
+    for (int j = 0; j < 3; j++)
+      t.m[out_perm[k]][in_perm[j]] = round_fixed(m[k][j], bits);
+    t.bias[out_perm[k]] = round_fixed(offset[k], bits) + (1 << (bits - 1));
+  }
+  return t;
+}
+
+DALI_FORCEINLINE uint8_t apply_fixed(const FixedPointTransform3 &t, int k,
+                                     int x0, int x1, int x2) {
+  int32_t acc = t.m[k][0] * x0 + t.m[k][1] * x1 + t.m[k][2] * x2 + t.bias[k];
+  acc >>= t.bits;
+  return acc < 0 ? 0 : acc > 255 ? 255 : acc;
+}
+
+#ifdef __SSE2__
+
+/**
+ * @brief Deinterleaves 32 pixels of 3 channels, stored in 6 vectors
+ *
+ * Each step interleaves the first and the second half of the 96 bytes, moving the byte at
+ * position p to 2p mod 95. After 5 steps, the element 3i+c is at 32c+i - vectors 0-1 contain
+ * the first channel, 2-3 the second and 4-5 the third.
+ */
+DALI_FORCEINLINE void deinterleave3(__m128i (&v)[6]) {
+  for (int step = 0; step < 5; step++) {
+    __m128i t0 = _mm_unpacklo_epi8(v[0], v[3]);
+    __m128i t1 = _mm_unpackhi_epi8(v[0], v[3]);
+    __m128i t2 = _mm_unpacklo_epi8(v[1], v[4]);
+    __m128i t3 = _mm_unpackhi_epi8(v[1], v[4]);
+    __m128i t4 = _mm_unpacklo_epi8(v[2], v[5]);
+    __m128i t5 = _mm_unpackhi_epi8(v[2], v[5]);
+    v[0] = t0; v[1] = t1; v[2] = t2; v[3] = t3; v[4] = t4; v[5] = t5;
+  }
+}
+
+/**
+ * @brief The inverse of deinterleave3
+ *
+ * Each step moves the even bytes to the first half and the odd bytes to the second half.
+ */
+DALI_FORCEINLINE void interleave3(__m128i (&v)[6]) {
+  __m128i mask = _mm_set1_epi16(0xff);
+  for (int step = 0; step < 5; step++) {
+    __m128i t0 = _mm_packus_epi16(_mm_and_si128(v[0], mask), _mm_and_si128(v[1], mask));
+    __m128i t1 = _mm_packus_epi16(_mm_and_si128(v[2], mask), _mm_and_si128(v[3], mask));
+    __m128i t2 = _mm_packus_epi16(_mm_and_si128(v[4], mask), _mm_and_si128(v[5], mask));
+    __m128i t3 = _mm_packus_epi16(_mm_srli_epi16(v[0], 8), _mm_srli_epi16(v[1], 8));
+    __m128i t4 = _mm_packus_epi16(_mm_srli_epi16(v[2], 8), _mm_srli_epi16(v[3], 8));
+    __m128i t5 = _mm_packus_epi16(_mm_srli_epi16(v[4], 8), _mm_srli_epi16(v[5], 8));
+    v[0] = t0; v[1] = t1; v[2] = t2; v[3] = t3; v[4] = t4; v[5] = t5;
+  }
+}
+
+/**
+ * @brief Calculates one output channel of FixedPointTransform3 for 16 pixels
+ */
+struct FixedPointRowSSE {
+  FixedPointRowSSE(const FixedPointTransform3 &t, int k) {
+    auto pair = [](int16_t lo, int16_t hi) {
+      return _mm_set1_epi32(static_cast<uint16_t>(lo) | (static_cast<uint32_t>(hi) << 16));
+    };
+    c01 = pair(t.m[k][0], t.m[k][1]);
+    c2 = pair(t.m[k][2], 0);
+    bias = _mm_set1_epi32(t.bias[k]);
+    shift = _mm_cvtsi32_si128(t.bits);
+  }
+
+  DALI_FORCEINLINE __m128i accumulate(__m128i x01, __m128i x2) const {
+    __m128i acc = _mm_add_epi32(_mm_madd_epi16(x01, c01), _mm_madd_epi16(x2, c2));
+    return _mm_sra_epi32(_mm_add_epi32(acc, bias), shift);
+  }
+
+  DALI_FORCEINLINE __m128i operator()(__m128i x0, __m128i x1, __m128i x2) const {
+    __m128i zero = _mm_setzero_si128();
+    __m128i out16[2];
+    for (int h = 0; h < 2; h++) {
+      __m128i a = h ? _mm_unpackhi_epi8(x0, zero) : _mm_unpacklo_epi8(x0, zero);
+      __m128i b = h ? _mm_unpackhi_epi8(x1, zero) : _mm_unpacklo_epi8(x1, zero);
+      __m128i c = h ? _mm_unpackhi_epi8(x2, zero) : _mm_unpacklo_epi8(x2, zero);
+      __m128i lo = accumulate(_mm_unpacklo_epi16(a, b), _mm_unpacklo_epi16(c, zero));
+      __m128i hi = accumulate(_mm_unpackhi_epi16(a, b), _mm_unpackhi_epi16(c, zero));
+      out16[h] = _mm_packs_epi32(lo, hi);
+    }
+    return _mm_packus_epi16(out16[0], out16[1]);
+  }
+
+  __m128i c01, c2, bias, shift;
+};
+
+#endif  // __SSE2__
+
+/**
+ * @brief Applies a fixed-point transform to a row of 8-bit pixels
+ *
+ * @tparam in_channels   1 or 3; a single input channel is used as all 3 transform inputs
+ * @tparam out_channels  1 or 3; with 1 output channel, only the first output is calculated
+ */
+template <int in_channels, int out_channels>
+void transform_row_u8(uint8_t *out, const uint8_t *in, int64_t npixels,
+                      const FixedPointTransform3 &t) {
+  int64_t i = 0;
+#ifdef __SSE2__
+  FixedPointRowSSE rows[3] = { { t, 0 }, { t, 1 }, { t, 2 } };
+  for (; i + 32 <= npixels; i += 32) {
+    __m128i x[6];
+    if (in_channels == 3) {
+      for (int j = 0; j < 6; j++)
+        x[j] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + 3 * i) + j);
+      deinterleave3(x);
+    } else {
+      x[0] = x[2] = x[4] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i));
+      x[1] = x[3] = x[5] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i) + 1);
+    }
+    __m128i y[6];
+    for (int k = 0; k < out_channels; k++)
+      for (int h = 0; h < 2; h++)
+        y[2 * k + h] = rows[k](x[h], x[2 + h], x[4 + h]);
+    if (out_channels == 3) {
+      interleave3(y);
+      for (int j = 0; j < 6; j++)
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out + 3 * i) + j, y[j]);
+    } else {
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i), y[0]);
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i) + 1, y[1]);
+    }
+  }
+#endif
+  for (; i < npixels; i++) {
+    const uint8_t *px = in + i * in_channels;
+    int x0 = px[0];
+    int x1 = in_channels == 3 ? px[1] : x0;
+    int x2 = in_channels == 3 ? px[2] : x0;
+    for (int k = 0; k < out_channels; k++)
+      out[i * out_channels + k] = apply_fixed(t, k, x0, x1, x2);
+  }
+}
+
+template <typename Out, typename In>
+constexpr bool is_u8_conversion =
+    std::is_same<Out, uint8_t>::value && std::is_same<In, uint8_t>::value;
+
+constexpr int kRGB[3] = { 0, 1, 2 };
+constexpr int kBGR[3] = { 2, 1, 0 };
+
+// ITU-R BT.601 - the same coefficients as in itu_r_bt_601
+constexpr double kRGB2YCbCr[3][3] = {
+  {  0.25678823529,  0.50412941176,  0.09790588235 },
+  { -0.14822289945, -0.29099278682,  0.43921568627 },
+  {  0.43921568627, -0.36778831435, -0.07142737192 },
+};
+constexpr double kRGB2YCbCrOffset[3] = { 16, 128, 128 };
+
+constexpr double kYScale = 255.0 / 219;
+constexpr double kYCbCr2RGB[3][3] = {
+  { kYScale,  0,              1.5960267848  },
+  { kYScale, -0.39176228842, -0.81296764538 },
+  { kYScale,  2.0172321417,   0             },
+};
+// the input offsets (16 for Y, 128 for Cb and Cr), moved to the output
+constexpr double kYCbCr2RGBOffset[3] = {
+  -16 * kYScale - 128 * kYCbCr2RGB[0][2],
+  -16 * kYScale - 128 * (kYCbCr2RGB[1][1] + kYCbCr2RGB[1][2]),
+  -16 * kYScale - 128 * kYCbCr2RGB[2][1],
+};
+
+// JPEG luma
+constexpr double kRGB2Gray[3][3] = { { 0.299, 0.587, 0.114 } };
+constexpr double kNoOffset[3] = {};
+
+constexpr double kGray2YCbCr[3][3] = { { 219.0 / 255 } };
+constexpr double kGray2YCbCrOffset[3] = { 16, 128, 128 };
+
+constexpr double kYCbCr2Gray[3][3] = { { kYScale } };
+constexpr double kYCbCr2GrayOffset[3] = { -16 * kYScale };
+
+}  // namespace detail
+
+/**
+ * @brief Converts RGB to BGR or vice versa
+ */
+template <typename Out, typename In>
+void swap_rb_row(Out *out, const In *in, int64_t npixels) {
+  int64_t i = 0;
+#ifdef __SSE2__
+  if constexpr (detail::is_u8_conversion<Out, In>) {
+    for (; i + 32 <= npixels; i += 32) {
+      __m128i x[6];
+      for (int j = 0; j < 6; j++)
+        x[j] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + 3 * i) + j);
+      detail::deinterleave3(x);
+      std::swap(x[0], x[4]);
+      std::swap(x[1], x[5]);
+      detail::interleave3(x);
+      for (int j = 0; j < 6; j++)
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out + 3 * i) + j, x[j]);
+    }
+  }
+#endif
+  for (; i < npixels; i++) {
+    Out r = ConvertSatNorm<Out>(in[3 * i]);
+    Out g = ConvertSatNorm<Out>(in[3 * i + 1]);
+    Out b = ConvertSatNorm<Out>(in[3 * i + 2]);
+    out[3 * i] = b;
+    out[3 * i + 1] = g;
+    out[3 * i + 2] = r;
+  }
+}
+
+/**
+ * @brief Converts RGB (or BGR, if `bgr` is true) to YCbCr, as defined by ITU-R BT.601
+ */
+template <bool bgr, typename Out, typename In>
+void rgb_to_ycbcr_row(Out *out, const In *in, int64_t npixels) {
+  if constexpr (detail::is_u8_conversion<Out, In>) {
+    static constexpr auto t = detail::MakeFixedPointTransform(
+        detail::kRGB2YCbCr, detail::kRGB2YCbCrOffset, bgr ? detail::kBGR : detail::kRGB);
+    detail::transform_row_u8<3, 3>(out, in, npixels, t);
+  } else {
+    constexpr int r = bgr ? 2 : 0, b = bgr ? 0 : 2;
+    #pragma omp simd
+    for (int64_t i = 0; i < npixels; i++) {
+      vec<3, In> rgb(in[3 * i + r], in[3 * i + 1], in[3 * i + b]);
+      out[3 * i]     = itu_r_bt_601::rgb_to_y<Out>(rgb);
+      out[3 * i + 1] = itu_r_bt_601::rgb_to_cb<Out>(rgb);
+      out[3 * i + 2] = itu_r_bt_601::rgb_to_cr<Out>(rgb);
+    }
+  }
+}
+
+/**
+ * @brief Converts YCbCr (ITU-R BT.601) to RGB (or BGR, if `bgr` is true)
+ */
+template <bool bgr, typename Out, typename In>
+void ycbcr_to_rgb_row(Out *out, const In *in, int64_t npixels) {
+  if constexpr (detail::is_u8_conversion<Out, In>) {
+    static constexpr auto t = detail::MakeFixedPointTransform(
+        detail::kYCbCr2RGB, detail::kYCbCr2RGBOffset, detail::kRGB,
+        bgr ? detail::kBGR : detail::kRGB);
+    detail::transform_row_u8<3, 3>(out, in, npixels, t);
+  } else {
+    constexpr int r = bgr ? 2 : 0, b = bgr ? 0 : 2;
+    #pragma omp simd
+    for (int64_t i = 0; i < npixels; i++) {
+      vec<3, In> ycbcr(in[3 * i], in[3 * i + 1], in[3 * i + 2]);
+      auto rgb = itu_r_bt_601::ycbcr_to_rgb<Out>(ycbcr);
+      out[3 * i + r] = rgb[0];
+      out[3 * i + 1] = rgb[1];
+      out[3 * i + b] = rgb[2];
+    }
+  }
+}
+
+/**
+ * @brief Converts RGB (or BGR, if `bgr` is true) to grayscale, with the JPEG luma formula
+ */
+template <bool bgr, typename Out, typename In>
+void rgb_to_gray_row(Out *out, const In *in, int64_t npixels) {
+  if constexpr (detail::is_u8_conversion<Out, In>) {
+    static constexpr auto t = detail::MakeFixedPointTransform(
+        detail::kRGB2Gray, detail::kNoOffset, bgr ? detail::kBGR : detail::kRGB);
+    detail::transform_row_u8<3, 1>(out, in, npixels, t);
+  } else {
+    constexpr int r = bgr ? 2 : 0, b = bgr ? 0 : 2;
+    #pragma omp simd
+    for (int64_t i = 0; i < npixels; i++) {
+      vec<3, In> rgb(in[3 * i + r], in[3 * i + 1], in[3 * i + b]);
+      out[i] = rgb_to_gray<Out>(rgb);
+    }
+  }
+}
+
+/**
+ * @brief Replicates the gray level in 3 channels
+ */
+template <typename Out, typename In>
+void gray_to_rgb_row(Out *out, const In *in, int64_t npixels) {
+  int64_t i = 0;
+#ifdef __SSE2__
+  if constexpr (detail::is_u8_conversion<Out, In>) {
+    for (; i + 32 <= npixels; i += 32) {
+      __m128i x[6];
+      x[0] = x[2] = x[4] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i));
+      x[1] = x[3] = x[5] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i) + 1);
+      detail::interleave3(x);
+      for (int j = 0; j < 6; j++)
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out + 3 * i) + j, x[j]);
+    }
+  }
+#endif
+  for (; i < npixels; i++) {
+    Out v = ConvertSatNorm<Out>(in[i]);
+    out[3 * i] = v;
+    out[3 * i + 1] = v;
+    out[3 * i + 2] = v;
+  }
+}
+
+/**
+ * @brief Converts grayscale to YCbCr (ITU-R BT.601); the chroma is neutral
+ */
+template <typename Out, typename In>
+void gray_to_ycbcr_row(Out *out, const In *in, int64_t npixels) {
+  if constexpr (detail::is_u8_conversion<Out, In>) {
+    // the chroma is produced by the transform as a constant
+    static constexpr auto t =
+        detail::MakeFixedPointTransform(detail::kGray2YCbCr, detail::kGray2YCbCrOffset);
+    detail::transform_row_u8<1, 3>(out, in, npixels, t);
+  } else {
+    Out c = ConvertNorm<Out>(0.5f);
+    #pragma omp simd
+    for (int64_t i = 0; i < npixels; i++) {
+      out[3 * i] = itu_r_bt_601::gray_to_y<Out>(in[i]);
+      out[3 * i + 1] = c;
+      out[3 * i + 2] = c;
+    }
+  }
+}
+
+/**
+ * @brief Converts YCbCr (ITU-R BT.601) to full range grayscale
+ */
+template <typename Out, typename In>
+void ycbcr_to_gray_row(Out *out, const In *in, int64_t npixels) {
+  if constexpr (detail::is_u8_conversion<Out, In>) {
+    static constexpr auto t =
+        detail::MakeFixedPointTransform(detail::kYCbCr2Gray, detail::kYCbCr2GrayOffset);
+    detail::transform_row_u8<3, 1>(out, in, npixels, t);
+  } else {
+    #pragma omp simd
+    for (int64_t i = 0; i < npixels; i++)
+      out[i] = itu_r_bt_601::y_to_gray<Out>(in[3 * i]);
+  }
+}
+
+/**
+ * @brief Copies the pixels, converting the type, if necessary
+ */
+template <typename Out, typename In>
+void copy_row(Out *out, const In *in, int64_t nvalues) {
+  if constexpr (std::is_same<Out, In>::value) {
+    std::memcpy(out, in, nvalues * sizeof(In));
+  } else {
+    #pragma omp simd
+    for (int64_t i = 0; i < nvalues; i++)
+      out[i] = ConvertSatNorm<Out>(in[i]);
+  }
+}
+
+}  // namespace cpu
+
+/**
+ * @brief Converts `npixels` interleaved pixels from `in_type` to `out_type` color space
+ *
+ * Supports RGB, BGR, YCbCr and GRAY.
+ */
+template <typename Out, typename In>
+void ConvertRow(Out *out, DALIImageType out_type, const In *in, DALIImageType in_type,
+                int64_t npixels) {
+  using namespace cpu;  // NOLINT
+  if (in_type == out_type) {
+    copy_row(out, in, npixels * NumberOfChannels(in_type));
+    return;
+  }
+  switch (in_type) {
+    case DALI_RGB:
+    case DALI_BGR: {
+      bool bgr = in_type == DALI_BGR;
+      switch (out_type) {
+        case DALI_RGB:
+        case DALI_BGR:
+          return swap_rb_row(out, in, npixels);
+        case DALI_YCbCr:
+          return bgr ? rgb_to_ycbcr_row<true>(out, in, npixels)
+                     : rgb_to_ycbcr_row<false>(out, in, npixels);
+        case DALI_GRAY:
+          return bgr ? rgb_to_gray_row<true>(out, in, npixels)
+                     : rgb_to_gray_row<false>(out, in, npixels);
+        default:
+          break;
+      }
+      break;
+    }
+    case DALI_YCbCr:
+      switch (out_type) {
+        case DALI_RGB:
+          return ycbcr_to_rgb_row<false>(out, in, npixels);
+        case DALI_BGR:
+          return ycbcr_to_rgb_row<true>(out, in, npixels);
+        case DALI_GRAY:
+          return ycbcr_to_gray_row(out, in, npixels);
+        default:
+          break;
+      }
+      break;
+    case DALI_GRAY:
+      switch (out_type) {
+        case DALI_RGB:
+        case DALI_BGR:
+          return gray_to_rgb_row(out, in, npixels);
+        case DALI_YCbCr:
+          return gray_to_ycbcr_row(out, in, npixels);
+        default:
+          break;
+      }
+      break;
+    default:
+      break;
+  }
+  DALI_FAIL(make_string("conversion not supported ", in_type, " to ", out_type));
+}
+
+}  // namespace color
+}  // namespace kernels
+}  // namespace dali
+
+#endif  // DALI_KERNELS_IMGPROC_COLOR_MANIPULATION_COLOR_SPACE_CONVERSION_CPU_H_
@@ -0,0 +1,186 @@
+// Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+#include <vector>
+#include "dali/kernels/imgproc/color_manipulation/color_space_conversion_cpu.h"
+
+namespace dali {
+namespace kernels {
+namespace color {
+namespace test {
+
+namespace {
+
+/**
+ * @brief Per-pixel reference, built from the same formulas as the GPU implementation
+ */
+template <typename Out, typename In>
+void RefConvertPixel(Out *out, DALIImageType out_type, const In *in, DALIImageType in_type) {
+  vec<3, In> rgb;
+  if (in_type == DALI_GRAY) {
+    if (out_type == DALI_YCbCr) {
+      out[0] = itu_r_bt_601::gray_to_y<Out>(in[0]);
+      out[1] = out[2] = ConvertNorm<Out>(0.5f);
+    } else if (out_type == DALI_GRAY) {
+      out[0] = ConvertSatNorm<Out>(in[0]);
+    } else {
+      out[0] = out[1] = out[2] = ConvertSatNorm<Out>(in[0]);
+    }
+    return;
+  }
+  if (in_type == DALI_YCbCr) {
+    if (out_type == DALI_GRAY) {
+      out[0] = itu_r_bt_601::y_to_gray<Out>(in[0]);
+      return;
+    }
+    vec<3, Out> out_rgb;
+    if (out_type == DALI_YCbCr)
+      out_rgb = { ConvertSatNorm<Out>(in[0]), ConvertSatNorm<Out>(in[1]),
+                  ConvertSatNorm<Out>(in[2]) };
+    else
+      out_rgb = itu_r_bt_601::ycbcr_to_rgb<Out>(vec<3, In>(in[0], in[1], in[2]));
+    bool swap = out_type == DALI_BGR;
+    out[0] = out_rgb[swap ? 2 : 0];
+    out[1] = out_rgb[1];
+    out[2] = out_rgb[swap ? 0 : 2];
+    return;
+  }
+  bool bgr = in_type == DALI_BGR;
+  rgb = { in[bgr ? 2 : 0], in[1], in[bgr ? 0 : 2] };
+  switch (out_type) {
+    case DALI_GRAY:
+      out[0] = rgb_to_gray<Out>(rgb);
+      break;
+    case DALI_YCbCr:
+      out[0] = itu_r_bt_601::rgb_to_y<Out>(rgb);
+      out[1] = itu_r_bt_601::rgb_to_cb<Out>(rgb);
+      out[2] = itu_r_bt_601::rgb_to_cr<Out>(rgb);
+      break;
+    default: {
+      bool swap = out_type == DALI_BGR;
+      out[0] = ConvertSatNorm<Out>(rgb[swap ? 2 : 0]);
+      out[1] = ConvertSatNorm<Out>(rgb[1]);
+      out[2] = ConvertSatNorm<Out>(rgb[swap ? 0 : 2]);
+      break;
+    }
+  }
+}
+
+template <typename T>
+T RandomValue(std::mt19937_64 &rng) {
+  if constexpr (std::is_integral<T>::value)
+    return std::uniform_int_distribution<int>(0, 255)(rng);
+  else
+    return std::uniform_real_distribution<T>(0, 1)(rng);
+}
+
+template <typename Out, typename In>
+void TestConvertRow(double eps) {
+  DALIImageType types[] = { DALI_RGB, DALI_BGR, DALI_YCbCr, DALI_GRAY };
+  std::mt19937_64 rng(1234);
+  // odd size to exercise the non-vectorized remainder
+  const int npixels = 1003;
+  for (auto in_type : types) {
+    for (auto out_type : types) {
+      int in_c = NumberOfChannels(in_type), out_c = NumberOfChannels(out_type);
+      std::vector<In> in(npixels * in_c);
+      for (auto &v : in)
+        v = RandomValue<In>(rng);
+      if (std::is_integral<In>::value) {
+        // include the extreme values
+        for (int i = 0; i < in_c; i++) {
+          in[i] = 0;
+          in[in_c + i] = 255;
+        }
+      }
+      std::vector<Out> out(npixels * out_c), ref(npixels * out_c);
+      ConvertRow(out.data(), out_type, in.data(), in_type, npixels);
+      for (int i = 0; i < npixels; i++)
+        RefConvertPixel(&ref[i * out_c], out_type, &in[i * in_c], in_type);
+      for (int i = 0; i < npixels * out_c; i++) {
+        ASSERT_NEAR(out[i], ref[i], eps)
+            << " at " << i << " when converting " << in_type << " to " << out_type;
+      }
+    }
+  }
+}
+
+}  // namespace
+
+TEST(ColorSpaceConversionCPU, ConvertRowU8) {
+  // fixed-point arithmetic
+  TestConvertRow<uint8_t, uint8_t>(1);
+}
+
+TEST(ColorSpaceConversionCPU, ConvertRowFloat) {
+  TestConvertRow<float, float>(0);
+  TestConvertRow<float, uint8_t>(0);
+  TestConvertRow<uint8_t, float>(0);
+}
+
+TEST(ColorSpaceConversionCPU, ConvertRowU8Exhaustive) {
+  // a dense grid of 8-bit colors
+  std::vector<uint8_t> in;
+  for (int r = 0; r < 256; r += 3)
+    for (int g = 0; g < 256; g += 5)
+      for (int b = 0; b < 256; b += 7)
+        in.insert(in.end(), { uint8_t(r), uint8_t(g), uint8_t(b) });
+  int npixels = in.size() / 3;
+  for (auto [in_type, out_type] : { std::make_pair(DALI_RGB, DALI_YCbCr),
+                                    std::make_pair(DALI_YCbCr, DALI_RGB),
+                                    std::make_pair(DALI_RGB, DALI_GRAY) }) {
+    int out_c = NumberOfChannels(out_type);
+    std::vector<uint8_t> out(npixels * out_c), ref(npixels * out_c);
+    ConvertRow(out.data(), out_type, in.data(), in_type, npixels);
+    int num_off = 0;
+    for (int i = 0; i < npixels; i++) {
+      RefConvertPixel(&ref[i * out_c], out_type, &in[i * 3], in_type);
+      for (int c = 0; c < out_c; c++) {
+        int diff = std::abs(out[i * out_c + c] - ref[i * out_c + c]);
+        ASSERT_LE(diff, 1);
+        num_off += diff;
+      }
+    }
+    // off-by-one results happen only for values very close to a rounding boundary
+    EXPECT_LT(num_off, npixels * out_c / 100) << in_type << " to " << out_type;
+  }
+}
+
+TEST(ColorSpaceConversionCPU, VectorizedMatchesScalar) {
+  // the blocks of pixels processed with SIMD must give exactly the same results as the remainder
+  std::mt19937_64 rng(4321);
+  const int npixels = 100;
+  std::vector<uint8_t> in(npixels * 3);
+  for (auto &v : in)
+    v = RandomValue<uint8_t>(rng);
+  DALIImageType types[] = { DALI_RGB, DALI_BGR, DALI_YCbCr, DALI_GRAY };
+  for (auto in_type : types) {
+    for (auto out_type : types) {
+      int in_c = NumberOfChannels(in_type), out_c = NumberOfChannels(out_type);
+      std::vector<uint8_t> row(npixels * out_c), single(npixels * out_c);
+      ConvertRow(row.data(), out_type, in.data(), in_type, npixels);
+      for (int i = 0; i < npixels; i++)
+        ConvertRow(&single[i * out_c], out_type, &in[i * in_c], in_type, 1);
+      EXPECT_EQ(row, single) << in_type << " to " << out_type;
+    }
+  }
+}
+
+}  // namespace test
+}  // namespace color
+}  // namespace kernels
+}  // namespace dali
@@ -0,0 +1,706 @@
+// Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DALI_KERNELS_IMGPROC_FILTER_MEDIAN_BLUR_CPU_H_
+#define DALI_KERNELS_IMGPROC_FILTER_MEDIAN_BLUR_CPU_H_
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "dali/core/boundary.h"
+#include "dali/core/error_handling.h"
+#include "dali/core/exec/engine.h"
+#include "dali/core/force_inline.h"
+#include "dali/core/geom/vec.h"
+#include "dali/core/tensor_view.h"
+#include "dali/kernels/common/tiling.h"
+#include "dali/kernels/kernel.h"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+namespace dali {
+namespace kernels {
+namespace median {
+
+/**
+ * @brief Median selection networks for 3x3 and 5x5 windows
+ *
+ * After the compare-exchange operations are applied, the median is at index `kMedian`.
+ * The networks come from N. Devillard, "Fast median search: an ANSI C implementation".
+ */
+struct Network3x3 {
+  static constexpr int kSize = 9;
+  static constexpr int kMedian = 4;
+  static constexpr uint8_t kPairs[][2] = {
+    {1, 2}, {4, 5}, {7, 8}, {0, 1}, {3, 4}, {6, 7}, {1, 2}, {4, 5}, {7, 8}, {0, 3},
+    {5, 8}, {4, 7}, {3, 6}, {1, 4}, {2, 5}, {4, 7}, {4, 2}, {6, 4}, {4, 2}
+  };
+};
+
+struct Network5x5 {
+  static constexpr int kSize = 25;
+  static constexpr int kMedian = 12;
+  static constexpr uint8_t kPairs[][2] = {
+    {0, 1}, {3, 4}, {2, 4}, {2, 3}, {6, 7}, {5, 7}, {5, 6}, {9, 10}, {8, 10}, {8, 9},
+    {12, 13}, {11, 13}, {11, 12}, {15, 16}, {14, 16}, {14, 15}, {18, 19}, {17, 19}, {17, 18},
+    {21, 22}, {20, 22}, {20, 21}, {23, 24}, {2, 5}, {3, 6}, {0, 6}, {0, 3}, {4, 7}, {1, 7},
+    {1, 4}, {11, 14}, {8, 14}, {8, 11}, {12, 15}, {9, 15}, {9, 12}, {13, 16}, {10, 16},
+    {10, 13}, {20, 23}, {17, 23}, {17, 20}, {21, 24}, {18, 24}, {18, 21}, {19, 22}, {8, 17},
+    {9, 18}, {0, 18}, {0, 9}, {10, 19}, {1, 19}, {1, 10}, {11, 20}, {2, 20}, {2, 11},
+    {12, 21}, {3, 21}, {3, 12}, {13, 22}, {4, 22}, {4, 13}, {14, 23}, {5, 23}, {5, 14},
+    {15, 24}, {6, 24}, {6, 15}, {7, 16}, {7, 19}, {13, 21}, {15, 23}, {7, 13}, {7, 15},
+    {1, 9}, {3, 11}, {5, 17}, {11, 17}, {9, 17}, {4, 10}, {6, 12}, {7, 14}, {4, 6}, {4, 7},
+    {12, 14}, {10, 14}, {6, 7}, {10, 12}, {6, 10}, {6, 17}, {12, 17}, {7, 17}, {7, 10},
+    {12, 18}, {7, 12}, {10, 18}, {12, 20}, {10, 20}, {10, 12}
+  };
+};
+
+/**
+ * @brief Scalar operations used by the selection networks
+ *
+ * Used for the types without SIMD min/max and for the rows shorter than a vector.
+ */
+template <typename T>
+struct ScalarOps {
+  using vec = T;
+  static constexpr int kLanes = 1;
+  static DALI_FORCEINLINE vec load(const T *src) { return *src; }
+  static DALI_FORCEINLINE void store(T *dst, vec v) { *dst = v; }
+  static DALI_FORCEINLINE vec min(vec a, vec b) { return b < a ? b : a; }
+  static DALI_FORCEINLINE vec max(vec a, vec b) { return b < a ? a : b; }
+};
+
+/**
+ * @brief Vector operations used by the selection networks
+ *
+ * The compare-exchange operations are carried out as SIMD min/max, without branches.
+ */
+template <typename T>
+struct VecOps : ScalarOps<T> {};
+
+#ifdef __SSE2__
+
+template <>
+struct VecOps<uint8_t> {
+  using vec = __m128i;
+  static constexpr int kLanes = 16;
+  static DALI_FORCEINLINE vec load(const uint8_t *src) {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+  }
+  static DALI_FORCEINLINE void store(uint8_t *dst, vec v) {
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), v);
+  }
+  static DALI_FORCEINLINE vec min(vec a, vec b) { return _mm_min_epu8(a, b); }
+  static DALI_FORCEINLINE vec max(vec a, vec b) { return _mm_max_epu8(a, b); }
+};
+
+template <>
+struct VecOps<int16_t> {
+  using vec = __m128i;
+  static constexpr int kLanes = 8;
+  static DALI_FORCEINLINE vec load(const int16_t *src) {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+  }
+  static DALI_FORCEINLINE void store(int16_t *dst, vec v) {
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), v);
+  }
+  static DALI_FORCEINLINE vec min(vec a, vec b) { return _mm_min_epi16(a, b); }
+  static DALI_FORCEINLINE vec max(vec a, vec b) { return _mm_max_epi16(a, b); }
+};
+
+/**
+ * SSE2 has no unsigned 16-bit min/max - the values are biased to signed range when loaded
+ * and restored when stored.
+ */
+template <>
+struct VecOps<uint16_t> : VecOps<int16_t> {
+  static DALI_FORCEINLINE vec load(const uint16_t *src) {
+    return _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(src)),
+                         _mm_set1_epi16(-0x8000));
+  }
+  static DALI_FORCEINLINE void store(uint16_t *dst, vec v) {
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), _mm_xor_si128(v, _mm_set1_epi16(-0x8000)));
+  }
+};
+
+template <>
+struct VecOps<float> {
+  using vec = __m128;
+  static constexpr int kLanes = 4;
+  static DALI_FORCEINLINE vec load(const float *src) { return _mm_loadu_ps(src); }
+  static DALI_FORCEINLINE void store(float *dst, vec v) { _mm_storeu_ps(dst, v); }
+  static DALI_FORCEINLINE vec min(vec a, vec b) { return _mm_min_ps(a, b); }
+  static DALI_FORCEINLINE vec max(vec a, vec b) { return _mm_max_ps(a, b); }
+};
+
+#endif  // __SSE2__
+
+template <typename Ops, int a, int b, typename V>
+DALI_FORCEINLINE void compare_exchange(V *v) {
+  V lo = Ops::min(v[a], v[b]);
+  v[b] = Ops::max(v[a], v[b]);
+  v[a] = lo;
+}
+
+/**
+ * @brief Applies the compare-exchange operations of the network
+ *
+ * The indices are compile-time constants, so the vectors can be kept in registers.
+ */
+template <typename Network, typename Ops, typename V, size_t... pair>
+DALI_FORCEINLINE void apply_network(V *v, std::index_sequence<pair...>) {
+  (compare_exchange<Ops, Network::kPairs[pair][0], Network::kPairs[pair][1]>(v), ...);
+}
+
+/**
+ * @brief Calculates `Ops::kLanes` consecutive medians, starting at offset `i` in the row
+ *
+ * Each element of the window is loaded directly from the padded rows as a vector of the
+ * corresponding elements of `kLanes` consecutive windows.
+ */
+template <typename Network, int kw, typename Ops, typename T>
+DALI_FORCEINLINE void network_median(T *out, const T *const *rows, int64_t i, int64_t channels) {
+  constexpr int kh = Network::kSize / kw;
+  typename Ops::vec v[Network::kSize];
+  for (int j = 0; j < kh; j++)
+    for (int dx = 0; dx < kw; dx++)
+      v[j * kw + dx] = Ops::load(rows[j] + i + dx * channels);
+  apply_network<Network, Ops>(v, std::make_index_sequence<std::size(Network::kPairs)>());
+  Ops::store(out + i, v[Network::kMedian]);
+}
+
+/**
+ * @brief Calculates the medians of a row with a selection network
+ *
+ * The outputs are calculated in vectors; the last vector overlaps the previous one
+ * instead of reading past the end of the padded rows.
+ *
+ * @param rows     `kh` padded input rows
+ * @param row_len  number of elements in the output row
+ * @param channels distance between horizontally adjacent elements of the window
+ */
+template <typename Network, int kw, typename T>
+void network_median_row(T *out, const T *const *rows, int64_t row_len, int64_t channels) {
+  using Ops = VecOps<T>;
+  constexpr int L = Ops::kLanes;
+  if (row_len < L) {
+    for (int64_t i = 0; i < row_len; i++)
+      network_median<Network, kw, ScalarOps<T>>(out, rows, i, channels);
+    return;
+  }
+  int64_t i = 0;
+  for (; i + L <= row_len; i += L)
+    network_median<Network, kw, Ops>(out, rows, i, channels);
+  if (i < row_len)
+    network_median<Network, kw, Ops>(out, rows, row_len - L, channels);
+}
+
+/**
+ * @brief 16 bins of a histogram, kept in registers when possible
+ */
+struct HistogramBins {
+  using count_t = uint16_t;
+
+#ifdef __SSE2__
+  __m128i lo, hi;
+
+  static DALI_FORCEINLINE HistogramBins zero() {
+    return { _mm_setzero_si128(), _mm_setzero_si128() };
+  }
+
+  static DALI_FORCEINLINE HistogramBins load(const count_t *h) {
+    return { _mm_loadu_si128(reinterpret_cast<const __m128i *>(h)),
+             _mm_loadu_si128(reinterpret_cast<const __m128i *>(h + 8)) };
+  }
+
+  DALI_FORCEINLINE void store(count_t *h) const {
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(h), lo);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(h + 8), hi);
+  }
+
+  DALI_FORCEINLINE HistogramBins &operator+=(const HistogramBins &b) {
+    lo = _mm_add_epi16(lo, b.lo);
+    hi = _mm_add_epi16(hi, b.hi);
+    return *this;
+  }
+
+  DALI_FORCEINLINE HistogramBins &operator-=(const HistogramBins &b) {
+    lo = _mm_sub_epi16(lo, b.lo);
+    hi = _mm_sub_epi16(hi, b.hi);
+    return *this;
+  }
+
+  /**
+   * @brief Finds the bin which contains the element of given rank
+   *
+   * On return, `rank` is the rank of that element within the bin. The counts must not
+   * exceed 0x7fff.
+   */
+  DALI_FORCEINLINE int select(int &rank) const {
+    // inclusive prefix sums of the two halves, then of the whole
+    __m128i l = _mm_add_epi16(lo, _mm_slli_si128(lo, 2));
+    __m128i h = _mm_add_epi16(hi, _mm_slli_si128(hi, 2));
+    l = _mm_add_epi16(l, _mm_slli_si128(l, 4));
+    h = _mm_add_epi16(h, _mm_slli_si128(h, 4));
+    l = _mm_add_epi16(l, _mm_slli_si128(l, 8));
+    h = _mm_add_epi16(h, _mm_slli_si128(h, 8));
+    h = _mm_add_epi16(h, _mm_shuffle_epi32(_mm_shufflehi_epi16(l, 0xff), 0xff));
+    // the bin is the number of prefix sums not greater than the rank
+    __m128i r = _mm_set1_epi16(rank);
+    __m128i gt_lo = _mm_cmpgt_epi16(l, r);
+    __m128i gt_hi = _mm_cmpgt_epi16(h, r);
+    int mask = _mm_movemask_epi8(gt_lo) | (_mm_movemask_epi8(gt_hi) << 16);
+    // the prefix sum before the bin is the largest one not greater than the rank
+    __m128i below = _mm_max_epi16(_mm_andnot_si128(gt_lo, l), _mm_andnot_si128(gt_hi, h));
+    below = _mm_max_epi16(below, _mm_shuffle_epi32(below, _MM_SHUFFLE(1, 0, 3, 2)));
+    below = _mm_max_epi16(below, _mm_shuffle_epi32(below, _MM_SHUFFLE(2, 3, 0, 1)));
+    below = _mm_max_epi16(below, _mm_shufflelo_epi16(below, _MM_SHUFFLE(2, 3, 0, 1)));
+    rank -= _mm_extract_epi16(below, 0);
+    return __builtin_ctz(mask) >> 1;
+  }
+#else
+  count_t v[16];
+
+  static HistogramBins zero() {
+    return {};
+  }
+
+  static HistogramBins load(const count_t *h) {
+    HistogramBins b;
+    std::copy(h, h + 16, b.v);
+    return b;
+  }
+
+  void store(count_t *h) const {
+    std::copy(v, v + 16, h);
+  }
+
+  HistogramBins &operator+=(const HistogramBins &b) {
+    for (int i = 0; i < 16; i++)
+      v[i] += b.v[i];
+    return *this;
+  }
+
+  HistogramBins &operator-=(const HistogramBins &b) {
+    for (int i = 0; i < 16; i++)
+      v[i] -= b.v[i];
+    return *this;
+  }
+
+  int select(int &rank) const {
+    int bin = 0;
+    while (v[bin] <= rank)
+      rank -= v[bin++];
+    return bin;
+  }
+#endif
+};
+
+/**
+ * @brief Calculates the medians of 8-bit values with histograms, in constant time per output
+ *
+ * This is the algorithm of S. Perreault and P. Hebert, "Median Filtering in Constant Time".
+ * Each column of the padded rows has a histogram of the `kh` values in the window rows;
+ * when the window moves down, these histograms are updated with one value leaving and one
+ * entering. The window histogram is the sum of `kw` column histograms - when the window
+ * moves right, one column histogram is added and one subtracted.
+ *
+ * The histograms are split into 16 coarse bins (the high nibble) and 16x16 fine bins.
+ * The coarse window histogram is kept up to date; a fine part (16 bins) is only updated
+ * when the median falls into its coarse bin, so the cost of a fine update is amortized
+ * over the outputs since it was last used.
+ *
+ * The column histograms take 544 bytes per column and channel, so the rows should be
+ * processed in strips narrow enough for the histograms to stay in the cache.
+ */
+class HistogramMedian {
+ public:
+  using count_t = HistogramBins::count_t;
+
+  /// The largest window area for which the counts can be compared as signed 16-bit numbers
+  static constexpr int kMaxArea = 0x7fff;
+
+  /**
+   * @param max_width maximum number of columns (pixels) - the width of the strip, including
+   *                  the `kw - 1` columns of the window margin
+   */
+  HistogramMedian(int64_t max_width, int64_t channels, int kw, int kh)
+  : stride_(max_width), C_(channels), kw_(kw), target_(kw * kh / 2),
+    col_coarse_(channels * max_width * kBins),
+    col_fine_(channels * kBins * max_width * kBins) {
+    assert(kw * kh <= kMaxArea);
+  }
+
+  /**
+   * @brief Empties the column histograms and sets the number of columns used
+   */
+  void Reset(int64_t width) {
+    assert(width <= stride_);
+    width_ = width;
+    std::fill(col_coarse_.begin(), col_coarse_.end(), 0);
+    std::fill(col_fine_.begin(), col_fine_.end(), 0);
+  }
+
+  /**
+   * @brief Adds a row of `width * channels` interleaved values to the column histograms
+   */
+  void AddRow(const uint8_t *row) {
+    UpdateColumns(row, 1);
+  }
+
+  /**
+   * @brief Removes a row, previously added with AddRow, from the column histograms
+   */
+  void RemoveRow(const uint8_t *row) {
+    UpdateColumns(row, -1);
+  }
+
+  /**
+   * @brief Calculates `width - kw + 1` pixels of medians of the rows in the histograms
+   */
+  void Row(uint8_t *out) {
+    int64_t W = width_ - kw_ + 1;
+    for (int64_t c = 0; c < C_; c++) {
+      auto coarse = HistogramBins::zero();
+      for (int dx = 0; dx < kw_; dx++)
+        coarse += column_coarse(c, dx);
+      for (int k = 0; k < kBins; k++)
+        fine_pos_[k] = -kw_;  // no overlap with any window - recalculated when first used
+
+      for (int64_t x = 0; x < W; x++) {
+        if (x > 0) {
+          coarse += column_coarse(c, x + kw_ - 1);
+          coarse -= column_coarse(c, x - 1);
+        }
+        int rank = target_;
+        int k = coarse.select(rank);
+        int f = UpdateFine(c, k, x).select(rank);
+        out[x * C_ + c] = k * kBins + f;
+      }
+    }
+  }
+
+ private:
+  static constexpr int kBins = 16;
+
+  void UpdateColumns(const uint8_t *row, int delta) {
+    for (int64_t x = 0; x < width_; x++) {
+      for (int64_t c = 0; c < C_; c++) {
+        uint8_t v = row[x * C_ + c];
+        int k = v >> 4;
+        col_coarse_[(c * stride_ + x) * kBins + k] += delta;
+        col_fine_[((c * kBins + k) * stride_ + x) * kBins + (v & 15)] += delta;
+      }
+    }
+  }
+
+  DALI_FORCEINLINE HistogramBins column_coarse(int64_t c, int64_t x) const {
+    return HistogramBins::load(&col_coarse_[(c * stride_ + x) * kBins]);
+  }
+
+  /// The fine histograms of the coarse bin `k` are contiguous for consecutive columns
+  DALI_FORCEINLINE HistogramBins column_fine(int64_t c, int k, int64_t x) const {
+    return HistogramBins::load(&col_fine_[((c * kBins + k) * stride_ + x) * kBins]);
+  }
+
+  /**
+   * @brief Brings the fine histogram of coarse bin `k` to the window at `x`
+   *
+   * The histogram is either moved from the window where it was last updated or, if that's
+   * cheaper, summed from scratch.
+   */
+  DALI_FORCEINLINE HistogramBins UpdateFine(int64_t c, int k, int64_t x) {
+    int64_t last = fine_pos_[k];
+    HistogramBins fine;
+    if (2 * (x - last) >= kw_) {
+      fine = HistogramBins::zero();
+      for (int dx = 0; dx < kw_; dx++)
+        fine += column_fine(c, k, x + dx);
+    } else {
+      fine = HistogramBins::load(fine_[k]);
+      for (int64_t px = last; px < x; px++) {
+        fine += column_fine(c, k, px + kw_);
+        fine -= column_fine(c, k, px);
+      }
+    }
+    fine.store(fine_[k]);
+    fine_pos_[k] = x;
+    return fine;
+  }
+
+  int64_t stride_, C_;
+  int kw_;
+  int target_;
+  int64_t width_ = 0;
+  std::vector<count_t> col_coarse_, col_fine_;
+  count_t fine_[kBins][kBins];
+  int64_t fine_pos_[kBins];
+};
+
+/**
+ * @brief Calculates the medians of a row of 8-bit values with a sliding histogram
+ *
+ * This is Huang's algorithm: when the window moves by one pixel, a column leaves the
+ * histogram and another one enters it. The median is tracked along with the number of
+ * elements in the window that are smaller than the median, so it only moves by as many bins
+ * as the updates require. The cost per output is proportional to the window height.
+ */
+inline void histogram_median_row(uint8_t *out, const uint8_t *const *rows, int64_t W,
+                                 int64_t C, int kw, int kh) {
+  const int target = kw * kh / 2;
+  int hist[256];
+  for (int64_t c = 0; c < C; c++) {
+    std::fill(std::begin(hist), std::end(hist), 0);
+    for (int j = 0; j < kh; j++)
+      for (int dx = 0; dx < kw; dx++)
+        hist[rows[j][dx * C + c]]++;
+    int med = 0, lt = 0;  // lt is the number of elements smaller than med
+    for (;;) {
+      if (lt + hist[med] > target)
+        break;
+      lt += hist[med++];
+    }
+    out[c] = med;
+    for (int64_t x = 1; x < W; x++) {
+      int64_t removed = (x - 1) * C + c;
+      int64_t added = (x + kw - 1) * C + c;
+      for (int j = 0; j < kh; j++) {
+        uint8_t r = rows[j][removed], a = rows[j][added];
+        hist[r]--;
+        hist[a]++;
+        lt += (a < med) - (r < med);
+      }
+      while (lt > target)
+        lt -= hist[--med];
+      while (lt + hist[med] <= target)
+        lt += hist[med++];
+      out[x * C + c] = med;
+    }
+  }
+}
+
+/**
+ * @brief Calculates the medians of a row by partial sorting of each window
+ */
+template <typename T>
+void select_median_row(T *out, const T *const *rows, int64_t W, int64_t C, int kw, int kh,
+                       std::vector<T> &window) {
+  int n = kw * kh;
+  window.resize(n);
+  for (int64_t x = 0; x < W; x++) {
+    for (int64_t c = 0; c < C; c++) {
+      int k = 0;
+      for (int j = 0; j < kh; j++)
+        for (int dx = 0; dx < kw; dx++)
+          window[k++] = rows[j][(x + dx) * C + c];
+      std::nth_element(window.begin(), window.begin() + n / 2, window.end());
+      out[x * C + c] = window[n / 2];
+    }
+  }
+}
+
+}  // namespace median
+
+/**
+ * @brief Replaces each pixel with the median of a rectangular window centered at it
+ *
+ * The input and output are HWC images. The window dimensions must be odd and the pixels
+ * outside of the image are replicated from the nearest edge.
+ *
+ * 3x3 and 5x5 windows use SIMD selection networks vectorized across the outputs. Larger
+ * windows use sliding histograms for 8-bit data - Huang's algorithm for short windows and
+ * the constant-time algorithm of Perreault and Hebert for tall ones - and partial sorting
+ * for other types.
+ */
+template <typename T>
+class MedianBlurCPU {
+ public:
+  KernelRequirements Setup(KernelContext &ctx, const InTensorCPU<T, 3> &in) {
+    KernelRequirements req;
+    req.output_shapes = { TensorListShape<3>({ in.shape }) };
+    return req;
+  }
+
+  /**
+   * @param window_size size of the window (width, height)
+   */
+  void Run(KernelContext &ctx, const OutTensorCPU<T, 3> &out, const InTensorCPU<T, 3> &in,
+           ivec2 window_size) {
+    SequentialExecutionEngine engine;
+    Schedule(engine, ctx, out, in, window_size);
+  }
+
+  /**
+   * @brief Adds the work to the execution engine
+   *
+   * Large images are split into bands of rows, which can be processed by multiple threads.
+   * The work is not run - the caller is responsible for calling `engine.RunAll()`.
+   *
+   * @param req_nblocks requested number of bands; by default, `kBandsPerThread` per thread
+   */
+  template <typename ExecutionEngine>
+  void Schedule(ExecutionEngine &engine, KernelContext &ctx,
+                const OutTensorCPU<T, 3> &out, const InTensorCPU<T, 3> &in,
+                ivec2 window_size, int req_nblocks = -1) {
+    DALI_ENFORCE(out.shape == in.shape, "Output and input shapes must match");
+    DALI_ENFORCE(window_size.x >= 1 && window_size.y >= 1 &&
+                 window_size.x % 2 == 1 && window_size.y % 2 == 1,
+                 make_string("The window size must be positive and odd, got ", window_size));
+
+    int64_t row_len = in.shape[1] * in.shape[2];
+    if (row_len == 0)
+      return;
+    // the cost per element grows with the window area, so small images are split, too
+    int64_t row_cost = row_len * std::min(window_size.x * window_size.y, 25);
+    // each band starts by filling the window rows above it
+    int halo = window_size.y / 2;
+    ScheduleBands(engine, in.shape[0], row_cost, [=](Band rows) {
+      RunRows(out, in, window_size, rows.begin, rows.end);
+    }, halo, req_nblocks, kMinBlockCost);
+  }
+
+ private:
+  /// Work smaller than that (in element-window products) is not split between threads
+  static constexpr int64_t kMinBlockCost = 1 << 20;
+
+  /**
+   * @brief Whether to use the constant-time HistogramMedian rather than Huang's algorithm
+   */
+  static bool UseHistogramMedian(int kw, int kh) {
+    return kw * kh <= median::HistogramMedian::kMaxArea && kh >= kMinHistogramMedianHeight;
+  }
+
+  static bool IsNetworkWindow(int kw, int kh) {
+    return (kw == 3 && kh == 3) || (kw == 5 && kh == 5);
+  }
+
+  /**
+   * Huang's algorithm is faster for short windows, where its per-output cost is lower;
+   * with a 1080p RGB image, the two break even at a window height of about 13.
+   */
+  static constexpr int kMinHistogramMedianHeight = 13;
+
+  /// The number of columns times channels processed at once with HistogramMedian
+  static constexpr int64_t kHistogramStripSize = 512;
+
+  static void RunRows(const OutTensorCPU<T, 3> &out, const InTensorCPU<T, 3> &in,
+                      ivec2 window_size, int64_t y0, int64_t y1) {
+    using namespace median;  // NOLINT
+    int64_t H = in.shape[0], W = in.shape[1], C = in.shape[2];
+    int64_t row_len = W * C;
+    int kw = window_size.x, kh = window_size.y;
+    int rx = kw / 2, ry = kh / 2;
+
+    if (kw == 1 && kh == 1) {
+      std::copy(in.data + y0 * row_len, in.data + y1 * row_len, out.data + y0 * row_len);
+      return;
+    }
+
+    if constexpr (std::is_same<T, uint8_t>::value) {
+      if (!IsNetworkWindow(kw, kh) && UseHistogramMedian(kw, kh)) {
+        RunRowsHistogram(out, in, kw, kh, y0, y1);
+        return;
+      }
+    }
+
+    // The input rows padded with the replicated border are kept in a ring of `kh` rows;
+    // the padded row for window position `p` is at `p % kh`.
+    int64_t padded_len = (W + kw - 1) * C;
+    std::vector<T> ring(kh * padded_len);
+    auto pad_row = [&](int64_t p) {
+      const T *src = in.data + boundary::idx_clamp<int64_t>(y0 - ry + p, 0, H) * row_len;
+      T *dst = ring.data() + (p % kh) * padded_len;
+      for (int64_t px = 0; px < rx; px++)
+        std::copy(src, src + C, dst + px * C);
+      std::copy(src, src + row_len, dst + rx * C);
+      for (int64_t px = rx + W; px < W + kw - 1; px++)
+        std::copy(src + row_len - C, src + row_len, dst + px * C);
+    };
+    for (int p = 0; p < kh - 1; p++)
+      pad_row(p);
+
+    std::vector<const T *> rows(kh);
+    std::vector<T> window;
+    for (int64_t y = y0; y < y1; y++) {
+      int64_t p0 = y - y0;
+      pad_row(p0 + kh - 1);
+      for (int j = 0; j < kh; j++)
+        rows[j] = ring.data() + ((p0 + j) % kh) * padded_len;
+      T *dst = out.data + y * row_len;
+      if (kw == 3 && kh == 3) {
+        network_median_row<Network3x3, 3>(dst, rows.data(), row_len, C);
+      } else if (kw == 5 && kh == 5) {
+        network_median_row<Network5x5, 5>(dst, rows.data(), row_len, C);
+      } else if constexpr (std::is_same<T, uint8_t>::value) {
+        histogram_median_row(dst, rows.data(), W, C, kw, kh);
+      } else {
+        select_median_row(dst, rows.data(), W, C, kw, kh, window);
+      }
+    }
+  }
+
+  /**
+   * @brief Calculates the medians with HistogramMedian
+   *
+   * The column histograms of a whole row wouldn't fit in the cache, so the rows are processed
+   * in vertical strips, each with a margin of `kw - 1` columns. The rows of the strips are
+   * read directly from the input - only the strips at the edges are padded.
+   */
+  static void RunRowsHistogram(const OutTensorCPU<T, 3> &out, const InTensorCPU<T, 3> &in,
+                               int kw, int kh, int64_t y0, int64_t y1) {
+    int64_t H = in.shape[0], W = in.shape[1], C = in.shape[2];
+    int64_t row_len = W * C;
+    int rx = kw / 2, ry = kh / 2;
+    int64_t strip = std::max<int64_t>(kHistogramStripSize / C - (kw - 1), 16);
+    strip = std::min(strip, W);
+    median::HistogramMedian hist(strip + kw - 1, C, kw, kh);
+    std::vector<uint8_t> padded((strip + kw - 1) * C);
+    for (int64_t x0 = 0; x0 < W; x0 += strip) {
+      int64_t width = std::min(strip, W - x0) + kw - 1;
+      int64_t first_col = x0 - rx;
+      bool inside = first_col >= 0 && first_col + width <= W;
+      auto strip_row = [&](int64_t y) {
+        const uint8_t *src = in.data + boundary::idx_clamp<int64_t>(y, 0, H) * row_len;
+        if (inside)
+          return src + first_col * C;
+        for (int64_t px = 0; px < width; px++) {
+          const uint8_t *s = src + boundary::idx_clamp<int64_t>(first_col + px, 0, W) * C;
+          std::copy(s, s + C, &padded[px * C]);
+        }
+        return static_cast<const uint8_t *>(padded.data());
+      };
+      hist.Reset(width);
+      for (int j = 0; j < kh; j++)
+        hist.AddRow(strip_row(y0 - ry + j));
+      for (int64_t y = y0; y < y1; y++) {
+        if (y > y0) {
+          hist.RemoveRow(strip_row(y - ry - 1));
+          hist.AddRow(strip_row(y + ry));
+        }
+        hist.Row(out.data + y * row_len + x0 * C);
+      }
+    }
+  }
+};
+
+}  // namespace kernels
+}  // namespace dali
+
+#endif  // DALI_KERNELS_IMGPROC_FILTER_MEDIAN_BLUR_CPU_H_
@@ -0,0 +1,127 @@
+// Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
+#include <vector>
+#include "dali/core/exec/deferred_engine.h"
+#include "dali/core/tensor_shape_print.h"
+#include "dali/kernels/imgproc/filter/median_blur_cpu.h"
+
+namespace dali {
+namespace kernels {
+
+namespace {
+
+template <typename T>
+void RefMedianBlur(T *out, const T *in, int H, int W, int C, ivec2 window) {
+  std::vector<T> values;
+  for (int y = 0; y < H; y++) {
+    for (int x = 0; x < W; x++) {
+      for (int c = 0; c < C; c++) {
+        values.clear();
+        for (int j = 0; j < window.y; j++) {
+          int sy = std::clamp(y - window.y / 2 + j, 0, H - 1);
+          for (int i = 0; i < window.x; i++) {
+            int sx = std::clamp(x - window.x / 2 + i, 0, W - 1);
+            values.push_back(in[(sy * W + sx) * C + c]);
+          }
+        }
+        std::sort(values.begin(), values.end());
+        out[(y * W + x) * C + c] = values[values.size() / 2];
+      }
+    }
+  }
+}
+
+template <typename T>
+void TestMedianBlur(TensorShape<3> shape, ivec2 window, bool scheduled = false,
+                    int max_value = 255) {
+  std::mt19937_64 rng(1234);
+  std::uniform_int_distribution<int> dist(0, max_value);
+  int64_t n = volume(shape);
+  std::vector<T> in(n), out(n), ref(n);
+  for (auto &x : in)
+    x = dist(rng);
+  RefMedianBlur(ref.data(), in.data(), shape[0], shape[1], shape[2], window);
+
+  MedianBlurCPU<T> kernel;
+  KernelContext ctx;
+  auto in_view = make_tensor_cpu<3>(in.data(), shape);
+  auto out_view = make_tensor_cpu<3>(out.data(), shape);
+  kernel.Setup(ctx, in_view);
+  if (scheduled) {
+    DeferredEngine engine;
+    kernel.Schedule(engine, ctx, out_view, in_view, window, 7);
+    engine.RunAll();
+  } else {
+    kernel.Run(ctx, out_view, in_view, window);
+  }
+  for (int64_t i = 0; i < n; i++) {
+    ASSERT_EQ(out[i], ref[i]) << " at " << i << " shape " << shape << " window " << window;
+  }
+}
+
+}  // namespace
+
+TEST(MedianBlurCPU, Networks) {
+  for (ivec2 window : { ivec2(3, 3), ivec2(5, 5) }) {
+    TestMedianBlur<uint8_t>({ 37, 41, 3 }, window);
+    TestMedianBlur<uint8_t>({ 20, 150, 1 }, window, false, 3);  // many equal values
+    TestMedianBlur<int16_t>({ 29, 33, 2 }, window);
+    TestMedianBlur<uint16_t>({ 4, 70, 4 }, window);
+    TestMedianBlur<float>({ 31, 65, 1 }, window);
+  }
+}
+
+TEST(MedianBlurCPU, LargeWindows) {
+  for (ivec2 window : { ivec2(7, 7), ivec2(1, 9), ivec2(15, 3), ivec2(3, 15), ivec2(31, 31) }) {
+    TestMedianBlur<uint8_t>({ 37, 41, 3 }, window);
+    TestMedianBlur<uint8_t>({ 20, 50, 1 }, window, false, 3);
+    TestMedianBlur<float>({ 29, 33, 2 }, window);
+    TestMedianBlur<int16_t>({ 12, 20, 1 }, window);
+  }
+}
+
+TEST(MedianBlurCPU, ShortRows) {
+  // shorter than a SIMD vector
+  TestMedianBlur<uint8_t>({ 6, 5, 1 }, { 3, 3 });
+  TestMedianBlur<float>({ 7, 3, 1 }, { 5, 5 });
+  TestMedianBlur<uint16_t>({ 5, 2, 3 }, { 5, 5 }, false, 65535);
+}
+
+TEST(MedianBlurCPU, HistogramStrips) {
+  // multiple strips, with and without the margin inside of the image
+  TestMedianBlur<uint8_t>({ 20, 700, 3 }, { 15, 15 });
+  TestMedianBlur<uint8_t>({ 20, 1100, 1 }, { 13, 21 });
+  TestMedianBlur<uint8_t>({ 50, 600, 1 }, { 1, 31 }, false, 3);
+  TestMedianBlur<uint8_t>({ 300, 301, 3 }, { 15, 13 }, true);
+  // too large for 16-bit counts - falls back to Huang's algorithm
+  TestMedianBlur<uint8_t>({ 20, 30, 1 }, { 183, 183 });
+}
+
+TEST(MedianBlurCPU, Identity) {
+  TestMedianBlur<uint8_t>({ 10, 11, 3 }, { 1, 1 });
+  TestMedianBlur<float>({ 10, 11, 1 }, { 1, 1 }, true);
+}
+
+TEST(MedianBlurCPU, Scheduled) {
+  TestMedianBlur<uint8_t>({ 300, 301, 3 }, { 3, 3 }, true);
+  TestMedianBlur<uint8_t>({ 300, 301, 1 }, { 9, 9 }, true);
+  TestMedianBlur<float>({ 256, 256, 1 }, { 5, 5 }, true);
+}
+
+}  // namespace kernels
+}  // namespace dali
@@ -0,0 +1,567 @@
+// Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DALI_KERNELS_IMGPROC_GEOM_REMAP_CPU_H_
+#define DALI_KERNELS_IMGPROC_GEOM_REMAP_CPU_H_
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "dali/core/common.h"
+#include "dali/core/convert.h"
+#include "dali/core/error_handling.h"
+#include "dali/core/exec/engine.h"
+#include "dali/core/force_inline.h"
+#include "dali/core/geom/vec.h"
+#include "dali/core/static_switch.h"
+#include "dali/core/tensor_shape_print.h"
+#include "dali/core/tensor_view.h"
+#include "dali/kernels/common/tiling.h"
+#include "dali/kernels/kernel.h"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+namespace dali {
+namespace kernels {
+namespace remap {
+
+/// @brief Number of bits of the fractional part of the source coordinates
+constexpr int kFracBits = 5;
+constexpr int kFracScale = 1 << kFracBits;
+constexpr int kFracMask = kFracScale - 1;
+/// @brief Number of bits of the fixed-point bilinear weights; the 4 weights sum up to 1 << this
+constexpr int kWeightBits = 2 * kFracBits;
+
+/// @brief Largest image extent for which the source coordinates fit in int16
+constexpr int kMaxExtent = 32000;
+
+/**
+ * @brief Remap coordinates converted to a fixed-point form
+ *
+ * For each output pixel, the integer source coordinates are kept as a pair of int16 values
+ * (`xy`). For linear interpolation, the fractional parts are kept as `kFracBits` bits each,
+ * packed to a single index (`frac = fy * kFracScale + fx`) to a table of bilinear weights.
+ *
+ * The source coordinates are clamped to a range just outside of the image, so that
+ * the values are representable and the pixels outside are still recognized as such.
+ */
+struct FixedPointMap {
+  TensorShape<2> shape;  //!< height and width of the map (and the output)
+  DALIInterpType interp = DALI_INTERP_LINEAR;
+  std::vector<int16_t> xy;
+  std::vector<uint16_t> frac;
+};
+
+/**
+ * @brief Converts floating point maps to the fixed-point form
+ *
+ * @param shift    value added to the map coordinates; -0.5 for pixel corner origin
+ * @param in_size  size (width, height) of the images that will be remapped
+ */
+inline void ConvertMap(FixedPointMap &map, const float *mapx, const float *mapy,
+                       TensorShape<2> shape, ivec2 in_size, DALIInterpType interp,
+                       float shift = 0) {
+  DALI_ENFORCE(interp == DALI_INTERP_NN || interp == DALI_INTERP_LINEAR, make_string(
+      "Unsupported interpolation type: ", to_string(interp), ". The CPU remap supports "
+      "nearest neighbor and linear interpolation."));
+  DALI_ENFORCE(in_size.x <= kMaxExtent && in_size.y <= kMaxExtent, make_string(
+      "The CPU remap supports images with up to ", kMaxExtent, " pixels in each dimension."));
+  map.shape = shape;
+  map.interp = interp;
+  int64_t n = volume(shape);
+  map.xy.resize(2 * n);
+  map.frac.resize(interp == DALI_INTERP_LINEAR ? n : 0);
+
+  // Anything beyond this range is outside of the image - including interpolation.
+  // The negated comparisons also map NaNs to the lower bound.
+  float lo_x = -2, hi_x = in_size.x + 1;
+  float lo_y = -2, hi_y = in_size.y + 1;
+  auto clamp_nan = [](float v, float lo, float hi) {
+    return !(v >= lo) ? lo : !(v <= hi) ? hi : v;
+  };
+  int16_t *xy = map.xy.data();
+  if (interp == DALI_INTERP_NN) {
+    for (int64_t i = 0; i < n; i++) {
+      float x = clamp_nan(mapx[i] + shift, lo_x, hi_x);
+      float y = clamp_nan(mapy[i] + shift, lo_y, hi_y);
+      xy[2 * i] = std::lrint(x);
+      xy[2 * i + 1] = std::lrint(y);
+    }
+  } else {
+    uint16_t *frac = map.frac.data();
+    for (int64_t i = 0; i < n; i++) {
+      float x = clamp_nan(mapx[i] + shift, lo_x, hi_x);
+      float y = clamp_nan(mapy[i] + shift, lo_y, hi_y);
+      int fx = std::lrint(x * kFracScale);
+      int fy = std::lrint(y * kFracScale);
+      xy[2 * i] = fx >> kFracBits;
+      xy[2 * i + 1] = fy >> kFracBits;
+      frac[i] = (fy & kFracMask) * kFracScale + (fx & kFracMask);
+    }
+  }
+}
+
+/**
+ * @brief Bilinear weights for each value of the packed fractional part
+ *
+ * The weights are (top-left, top-right, bottom-left, bottom-right) and sum up to
+ * `1 << kWeightBits`.
+ */
+struct BilinearTable {
+  int16_t w[kFracScale * kFracScale][4];
+
+  BilinearTable() {
+    for (int fy = 0; fy < kFracScale; fy++) {
+      for (int fx = 0; fx < kFracScale; fx++) {
+        int16_t *e = w[fy * kFracScale + fx];
+        e[0] = (kFracScale - fx) * (kFracScale - fy);
+        e[1] = fx * (kFracScale - fy);
+        e[2] = (kFracScale - fx) * fy;
+        e[3] = fx * fy;
+      }
+    }
+  }
+
+  static const BilinearTable &instance() {
+    static const BilinearTable table;
+    return table;
+  }
+};
+
+/**
+ * @brief Calculates a 64-bit hash of the contents of a pair of maps
+ *
+ * The data is processed as 64-bit words in 4 independent lanes, so the hashing runs at
+ * close to memory bandwidth.
+ */
+inline uint64_t HashMaps(const float *mapx, const float *mapy, int64_t n) {
+  constexpr uint64_t kMul1 = 0x9e3779b97f4a7c15ull, kMul2 = 0xc2b2ae3d27d4eb4full;
+  auto mix = [](uint64_t h, uint64_t v) {
+    h = (h ^ v) * kMul1;
+    return h ^ (h >> 29);
+  };
+  uint64_t h = static_cast<uint64_t>(n) * kMul2;
+  for (const float *data : { mapx, mapy }) {
+    uint64_t lanes[4] = { 1, 2, 3, 4 };
+    int64_t bytes = n * sizeof(float);
+    auto *p = reinterpret_cast<const char *>(data);
+    int64_t i = 0;
+    for (; i + 32 <= bytes; i += 32) {
+      for (int l = 0; l < 4; l++) {
+        uint64_t v;
+        std::memcpy(&v, p + i + 8 * l, 8);
+        lanes[l] = mix(lanes[l], v);
+      }
+    }
+    for (; i < bytes; i += 4) {
+      uint32_t v;
+      std::memcpy(&v, p + i, 4);
+      lanes[0] = mix(lanes[0], v);
+    }
+    for (int l = 0; l < 4; l++)
+      h = mix(h, lanes[l]) * kMul2;
+  }
+  return h;
+}
+
+/**
+ * @brief Caches the fixed-point maps between iterations
+ *
+ * The maps are matched by a hash of their contents, so maps that don't change between
+ * iterations are converted only once, even if they are stored in a different buffer each
+ * time. Within a batch, the maps in the same buffers are matched without hashing.
+ *
+ * The total size of the cached maps is bounded - after each batch, the least recently used
+ * maps are evicted until the size is within the capacity. The maps used in the batch are
+ * never evicted, so a batch with many different maps temporarily exceeds the capacity.
+ */
+class FixedPointMapCache {
+ public:
+  static constexpr int64_t kDefaultCapacity = 256 << 20;
+
+  /**
+   * @param capacity  maximum total size, in bytes, of the maps kept between batches
+   */
+  explicit FixedPointMapCache(int64_t capacity = kDefaultCapacity) : capacity_(capacity) {}
+
+  /**
+   * @brief Starts a new batch
+   */
+  void BeginBatch() {
+    batch_++;
+  }
+
+  /**
+   * @brief Ends the batch and evicts the least recently used maps, if over capacity
+   */
+  void EndBatch() {
+    while (bytes_ > capacity_) {
+      auto lru = std::min_element(entries_.begin(), entries_.end(),
+                                  [](const Entry &a, const Entry &b) {
+                                    return a.last_used < b.last_used;
+                                  });
+      if (lru == entries_.end() || lru->last_used == batch_)
+        break;
+      bytes_ -= lru->bytes;
+      entries_.erase(lru);
+    }
+  }
+
+  /**
+   * @brief Returns the fixed-point map for the given floating point maps
+   *
+   * The returned pointer stays valid for as long as the caller keeps it.
+   */
+  std::shared_ptr<const FixedPointMap> Get(const float *mapx, const float *mapy,
+                                           TensorShape<2> shape, ivec2 in_size,
+                                           DALIInterpType interp, float shift) {
+    auto matches = [&](const Entry &e) {
+      return e.map->shape == shape && e.map->interp == interp && e.shift == shift &&
+             e.in_size == in_size;
+    };
+    // the buffers can't change within a batch
+    for (auto &e : entries_) {
+      if (e.last_used == batch_ && e.mapx_ptr == mapx && e.mapy_ptr == mapy && matches(e))
+        return e.map;
+    }
+    int64_t n = volume(shape);
+    uint64_t hash = HashMaps(mapx, mapy, n);
+    for (auto &e : entries_) {
+      if (e.hash == hash && matches(e)) {
+        if (e.last_used != batch_)
+          hits_++;
+        Use(e, mapx, mapy);
+        return e.map;
+      }
+    }
+    misses_++;
+    auto map = std::make_shared<FixedPointMap>();
+    ConvertMap(*map, mapx, mapy, shape, in_size, interp, shift);
+    Entry &e = entries_.emplace_back();
+    e.hash = hash;
+    e.in_size = in_size;
+    e.shift = shift;
+    e.bytes = map->xy.size() * sizeof(map->xy[0]) + map->frac.size() * sizeof(map->frac[0]);
+    bytes_ += e.bytes;
+    e.map = std::move(map);
+    Use(e, mapx, mapy);
+    return e.map;
+  }
+
+  /// @brief Number of maps that were reused from an earlier batch
+  int64_t hits() const { return hits_; }
+  /// @brief Number of maps that had to be converted
+  int64_t misses() const { return misses_; }
+  /// @brief Total size of the cached maps, in bytes
+  int64_t bytes() const { return bytes_; }
+
+ private:
+  struct Entry {
+    uint64_t hash = 0;
+    /// the buffers the map was last obtained from; only valid in the batch `last_used`
+    const float *mapx_ptr = nullptr, *mapy_ptr = nullptr;
+    int64_t last_used = 0;
+    ivec2 in_size;
+    float shift = 0;
+    int64_t bytes = 0;
+    std::shared_ptr<const FixedPointMap> map;
+  };
+
+  void Use(Entry &e, const float *mapx, const float *mapy) {
+    e.mapx_ptr = mapx;
+    e.mapy_ptr = mapy;
+    e.last_used = batch_;
+  }
+
+  std::vector<Entry> entries_;
+  int64_t capacity_;
+  int64_t bytes_ = 0;
+  int64_t batch_ = 0;
+  int64_t hits_ = 0, misses_ = 0;
+};
+
+template <typename T>
+DALI_FORCEINLINE T bilinear_fixed(const int16_t *w, T p00, T p01, T p10, T p11) {
+  if constexpr (std::is_integral<T>::value) {
+    int64_t acc = static_cast<int64_t>(p00) * w[0] + static_cast<int64_t>(p01) * w[1] +
+                  static_cast<int64_t>(p10) * w[2] + static_cast<int64_t>(p11) * w[3];
+    // round half up; the result is within the range of the inputs
+    return (acc + (1 << (kWeightBits - 1))) >> kWeightBits;
+  } else {
+    constexpr float scale = 1.0f / (1 << kWeightBits);
+    return (p00 * w[0] + p01 * w[1] + p10 * w[2] + p11 * w[3]) * scale;
+  }
+}
+
+/**
+ * @brief Remaps the output rows `[y0, y1)` with nearest neighbor interpolation
+ *
+ * The source pixels outside of the image are zero.
+ *
+ * @tparam static_channels the number of channels, if known at compile time, or -1
+ */
+template <int static_channels, typename T>
+void RemapRowsNNImpl(T *out, const T *in, int64_t W, int64_t H, int64_t C,
+                     const FixedPointMap &map, int64_t y0, int64_t y1) {
+  const int64_t nch = static_channels > 0 ? static_channels : C;
+  int64_t out_w = map.shape[1];
+  for (int64_t y = y0; y < y1; y++) {
+    const int16_t *xy = map.xy.data() + 2 * y * out_w;
+    T *out_row = out + y * out_w * nch;
+    for (int64_t x = 0; x < out_w; x++) {
+      int sx = xy[2 * x], sy = xy[2 * x + 1];
+      T *o = out_row + x * nch;
+      if (sx >= 0 && sx < W && sy >= 0 && sy < H) {
+        std::memcpy(o, in + (sy * W + sx) * nch, nch * sizeof(T));
+      } else {
+        std::memset(o, 0, nch * sizeof(T));
+      }
+    }
+  }
+}
+
+#ifdef __SSE2__
+/**
+ * @brief Interpolates 4 consecutive single-channel output pixels, whose source pixels are all
+ *        inside the image
+ *
+ * The source values are gathered as pairs of horizontal neighbors and multiplied by pairs of
+ * weights, so that `_mm_madd_epi16` calculates two of the four products at once.
+ */
+DALI_FORCEINLINE void RemapLinear4(uint8_t *out, const uint8_t *in, int64_t row_stride,
+                                   const int16_t *xy, const uint16_t *frac) {
+  const auto &table = BilinearTable::instance();
+  uint16_t t[4], b[4];
+  for (int l = 0; l < 4; l++) {
+    const uint8_t *p = in + xy[2 * l + 1] * row_stride + xy[2 * l];
+    std::memcpy(&t[l], p, 2);
+    std::memcpy(&b[l], p + row_stride, 2);
+  }
+  // each weight entry is (top-left, top-right, bottom-left, bottom-right) - the top and bottom
+  // pairs are separated by shuffling 32-bit lanes
+  auto load_w = [&](int l) {
+    return _mm_loadl_epi64(reinterpret_cast<const __m128i *>(table.w[frac[l]]));
+  };
+  __m128 w01 = _mm_castsi128_ps(_mm_unpacklo_epi64(load_w(0), load_w(1)));
+  __m128 w23 = _mm_castsi128_ps(_mm_unpacklo_epi64(load_w(2), load_w(3)));
+  __m128i wt = _mm_castps_si128(_mm_shuffle_ps(w01, w23, _MM_SHUFFLE(2, 0, 2, 0)));
+  __m128i wb = _mm_castps_si128(_mm_shuffle_ps(w01, w23, _MM_SHUFFLE(3, 1, 3, 1)));
+  const __m128i zero = _mm_setzero_si128();
+  __m128i pt = _mm_unpacklo_epi8(_mm_setr_epi16(t[0], t[1], t[2], t[3], 0, 0, 0, 0), zero);
+  __m128i pb = _mm_unpacklo_epi8(_mm_setr_epi16(b[0], b[1], b[2], b[3], 0, 0, 0, 0), zero);
+  __m128i acc = _mm_add_epi32(_mm_madd_epi16(pt, wt), _mm_madd_epi16(pb, wb));
+  acc = _mm_srli_epi32(_mm_add_epi32(acc, _mm_set1_epi32(1 << (kWeightBits - 1))), kWeightBits);
+  acc = _mm_packs_epi32(acc, acc);
+  uint32_t res = _mm_cvtsi128_si32(_mm_packus_epi16(acc, acc));
+  std::memcpy(out, &res, 4);
+}
+
+DALI_FORCEINLINE __m128i load_u8x4(const uint8_t *p) {
+  uint32_t v;
+  std::memcpy(&v, p, 4);
+  return _mm_cvtsi32_si128(v);
+}
+
+/**
+ * @brief Interpolates all channels of one output pixel, whose source pixels are inside the image
+ *
+ * The channels are processed in groups of 4. The left and right neighbors are interleaved, so
+ * that `_mm_madd_epi16` calculates the horizontal interpolation of the top and bottom rows.
+ *
+ * Each group is read with a full 4-byte load (partial loads are much slower), so up to 3 bytes
+ * past the bottom-right source pixel are read - see `linear_pixel_overread`.
+ */
+/// @brief The number of bytes read by `RemapLinearPixel` past its bottom-right source pixel
+inline int64_t linear_pixel_overread(int64_t C) {
+  return 4 - (C - 1) % 4 - 1;
+}
+
+template <int static_channels>
+DALI_FORCEINLINE void RemapLinearPixel(uint8_t *out, const uint8_t *p, int64_t row_stride,
+                                       int64_t C, const int16_t *w) {
+  const int64_t nch = static_channels > 0 ? static_channels : C;
+  const __m128i zero = _mm_setzero_si128();
+  __m128i wt = _mm_set1_epi32(static_cast<uint16_t>(w[0]) | (static_cast<uint32_t>(w[1]) << 16));
+  __m128i wb = _mm_set1_epi32(static_cast<uint16_t>(w[2]) | (static_cast<uint32_t>(w[3]) << 16));
+  for (int64_t c = 0; c < nch; c += 4) {
+    int n = std::min<int64_t>(nch - c, 4);
+    const uint8_t *t = p + c, *b = p + c + row_stride;
+    __m128i pt = _mm_unpacklo_epi8(_mm_unpacklo_epi8(load_u8x4(t), load_u8x4(t + nch)), zero);
+    __m128i pb = _mm_unpacklo_epi8(_mm_unpacklo_epi8(load_u8x4(b), load_u8x4(b + nch)), zero);
+    __m128i acc = _mm_add_epi32(_mm_madd_epi16(pt, wt), _mm_madd_epi16(pb, wb));
+    acc = _mm_srli_epi32(_mm_add_epi32(acc, _mm_set1_epi32(1 << (kWeightBits - 1))),
+                         kWeightBits);
+    acc = _mm_packs_epi32(acc, acc);
+    uint32_t res = _mm_cvtsi128_si32(_mm_packus_epi16(acc, acc));
+    std::memcpy(out + c, &res, n);
+  }
+}
+#endif
+
+/**
+ * @brief Remaps the output rows `[y0, y1)` with linear interpolation
+ *
+ * The pixels for which all 4 source pixels are inside of the image are processed without any
+ * border handling; for 8-bit data, they are interpolated with SSE2 - all channels at once or,
+ * for single-channel images, 4 pixels at once.
+ * The source pixels outside of the image are zero.
+ *
+ * @tparam static_channels the number of channels, if known at compile time, or -1
+ */
+template <int static_channels, typename T>
+void RemapRowsLinearImpl(T *out, const T *in, int64_t W, int64_t H, int64_t C,
+                         const FixedPointMap &map, int64_t y0, int64_t y1) {
+  const int64_t nch = static_channels > 0 ? static_channels : C;
+  const auto &table = BilinearTable::instance();
+  int64_t out_w = map.shape[1];
+  int64_t row_stride = W * nch;
+  auto inside = [&](int x, int y) {
+    return static_cast<uint64_t>(x) < static_cast<uint64_t>(W - 1) &&
+           static_cast<uint64_t>(y) < static_cast<uint64_t>(H - 1);
+  };
+#ifdef __SSE2__
+  // the offset of the last top-left source pixel which can be processed without reading past
+  // the end of the input
+  const int64_t simd_end = (H - 1) * row_stride - 2 * nch - linear_pixel_overread(nch);
+#endif
+  for (int64_t y = y0; y < y1; y++) {
+    const int16_t *xy = map.xy.data() + 2 * y * out_w;
+    const uint16_t *frac = map.frac.data() + y * out_w;
+    T *out_row = out + y * out_w * nch;
+    for (int64_t x = 0; x < out_w; x++) {
+      int sx = xy[2 * x], sy = xy[2 * x + 1];
+      const int16_t *w = table.w[frac[x]];
+      const T *p = in + sy * row_stride + sx * nch;
+      T *o = out_row + x * nch;
+#ifdef __SSE2__
+      if constexpr (std::is_same<T, uint8_t>::value) {
+        if (static_channels == 1) {
+          const int16_t *c = xy + 2 * x;
+          if (x + 4 <= out_w && inside(c[0], c[1]) && inside(c[2], c[3]) &&
+              inside(c[4], c[5]) && inside(c[6], c[7])) {
+            RemapLinear4(o, in, row_stride, c, frac + x);
+            x += 3;
+            continue;
+          }
+        } else if (inside(sx, sy) && p - in <= simd_end) {
+          RemapLinearPixel<static_channels>(o, p, row_stride, nch, w);
+          continue;
+        }
+      }
+#endif
+      if (inside(sx, sy)) {
+        for (int64_t ch = 0; ch < nch; ch++)
+          o[ch] = bilinear_fixed<T>(w, p[ch], p[ch + nch], p[ch + row_stride],
+                                    p[ch + row_stride + nch]);
+      } else {
+        bool x0 = sx >= 0 && sx < W, x1 = sx + 1 >= 0 && sx + 1 < W;
+        bool y0 = sy >= 0 && sy < H, y1 = sy + 1 >= 0 && sy + 1 < H;
+        for (int64_t ch = 0; ch < nch; ch++) {
+          T p00 = y0 && x0 ? p[ch] : T();
+          T p01 = y0 && x1 ? p[ch + nch] : T();
+          T p10 = y1 && x0 ? p[ch + row_stride] : T();
+          T p11 = y1 && x1 ? p[ch + row_stride + nch] : T();
+          o[ch] = bilinear_fixed<T>(w, p00, p01, p10, p11);
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @brief Remaps the output rows `[y0, y1)`, dispatching to a variant with a static number
+ *        of channels, if possible.
+ */
+template <typename T>
+void RemapRows(T *out, const T *in, int64_t W, int64_t H, int64_t C,
+               const FixedPointMap &map, int64_t y0, int64_t y1) {
+  VALUE_SWITCH(C, static_channels, (1, 2, 3, 4), (
+    if (map.interp == DALI_INTERP_NN)
+      RemapRowsNNImpl<static_channels>(out, in, W, H, C, map, y0, y1);
+    else
+      RemapRowsLinearImpl<static_channels>(out, in, W, H, C, map, y0, y1);
+  ), (  // NOLINT
+    if (map.interp == DALI_INTERP_NN)
+      RemapRowsNNImpl<-1>(out, in, W, H, C, map, y0, y1);
+    else
+      RemapRowsLinearImpl<-1>(out, in, W, H, C, map, y0, y1);
+  ));  // NOLINT
+}
+
+}  // namespace remap
+
+/**
+ * @brief Remaps HWC images with precomputed fixed-point maps
+ *
+ * `output(x, y) = input(mapx(x, y), mapy(x, y))`, with the source pixels outside of the image
+ * equal to zero. The output has the size of the map and the number of channels of the input.
+ *
+ * The maps are converted with `remap::ConvertMap` (or obtained from `remap::FixedPointMapCache`)
+ * and can be reused for any number of images of the same size.
+ */
+template <typename T>
+class RemapCPU {
+ public:
+  KernelRequirements Setup(KernelContext &ctx, const InTensorCPU<T, 3> &in,
+                           const remap::FixedPointMap &map) {
+    KernelRequirements req;
+    req.output_shapes = { TensorListShape<3>({ TensorShape<3>{ map.shape[0], map.shape[1],
+                                                               in.shape[2] } }) };
+    return req;
+  }
+
+  void Run(KernelContext &ctx, const OutTensorCPU<T, 3> &out, const InTensorCPU<T, 3> &in,
+           const remap::FixedPointMap &map) {
+    SequentialExecutionEngine engine;
+    Schedule(engine, ctx, out, in, map);
+  }
+
+  /**
+   * @brief Adds the work to the execution engine
+   *
+   * Large images are split into bands of rows, which can be processed by multiple threads.
+   * The work is not run - the caller is responsible for calling `engine.RunAll()` and for
+   * keeping the map alive until then.
+   *
+   * @param req_nblocks requested number of bands; by default, `kBandsPerThread` per thread
+   */
+  template <typename ExecutionEngine>
+  void Schedule(ExecutionEngine &engine, KernelContext &ctx,
+                const OutTensorCPU<T, 3> &out, const InTensorCPU<T, 3> &in,
+                const remap::FixedPointMap &map, int req_nblocks = -1) {
+    DALI_ENFORCE(out.shape[0] == map.shape[0] && out.shape[1] == map.shape[1] &&
+                 out.shape[2] == in.shape[2], make_string(
+                 "The output shape ", out.shape, " doesn't match the map shape ", map.shape,
+                 " and the number of channels ", in.shape[2]));
+    int64_t row_len = out.shape[1] * out.shape[2];
+    if (row_len == 0)
+      return;
+    const remap::FixedPointMap *m = &map;
+    ScheduleBands(engine, out.shape[0], row_len, [=](Band rows) {
+      remap::RemapRows(out.data, in.data, in.shape[1], in.shape[0], in.shape[2], *m,
+                       rows.begin, rows.end);
+    }, 0, req_nblocks);
+  }
+};
+
+}  // namespace kernels
+}  // namespace dali
+
+#endif  // DALI_KERNELS_IMGPROC_GEOM_REMAP_CPU_H_
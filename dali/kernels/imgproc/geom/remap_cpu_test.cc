@@ -0,0 +1,218 @@
+// Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+#include <utility>
+#include <vector>
+#include "dali/core/exec/deferred_engine.h"
+#include "dali/core/tensor_shape_print.h"
+#include "dali/kernels/imgproc/geom/remap_cpu.h"
+
+namespace dali {
+namespace kernels {
+
+namespace {
+
+/**
+ * @brief Reference remap in double precision, with the coordinates quantized the same way
+ *        as in the fixed-point maps
+ */
+template <typename T>
+double RefRemap(const T *in, int H, int W, int C, float mx, float my, int c,
+                DALIInterpType interp) {
+  auto at = [&](int x, int y) -> double {
+    return x >= 0 && x < W && y >= 0 && y < H ? in[(y * W + x) * C + c] : 0;
+  };
+  if (interp == DALI_INTERP_NN)
+    return at(std::lrint(mx), std::lrint(my));
+  int qx = std::lrint(mx * remap::kFracScale);
+  int qy = std::lrint(my * remap::kFracScale);
+  int x0 = qx >> remap::kFracBits, y0 = qy >> remap::kFracBits;
+  double fx = (qx & remap::kFracMask) / static_cast<double>(remap::kFracScale);
+  double fy = (qy & remap::kFracMask) / static_cast<double>(remap::kFracScale);
+  double top = at(x0, y0) * (1 - fx) + at(x0 + 1, y0) * fx;
+  double bottom = at(x0, y0 + 1) * (1 - fx) + at(x0 + 1, y0 + 1) * fx;
+  return top * (1 - fy) + bottom * fy;
+}
+
+template <typename T>
+void TestRemap(TensorShape<3> in_shape, TensorShape<2> map_shape, DALIInterpType interp,
+               float shift, bool scheduled = false) {
+  std::mt19937_64 rng(1234);
+  std::uniform_int_distribution<int> value_dist(std::is_signed<T>::value ? -1000 : 0,
+                                                std::is_same<T, uint8_t>::value ? 255 : 1000);
+  int H = in_shape[0], W = in_shape[1], C = in_shape[2];
+  std::uniform_real_distribution<float> x_dist(-3, W + 3), y_dist(-3, H + 3);
+  std::vector<T> in(volume(in_shape));
+  for (auto &v : in)
+    v = value_dist(rng);
+  int64_t n = volume(map_shape);
+  std::vector<float> mapx(n), mapy(n);
+  for (int64_t i = 0; i < n; i++) {
+    if (i % 7 == 0) {  // grid-aligned coordinates, including the edges
+      mapx[i] = (i / 7) % (W + 1);
+      mapy[i] = (i / 7 / (W + 1)) % (H + 1);
+    } else {
+      mapx[i] = x_dist(rng);
+      mapy[i] = y_dist(rng);
+    }
+  }
+  mapx[0] = std::nanf("");
+
+  remap::FixedPointMap map;
+  remap::ConvertMap(map, mapx.data(), mapy.data(), map_shape, { W, H }, interp, shift);
+
+  TensorShape<3> out_shape{ map_shape[0], map_shape[1], C };
+  std::vector<T> out(volume(out_shape));
+  RemapCPU<T> kernel;
+  KernelContext ctx;
+  auto in_view = make_tensor_cpu<3>(in.data(), in_shape);
+  auto out_view = make_tensor_cpu<3>(out.data(), out_shape);
+  auto req = kernel.Setup(ctx, in_view, map);
+  ASSERT_EQ(req.output_shapes[0][0], out_shape);
+  if (scheduled) {
+    DeferredEngine engine;
+    kernel.Schedule(engine, ctx, out_view, in_view, map, 5);
+    engine.RunAll();
+  } else {
+    kernel.Run(ctx, out_view, in_view, map);
+  }
+
+  for (int64_t i = 0; i < n; i++) {
+    float mx = mapx[i] + shift, my = mapy[i] + shift;
+    if (std::isnan(mx))
+      mx = -2;
+    for (int c = 0; c < C; c++) {
+      double ref = RefRemap(in.data(), H, W, C, mx, my, c, interp);
+      if (std::is_integral<T>::value)
+        ASSERT_EQ(out[i * C + c], std::floor(ref + 0.5)) << " at pixel " << i << " channel " << c;
+      else
+        ASSERT_NEAR(out[i * C + c], ref, 1e-3) << " at pixel " << i << " channel " << c;
+    }
+  }
+}
+
+}  // namespace
+
+TEST(RemapCPU, Linear) {
+  for (int c : { 1, 2, 3, 4, 5 }) {
+    TestRemap<uint8_t>({ 37, 41, c }, { 30, 50 }, DALI_INTERP_LINEAR, 0);
+    TestRemap<uint8_t>({ 37, 41, c }, { 30, 50 }, DALI_INTERP_LINEAR, -0.5f);
+    TestRemap<int16_t>({ 20, 25, c }, { 20, 25 }, DALI_INTERP_LINEAR, 0);
+    TestRemap<uint16_t>({ 20, 25, c }, { 21, 13 }, DALI_INTERP_LINEAR, -0.5f);
+    TestRemap<float>({ 20, 25, c }, { 21, 13 }, DALI_INTERP_LINEAR, 0);
+  }
+}
+
+TEST(RemapCPU, NN) {
+  for (int c : { 1, 3, 6 }) {
+    TestRemap<uint8_t>({ 37, 41, c }, { 30, 50 }, DALI_INTERP_NN, 0);
+    TestRemap<int16_t>({ 20, 25, c }, { 20, 25 }, DALI_INTERP_NN, -0.5f);
+    TestRemap<float>({ 20, 25, c }, { 21, 13 }, DALI_INTERP_NN, 0);
+  }
+}
+
+TEST(RemapCPU, Scheduled) {
+  TestRemap<uint8_t>({ 300, 301, 3 }, { 300, 301 }, DALI_INTERP_LINEAR, 0, true);
+  TestRemap<float>({ 200, 300, 1 }, { 256, 256 }, DALI_INTERP_NN, -0.5f, true);
+}
+
+TEST(RemapCPU, UnsupportedInterpolation) {
+  std::vector<float> mapx(4), mapy(4);
+  remap::FixedPointMap map;
+  EXPECT_THROW(remap::ConvertMap(map, mapx.data(), mapy.data(), { 2, 2 }, { 2, 2 },
+                                 DALI_INTERP_CUBIC), std::exception);
+}
+
+TEST(RemapCPU, MapCache) {
+  TensorShape<2> shape{ 10, 20 };
+  std::vector<float> mapx(200, 1.5f), mapy(200, 2.5f), mapx2(200, 1.5f), other(200, 3.0f);
+  remap::FixedPointMapCache cache;
+
+  cache.BeginBatch();
+  auto m1 = cache.Get(mapx.data(), mapy.data(), shape, { 20, 10 }, DALI_INTERP_LINEAR, 0);
+  // the same buffers in one batch
+  auto m2 = cache.Get(mapx.data(), mapy.data(), shape, { 20, 10 }, DALI_INTERP_LINEAR, 0);
+  // the same contents in a different buffer
+  auto m3 = cache.Get(mapx2.data(), mapy.data(), shape, { 20, 10 }, DALI_INTERP_LINEAR, 0);
+  // different parameters
+  auto m4 = cache.Get(mapx.data(), mapy.data(), shape, { 20, 10 }, DALI_INTERP_NN, 0);
+  auto m5 = cache.Get(mapx.data(), mapy.data(), shape, { 20, 10 }, DALI_INTERP_LINEAR, -0.5f);
+  cache.EndBatch();
+  EXPECT_EQ(m1, m2);
+  EXPECT_EQ(m1, m3);
+  EXPECT_NE(m1, m4);
+  EXPECT_NE(m1, m5);
+  EXPECT_EQ(cache.misses(), 3);
+  EXPECT_EQ(cache.hits(), 0);
+
+  // the next batch - the contents are compared
+  cache.BeginBatch();
+  auto n1 = cache.Get(mapx2.data(), mapy.data(), shape, { 20, 10 }, DALI_INTERP_LINEAR, 0);
+  auto n2 = cache.Get(other.data(), mapy.data(), shape, { 20, 10 }, DALI_INTERP_LINEAR, 0);
+  cache.EndBatch();
+  EXPECT_EQ(n1, m1);
+  EXPECT_NE(n2, m1);
+  EXPECT_EQ(cache.hits(), 1);
+  EXPECT_EQ(cache.misses(), 4);
+
+  // modified in place - must not be reused
+  mapx2[117] = 5.0f;
+  cache.BeginBatch();
+  auto k1 = cache.Get(mapx2.data(), mapy.data(), shape, { 20, 10 }, DALI_INTERP_LINEAR, 0);
+  cache.EndBatch();
+  EXPECT_NE(k1, m1);
+  EXPECT_EQ(k1->xy[2 * 117], 5);
+  EXPECT_EQ(cache.misses(), 5);
+}
+
+TEST(RemapCPU, MapCacheCapacity) {
+  TensorShape<2> shape{ 10, 20 };
+  std::vector<float> mapx1(200, 1.5f), mapx2(200, 2.5f), mapy(200, 2.5f);
+  auto get = [&](remap::FixedPointMapCache &cache, const std::vector<float> &mapx) {
+    return cache.Get(mapx.data(), mapy.data(), shape, { 20, 10 }, DALI_INTERP_LINEAR, 0);
+  };
+  remap::FixedPointMap map;
+  remap::ConvertMap(map, mapx1.data(), mapy.data(), shape, { 20, 10 }, DALI_INTERP_LINEAR);
+  int64_t map_bytes = map.xy.size() * sizeof(int16_t) + map.frac.size() * sizeof(uint16_t);
+  remap::FixedPointMapCache cache(map_bytes);
+
+  // the maps used in the batch are kept, even over capacity
+  cache.BeginBatch();
+  auto m1 = get(cache, mapx1);
+  auto m2 = get(cache, mapx2);
+  cache.EndBatch();
+  EXPECT_EQ(cache.bytes(), 2 * map_bytes);
+
+  // the least recently used map is evicted
+  cache.BeginBatch();
+  EXPECT_EQ(get(cache, mapx2), m2);
+  cache.EndBatch();
+  EXPECT_EQ(cache.bytes(), map_bytes);
+  EXPECT_EQ(cache.hits(), 1);
+
+  cache.BeginBatch();
+  EXPECT_EQ(get(cache, mapx2), m2);
+  auto m1_again = get(cache, mapx1);
+  cache.EndBatch();
+  EXPECT_NE(m1_again, m1);
+  EXPECT_EQ(m1_again->xy, m1->xy);
+  EXPECT_EQ(cache.hits(), 2);
+  EXPECT_EQ(cache.misses(), 3);
+}
+
+}  // namespace kernels
+}  // namespace dali
@@ -0,0 +1,406 @@
+// Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DALI_KERNELS_IMGPROC_MORPHOLOGY_MORPHOLOGY_CPU_H_
+#define DALI_KERNELS_IMGPROC_MORPHOLOGY_MORPHOLOGY_CPU_H_
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+#include "dali/core/boundary.h"
+#include "dali/core/error_handling.h"
+#include "dali/core/exec/engine.h"
+#include "dali/core/force_inline.h"
+#include "dali/core/geom/vec.h"
+#include "dali/core/tensor_view.h"
+#include "dali/kernels/common/tiling.h"
+#include "dali/kernels/kernel.h"
+
+namespace dali {
+namespace kernels {
+
+enum class MorphologyOp {
+  Erode,   //!< minimum over the structuring element
+  Dilate,  //!< maximum over the structuring element
+};
+
+namespace morphology {
+
+template <MorphologyOp op>
+struct MinMax;
+
+template <>
+struct MinMax<MorphologyOp::Erode> {
+  template <typename T>
+  static DALI_FORCEINLINE T apply(T a, T b) { return b < a ? b : a; }
+
+  /// @brief A value that doesn't affect the result
+  template <typename T>
+  static constexpr T neutral() {
+    return std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity()
+                                                : std::numeric_limits<T>::max();
+  }
+};
+
+template <>
+struct MinMax<MorphologyOp::Dilate> {
+  template <typename T>
+  static DALI_FORCEINLINE T apply(T a, T b) { return b > a ? b : a; }
+
+  /// @brief A value that doesn't affect the result
+  template <typename T>
+  static constexpr T neutral() {
+    return std::numeric_limits<T>::has_infinity ? -std::numeric_limits<T>::infinity()
+                                                : std::numeric_limits<T>::lowest();
+  }
+};
+
+/// @brief Windows up to this size are processed directly, larger ones with van Herk/Gil-Werman
+constexpr int kDirectWindow = 4;
+
+/// @brief Shorter strides leave too little room for vectorizing van Herk/Gil-Werman recurrences
+constexpr int64_t kMinVanHerkStride = 16;
+
+/**
+ * @brief Maps an out-of-range coordinate to the input range, or returns -1 if the coordinate
+ *        should be replaced with a neutral value.
+ */
+inline int64_t remap_border(int64_t idx, int64_t size, boundary::BoundaryType border) {
+  if (idx >= 0 && idx < size)
+    return idx;
+  switch (border) {
+    case boundary::BoundaryType::CLAMP:
+      return boundary::idx_clamp<int64_t>(idx, 0, size);
+    case boundary::BoundaryType::REFLECT_1001:
+      return boundary::idx_reflect_1001<int64_t>(idx, size);
+    case boundary::BoundaryType::REFLECT_101:
+      return boundary::idx_reflect_101<int64_t>(idx, size);
+    case boundary::BoundaryType::WRAP:
+      return boundary::idx_wrap<int64_t>(idx, size);
+    default:
+      return -1;
+  }
+}
+
+/**
+ * @brief Calculates a running minimum/maximum of `k` elements, `stride` apart
+ *
+ * `out[i] = op(in[i], in[i + stride], ..., in[i + (k - 1) * stride])` for `i` in `[0, n)`
+ *
+ * For small windows, the result is accumulated directly - the inner loops are contiguous and
+ * can be vectorized. Larger windows use the van Herk/Gil-Werman algorithm, which takes
+ * 3 operations per element, regardless of the window size:
+ * the input is divided into blocks of `k` strides and, for each block, prefix (`g`) and suffix
+ * (`h`) running results are calculated. Each window spans at most two adjacent blocks, so
+ * the result is `op(h[i], g[i + (k - 1) * stride])`.
+ *
+ * The prefix and suffix recurrences are only vectorized across the `stride` elements, so with
+ * short strides (interleaved channels) the window is instead built from overlapping windows of
+ * doubling size - this takes `log2(k) + 1` operations per element, but all of them are vectorized.
+ *
+ * @param in      input; must contain `n + (k - 1) * stride` elements
+ * @param scratch buffer for `2 * (n + (k - 1) * stride)` elements; not used for small windows
+ */
+template <MorphologyOp op, typename T>
+void running_min_max(T *out, const T *in, int64_t n, int64_t stride, int k, T *scratch) {
+  using Op = MinMax<op>;
+  if (k == 1) {
+    std::copy(in, in + n, out);
+    return;
+  }
+  if (k <= kDirectWindow) {
+    const T *in1 = in + stride;
+    #pragma omp simd
+    for (int64_t i = 0; i < n; i++)
+      out[i] = Op::apply(in[i], in1[i]);
+    for (int j = 2; j < k; j++) {
+      const T *src = in + j * stride;
+      #pragma omp simd
+      for (int64_t i = 0; i < n; i++)
+        out[i] = Op::apply(out[i], src[i]);
+    }
+    return;
+  }
+  int64_t padded = n + (k - 1) * stride;
+  if (stride < kMinVanHerkStride) {
+    // op over [i, i + 2p) is op over [i, i + p) and [i + p, i + 2p); overlapping is harmless
+    const T *cur = in;
+    T *next = scratch;
+    int64_t len = padded;
+    int p = 1;
+    for (; 2 * p <= k; p *= 2) {
+      len -= p * stride;
+      const T *shifted = cur + p * stride;
+      #pragma omp simd
+      for (int64_t i = 0; i < len; i++)
+        next[i] = Op::apply(cur[i], shifted[i]);
+      cur = next;
+      next = next == scratch ? scratch + padded : scratch;
+    }
+    const T *last = cur + (k - p) * stride;
+    #pragma omp simd
+    for (int64_t i = 0; i < n; i++)
+      out[i] = Op::apply(cur[i], last[i]);
+    return;
+  }
+  int64_t npos = padded / stride;  // number of positions in the strided sequence
+  T *g = scratch;
+  T *h = scratch + padded;
+  for (int64_t p = 0; p < npos; p++) {
+    const T *src = in + p * stride;
+    T *dst = g + p * stride;
+    if (p % k == 0) {
+      for (int64_t c = 0; c < stride; c++)
+        dst[c] = src[c];
+    } else {
+      #pragma omp simd
+      for (int64_t c = 0; c < stride; c++)
+        dst[c] = Op::apply(dst[c - stride], src[c]);
+    }
+  }
+  for (int64_t p = npos - 1; p >= 0; p--) {
+    const T *src = in + p * stride;
+    T *dst = h + p * stride;
+    if (p == npos - 1 || (p + 1) % k == 0) {
+      for (int64_t c = 0; c < stride; c++)
+        dst[c] = src[c];
+    } else {
+      #pragma omp simd
+      for (int64_t c = 0; c < stride; c++)
+        dst[c] = Op::apply(dst[c + stride], src[c]);
+    }
+  }
+  const T *g_end = g + (k - 1) * stride;
+  #pragma omp simd
+  for (int64_t i = 0; i < n; i++)
+    out[i] = Op::apply(h[i], g_end[i]);
+}
+
+/**
+ * @brief Calculates a running minimum/maximum of `k` rows
+ *
+ * `out[y]` is the result for rows `rows[y]` to `rows[y + k - 1]`.
+ * This is the van Herk/Gil-Werman algorithm applied to whole rows - the rows are processed
+ * in strips narrow enough that the prefix and suffix results stay in cache.
+ */
+template <MorphologyOp op, typename T>
+void running_min_max_rows(T *out, int64_t out_stride, const T *const *rows, int64_t nrows,
+                          int64_t row_len, int k) {
+  using Op = MinMax<op>;
+  if (k <= kDirectWindow) {
+    for (int64_t y = 0; y < nrows; y++) {
+      T *dst = out + y * out_stride;
+      const T *src0 = rows[y];
+      if (k == 1) {
+        std::copy(src0, src0 + row_len, dst);
+        continue;
+      }
+      const T *src1 = rows[y + 1];
+      #pragma omp simd
+      for (int64_t i = 0; i < row_len; i++)
+        dst[i] = Op::apply(src0[i], src1[i]);
+      for (int j = 2; j < k; j++) {
+        const T *src = rows[y + j];
+        #pragma omp simd
+        for (int64_t i = 0; i < row_len; i++)
+          dst[i] = Op::apply(dst[i], src[i]);
+      }
+    }
+    return;
+  }
+
+  constexpr int64_t kStrip = 256;
+  int64_t npos = nrows + k - 1;
+  std::vector<T> tmp(2 * npos * kStrip);
+  T *g = tmp.data();
+  T *h = g + npos * kStrip;
+  for (int64_t x0 = 0; x0 < row_len; x0 += kStrip) {
+    int64_t w = std::min(kStrip, row_len - x0);
+    for (int64_t p = 0; p < npos; p++) {
+      const T *src = rows[p] + x0;
+      T *dst = g + p * kStrip;
+      if (p % k == 0) {
+        for (int64_t i = 0; i < w; i++)
+          dst[i] = src[i];
+      } else {
+        const T *prev = dst - kStrip;
+        #pragma omp simd
+        for (int64_t i = 0; i < w; i++)
+          dst[i] = Op::apply(prev[i], src[i]);
+      }
+    }
+    for (int64_t p = npos - 1; p >= 0; p--) {
+      const T *src = rows[p] + x0;
+      T *dst = h + p * kStrip;
+      if (p == npos - 1 || (p + 1) % k == 0) {
+        for (int64_t i = 0; i < w; i++)
+          dst[i] = src[i];
+      } else {
+        const T *next = dst + kStrip;
+        #pragma omp simd
+        for (int64_t i = 0; i < w; i++)
+          dst[i] = Op::apply(next[i], src[i]);
+      }
+    }
+    for (int64_t y = 0; y < nrows; y++) {
+      const T *hy = h + y * kStrip;
+      const T *gy = g + (y + k - 1) * kStrip;
+      T *dst = out + y * out_stride + x0;
+      #pragma omp simd
+      for (int64_t i = 0; i < w; i++)
+        dst[i] = Op::apply(hy[i], gy[i]);
+    }
+  }
+}
+
+}  // namespace morphology
+
+/**
+ * @brief Erodes or dilates an image with a rectangular structuring element
+ *
+ * The operation is separable - the running minimum/maximum is calculated along rows and then
+ * along columns. The input and output are HWC images.
+ *
+ * Constant border means that the pixels outside of the image are ignored (as if they had
+ * the maximum value for erosion and the minimum value for dilation).
+ */
+template <typename T>
+class MorphologyCPU {
+ public:
+  KernelRequirements Setup(KernelContext &ctx, const InTensorCPU<T, 3> &in) {
+    KernelRequirements req;
+    req.output_shapes = { TensorListShape<3>({ in.shape }) };
+    return req;
+  }
+
+  /**
+   * @param mask_size size of the structuring element (width, height)
+   * @param anchor    position of the anchor point within the structuring element (x, y);
+   *                  negative coordinates denote the center
+   */
+  void Run(KernelContext &ctx, const OutTensorCPU<T, 3> &out, const InTensorCPU<T, 3> &in,
+           MorphologyOp op, ivec2 mask_size, ivec2 anchor = { -1, -1 },
+           boundary::BoundaryType border = boundary::BoundaryType::CONSTANT) {
+    SequentialExecutionEngine engine;
+    Schedule(engine, ctx, out, in, op, mask_size, anchor, border);
+  }
+
+  /**
+   * @brief Adds the work to the execution engine
+   *
+   * Large images are split into bands of rows, which can be processed by multiple threads.
+   * The work is not run - the caller is responsible for calling `engine.RunAll()`.
+   *
+   * @param req_nblocks requested number of bands; by default, `kBandsPerThread` per thread
+   */
+  template <typename ExecutionEngine>
+  void Schedule(ExecutionEngine &engine, KernelContext &ctx,
+                const OutTensorCPU<T, 3> &out, const InTensorCPU<T, 3> &in,
+                MorphologyOp op, ivec2 mask_size, ivec2 anchor = { -1, -1 },
+                boundary::BoundaryType border = boundary::BoundaryType::CONSTANT,
+                int req_nblocks = -1) {
+    DALI_ENFORCE(out.shape == in.shape, "Output and input shapes must match");
+    DALI_ENFORCE(mask_size.x >= 1 && mask_size.y >= 1,
+                 make_string("The mask size must be positive, got ", mask_size));
+    for (int d = 0; d < 2; d++) {
+      if (anchor[d] < 0)
+        anchor[d] = mask_size[d] / 2;
+      DALI_ENFORCE(anchor[d] < mask_size[d], make_string(
+          "The anchor must lie within the mask, got anchor ", anchor, " for mask ", mask_size));
+    }
+
+    int64_t row_len = in.shape[1] * in.shape[2];
+    if (row_len == 0)
+      return;
+    // each band reads the rows covered by the mask above and below it
+    int halo = mask_size.y / 2;
+    ScheduleBands(engine, in.shape[0], row_len, [=](Band rows) {
+      if (op == MorphologyOp::Erode)
+        RunRows<MorphologyOp::Erode>(out, in, mask_size, anchor, border, rows.begin, rows.end);
+      else
+        RunRows<MorphologyOp::Dilate>(out, in, mask_size, anchor, border, rows.begin, rows.end);
+    }, halo, req_nblocks);
+  }
+
+ private:
+  template <MorphologyOp op>
+  static void RunRows(const OutTensorCPU<T, 3> &out, const InTensorCPU<T, 3> &in,
+                      ivec2 mask_size, ivec2 anchor, boundary::BoundaryType border,
+                      int64_t y0, int64_t y1) {
+    using namespace morphology;  // NOLINT
+    using Op = MinMax<op>;
+    const T neutral = Op::template neutral<T>();
+    int64_t H = in.shape[0], W = in.shape[1], C = in.shape[2];
+    int64_t row_len = W * C;
+    int kw = mask_size.x, kh = mask_size.y;
+
+    // Source rows needed for the band; rows outside of the image are remapped or,
+    // for constant border, replaced with a row of neutral values.
+    int64_t npos = y1 - y0 + kh - 1;
+    std::vector<int64_t> src_y(npos), unique_y;
+    for (int64_t p = 0; p < npos; p++) {
+      src_y[p] = remap_border(y0 - anchor.y + p, H, border);
+      if (src_y[p] >= 0)
+        unique_y.push_back(src_y[p]);
+    }
+    std::sort(unique_y.begin(), unique_y.end());
+    unique_y.erase(std::unique(unique_y.begin(), unique_y.end()), unique_y.end());
+
+    // Horizontal pass - each of the source rows is processed once
+    int64_t padded_len = (W + kw - 1) * C;
+    std::vector<T> horz(unique_y.size() * row_len);
+    std::vector<T> padded(padded_len), scratch(kw > kDirectWindow ? 2 * padded_len : 0);
+    for (size_t r = 0; r < unique_y.size(); r++) {
+      const T *src = in.data + unique_y[r] * row_len;
+      T *dst = horz.data() + r * row_len;
+      if (kw == 1) {
+        std::copy(src, src + row_len, dst);
+        continue;
+      }
+      // only the margins need border handling
+      std::copy(src, src + row_len, padded.data() + anchor.x * C);
+      for (int64_t px = 0; px < W + kw - 1; px++) {
+        if (px == anchor.x)
+          px += W;
+        if (px >= W + kw - 1)
+          break;
+        int64_t x = remap_border(px - anchor.x, W, border);
+        for (int64_t c = 0; c < C; c++)
+          padded[px * C + c] = x >= 0 ? src[x * C + c] : neutral;
+      }
+      running_min_max<op>(dst, padded.data(), row_len, C, kw, scratch.data());
+    }
+
+    // Vertical pass - directly to the output
+    std::vector<T> neutral_row;
+    std::vector<const T *> rows(npos);
+    for (int64_t p = 0; p < npos; p++) {
+      if (src_y[p] < 0) {
+        if (neutral_row.empty())
+          neutral_row.resize(row_len, neutral);
+        rows[p] = neutral_row.data();
+      } else {
+        auto it = std::lower_bound(unique_y.begin(), unique_y.end(), src_y[p]);
+        rows[p] = horz.data() + (it - unique_y.begin()) * row_len;
+      }
+    }
+    running_min_max_rows<op>(out.data + y0 * row_len, row_len, rows.data(), y1 - y0,
+                             row_len, kh);
+  }
+};
+
+}  // namespace kernels
+}  // namespace dali
+
+#endif  // DALI_KERNELS_IMGPROC_MORPHOLOGY_MORPHOLOGY_CPU_H_
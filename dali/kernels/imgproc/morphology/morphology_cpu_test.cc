@@ -0,0 +1,130 @@
+// Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+#include "dali/core/exec/deferred_engine.h"
+#include "dali/core/tensor_shape_print.h"
+#include "dali/kernels/imgproc/morphology/morphology_cpu.h"
+
+namespace dali {
+namespace kernels {
+
+namespace {
+
+template <typename T>
+void RefMorphology(T *out, const T *in, int H, int W, int C, MorphologyOp op,
+                   ivec2 mask, ivec2 anchor, boundary::BoundaryType border) {
+  for (int y = 0; y < H; y++) {
+    for (int x = 0; x < W; x++) {
+      for (int c = 0; c < C; c++) {
+        bool any = false;
+        T result = 0;
+        for (int j = 0; j < mask.y; j++) {
+          int64_t sy = morphology::remap_border(y - anchor.y + j, H, border);
+          for (int i = 0; i < mask.x; i++) {
+            int64_t sx = morphology::remap_border(x - anchor.x + i, W, border);
+            if (sy < 0 || sx < 0)
+              continue;
+            T v = in[(sy * W + sx) * C + c];
+            if (!any)
+              result = v;
+            else
+              result = op == MorphologyOp::Erode ? std::min(result, v) : std::max(result, v);
+            any = true;
+          }
+        }
+        out[(y * W + x) * C + c] = result;
+      }
+    }
+  }
+}
+
+template <typename T>
+void TestMorphology(TensorShape<3> shape, MorphologyOp op, ivec2 mask, ivec2 anchor,
+                    boundary::BoundaryType border, bool scheduled = false) {
+  std::mt19937_64 rng(1234);
+  std::uniform_int_distribution<int> dist(0, 255);
+  int64_t n = volume(shape);
+  std::vector<T> in(n), out(n), ref(n);
+  for (auto &x : in)
+    x = dist(rng);
+  ivec2 center = anchor;
+  for (int d = 0; d < 2; d++)
+    if (center[d] < 0)
+      center[d] = mask[d] / 2;
+  RefMorphology(ref.data(), in.data(), shape[0], shape[1], shape[2], op, mask, center, border);
+
+  MorphologyCPU<T> kernel;
+  KernelContext ctx;
+  auto in_view = make_tensor_cpu<3>(in.data(), shape);
+  auto out_view = make_tensor_cpu<3>(out.data(), shape);
+  kernel.Setup(ctx, in_view);
+  if (scheduled) {
+    DeferredEngine engine;
+    kernel.Schedule(engine, ctx, out_view, in_view, op, mask, anchor, border, 7);
+    engine.RunAll();
+  } else {
+    kernel.Run(ctx, out_view, in_view, op, mask, anchor, border);
+  }
+  for (int64_t i = 0; i < n; i++) {
+    ASSERT_EQ(out[i], ref[i]) << " at " << i << " shape " << shape << " mask " << mask
+                              << " anchor " << anchor << " border " << to_string(border);
+  }
+}
+
+}  // namespace
+
+TEST(MorphologyCPU, AllBorders) {
+  using boundary::BoundaryType;
+  for (auto border : { BoundaryType::CONSTANT, BoundaryType::CLAMP, BoundaryType::REFLECT_1001,
+                       BoundaryType::REFLECT_101, BoundaryType::WRAP }) {
+    for (auto op : { MorphologyOp::Erode, MorphologyOp::Dilate }) {
+      TestMorphology<uint8_t>({ 37, 41, 3 }, op, { 3, 3 }, { -1, -1 }, border);
+      TestMorphology<uint8_t>({ 37, 41, 1 }, op, { 7, 5 }, { 1, 4 }, border);
+      TestMorphology<float>({ 29, 33, 2 }, op, { 2, 9 }, { -1, -1 }, border);
+      TestMorphology<int16_t>({ 20, 50, 4 }, op, { 11, 1 }, { 0, 0 }, border);
+    }
+  }
+}
+
+TEST(MorphologyCPU, LargeMasks) {
+  // larger than the image - the border handling is applied multiple times
+  using boundary::BoundaryType;
+  TestMorphology<uint16_t>({ 15, 17, 3 }, MorphologyOp::Dilate, { 21, 40 }, { -1, -1 },
+                           BoundaryType::CONSTANT);
+  TestMorphology<uint16_t>({ 15, 17, 3 }, MorphologyOp::Erode, { 33, 19 }, { 2, 3 },
+                           BoundaryType::REFLECT_101);
+  TestMorphology<float>({ 64, 300, 1 }, MorphologyOp::Erode, { 25, 25 }, { -1, -1 },
+                        BoundaryType::CLAMP);
+  // many channels - van Herk/Gil-Werman in the horizontal pass
+  TestMorphology<uint8_t>({ 20, 30, 16 }, MorphologyOp::Dilate, { 9, 3 }, { -1, -1 },
+                          BoundaryType::REFLECT_101);
+  TestMorphology<float>({ 20, 30, 17 }, MorphologyOp::Erode, { 6, 5 }, { 5, 0 },
+                        BoundaryType::CONSTANT);
+}
+
+TEST(MorphologyCPU, Scheduled) {
+  using boundary::BoundaryType;
+  TestMorphology<uint8_t>({ 300, 301, 3 }, MorphologyOp::Erode, { 5, 5 }, { -1, -1 },
+                          BoundaryType::CONSTANT, true);
+  TestMorphology<uint8_t>({ 300, 301, 3 }, MorphologyOp::Dilate, { 9, 7 }, { 0, 6 },
+                          BoundaryType::REFLECT_1001, true);
+  TestMorphology<float>({ 256, 256, 1 }, MorphologyOp::Dilate, { 3, 15 }, { -1, -1 },
+                        BoundaryType::WRAP, true);
+}
+
+}  // namespace kernels
+}  // namespace dali
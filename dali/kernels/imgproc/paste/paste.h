@@ -23,6 +23,7 @@
 #include "dali/core/error_handling.h"
 #include "dali/kernels/kernel.h"
 #include "dali/kernels/imgproc/roi.h"
+#include "dali/kernels/imgproc/paste/paste_cpu.h"
 
 const int Y_AXIS = 0;
 const int X_AXIS = 1;
@@ -69,13 +70,7 @@ class PasteCPU {
     auto row_value_count = inXShape * num_channels;
 
     for (int y = 0; y < inYShape; y++) {
-      if (std::is_same<InputType, OutputType>::value) {
-        memcpy(out_ptr, in_ptr, row_value_count * sizeof(in_ptr[0]));
-      } else {
-        for (int i = 0; i < row_value_count; i++) {
-          out_ptr[i] = ConvertSat<OutputType>(in_ptr[i]);
-        }
-      }
+      paste::ConvertRow(out_ptr, in_ptr, row_value_count);
       in_ptr += in_row_stride;
       out_ptr += out_row_stride;
     }
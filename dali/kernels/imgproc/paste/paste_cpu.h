@@ -0,0 +1,296 @@
+// Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DALI_KERNELS_IMGPROC_PASTE_PASTE_CPU_H_
+#define DALI_KERNELS_IMGPROC_PASTE_PASTE_CPU_H_
+
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+#include "dali/core/convert.h"
+#include "dali/core/error_handling.h"
+#include "dali/core/geom/vec.h"
+#include "dali/core/span.h"
+#include "dali/core/tensor_view.h"
+#include "dali/kernels/common/simd.h"
+#include "dali/kernels/common/tiling.h"
+#include "dali/kernels/imgproc/paste/paste_gpu_input.h"
+#include "dali/kernels/kernel.h"
+
+namespace dali {
+namespace kernels {
+namespace paste {
+
+#ifdef __SSE2__
+
+/**
+ * @brief Rounds to nearest integer, with halfway cases rounded away from zero (like std::round)
+ */
+inline __m128 round_half_away(__m128 x) {
+  __m128 abs_mask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+  // values this large are already integers (and may not fit in int32)
+  __m128 is_int = _mm_cmpge_ps(_mm_and_ps(x, abs_mask), _mm_set1_ps(1 << 23));
+  __m128 t = _mm_cvtepi32_ps(_mm_cvttps_epi32(x));
+  __m128 frac = _mm_sub_ps(x, t);  // exact
+  __m128 one = _mm_set1_ps(1.0f);
+  t = _mm_add_ps(t, _mm_and_ps(_mm_cmpge_ps(frac, _mm_set1_ps(0.5f)), one));
+  t = _mm_sub_ps(t, _mm_and_ps(_mm_cmple_ps(frac, _mm_set1_ps(-0.5f)), one));
+  return _mm_or_ps(_mm_and_ps(is_int, x), _mm_andnot_ps(is_int, t));
+}
+
+#endif  // __SSE2__
+
+/**
+ * @brief Copies `n` values, converting them from `In` to `Out` with `ConvertSat`
+ *
+ * Same types are copied with memcpy; other combinations of 8-, 16- and 32-bit types
+ * are converted in SIMD registers, going through float.
+ */
+template <typename Out, typename In>
+inline void ConvertRow(Out *__restrict__ out, const In *__restrict__ in, int64_t n) {
+  if constexpr (std::is_same<Out, In>::value) {
+    std::memcpy(out, in, n * sizeof(Out));
+  } else {
+    int64_t i = 0;
+#ifdef __SSE2__
+    if constexpr (!std::is_same<Out, bool>::value && !std::is_same<In, bool>::value &&
+                  sizeof(In) <= 4 && sizeof(Out) <= 4) {
+      // one iteration processes a full vector of the narrower type
+      constexpr int kLanes = 16 / std::min(sizeof(In), sizeof(Out));
+      using V = simd::multivec<kLanes / 4>;
+      for (; i + kLanes <= n; i += kLanes) {
+        V v = V::load(in + i);
+        if constexpr (std::is_floating_point<In>::value && std::is_integral<Out>::value) {
+          // the integer conversion in `store` rounds halfway cases to even
+          for (int j = 0; j < kLanes / 4; j++)
+            v.v[j] = round_half_away(v.v[j]);
+        }
+        simd::store(out + i, v);
+      }
+    }
+#endif  // __SSE2__
+    for (; i < n; i++)
+      out[i] = ConvertSat<Out>(in[i]);
+  }
+}
+
+}  // namespace paste
+
+/**
+ * @brief Pastes multiple regions of input images onto an output canvas
+ *
+ * The regions are pasted in order - where they overlap, the later one is visible.
+ * The pixels not covered by any region are filled with a constant.
+ *
+ * The output is produced in a single pass: the canvas is divided into groups of rows with
+ * the same arrangement of regions, and each group into horizontal spans, each of which comes
+ * from one region (or from the fill value). Each output pixel is written exactly once and
+ * the spans are copied with memcpy or converted with SIMD.
+ */
+template <typename OutputType, typename InputType>
+class MultiPasteCPU {
+ public:
+  using Patch = typename paste::MultiPasteSampleInput<2>::InputPatch;
+
+  /**
+   * @brief Pastes the regions onto the output
+   *
+   * @param out      output canvas, HWC
+   * @param inputs   input images, HWC, one per patch; the number of channels must match
+   *                 the output
+   * @param patches  the pasted regions, in order; the coordinates are (y, x) and the regions
+   *                 must lie within the input and the output; `in_idx` and `batch_idx` are
+   *                 ignored
+   * @param fill     the value of the pixels not covered by any region: either one value
+   *                 per channel, a single value for all channels or, if empty, zero
+   */
+  void Run(KernelContext &context, const OutTensorCPU<OutputType, 3> &out,
+           span<const InTensorCPU<InputType, 3>> inputs, span<const Patch> patches,
+           span<const OutputType> fill = {}) {
+    Plan(out, inputs, patches, fill);
+    RunRows(0, out.shape[0]);
+  }
+
+  /**
+   * @brief Schedules the pasting to be run in bands of rows
+   *
+   * The work is not run - the caller is responsible for calling `engine.RunAll()`.
+   * The inputs are copied, but the kernel object must not be destroyed or reused until
+   * the work completes.
+   *
+   * @param req_nblocks requested number of bands; by default, `kBandsPerThread` per thread
+   *
+   * @see Run
+   */
+  template <typename ExecutionEngine>
+  void Schedule(ExecutionEngine &engine, const OutTensorCPU<OutputType, 3> &out,
+                span<const InTensorCPU<InputType, 3>> inputs, span<const Patch> patches,
+                span<const OutputType> fill = {}, int req_nblocks = -1) {
+    Plan(out, inputs, patches, fill);
+    ScheduleBands(engine, out.shape[0], out.shape[1] * out.shape[2], [this](Band rows) {
+      RunRows(rows.begin, rows.end);
+    }, 0, req_nblocks);
+  }
+
+ private:
+  /// A horizontal span of output pixels taken from one patch (or filled, if `patch` < 0)
+  struct Span {
+    int x0, x1;
+    int patch;
+  };
+
+  /// A group of rows with the same spans
+  struct RowGroup {
+    int y0, y1;
+    int first_span, end_span;
+  };
+
+  void Plan(const OutTensorCPU<OutputType, 3> &out,
+            span<const InTensorCPU<InputType, 3>> inputs, span<const Patch> patches,
+            span<const OutputType> fill) {
+    DALI_ENFORCE(inputs.size() == patches.size(),
+                 make_string("Expected one input per pasted region, got ", inputs.size(),
+                             " inputs and ", patches.size(), " regions."));
+    int H = out.shape[0], W = out.shape[1], C = out.shape[2];
+    DALI_ENFORCE(fill.empty() || fill.size() == 1 || static_cast<int>(fill.size()) == C,
+                 make_string("The fill value must have 1 or ", C, " elements, got ",
+                             fill.size(), "."));
+    out_ = out;
+    inputs_.assign(inputs.begin(), inputs.end());
+    patches_.assign(patches.begin(), patches.end());
+    for (int i = 0; i < static_cast<int>(patches_.size()); i++) {
+      assert(inputs_[i].shape[2] == C);
+      assert(all_coords(patches_[i].out_anchor >= 0) &&
+             all_coords(patches_[i].out_anchor + patches_[i].size <= ivec2(H, W)));
+      assert(all_coords(patches_[i].in_anchor >= 0) &&
+             all_coords(patches_[i].in_anchor + patches_[i].size <=
+                        ivec2(inputs_[i].shape[0], inputs_[i].shape[1])));
+    }
+
+    fill_row_.clear();
+    if (std::any_of(fill.begin(), fill.end(), [](OutputType v) { return v != OutputType(); })) {
+      fill_row_.resize(static_cast<int64_t>(W) * C);
+      for (int64_t i = 0; i < static_cast<int64_t>(fill_row_.size()); i++)
+        fill_row_[i] = fill[fill.size() == 1 ? 0 : i % C];
+    }
+
+    std::vector<int> ys = { 0, H };
+    for (auto &p : patches_) {
+      if (p.size[0] > 0 && p.size[1] > 0) {
+        ys.push_back(p.out_anchor[0]);
+        ys.push_back(p.out_anchor[0] + p.size[0]);
+      }
+    }
+    std::sort(ys.begin(), ys.end());
+    ys.erase(std::unique(ys.begin(), ys.end()), ys.end());
+
+    groups_.clear();
+    spans_.clear();
+    std::vector<int> active, xs;
+    for (int g = 0; g + 1 < static_cast<int>(ys.size()); g++) {
+      int y0 = ys[g], y1 = ys[g + 1];
+      active.clear();
+      xs = { 0, W };
+      for (int i = 0; i < static_cast<int>(patches_.size()); i++) {
+        auto &p = patches_[i];
+        if (p.size[1] > 0 && p.out_anchor[0] <= y0 && y0 < p.out_anchor[0] + p.size[0]) {
+          active.push_back(i);
+          xs.push_back(p.out_anchor[1]);
+          xs.push_back(p.out_anchor[1] + p.size[1]);
+        }
+      }
+      std::sort(xs.begin(), xs.end());
+      xs.erase(std::unique(xs.begin(), xs.end()), xs.end());
+
+      int first_span = spans_.size();
+      for (int k = 0; k + 1 < static_cast<int>(xs.size()); k++) {
+        int x0 = xs[k], x1 = xs[k + 1];
+        int owner = -1;
+        for (int a = active.size() - 1; a >= 0; a--) {
+          auto &p = patches_[active[a]];
+          if (p.out_anchor[1] <= x0 && x0 < p.out_anchor[1] + p.size[1]) {
+            owner = active[a];
+            break;
+          }
+        }
+        if (static_cast<int>(spans_.size()) > first_span && spans_.back().patch == owner)
+          spans_.back().x1 = x1;
+        else
+          spans_.push_back({ x0, x1, owner });
+      }
+
+      if (!groups_.empty() && SameSpans(groups_.back(), first_span)) {
+        groups_.back().y1 = y1;  // the arrangement didn't change
+        spans_.resize(first_span);
+      } else {
+        groups_.push_back({ y0, y1, first_span, static_cast<int>(spans_.size()) });
+      }
+    }
+  }
+
+  bool SameSpans(const RowGroup &prev, int first_span) const {
+    int n = spans_.size() - first_span;
+    if (prev.end_span - prev.first_span != n)
+      return false;
+    for (int i = 0; i < n; i++) {
+      const Span &a = spans_[prev.first_span + i], &b = spans_[first_span + i];
+      if (a.x0 != b.x0 || a.x1 != b.x1 || a.patch != b.patch)
+        return false;
+    }
+    return true;
+  }
+
+  void RunRows(int64_t y_begin, int64_t y_end) {
+    int64_t W = out_.shape[1], C = out_.shape[2];
+    auto group_it = std::upper_bound(groups_.begin(), groups_.end(), y_begin,
+                                     [](int64_t y, const RowGroup &g) { return y < g.y1; });
+    for (int64_t y = y_begin; y < y_end; group_it++) {
+      assert(group_it != groups_.end());
+      const RowGroup &group = *group_it;
+      for (; y < std::min<int64_t>(group.y1, y_end); y++) {
+        OutputType *out_row = out_.data + y * W * C;
+        for (int s = group.first_span; s < group.end_span; s++) {
+          const Span &span = spans_[s];
+          OutputType *out_ptr = out_row + span.x0 * C;
+          int64_t n = (span.x1 - span.x0) * C;
+          if (span.patch < 0) {
+            if (fill_row_.empty())
+              std::memset(out_ptr, 0, n * sizeof(OutputType));
+            else
+              std::memcpy(out_ptr, fill_row_.data() + span.x0 * C, n * sizeof(OutputType));
+          } else {
+            const Patch &p = patches_[span.patch];
+            const auto &in = inputs_[span.patch];
+            int64_t in_y = y - p.out_anchor[0] + p.in_anchor[0];
+            int64_t in_x = span.x0 - p.out_anchor[1] + p.in_anchor[1];
+            paste::ConvertRow(out_ptr, in.data + (in_y * in.shape[1] + in_x) * C, n);
+          }
+        }
+      }
+    }
+  }
+
+  OutTensorCPU<OutputType, 3> out_;
+  std::vector<InTensorCPU<InputType, 3>> inputs_;
+  std::vector<Patch> patches_;
+  std::vector<OutputType> fill_row_;
+  std::vector<RowGroup> groups_;
+  std::vector<Span> spans_;
+};
+
+}  // namespace kernels
+}  // namespace dali
+
+#endif  // DALI_KERNELS_IMGPROC_PASTE_PASTE_CPU_H_
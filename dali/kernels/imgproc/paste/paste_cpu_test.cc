@@ -0,0 +1,153 @@
+// Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <random>
+#include <utility>
+#include <vector>
+#include "dali/core/exec/deferred_engine.h"
+#include "dali/kernels/imgproc/paste/paste_cpu.h"
+
+namespace dali {
+namespace kernels {
+
+namespace {
+
+template <typename Out, typename In>
+void RefMultiPaste(Out *out, int H, int W, int C, const std::vector<const In *> &inputs,
+                   const std::vector<TensorShape<3>> &in_shapes,
+                   const std::vector<paste::MultiPasteSampleInput<2>::InputPatch> &patches,
+                   const std::vector<Out> &fill) {
+  for (int64_t i = 0; i < int64_t{H} * W * C; i++)
+    out[i] = fill.empty() ? Out() : fill[fill.size() == 1 ? 0 : i % C];
+  for (size_t p = 0; p < patches.size(); p++) {
+    auto &patch = patches[p];
+    for (int y = 0; y < patch.size[0]; y++)
+      for (int x = 0; x < patch.size[1]; x++)
+        for (int c = 0; c < C; c++) {
+          int in_y = patch.in_anchor[0] + y, in_x = patch.in_anchor[1] + x;
+          int out_y = patch.out_anchor[0] + y, out_x = patch.out_anchor[1] + x;
+          out[(out_y * W + out_x) * C + c] =
+              ConvertSat<Out>(inputs[p][(in_y * in_shapes[p][1] + in_x) * C + c]);
+        }
+  }
+}
+
+template <typename Out, typename In>
+void TestMultiPaste(bool overlapping, bool scheduled, int nfill) {
+  std::mt19937_64 rng(overlapping * 4 + scheduled * 2 + nfill);
+  int H = 123, W = 97, C = 3;
+  int npatches = 7;
+  std::vector<std::vector<In>> in_data(npatches);
+  std::vector<TensorShape<3>> in_shapes(npatches);
+  std::vector<InTensorCPU<In, 3>> inputs(npatches);
+  std::vector<const In *> in_ptrs(npatches);
+  std::vector<paste::MultiPasteSampleInput<2>::InputPatch> patches(npatches);
+  std::uniform_real_distribution<float> value_dist(-300, 300);
+  for (int p = 0; p < npatches; p++) {
+    in_shapes[p] = { 40 + p * 5, 30 + p * 7, C };
+    in_data[p].resize(volume(in_shapes[p]));
+    for (auto &v : in_data[p]) {
+      float f = value_dist(rng);
+      // include halfway cases
+      v = ConvertSat<In>(p % 2 ? std::floor(f) + 0.5f : f);
+    }
+    inputs[p] = make_tensor_cpu<3>(in_data[p].data(), in_shapes[p]);
+    in_ptrs[p] = in_data[p].data();
+    auto &patch = patches[p];
+    int ih = in_shapes[p][0], iw = in_shapes[p][1];
+    auto uniform = [&](int lo, int hi) {
+      return std::uniform_int_distribution<int>(lo, hi)(rng);
+    };
+    if (overlapping) {
+      patch.size = { uniform(0, ih), uniform(0, iw) };
+      patch.in_anchor = { uniform(0, ih - patch.size[0]), uniform(0, iw - patch.size[1]) };
+      patch.out_anchor = { uniform(0, H - patch.size[0]), uniform(0, W - patch.size[1]) };
+    } else {
+      // a grid of tiles, like in a mosaic
+      int ty = p / 3, tx = p % 3;
+      patch.size = { std::min(H / 3, ih), std::min(W / 3, iw) };
+      patch.in_anchor = { ih - patch.size[0], 0 };
+      patch.out_anchor = { ty * (H / 3), tx * (W / 3) };
+    }
+  }
+  std::vector<Out> fill;
+  for (int c = 0; c < nfill; c++)
+    fill.push_back(ConvertSat<Out>(10 * c + 5));
+
+  std::vector<Out> out(H * W * C, 77), ref(out.size());
+  RefMultiPaste(ref.data(), H, W, C, in_ptrs, in_shapes, patches, fill);
+
+  MultiPasteCPU<Out, In> kernel;
+  auto out_tv = make_tensor_cpu<3>(out.data(), { H, W, C });
+  if (scheduled) {
+    DeferredEngine engine;
+    kernel.Schedule(engine, out_tv, make_cspan(inputs), make_cspan(patches), make_cspan(fill), 9);
+    engine.RunAll();
+  } else {
+    KernelContext ctx;
+    kernel.Run(ctx, out_tv, make_cspan(inputs), make_cspan(patches), make_cspan(fill));
+  }
+  for (int y = 0; y < H; y++)
+    for (int x = 0; x < W; x++)
+      for (int c = 0; c < C; c++) {
+        int i = (y * W + x) * C + c;
+        ASSERT_EQ(out[i], ref[i]) << " at " << y << ", " << x << ", " << c;
+      }
+}
+
+}  // namespace
+
+TEST(MultiPasteCPU, SameType) {
+  for (bool overlapping : { false, true })
+    for (bool scheduled : { false, true })
+      TestMultiPaste<uint8_t, uint8_t>(overlapping, scheduled, 0);
+}
+
+TEST(MultiPasteCPU, Convert) {
+  for (bool overlapping : { false, true }) {
+    TestMultiPaste<float, uint8_t>(overlapping, true, 0);
+    TestMultiPaste<uint8_t, float>(overlapping, true, 3);
+    TestMultiPaste<int16_t, float>(overlapping, true, 1);
+    TestMultiPaste<int32_t, float>(overlapping, false, 0);
+    TestMultiPaste<int32_t, int16_t>(overlapping, true, 3);
+    TestMultiPaste<uint8_t, int32_t>(overlapping, false, 1);
+    TestMultiPaste<float, int32_t>(overlapping, true, 0);
+  }
+}
+
+TEST(MultiPasteCPU, Fill) {
+  for (int nfill : { 1, 3 })
+    TestMultiPaste<uint8_t, uint8_t>(true, true, nfill);
+}
+
+TEST(MultiPasteCPU, ConvertRow) {
+  std::vector<float> in = { 0.5f, 1.5f, 2.5f, -0.5f, -1.5f, 254.5f, 255.5f, 1e10f,
+                            -1e10f, 3.49999f, 7.0f, 0.0f, 100.25f, -3.75f, 65535.5f, 1e7f,
+                            0.5f, 1.5f };
+  std::vector<uint8_t> out_u8(in.size());
+  std::vector<int16_t> out_i16(in.size());
+  std::vector<int32_t> out_i32(in.size());
+  paste::ConvertRow(out_u8.data(), in.data(), in.size());
+  paste::ConvertRow(out_i16.data(), in.data(), in.size());
+  paste::ConvertRow(out_i32.data(), in.data(), in.size());
+  for (size_t i = 0; i < in.size(); i++) {
+    EXPECT_EQ(out_u8[i], ConvertSat<uint8_t>(in[i])) << " for " << in[i];
+    EXPECT_EQ(out_i16[i], ConvertSat<int16_t>(in[i])) << " for " << in[i];
+    EXPECT_EQ(out_i32[i], ConvertSat<int32_t>(in[i])) << " for " << in[i];
+  }
+}
+
+}  // namespace kernels
+}  // namespace dali
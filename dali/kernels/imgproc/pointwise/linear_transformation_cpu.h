@@ -15,12 +15,15 @@
 #ifndef DALI_KERNELS_IMGPROC_POINTWISE_LINEAR_TRANSFORMATION_CPU_H_
 #define DALI_KERNELS_IMGPROC_POINTWISE_LINEAR_TRANSFORMATION_CPU_H_
 
+#include <cmath>
+#include <type_traits>
 #include <vector>
 #include <utility>
 #include "dali/core/format.h"
 #include "dali/core/convert.h"
 #include "dali/core/geom/box.h"
 #include "dali/kernels/common/block_setup.h"
+#include "dali/kernels/imgproc/color_manipulation/color_space_conversion_cpu.h"
 #include "dali/kernels/imgproc/surface.h"
 #include "dali/kernels/imgproc/roi.h"
 
@@ -60,6 +63,21 @@ class LinearTransformationCpu {
     auto ptr = out.data;
     auto in_width = in.shape[1];
 
+    if constexpr (std::is_same<OutputType, uint8_t>::value &&
+                  std::is_same<InputType, uint8_t>::value &&
+                  channels_out == 3 && channels_in == 3) {
+      color::cpu::detail::FixedPointTransform3 t;
+      if (ToFixedPoint(t, tmatrix, tvector)) {
+        int64_t width = adjusted_roi.hi.x - adjusted_roi.lo.x;
+        for (int y = adjusted_roi.lo.y; y < adjusted_roi.hi.y; y++) {
+          auto *row_ptr = &in.data[(y * in_width + adjusted_roi.lo.x) * channels_in];
+          color::cpu::detail::transform_row_u8<3, 3>(ptr, row_ptr, width, t);
+          ptr += width * channels_out;
+        }
+        return;
+      }
+    }
+
     for (int y = adjusted_roi.lo.y; y < adjusted_roi.hi.y; y++) {
       auto *row_ptr = &in.data[y * in_width * channels_in];
       for (int x = adjusted_roi.lo.x; x < adjusted_roi.hi.x; x++) {
@@ -74,6 +92,31 @@ class LinearTransformationCpu {
       }
     }
   }
+
+ private:
+  /**
+   * @brief Converts the transform to 8-bit fixed-point, if it can be done accurately
+   *
+   * The coefficients must fit in 16 bits with at least 10 fractional bits and the offsets
+   * must be small enough not to overflow the 32-bit accumulators.
+   */
+  static bool ToFixedPoint(color::cpu::detail::FixedPointTransform3 &t, const Mat &m,
+                           const Vec &v) {
+    double dm[3][3], dv[3];
+    for (int k = 0; k < 3; k++) {
+      for (int j = 0; j < 3; j++)
+        dm[k][j] = m(k, j);
+      dv[k] = v[k];
+      if (!(std::abs(dv[k]) < 4096))  // also rejects NaN
+        return false;
+    }
+    for (int k = 0; k < 3; k++)
+      for (int j = 0; j < 3; j++)
+        if (!(std::abs(dm[k][j]) < 32))
+          return false;
+    t = color::cpu::detail::MakeFixedPointTransform(dm, dv);
+    return t.bits >= 10;
+  }
 };
 
 }  // namespace kernels
@@ -163,6 +163,42 @@ TYPED_TEST(LinearTransformationCpuTest, run_test_with_roi) {
   Check(out, view_as_tensor<float>(mat), EqualUlp());
 }
 
+TEST(LinearTransformationCpuFixedPointTest, rgb_u8) {
+  // a hue rotation combined with saturation and value scaling, as used by the Hsv operator
+  mat3 m = {{
+    { 0.7071f, 0.4123f, -0.1194f },
+    { -0.2237f, 1.1151f, 0.3013f },
+    { 0.1577f, -0.3512f, 1.4142f },
+  }};
+  vec3 offset = { 5.31f, -20.17f, 3.09f };
+  std::vector<uint8_t> input(37 * 45 * 3);
+  std::mt19937_64 rng;
+  UniformRandomFill(input, rng, 0, 255);
+  Roi<2> roi = {{3, 2}, {40, 29}};
+  InTensorCPU<uint8_t, kNDims> in(input.data(), {37, 45, 3});
+  auto out_shape = ShapeFromRoi(roi, 3);
+  std::vector<uint8_t> output(volume(out_shape));
+  OutTensorCPU<uint8_t, kNDims> out(output.data(), out_shape);
+
+  LinearTransformationCpu<uint8_t, uint8_t, 3, 3, kNDims> kernel;
+  KernelContext ctx;
+  kernel.Run(ctx, out, in, m, offset, &roi);
+
+  int num_off = 0;
+  for (int y = roi.lo.y; y < roi.hi.y; y++) {
+    for (int x = roi.lo.x; x < roi.hi.x; x++) {
+      const uint8_t *px = &input[(y * 45 + x) * 3];
+      vec3 ref = m * vec3(px[0], px[1], px[2]) + offset;
+      for (int c = 0; c < 3; c++) {
+        int diff = std::abs(*out(y - roi.lo.y, x - roi.lo.x, c) - ConvertSat<uint8_t>(ref[c]));
+        ASSERT_LE(diff, 1) << " at " << y << ", " << x << ", " << c;
+        num_off += diff;
+      }
+    }
+  }
+  EXPECT_LT(num_off, volume(out_shape) / 100);
+}
+
 }  // namespace test
 }  // namespace kernels
 }  // namespace dali
@@ -21,15 +21,16 @@ namespace kernels {
 
 void InitializeResamplingFilter(
     int32_t *out_indices, float *out_coeffs, int out_size,
-    float srcx_0, float scale, const ResamplingFilter &filter) {
+    float srcx_0, float scale, const ResamplingFilter &filter,
+    int out_offset, int in_offset) {
 
   srcx_0 += 0.5f * scale - 0.5f - filter.anchor;
   int support = filter.support();
 
   for (int x = 0; x < out_size; x++) {
-    float sx0f = x * scale + srcx_0;
+    float sx0f = (x + out_offset) * scale + srcx_0;
     int sx0 = ceilf(sx0f);  // ceiling - below sx0f we assume the filter to be zero
-    out_indices[x] = sx0;
+    out_indices[x] = sx0 - in_offset;
     const float f0 = sx0 - sx0f;
     float sum = 0;
     int k = 0;
@@ -29,9 +29,17 @@ namespace kernels {
 struct FilterWindow;
 struct ResamplingFilter;
 
+/**
+ * @brief Calculates the input indices and filter coefficients for each output position
+ *
+ * The source coordinate of output position `x` is `srcx0 + (x + out_offset + 0.5) * scale`;
+ * the indices are stored relative to `in_offset`. The offsets allow a part of the output to be
+ * calculated with exactly the same coefficients as when calculating the whole.
+ */
 DLL_PUBLIC
 void InitializeResamplingFilter(int32_t *out_indices, float *out_coeffs, int out_size,
-                                float srcx0, float scale, const ResamplingFilter &filter);
+                                float srcx0, float scale, const ResamplingFilter &filter,
+                                int out_offset = 0, int in_offset = 0);
 
 /**
  * @brief Calculates a single pixel for horizontal resampling
@@ -510,18 +518,30 @@ inline void ResampleAxis(Surface<spatial_ndim, Out> out, Surface<spatial_ndim, I
     assert(!"Invalid axis index");
 }
 
+/**
+ * @brief Returns the (unclamped) index of the source pixel for the output pixel `x`
+ *
+ * The coordinate is not accumulated, so it doesn't depend on which part of the output is
+ * calculated.
+ */
+inline int NNSourceIndex(int x, float origin, float scale) {
+  return std::floor(origin + (x + 0.5f) * scale);
+}
+
 /**
  * @brief Resamples `in` using Nearest Neighbor interpolation and stores result in `out`
  * @param out - output surface
  * @param in - input surface
  * @param origin - input coordinates corresponding to output's origin
  * @param scale - step of input coordinates taken for each output pixel
+ * @param out_y0 - the index of the first output row in the whole output image
+ * @param in_y0 - the index of the first input row in the whole input image
  * @remarks The function clamps input coordinates to fit in range defined by `in` dimensions.
  *          Scales can be negative to achieve flipping.
  */
 template <typename Out, typename In>
 void ResampleNN(Surface2D<Out> out, Surface2D<const In> in,
-                vec2 origin, vec2 scale) {
+                vec2 origin, vec2 scale, int out_y0 = 0, int in_y0 = 0) {
   assert(out.channels == in.channels);
   assert((in.channel_stride == 1 && out.channel_stride == 1) ||
          (in.channels == 1 && out.channels == 1));
@@ -539,9 +559,8 @@ void ResampleNN(Surface2D<Out> out, Surface2D<const In> in,
       dx0 = std::min(-sx0, out.size.x);
     }
 
-    float sy = origin.y + 0.5f * scale.y;
-    for (int y = 0; y < out.size.y; y++, sy += scale.y) {
-      int srcy = std::floor(sy);
+    for (int y = 0; y < out.size.y; y++) {
+      int srcy = NNSourceIndex(y + out_y0, origin.y, scale.y) - in_y0;
 
       if (srcy < 0) srcy = 0;
       else if (srcy > in.size.y-1) srcy = in.size.y-1;
@@ -573,21 +592,18 @@ void ResampleNN(Surface2D<Out> out, Surface2D<const In> in,
   int col_offsets[max_span_width];  // NOLINT (kOnstant)
 
   for (int x0 = 0; x0 < out.size.x; x0 += max_span_width) {
-    float sy = origin.y + 0.5f * scale.y;
-
     int span_width = x0 + max_span_width <= out.size.x ? max_span_width : out.size.x - x0;
 
     for (int j = 0; j < span_width; j++) {
       int x = x0 + j;
-      float sx = origin.x + (x + 0.5f) * scale.x;
-      int srcx = std::floor(sx);
+      int srcx = NNSourceIndex(x, origin.x, scale.x);
       if (srcx < 0) srcx = 0;
-      else if (srcx > in.size.x-1) srcx += in.size.x - 1;
+      else if (srcx > in.size.x-1) srcx = in.size.x - 1;
       col_offsets[j] = srcx * in.strides.x;
     }
 
-    for (int y = 0; y < out.size.y; y++, sy += scale.y) {
-      int srcy = std::floor(sy);
+    for (int y = 0; y < out.size.y; y++) {
+      int srcy = NNSourceIndex(y + out_y0, origin.y, scale.y) - in_y0;
 
       if (srcy < 0) srcy = 0;
       else if (srcy > in.size.y-1) srcy = in.size.y-1;
@@ -612,17 +628,18 @@ void ResampleNN(Surface2D<Out> out, Surface2D<const In> in,
  * @param in - input surface
  * @param origin - input coordinates corresponding to output's origin
  * @param scale - step of input coordinates taken for each output pixel
+ * @param out_offset - the index of the first output slice (outermost dimension) in the whole output
+ * @param in_offset - the index of the first input slice (outermost dimension) in the whole input
  * @remarks The function clamps input coordinates to fit in range defined by `in` dimensions.
  *          Scales can be negative to achieve flipping.
  */
 template <typename Out, typename In, int n>
 void ResampleNN(Surface<n, Out> out, Surface<n, const In> in,
-                vec<n> origin, vec<n> scale) {
+                vec<n> origin, vec<n> scale, int out_offset = 0, int in_offset = 0) {
   static_assert(n > 2, "This function only works with surfaces of dimensionality > 2");
-  const float step = scale[n-1];
-  float src = origin[n-1] + 0.5f * step;
-  for (int i = 0; i < out.size[n-1]; i++, src += step) {
-    int isrc = clamp<int>(std::floor(src), 0, in.size[n-1]-1);
+  for (int i = 0; i < out.size[n-1]; i++) {
+    int isrc = NNSourceIndex(i + out_offset, origin[n-1], scale[n-1]) - in_offset;
+    isrc = clamp<int>(isrc, 0, in.size[n-1]-1);
     ResampleNN(out.slice(i), in.slice(isrc), sub<n-1>(origin), sub<n-1>(scale));
   }
 }
@@ -117,14 +117,91 @@ struct ResamplingSetupSingleImage : ResamplingSetupCPU<spatial_ndim> {
   using typename Base::MemoryReq;
   using Base::tensor_ndim;
 
+  /// The outermost axis, in vec order
+  static constexpr int outer_axis = spatial_ndim - 1;
+
+  /**
+   * @brief Prepares the resampling of the output slices `[out_begin, out_end)` along the
+   *        outermost dimension (a negative `out_end` denotes the end of the output)
+   */
   void Setup(const TensorShape<tensor_ndim> &in_shape,
-             const ResamplingParamsND<spatial_ndim> &params) {
+             const ResamplingParamsND<spatial_ndim> &params,
+             int out_begin = 0, int out_end = -1) {
     this->SetupSample(desc, in_shape, params);
+    SelectOuterRange(in_shape, params, out_begin, out_end);
     memory = this->GetMemoryRequirements(desc);
   }
 
   SampleDesc desc;
   MemoryReq memory;
+  /// The index of the first output slice in the whole output
+  int outer_out_offset = 0;
+  /// The index of the first input slice, read by the resampling, in the whole input
+  int outer_in_offset = 0;
+
+ private:
+  /**
+   * @brief Restricts the processing to a range of output slices along the outermost axis
+   *
+   * The source coordinates along the outermost axis are calculated in the coordinate system of
+   * the whole image; the range only offsets the output and input indices by integers. This way,
+   * the parts of the output stitch exactly - bit for bit - into the full result.
+   * The range is applied also when it spans the whole output, so that the same arithmetic is
+   * used regardless of how the image is split.
+   */
+  void SelectOuterRange(const TensorShape<tensor_ndim> &in_shape,
+                        const ResamplingParamsND<spatial_ndim> &params,
+                        int out_begin, int out_end) {
+    constexpr int a = outer_axis;
+    int in_extent = in_shape[0];
+    int out_extent = desc.out_shape()[a];
+    if (out_end < 0)
+      out_end = out_extent;
+    assert(0 <= out_begin && out_begin <= out_end && out_end <= out_extent);
+
+    ptrdiff_t in_stride = spatial_ndim > 1 ? desc.strides[0][a - 1] : desc.channels;
+
+    // SetupSample may have cropped the input to the ROI and moved the origin accordingly - undo
+    float origin = params[0].roi.use_roi ? params[0].roi.start : 0;
+    int cropped = std::lround(origin - desc.origin[a]);
+    desc.in_offset() -= cropped * in_stride;
+    desc.origin[a] = origin;
+
+    // The range of input slices read when calculating the selected output slices.
+    // It's calculated with a margin, so it's conservative; the slices beyond the filter's
+    // footprint are never read.
+    double scale = desc.scale[a];
+    const auto &filter = desc.filter[a];
+    int support = std::max(1, filter.support());
+    double s0 = origin + (out_begin + 0.5) * scale;
+    double s1 = origin + (out_end - 0.5) * scale;
+    if (s0 > s1)
+      std::swap(s0, s1);
+    int64_t lo = std::floor(s0 - 0.5 - filter.anchor) - 1;
+    int64_t hi = std::ceil(s1 - 0.5 - filter.anchor) + support + 1;
+    lo = clamp<int64_t>(lo, 0, in_extent);
+    hi = clamp<int64_t>(hi, 0, in_extent);
+    if (hi <= lo) {  // the whole range is clamped to an edge - keep the edge slice
+      if (lo >= in_extent)
+        lo = in_extent - 1;
+      hi = lo + 1;
+    }
+    if (out_begin == out_end)
+      lo = hi = 0;
+
+    desc.in_offset() += lo * in_stride;
+    desc.in_shape()[a] = hi - lo;
+    desc.out_shape()[a] = out_end - out_begin;
+    // the outermost dimension doesn't affect the strides, only the intermediate shapes
+    for (int pass = 0; pass < spatial_ndim - 1; pass++) {
+      bool resized = false;
+      for (int p = 0; p <= pass; p++)
+        resized |= desc.order[p] == a;
+      desc.tmp_shape(pass)[a] = resized ? desc.out_shape()[a] : desc.in_shape()[a];
+    }
+    outer_out_offset = out_begin;
+    outer_in_offset = lo;
+  }
 };
 
 template <typename OutputElement, typename InputElement, int _spatial_ndim>
@@ -134,10 +211,17 @@ struct SeparableResampleCPU  {
   using Input =  InTensorCPU<InputElement, tensor_ndim>;
   using Output = OutTensorCPU<OutputElement, tensor_ndim>;
 
+  /**
+   * @brief Sets up the resampling of `input`
+   *
+   * Optionally, only the output slices `[out_begin, out_end)` along the outermost dimension are
+   * calculated; the result is bit-exact with the corresponding part of the whole output.
+   */
   KernelRequirements Setup(KernelContext &context,
                            const Input &input,
-                           const ResamplingParamsND<spatial_ndim> &params) {
-    setup.Setup(input.shape, params);
+                           const ResamplingParamsND<spatial_ndim> &params,
+                           int out_begin = 0, int out_end = -1) {
+    setup.Setup(input.shape, params, out_begin, out_end);
 
     TensorShape<tensor_ndim> out_shape =
       shape_cat(vec2shape(setup.desc.out_shape()), setup.desc.channels);
@@ -169,7 +253,8 @@ struct SeparableResampleCPU  {
     out_ROI.data = desc.template out_ptr<OutputElement>();
 
     if (setup.IsPureNN(desc)) {
-      ResampleNN(out_ROI, in_ROI, desc.origin, desc.scale);
+      ResampleNN(out_ROI, in_ROI, desc.origin, desc.scale,
+                 setup.outer_out_offset, setup.outer_in_offset);
     } else {
       TensorShape<tensor_ndim> tmp_shapes[num_tmp_buffers];
       for (int i = 0; i < num_tmp_buffers; i++) {
@@ -217,15 +302,22 @@ struct SeparableResampleCPU  {
                     void *mem,
                     int axis) {
     auto &desc = setup.desc;
+    bool outer = axis == setup.outer_axis;
+    int out_offset = outer ? setup.outer_out_offset : 0;
+    int in_offset = outer ? setup.outer_in_offset : 0;
 
     if (desc.filter_type[axis] == ResamplingFilterType::Nearest) {
       // use specialized NN resampling pass - should be faster
+      // the other axes are copied 1:1
+      auto origin = desc.origin;
       auto scale = desc.scale;
       for (int i = 0; i < spatial_ndim; i++) {
-        if (i != axis)
+        if (i != axis) {
+          origin[i] = 0;
           scale[i] = 1;
+        }
       }
-      ResampleNN(out, in, desc.origin, scale);
+      ResampleNN(out, in, origin, scale, out_offset, in_offset);
     } else {
       int32_t *indices = static_cast<int32_t*>(mem);
       int out_size = desc.out_shape()[axis];
@@ -234,7 +326,7 @@ struct SeparableResampleCPU  {
 
       InitializeResamplingFilter(indices, coeffs, out_size,
                                  desc.origin[axis], desc.scale[axis],
-                                 desc.filter[axis]);
+                                 desc.filter[axis], out_offset, in_offset);
 
       ResampleAxis(out, in, indices, coeffs, support, axis);
     }
@@ -0,0 +1,261 @@
+// Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DALI_KERNELS_IMGPROC_WARP_WARP_AFFINE_CPU_IMPL_H_
+#define DALI_KERNELS_IMGPROC_WARP_WARP_AFFINE_CPU_IMPL_H_
+
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+#include <utility>
+#include "dali/core/common.h"
+#include "dali/core/convert.h"
+#include "dali/core/force_inline.h"
+#include "dali/core/geom/vec.h"
+#include "dali/core/static_switch.h"
+#include "dali/kernels/common/simd.h"
+#include "dali/kernels/imgproc/surface.h"
+
+namespace dali {
+namespace kernels {
+namespace warp {
+
+/**
+ * @brief Source coordinates of the pixel `x` in an output row of a 2D affine warp
+ *
+ * @param src0 source coordinates of the first pixel in the row
+ * @param dsdx source coordinates increment per output pixel
+ *
+ * The coordinates are calculated directly instead of being accumulated, so that there's no
+ * accumulation error and the vectorized implementation produces exactly the same values.
+ */
+DALI_FORCEINLINE vec2 affine_row_coords(vec2 src0, vec2 dsdx, int x) {
+  float fx = x;
+  return vec2(src0.x + fx * dsdx.x, src0.y + fx * dsdx.y);
+}
+
+/**
+ * @brief Calculates the range of pixels in an output row for which no border handling is needed
+ *
+ * @return [begin, end) range of x coordinates in the output row, for which all source pixels
+ *         used in interpolation lie inside the input image
+ */
+template <DALIInterpType interp>
+ivec2 AffineRowInterior(vec2 src0, vec2 dsdx, int out_w, ivec2 in_size) {
+  // Linear interpolation reads the pixel at floor(s - 0.5) and the next one.
+  constexpr float margin = interp == DALI_INTERP_LINEAR ? 0.5f : 0.0f;
+  vec2 lo(margin, margin);
+  vec2 hi(in_size.x - margin, in_size.y - margin);
+
+  float begin = 0, end = out_w;
+  for (int a = 0; a < 2; a++) {
+    if (dsdx[a] == 0) {
+      if (!(src0[a] >= lo[a] && src0[a] < hi[a]))
+        return { 0, 0 };
+      continue;
+    }
+    float t0 = (lo[a] - src0[a]) / dsdx[a];
+    float t1 = (hi[a] - src0[a]) / dsdx[a];
+    if (t0 > t1)
+      std::swap(t0, t1);
+    begin = std::max(begin, t0);
+    end = std::min(end, t1);
+  }
+  if (!(begin < end))
+    return { 0, 0 };
+
+  int x0 = std::ceil(begin);
+  int x1 = std::min<int>(std::floor(end) + 1, out_w);
+
+  // The analytical solution may be off by a pixel due to rounding - the range is adjusted,
+  // so that it agrees with the coordinates that are actually used for sampling.
+  // The coordinates are monotonic in x, so it's enough to check the ends.
+  auto inside = [&](int x) {
+    vec2 s = affine_row_coords(src0, dsdx, x);
+    return s.x >= lo.x && s.x < hi.x && s.y >= lo.y && s.y < hi.y;
+  };
+  while (x0 < x1 && !inside(x0))
+    x0++;
+  while (x1 > x0 && !inside(x1 - 1))
+    x1--;
+  return { x0, x1 };
+}
+
+#ifdef __SSE2__
+/**
+ * @brief Calculates integer and fractional parts of source coordinates of 4 consecutive pixels
+ *
+ * The source coordinates must be non-negative, so that truncation is equivalent to floor.
+ */
+DALI_FORCEINLINE void affine_coords4(int32_t *ix, int32_t *iy, float *qx, float *qy,
+                                     vec2 src0, vec2 dsdx, int x, float offset) {
+  __m128 vx = _mm_add_ps(_mm_set1_ps(x), _mm_setr_ps(0, 1, 2, 3));
+  __m128 sx = _mm_add_ps(_mm_set1_ps(src0.x), _mm_mul_ps(vx, _mm_set1_ps(dsdx.x)));
+  __m128 sy = _mm_add_ps(_mm_set1_ps(src0.y), _mm_mul_ps(vx, _mm_set1_ps(dsdx.y)));
+  sx = _mm_sub_ps(sx, _mm_set1_ps(offset));
+  sy = _mm_sub_ps(sy, _mm_set1_ps(offset));
+  __m128i vix = _mm_cvttps_epi32(sx);
+  __m128i viy = _mm_cvttps_epi32(sy);
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(ix), vix);
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(iy), viy);
+  if (qx) {
+    _mm_storeu_ps(qx, _mm_sub_ps(sx, _mm_cvtepi32_ps(vix)));
+    _mm_storeu_ps(qy, _mm_sub_ps(sy, _mm_cvtepi32_ps(viy)));
+  }
+}
+#endif
+
+/**
+ * @brief Samples the interior part of an output row with nearest neighbor interpolation
+ *
+ * @param out pointer to the output row
+ * @param x_begin the first pixel to process; must be inside the range returned by
+ *                AffineRowInterior
+ * @param x_end one past the last pixel to process
+ */
+template <int static_channels, typename Out, typename In>
+void WarpAffineRowNN(Out *out, const Surface2D<const In> &in, vec2 src0, vec2 dsdx,
+                     int x_begin, int x_end, int dynamic_channels) {
+  const int channels = static_channels < 0 ? dynamic_channels : static_channels;
+  const In *data = in.data;
+  int64_t pixel_stride = in.strides.x, row_stride = in.strides.y;
+  int64_t channel_stride = in.channel_stride;
+  int x = x_begin;
+#ifdef __SSE2__
+  for (; x + 4 <= x_end; x += 4) {
+    int32_t ix[4], iy[4];
+    affine_coords4(ix, iy, nullptr, nullptr, src0, dsdx, x, 0.0f);
+    for (int l = 0; l < 4; l++) {
+      const In *src = data + iy[l] * row_stride + ix[l] * pixel_stride;
+      for (int c = 0; c < channels; c++)
+        out[(x + l) * channels + c] = ConvertSat<Out>(src[c * channel_stride]);
+    }
+  }
+#endif
+  for (; x < x_end; x++) {
+    ivec2 pos = floor_int(affine_row_coords(src0, dsdx, x));
+    const In *src = data + pos.y * row_stride + pos.x * pixel_stride;
+    for (int c = 0; c < channels; c++)
+      out[x * channels + c] = ConvertSat<Out>(src[c * channel_stride]);
+  }
+}
+
+/**
+ * @brief Samples the interior part of an output row with bilinear interpolation
+ *
+ * The coordinates and weights are calculated for a vector of 4 pixels at a time and then the
+ * interpolation is carried out on the gathered source values, one channel at a time.
+ *
+ * @param out pointer to the output row
+ * @param x_begin the first pixel to process; must be inside the range returned by
+ *                AffineRowInterior
+ * @param x_end one past the last pixel to process
+ */
+template <int static_channels, typename Out, typename In>
+void WarpAffineRowLinear(Out *out, const Surface2D<const In> &in, vec2 src0, vec2 dsdx,
+                         int x_begin, int x_end, int dynamic_channels) {
+  const int channels = static_channels < 0 ? dynamic_channels : static_channels;
+  const In *data = in.data;
+  int64_t pixel_stride = in.strides.x, row_stride = in.strides.y;
+  int64_t channel_stride = in.channel_stride;
+  int x = x_begin;
+#ifdef __SSE2__
+  // integers are gathered as int32 and converted to/from float with vector instructions
+  using Gathered = std::conditional_t<std::is_integral<In>::value, int32_t, float>;
+  using Result = std::conditional_t<std::is_integral<Out>::value, int32_t, float>;
+
+  for (; x + 4 <= x_end; x += 4) {
+    int32_t ix[4], iy[4];
+    float qx[4], qy[4];
+    affine_coords4(ix, iy, qx, qy, src0, dsdx, x, 0.5f);
+
+    const In *src[4];
+    for (int l = 0; l < 4; l++)
+      src[l] = data + iy[l] * row_stride + ix[l] * pixel_stride;
+
+    __m128 vqx = _mm_loadu_ps(qx), vqy = _mm_loadu_ps(qy);
+    __m128 vpx = _mm_sub_ps(_mm_set1_ps(1.0f), vqx);
+
+    for (int c = 0; c < channels; c++) {
+      Gathered s00[4], s01[4], s10[4], s11[4];
+      for (int l = 0; l < 4; l++) {
+        const In *p = src[l] + c * channel_stride;
+        s00[l] = p[0];
+        s01[l] = p[pixel_stride];
+        s10[l] = p[row_stride];
+        s11[l] = p[row_stride + pixel_stride];
+      }
+      __m128 v00 = simd::load_f(s00).v[0], v01 = simd::load_f(s01).v[0];
+      __m128 v10 = simd::load_f(s10).v[0], v11 = simd::load_f(s11).v[0];
+      __m128 s0 = _mm_add_ps(_mm_mul_ps(v00, vpx), _mm_mul_ps(v01, vqx));
+      __m128 s1 = _mm_add_ps(_mm_mul_ps(v10, vpx), _mm_mul_ps(v11, vqx));
+      __m128 result = _mm_add_ps(s0, _mm_mul_ps(_mm_sub_ps(s1, s0), vqy));
+
+      Result tmp[4];
+      if constexpr (std::is_integral<Out>::value)
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(tmp), simd::saturate_f_i32(result));
+      else
+        _mm_storeu_ps(tmp, result);
+      for (int l = 0; l < 4; l++)
+        out[(x + l) * channels + c] = clamp<Out>(tmp[l]);
+    }
+  }
+#endif
+  for (; x < x_end; x++) {
+    vec2 s = affine_row_coords(src0, dsdx, x);
+    float fx = s.x - 0.5f;
+    float fy = s.y - 0.5f;
+    int x0 = floor_int(fx);
+    int y0 = floor_int(fy);
+    float qx = fx - x0;
+    float px = 1 - qx;
+    float qy = fy - y0;
+    const In *src = data + y0 * row_stride + x0 * pixel_stride;
+    for (int c = 0; c < channels; c++) {
+      const In *p = src + c * channel_stride;
+      float s0 = p[0] * px + p[pixel_stride] * qx;
+      float s1 = p[row_stride] * px + p[row_stride + pixel_stride] * qx;
+      out[x * channels + c] = ConvertSat<Out>(s0 + (s1 - s0) * qy);
+    }
+  }
+}
+
+/**
+ * @brief Samples the interior part of an output row, dispatching to a variant with
+ *        a static number of channels, if possible.
+ */
+template <DALIInterpType interp, typename Out, typename In>
+void WarpAffineRowInterior(Out *out, const Surface2D<const In> &in, vec2 src0, vec2 dsdx,
+                           int x_begin, int x_end) {
+  if (x_begin >= x_end)
+    return;
+  int channels = in.channels;
+  VALUE_SWITCH(channels, static_channels, (1, 2, 3, 4), (
+    if (interp == DALI_INTERP_NN)
+      WarpAffineRowNN<static_channels>(out, in, src0, dsdx, x_begin, x_end, channels);
+    else
+      WarpAffineRowLinear<static_channels>(out, in, src0, dsdx, x_begin, x_end, channels);
+  ), (  // NOLINT
+    if (interp == DALI_INTERP_NN)
+      WarpAffineRowNN<-1>(out, in, src0, dsdx, x_begin, x_end, channels);
+    else
+      WarpAffineRowLinear<-1>(out, in, src0, dsdx, x_begin, x_end, channels);
+  ));  // NOLINT
+}
+
+}  // namespace warp
+}  // namespace kernels
+}  // namespace dali
+
+#endif  // DALI_KERNELS_IMGPROC_WARP_WARP_AFFINE_CPU_IMPL_H_
@@ -17,14 +17,17 @@
 
 #include <algorithm>
 #include "dali/core/common.h"
+#include "dali/core/exec/engine.h"
 #include "dali/core/geom/vec.h"
 #include "dali/core/geom/transform.h"
 #include "dali/core/static_switch.h"
+#include "dali/kernels/common/tiling.h"
 #include "dali/kernels/kernel.h"
 #include "dali/kernels/imgproc/warp/mapping_traits.h"
 #include "dali/kernels/imgproc/sampler.h"
 #include "dali/kernels/imgproc/warp/map_coords.h"
 #include "dali/kernels/imgproc/warp/affine.h"
+#include "dali/kernels/imgproc/warp/warp_affine_cpu_impl.h"
 
 namespace dali {
 namespace kernels {
@@ -77,12 +80,42 @@ class WarpCPU {
       const TensorShape<spatial_ndim> &out_size,
       DALIInterpType interp = DALI_INTERP_LINEAR,
       const BorderType &border = {}) {
+    SequentialExecutionEngine engine;
+    Schedule(engine, context, output, input, mapping_params, out_size, interp, border);
+  }
+
+  /**
+   * @brief Adds the work to the execution engine
+   *
+   * Large outputs are split into bands of rows (for 3D: of rows in all slices), so that
+   * a single image can be processed by multiple threads.
+   * The work is not run - the caller is responsible for calling `engine.RunAll()`.
+   *
+   * @param req_nblocks requested number of bands; by default, `kBandsPerThread` per thread
+   */
+  template <typename ExecutionEngine>
+  void Schedule(
+      ExecutionEngine &engine,
+      KernelContext &context,
+      const OutTensorCPU<OutputType, tensor_ndim> &output,
+      const InTensorCPU<InputType, tensor_ndim> &input,
+      const MappingParams &mapping_params,
+      const TensorShape<spatial_ndim> &out_size,
+      DALIInterpType interp = DALI_INTERP_LINEAR,
+      const BorderType &border = {},
+      int req_nblocks = -1) {
     Mapping mapping(mapping_params);
 
     assert(output.shape == shape_cat(out_size, input.shape[channel_dim]));
 
-    VALUE_SWITCH(interp, static_interp, (DALI_INTERP_NN, DALI_INTERP_LINEAR),
-      (RunImpl<static_interp>(context, output, input, mapping, border);),
+    int64_t nrows = volume(output.shape.begin(), output.shape.begin() + spatial_ndim - 1);
+    int64_t row_volume = output.shape[spatial_ndim - 1] * output.shape[channel_dim];
+
+    VALUE_SWITCH(interp, static_interp, (DALI_INTERP_NN, DALI_INTERP_LINEAR), (
+      ScheduleBands(engine, nrows, row_volume, [=, this](Band rows) {
+        auto m = mapping;
+        RunImpl<static_interp>(output, input, m, border, rows.begin, rows.end);
+      }, 0, req_nblocks);),  // NOLINT
       (DALI_FAIL("Unsupported interpolation type"))
     ); // NOLINT
   }
@@ -90,20 +123,19 @@ class WarpCPU {
  private:
   template <DALIInterpType static_interp, typename Mapping_>
   void RunImpl(
-      KernelContext &context,
       const OutTensorCPU<OutputType, 3> &output,
       const InTensorCPU<InputType, 3> &input,
       Mapping_ &mapping,
-      BorderType border = {}) {
+      BorderType border,
+      int64_t row_begin, int64_t row_end) {
     int out_w = output.shape[1];
-    int out_h = output.shape[0];
     int c     = output.shape[2];
 
     Surface2D<const InputType> in = as_surface_channel_last(input);
 
     Sampler2D<static_interp, InputType> sampler(in);
 
-    for (int y = 0; y < out_h; y++) {
+    for (int y = row_begin; y < row_end; y++) {
       OutputType *out_row = output(y, 0);
       for (int x = 0; x < out_w; x++) {
         auto src = warp::map_coords(mapping, ivec2(x, y));
@@ -114,27 +146,26 @@ class WarpCPU {
 
   template <DALIInterpType static_interp, typename Mapping_>
   void RunImpl(
-      KernelContext &context,
       const OutTensorCPU<OutputType, 4> &output,
       const InTensorCPU<InputType, 4> &input,
       Mapping_ &mapping,
-      BorderType border = {}) {
+      BorderType border,
+      int64_t row_begin, int64_t row_end) {
     int out_w = output.shape[2];
     int out_h = output.shape[1];
-    int out_d = output.shape[0];
     int c     = output.shape[3];
 
-    Surface2D<const InputType> in = as_surface_channel_last(input);
+    Surface3D<const InputType> in = as_surface_channel_last(input);
 
-    Sampler2D<static_interp, InputType> sampler(in);
+    Sampler3D<static_interp, InputType> sampler(in);
 
-    for (int z = 0; z < out_d; z++) {
-      for (int y = 0; y < out_h; y++) {
-        OutputType *out_row = output(z, y, 0);
-        for (int x = 0; x < out_w; x++) {
-          auto src = warp::map_coords(mapping, ivec3(x, y, z));
-          sampler(&out_row[c*x], src, border);
-        }
+    for (int64_t row = row_begin; row < row_end; row++) {
+      int z = row / out_h;
+      int y = row % out_h;
+      OutputType *out_row = output(z, y, 0);
+      for (int x = 0; x < out_w; x++) {
+        auto src = warp::map_coords(mapping, ivec3(x, y, z));
+        sampler(&out_row[c*x], src, border);
       }
     }
   }
@@ -142,13 +173,12 @@ class WarpCPU {
 
   template <DALIInterpType static_interp>
   void RunImpl(
-      KernelContext &context,
       const OutTensorCPU<OutputType, 3> &output,
       const InTensorCPU<InputType, 3> &input,
       AffineMapping<2> &mapping,
-      BorderType border = {}) {
+      BorderType border,
+      int64_t row_begin, int64_t row_end) {
     int out_w = output.shape[1];
-    int out_h = output.shape[0];
     int c     = output.shape[2];
 
     Surface2D<const InputType> in = as_surface_channel_last(input);
@@ -156,38 +186,35 @@ class WarpCPU {
     Sampler2D<static_interp, InputType> sampler(in);
 
     // Optimization: instead of naively calculating source coordinates for each destination pixel,
-    // we can exploit the linearity of the affine transform and just add ds/dx derivative
-    // for each x.
+    // we can exploit the linearity of the affine transform - in each row, the source coordinates
+    // are src0 + x * ds/dx.
     vec2 dsdx = mapping.transform.col(0);
 
-    // use tiles to produce "checkpoints" to avoid excessive accumulation error
-    constexpr int tile_w = 256;
-    vec2 dsdx_tile = tile_w * dsdx;
-
-    for (int y = 0; y < out_h; y++) {
+    for (int y = row_begin; y < row_end; y++) {
       OutputType *out_row = output(y, 0);
-      auto src_tile = warp::map_coords(mapping, ivec2(0, y));
-      for (int x_tile = 0; x_tile < out_w; x_tile += tile_w, src_tile += dsdx_tile) {
-        int x_tile_end = std::min(x_tile + tile_w, out_w);
-        auto src = src_tile;
-        for (int x = x_tile; x < x_tile_end; x++, src += dsdx) {
-          sampler(&out_row[c*x], src, border);
-        }
-      }
+      vec2 src0 = warp::map_coords(mapping, ivec2(0, y));
+      // Only the pixels close to the edge of the input need border handling - the rest
+      // is processed by a vectorized implementation.
+      ivec2 interior = warp::AffineRowInterior<static_interp>(src0, dsdx, out_w, in.size);
+      for (int x = 0; x < interior[0]; x++)
+        sampler(&out_row[c*x], warp::affine_row_coords(src0, dsdx, x), border);
+      warp::WarpAffineRowInterior<static_interp>(out_row, in, src0, dsdx,
+                                                 interior[0], interior[1]);
+      for (int x = interior[1]; x < out_w; x++)
+        sampler(&out_row[c*x], warp::affine_row_coords(src0, dsdx, x), border);
     }
   }
 
 
   template <DALIInterpType static_interp>
   void RunImpl(
-      KernelContext &context,
       const OutTensorCPU<OutputType, 4> &output,
       const InTensorCPU<InputType, 4> &input,
       AffineMapping<3> &mapping,
-      BorderType border = {}) {
+      BorderType border,
+      int64_t row_begin, int64_t row_end) {
     int out_w = output.shape[2];
     int out_h = output.shape[1];
-    int out_d = output.shape[0];
     int c     = output.shape[3];
 
     Surface3D<const InputType> in = as_surface_channel_last(input);
@@ -203,16 +230,16 @@ class WarpCPU {
     constexpr int tile_w = 256;
     vec3 dsdx_tile = tile_w * dsdx;
 
-    for (int z = 0; z < out_d; z++) {
-      for (int y = 0; y < out_h; y++) {
-        OutputType *out_row = output(z, y, 0);
-        auto src_tile = warp::map_coords(mapping, ivec3(0, y, z));
-        for (int x_tile = 0; x_tile < out_w; x_tile += tile_w, src_tile += dsdx_tile) {
-          int x_tile_end = std::min(x_tile + tile_w, out_w);
-          auto src = src_tile;
-          for (int x = x_tile; x < x_tile_end; x++, src += dsdx) {
-            sampler(&out_row[c*x], src, border);
-          }
+    for (int64_t row = row_begin; row < row_end; row++) {
+      int z = row / out_h;
+      int y = row % out_h;
+      OutputType *out_row = output(z, y, 0);
+      auto src_tile = warp::map_coords(mapping, ivec3(0, y, z));
+      for (int x_tile = 0; x_tile < out_w; x_tile += tile_w, src_tile += dsdx_tile) {
+        int x_tile_end = std::min(x_tile + tile_w, out_w);
+        auto src = src_tile;
+        for (int x = x_tile; x < x_tile_end; x++, src += dsdx) {
+          sampler(&out_row[c*x], src, border);
         }
       }
     }
@@ -15,10 +15,14 @@
 #ifndef DALI_KERNELS_NORMALIZE_NORMALIZE_CPU_H_
 #define DALI_KERNELS_NORMALIZE_NORMALIZE_CPU_H_
 
+#include <algorithm>
 #include <cassert>
+#include <numeric>
+#include <type_traits>
 #include <utility>
 #include <vector>
 #include "dali/kernels/kernel.h"
+#include "dali/kernels/common/simd.h"
 #include "dali/kernels/common/utils.h"
 #include "dali/core/format.h"
 #include "dali/core/small_vector.h"
@@ -34,33 +38,107 @@ namespace kernels {
 
 namespace normalize_impl {
 
+/// @brief Number of values processed in one SIMD step - enough to fill a vector of 8-bit values
+constexpr int kSimdLanes = 16;
+
+#ifdef __SSE2__
+template <typename T>
+struct has_simd_conversion
+    : std::integral_constant<bool,
+        std::is_same<T, uint8_t>::value || std::is_same<T, int8_t>::value ||
+        std::is_same<T, uint16_t>::value || std::is_same<T, int16_t>::value ||
+        std::is_same<T, int32_t>::value || std::is_same<T, float>::value> {};
+
+template <typename Out, typename In, typename Param>
+struct use_simd
+    : std::integral_constant<bool,
+        std::is_same<Param, float>::value &&
+        has_simd_conversion<Out>::value && has_simd_conversion<In>::value> {};
+
+constexpr int kSimdVecs = kSimdLanes / 4;
+using simd_vec = simd::multivec<kSimdLanes / 4>;
+
+/**
+ * @brief Normalizes kSimdLanes values; the parameters are either scalars or kSimdLanes vectors
+ */
+template <typename Out, typename In>
+DALI_FORCEINLINE void normalize_simd(Out *out, const In *in,
+                                     const simd_vec &mean, const simd_vec &scale, __m128 shift) {
+  simd_vec x = simd_vec::load(in);
+  for (int v = 0; v < kSimdVecs; v++)
+    x.v[v] = _mm_add_ps(_mm_mul_ps(_mm_sub_ps(x.v[v], mean.v[v]), scale.v[v]), shift);
+  simd::store(out, x);
+}
+#else
+template <typename Out, typename In, typename Param>
+struct use_simd : std::false_type {};
+#endif
+
 template <typename Out, typename In, typename Param>
 void normalize(Out *out, const In *in, int64_t count,
                const Param *mean, const Param *scale, Param shift) {
+  int64_t i = 0;
+#ifdef __SSE2__
+  if constexpr (use_simd<Out, In, Param>::value) {
+    __m128 vshift = _mm_set1_ps(shift);
+    for (; i + kSimdLanes <= count; i += kSimdLanes) {
+      normalize_simd(out + i, in + i,
+                     simd_vec::load(mean + i), simd_vec::load(scale + i), vshift);
+    }
+  }
+#endif
   #pragma omp simd
-  for (int64_t i = 0; i < count; i++) {
-    out[i] = ConvertSat<Out>((in[i] - mean[i]) * scale[i] + shift);
+  for (int64_t j = i; j < count; j++) {
+    out[j] = ConvertSat<Out>((in[j] - mean[j]) * scale[j] + shift);
   }
 }
 
 template <typename Out, typename In, typename Param>
 void normalize(Out *out, const In *in, int64_t count,
                Param mean, Param scale, Param shift) {
+  int64_t i = 0;
+#ifdef __SSE2__
+  if constexpr (use_simd<Out, In, Param>::value) {
+    simd_vec vmean, vscale;
+    for (int v = 0; v < kSimdVecs; v++) {
+      vmean.v[v] = _mm_set1_ps(mean);
+      vscale.v[v] = _mm_set1_ps(scale);
+    }
+    __m128 vshift = _mm_set1_ps(shift);
+    for (; i + kSimdLanes <= count; i += kSimdLanes)
+      normalize_simd(out + i, in + i, vmean, vscale, vshift);
+  }
+#endif
   #pragma omp simd
-  for (int64_t i = 0; i < count; i++) {
-    out[i] = ConvertSat<Out>((in[i] - mean) * scale + shift);
+  for (int64_t j = i; j < count; j++) {
+    out[j] = ConvertSat<Out>((in[j] - mean) * scale + shift);
   }
 }
 
 template <typename Out, typename In, typename Param>
 void normalize_inner(Out *out, const In *in, int64_t nouter, int64_t ninner,
                      const Param *mean, const Param *scale, Param shift) {
-  for (int64_t i = 0, k = 0; i < nouter; i++, k += ninner) {
-    #pragma omp simd
-    for (int64_t j = 0; j < ninner; j++) {
-      out[k + j] = ConvertSat<Out>((in[k + j] - mean[j]) * scale[j] + shift);
+  if constexpr (use_simd<Out, In, Param>::value) {
+    // Short inner dimension (e.g. interleaved channels) - the parameters are replicated, so that
+    // they span a whole number of vectors and the data is processed as one flat array.
+    constexpr int kMaxPeriod = 256;
+    int64_t period = std::lcm<int64_t>(ninner, kSimdLanes);
+    if (period <= kMaxPeriod && nouter * ninner >= period) {
+      Param mean_rep[kMaxPeriod], scale_rep[kMaxPeriod];
+      for (int64_t j = 0; j < period; j++) {
+        mean_rep[j] = mean[j % ninner];
+        scale_rep[j] = scale[j % ninner];
+      }
+      int64_t total = nouter * ninner;
+      for (int64_t k = 0; k < total; k += period) {
+        normalize(out + k, in + k, std::min(period, total - k), mean_rep, scale_rep, shift);
+      }
+      return;
     }
   }
+  for (int64_t i = 0, k = 0; i < nouter; i++, k += ninner) {
+    normalize(out + k, in + k, ninner, mean, scale, shift);
+  }
 }
 
 template <typename Out, typename In, typename Param>
@@ -16,6 +16,7 @@
 #include <gtest/gtest.h>
 #include <string>
 #include <tuple>
+#include <vector>
 #include "dali/kernels/normalize/normalize_cpu.h"
 #include "dali/test/tensor_test_utils.h"
 
@@ -110,6 +111,41 @@ TEST(NormalizeTest, 1D_global) {
   Check(out, ref);
 }
 
+template <typename Out, typename In>
+void TestNormalizeInterleaved(int channels) {
+  std::mt19937 rng(4321);
+  TensorShape<3> data_shape = { 37, 53, channels };
+  TensorShape<3> param_shape = { 1, 1, channels };
+  std::vector<In> in_data(volume(data_shape));
+  std::vector<Out> out_data(in_data.size()), ref_data(in_data.size());
+  std::vector<float> mean_data(channels), invstddev_data(channels);
+  UniformRandomFill(in_data, rng, 0, 100);
+  UniformRandomFill(mean_data, rng, 0, 100);
+  UniformRandomFill(invstddev_data, rng, 0.0, 2.0);
+  auto in = make_tensor_cpu(in_data.data(), data_shape);
+  auto out = make_tensor_cpu(out_data.data(), data_shape);
+  auto ref = make_tensor_cpu(ref_data.data(), data_shape);
+  auto mean = make_tensor_cpu(mean_data.data(), param_shape);
+  auto invstddev = make_tensor_cpu(invstddev_data.data(), param_shape);
+  NormalizeCPU<Out, In> norm;
+  KernelContext ctx;
+  norm.Setup(ctx, data_shape, param_shape);
+  norm.Run(ctx, out, in, mean, invstddev);
+  ReferenceNormalize<Out, In, float, 3>(ref, in, mean, invstddev);
+  // vectorized conversion rounds halfway values to even
+  Check(out, ref, EqualEps(std::is_integral<Out>::value ? 1 : 0));
+}
+
+TEST(NormalizeTest, InterleavedChannels) {
+  for (int channels : { 1, 3, 4, 5, 24 }) {
+    TestNormalizeInterleaved<float, uint8_t>(channels);
+    TestNormalizeInterleaved<uint8_t, uint8_t>(channels);
+    TestNormalizeInterleaved<int16_t, uint8_t>(channels);
+    TestNormalizeInterleaved<int16_t, float>(channels);
+    TestNormalizeInterleaved<float, uint16_t>(channels);
+  }
+}
+
 class NormalizeNDTest : public ::testing::Test,
                         public ::testing::WithParamInterface<std::tuple<int, int>> {
  public:
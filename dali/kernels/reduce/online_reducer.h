@@ -77,6 +77,56 @@ template <typename Acc>
 struct OnlineReducer<Acc, reductions::sum> : OnlineSum<Acc> {};
 
 
+/**
+ * @brief Accumulates the mean and the sum of squared deviations from the mean
+ *
+ * Single values are added with Welford's algorithm; partial results, e.g. calculated for different
+ * blocks of data, are combined with Chan's formula. Both are numerically stable and require only
+ * one pass over the data.
+ */
+template <typename Acc>
+struct OnlineMeanVariance {
+  int64_t count = 0;
+  Acc mean = 0;
+  Acc m2 = 0;  //!< sum of squared deviations from the mean
+
+  DALI_HOST_DEV DALI_FORCEINLINE void reset() {
+    count = 0;
+    mean = m2 = 0;
+  }
+
+  template <typename T>
+  DALI_HOST_DEV DALI_FORCEINLINE void add(T value) {
+    count++;
+    Acc delta = value - mean;
+    mean += delta / count;
+    m2 += delta * (value - mean);
+  }
+
+  DALI_HOST_DEV DALI_FORCEINLINE void add(const OnlineMeanVariance &other) {
+    if (other.count == 0)
+      return;
+    if (count == 0) {
+      *this = other;
+      return;
+    }
+    int64_t n = count + other.count;
+    Acc delta = other.mean - mean;
+    Acc w = static_cast<Acc>(other.count) / n;
+    mean += delta * w;
+    m2 += other.m2 + delta * delta * count * w;
+    count = n;
+  }
+
+  /**
+   * @brief Returns the variance with `ddof` delta degrees of freedom or 0, if there's not
+   *        enough data.
+   */
+  DALI_HOST_DEV DALI_FORCEINLINE Acc variance(int ddof = 0) const {
+    return count > ddof ? m2 / (count - ddof) : Acc(0);
+  }
+};
+
 }  // namespace kernels
 }  // namespace dali
 
@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include <gtest/gtest.h>
+#include <vector>
 #include "dali/kernels/reduce/online_reducer.h"
 
 namespace dali {
@@ -32,5 +33,37 @@ TEST(OnlineReducer, TestVsDoubleSum) {
   EXPECT_NEAR(r.result(), ref_sum, eps);
 }
 
+TEST(OnlineMeanVariance, AddAndMerge) {
+  std::vector<double> data;
+  for (int i = 0; i < 10000; i++)
+    data.push_back(1000 + (i % 37) * 0.25 - (i % 11));
+  double ref_mean = 0, ref_m2 = 0;
+  for (double x : data)
+    ref_mean += x;
+  ref_mean /= data.size();
+  for (double x : data)
+    ref_m2 += (x - ref_mean) * (x - ref_mean);
+
+  OnlineMeanVariance<float> all, part1, part2;
+  for (size_t i = 0; i < data.size(); i++) {
+    all.add(data[i]);
+    (i < 3000 ? part1 : part2).add(data[i]);
+  }
+  EXPECT_EQ(all.count, 10000);
+  EXPECT_NEAR(all.mean, ref_mean, 1e-3);
+  EXPECT_NEAR(all.variance(), ref_m2 / data.size(), 1e-3);
+
+  part1.add(part2);
+  EXPECT_EQ(part1.count, 10000);
+  EXPECT_NEAR(part1.mean, ref_mean, 1e-3);
+  EXPECT_NEAR(part1.variance(1), ref_m2 / (data.size() - 1), 1e-3);
+
+  OnlineMeanVariance<float> empty;
+  EXPECT_EQ(empty.variance(), 0);
+  empty.add(part1);
+  EXPECT_EQ(empty.mean, part1.mean);
+  EXPECT_EQ(empty.m2, part1.m2);
+}
+
 }  // namespace kernels
 }  // namespace dali
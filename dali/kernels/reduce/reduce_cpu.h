@@ -15,14 +15,20 @@
 #ifndef DALI_KERNELS_REDUCE_REDUCE_CPU_H_
 #define DALI_KERNELS_REDUCE_REDUCE_CPU_H_
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <memory>
 #include <utility>
 #include <vector>
 #include "dali/kernels/kernel.h"
 #include "dali/kernels/common/utils.h"
+#include "dali/kernels/reduce/online_reducer.h"
 #include "dali/kernels/reduce/reduce_setup_utils.h"
 #include "dali/kernels/reduce/reductions.h"
+#include "dali/core/exec/engine.h"
 #include "dali/core/format.h"
+#include "dali/core/geom/vec.h"
 #include "dali/core/small_vector.h"
 #include "dali/core/span.h"
 #include "dali/core/static_switch.h"
@@ -37,12 +43,29 @@ namespace reduce_impl {
 
 constexpr int kTreeReduceThreshold = 32;
 
+/**
+ * @brief Number of independent accumulators used when reducing a contiguous range.
+ *
+ * The accumulators break the dependency chain between consecutive elements, which allows
+ * the compiler to vectorize the loop (the reductions are commutative), and each of them
+ * receives at most kTreeReduceThreshold values before the pairwise step takes over, so the
+ * numerical properties are the same as in the scalar version.
+ */
+constexpr int kReduceLanes = 8;
+
+/**
+ * @brief Number of adjacent output values reduced together when the innermost dimension
+ *        is not reduced.
+ */
+constexpr int kReduceColumns = 8;
+
 template <int static_stride, typename Dst, typename Src, typename Preprocessor, typename Reduction>
 void reduce1D_stride(Dst &reduced, const Src *data, int64_t dynamic_stride, int64_t n,
                      const Preprocessor &P, const Reduction &R) {
   const int64_t stride = static_stride < 0 ? dynamic_stride : static_stride;
   const Dst neutral = R.template neutral<Dst>();
-  if (n > kTreeReduceThreshold) {
+  constexpr int lanes = static_stride == 1 ? kReduceLanes : 1;
+  if (n > kTreeReduceThreshold * lanes) {
     int64_t m = n >> 1;
     Dst tmp1 = neutral, tmp2 = neutral;
     // reduce first half and accumulate
@@ -51,6 +74,23 @@ void reduce1D_stride(Dst &reduced, const Src *data, int64_t dynamic_stride, int6
     reduce1D_stride<static_stride>(tmp2, data + m * stride, stride, n - m, P, R);
     R(tmp1, tmp2);
     R(reduced, tmp1);
+  } else if (lanes > 1 && n >= 2 * lanes) {
+    Dst tmp[lanes];
+    for (int l = 0; l < lanes; l++)
+      tmp[l] = neutral;
+    int64_t i = 0;
+    for (; i + lanes <= n; i += lanes) {
+      for (int l = 0; l < lanes; l++)
+        R(tmp[l], P(data[i + l]));
+    }
+    for (int l = 0; i < n; i++, l++)
+      R(tmp[l], P(data[i]));
+    // combine the accumulators pairwise
+    for (int w = lanes / 2; w > 0; w >>= 1) {
+      for (int l = 0; l < w; l++)
+        R(tmp[l], tmp[l + w]);
+    }
+    R(reduced, tmp[0]);
   } else {
     // reduce to a temporary
     Dst tmp = neutral;
@@ -70,6 +110,115 @@ void reduce1D(Dst &reduced, const Src *data, int64_t stride, int64_t n,
   );  // NOLINT
 }
 
+/// @brief Maximum number of values in a block, for which mean_variance makes two passes
+constexpr int kMeanVarianceBlock = 1024;
+
+/**
+ * @brief Calculates the mean and the sum of squared deviations of a 1D range in one pass
+ *
+ * The range is split into blocks small enough to stay in L1 cache. In each block, the mean
+ * is calculated first and then the squared deviations from it, which is as accurate as a two-pass
+ * algorithm. The results for the blocks are combined pairwise with Chan's formula.
+ */
+template <typename Acc, typename Src, typename Preprocessor>
+void reduce1D(OnlineMeanVariance<Acc> &reduced, const Src *data, int64_t stride, int64_t n,
+              const Preprocessor &P, const reductions::mean_variance &R) {
+  if (n > kMeanVarianceBlock) {
+    int64_t m = n >> 1;
+    OnlineMeanVariance<Acc> tmp1, tmp2;
+    reduce1D(tmp1, data, stride, m, P, R);
+    reduce1D(tmp2, data + m * stride, stride, n - m, P, R);
+    tmp1.add(tmp2);
+    reduced.add(tmp1);
+  } else if (n > 0) {
+    Acc sum = 0;
+    auto value = [&](const Src &x) { return static_cast<Acc>(P(x)); };
+    reduce1D(sum, data, stride, n, value, reductions::sum());
+    OnlineMeanVariance<Acc> block;
+    block.count = n;
+    block.mean = sum / n;
+    auto sq_dev = [&](const Src &x) {
+      Acc d = static_cast<Acc>(P(x)) - block.mean;
+      return d * d;
+    };
+    reduce1D(block.m2, data, stride, n, sq_dev, reductions::sum());
+    reduced.add(block);
+  }
+}
+
+/**
+ * @brief Reduces `n` rows of `columns` adjacent values, producing `columns` results.
+ *
+ * This is used when the innermost dimension is not reduced - instead of traversing the input
+ * with a large stride once per output value, the adjacent output values are calculated
+ * together and the input is read contiguously.
+ *
+ * @param P array of `columns` preprocessors, one per output value
+ */
+template <int columns, typename Dst, typename Src, typename Preprocessor, typename Reduction>
+void reduce1D_columns(vec<columns, Dst> &reduced, const Src *data, int64_t stride, int64_t n,
+                      const Preprocessor *P, const Reduction &R) {
+  const vec<columns, Dst> neutral = R.template neutral<Dst>();
+  if (n > kTreeReduceThreshold) {
+    int64_t m = n >> 1;
+    vec<columns, Dst> tmp1 = neutral, tmp2 = neutral;
+    reduce1D_columns(tmp1, data, stride, m, P, R);
+    reduce1D_columns(tmp2, data + m * stride, stride, n - m, P, R);
+    R(tmp1, tmp2);
+    R(reduced, tmp1);
+  } else {
+    vec<columns, Dst> tmp = neutral;
+    for (int64_t i = 0; i < n; i++) {
+      const Src *row = data + i * stride;
+      for (int c = 0; c < columns; c++)
+        R(tmp[c], P[c](row[c]));
+    }
+    R(reduced, tmp);
+  }
+}
+
+/**
+ * @brief Calculates the mean and the sum of squared deviations in `columns` adjacent columns
+ *
+ * @see reduce1D for mean_variance
+ */
+template <int columns, typename Acc, typename Src, typename Preprocessor>
+void reduce1D_columns(vec<columns, OnlineMeanVariance<Acc>> &reduced, const Src *data,
+                      int64_t stride, int64_t n,
+                      const Preprocessor *P, const reductions::mean_variance &R) {
+  if (n > kTreeReduceThreshold) {
+    int64_t m = n >> 1;
+    vec<columns, OnlineMeanVariance<Acc>> tmp1, tmp2;
+    reduce1D_columns(tmp1, data, stride, m, P, R);
+    reduce1D_columns(tmp2, data + m * stride, stride, n - m, P, R);
+    R(tmp1, tmp2);
+    R(reduced, tmp1);
+  } else if (n > 0) {
+    Acc mean[columns] = {}, m2[columns] = {};
+    for (int64_t i = 0; i < n; i++) {
+      const Src *row = data + i * stride;
+      for (int c = 0; c < columns; c++)
+        mean[c] += static_cast<Acc>(P[c](row[c]));
+    }
+    for (int c = 0; c < columns; c++)
+      mean[c] /= n;
+    for (int64_t i = 0; i < n; i++) {
+      const Src *row = data + i * stride;
+      for (int c = 0; c < columns; c++) {
+        Acc d = static_cast<Acc>(P[c](row[c])) - mean[c];
+        m2[c] += d * d;
+      }
+    }
+    for (int c = 0; c < columns; c++) {
+      OnlineMeanVariance<Acc> block;
+      block.count = n;
+      block.mean = mean[c];
+      block.m2 = m2[c];
+      reduced[c].add(block);
+    }
+  }
+}
+
 template <typename Backend, typename T>
 struct StridedTensor {
   T *data = nullptr;
@@ -77,30 +226,35 @@ struct StridedTensor {
   SmallVector<int, 6> stride, size;
 };
 
-/// @brief Reduces a strided tensor slice to a scalar
-template <typename Dst, typename Src, typename Preprocessor, typename Reduction>
-void reduce(Dst &reduced, const StridedTensor<StorageCPU, Src> &in,
-            const Preprocessor &P, const Reduction &R,
-            int axis, int64_t extent, int64_t offset) {
+/**
+ * @brief Reduces a strided tensor slice to a scalar
+ *
+ * The outer dimensions are split in halves until the slice is small enough; the innermost
+ * dimension is reduced by `leaf`, which is called as `leaf(acc, data, stride, n)`.
+ */
+template <typename Dst, typename Src, typename Leaf, typename Reduction>
+void reduce_tree(Dst &reduced, const StridedTensor<StorageCPU, Src> &in,
+                 const Leaf &leaf, const Reduction &R,
+                 int axis, int64_t extent, int64_t offset) {
   int64_t stride = in.stride[axis];
   const Dst neutral = R.template neutral<Dst>();
   if (axis == in.dim() - 1) {
     Dst tmp = neutral;
-    reduce1D(tmp, in.data + offset, stride, in.size[axis], P, R);
+    leaf(tmp, in.data + offset, stride, extent);
     R(reduced, tmp);
   } else {
     int64_t sub_v = volume(in.size.begin() + axis + 1, in.size.end());
     if (extent >= 2 && extent * sub_v > kTreeReduceThreshold) {
       Dst tmp1 = neutral, tmp2 = neutral;
       int64_t mid = extent / 2;
-      reduce(tmp1, in, P, R, axis, mid, offset);
-      reduce(tmp2, in, P, R, axis, extent - mid, offset + mid * stride);
+      reduce_tree(tmp1, in, leaf, R, axis, mid, offset);
+      reduce_tree(tmp2, in, leaf, R, axis, extent - mid, offset + mid * stride);
       R(tmp1, tmp2);
       R(reduced, tmp1);
     } else {
       for (int64_t i = 0; i < extent; i++) {
         Dst tmp = neutral;
-        reduce(tmp, in, P, R, axis + 1, in.size[axis + 1], offset + i * stride);
+        reduce_tree(tmp, in, leaf, R, axis + 1, in.size[axis + 1], offset + i * stride);
         R(reduced, tmp);
       }
     }
@@ -111,7 +265,23 @@ void reduce(Dst &reduced, const StridedTensor<StorageCPU, Src> &in,
 template <typename Dst, typename Src, typename Preprocessor, typename Reduction>
 void reduce(Dst &reduced, const StridedTensor<StorageCPU, Src> &in,
             const Preprocessor &P, const Reduction &R, int64_t offset) {
-  reduce(reduced, in, P, R, 0, in.size[0], offset);
+  auto leaf = [&](Dst &acc, const Src *data, int64_t stride, int64_t n) {
+    reduce1D(acc, data, stride, n, P, R);
+  };
+  reduce_tree(reduced, in, leaf, R, 0, in.size[0], offset);
+}
+
+/**
+ * @brief Reduces a strided tensor to `columns` values located at adjacent addresses,
+ *        starting at `offset`.
+ */
+template <int columns, typename Dst, typename Src, typename Preprocessor, typename Reduction>
+void reduce_columns(vec<columns, Dst> &reduced, const StridedTensor<StorageCPU, Src> &in,
+                    const Preprocessor *P, const Reduction &R, int64_t offset) {
+  auto leaf = [&](vec<columns, Dst> &acc, const Src *data, int64_t stride, int64_t n) {
+    reduce1D_columns(acc, data, stride, n, P, R);
+  };
+  reduce_tree(reduced, in, leaf, R, 0, in.size[0], offset);
 }
 
 }  // namespace reduce_impl
@@ -125,7 +295,9 @@ void reduce(Dst &reduced, const StridedTensor<StorageCPU, Src> &in,
  * of reduction is not suitable, the Actual class should replace the whole Run method.
  *
  * The default postprocessing is an elementwise call to Actual::Postprocess. If different kind of
- * postprocessing is required, Actual should replace the PostprocessAll method instead.
+ * postprocessing is required, Actual should replace the PostprocessRange method instead.
+ *
+ * A single tensor can be reduced by multiple threads - see Schedule.
  *
  * @tparam Actual - provides `GetPreprocessor`, `GetReduction`, `PostSetup` and `Postprocess`
  *         functions
@@ -167,28 +339,99 @@ struct ReduceBaseCPU {
   void PostSetup() {}
 
   void Run(bool clear = true, bool postprocess = true) {
-    SmallVector<int64_t, 6> pos;
-    pos.resize(output.dim());
-    if (axes.empty()) {
-      ReduceForEmptyAxes(make_span(pos));
-    } else {
-      ReduceAxis(clear, make_span(pos), 0, 0);
-    }
-    if (postprocess)
-      This().PostprocessAll();
+    SequentialExecutionEngine engine;
+    Schedule(engine, clear, postprocess, 1);
   }
 
   void Run(KernelContext ctx, bool clear = true, bool postprocess = true) {
     Run(clear, postprocess);
   }
 
+  /**
+   * @brief Schedules the reduction in an execution engine (e.g. a thread pool)
+   *
+   * If the input is large enough, the work is split into up to `req_nblocks` parts:
+   * - if there are enough output values, each part calculates a range of them;
+   * - otherwise, the outermost reduced dimension is split and the partial results are combined
+   *   by the part which finishes last.
+   *
+   * The kernel object must not be modified or destroyed until the work is complete.
+   *
+   * @param req_nblocks     requested number of parts; if not positive, the number of threads
+   *                        in the engine is used
+   * @param min_block_size  minimum number of input elements per part
+   */
+  template <typename ExecutionEngine>
+  void Schedule(ExecutionEngine &engine, bool clear = true, bool postprocess = true,
+                int req_nblocks = -1, int64_t min_block_size = kMinBlockSize) {
+    int64_t in_v = input.num_elements();
+    int64_t out_v = output.num_elements();
+    if (axes.empty()) {
+      engine.AddWork([=, this](int) {
+        SmallVector<int64_t, 6> pos;
+        pos.resize(output.dim());
+        ReduceForEmptyAxes(make_span(pos));
+        if (postprocess)
+          This().PostprocessRange(0, out_v);
+      }, in_v);
+      return;
+    }
+
+    int64_t nblocks = req_nblocks > 0 ? req_nblocks : engine.NumThreads();
+    nblocks = std::max<int64_t>(1, std::min(nblocks, in_v / std::max<int64_t>(min_block_size, 1)));
+
+    if (nblocks > 1 && out_v >= nblocks * reduce_impl::kReduceColumns) {
+      // Split the output
+      for (int64_t b = 0; b < nblocks; b++) {
+        int64_t begin = out_v * b / nblocks;
+        int64_t end = out_v * (b + 1) / nblocks;
+        engine.AddWork([=, this](int) {
+          ReduceRange(output.data, strided_in, begin, end, clear);
+          if (postprocess)
+            This().PostprocessRange(begin, end);
+        }, (end - begin) * (in_v / out_v));
+      }
+      return;
+    }
+
+    nblocks = std::min<int64_t>(nblocks, strided_in.size[0]);
+    if (nblocks <= 1) {
+      engine.AddWork([=, this](int) {
+        ReduceRange(output.data, strided_in, 0, out_v, clear);
+        if (postprocess)
+          This().PostprocessRange(0, out_v);
+      }, in_v);
+      return;
+    }
+
+    // Split the outermost reduced dimension; each part produces a full set of partial results.
+    partial_.resize(nblocks * out_v);
+    auto pending = std::make_shared<std::atomic<int>>(nblocks);
+    int64_t extent = strided_in.size[0];
+    for (int64_t b = 0; b < nblocks; b++) {
+      int64_t begin = extent * b / nblocks;
+      int64_t end = extent * (b + 1) / nblocks;
+      engine.AddWork([=, this](int) {
+        auto part = strided_in;
+        part.data += begin * part.stride[0];
+        part.size[0] = end - begin;
+        ReduceRange(partial_.data() + b * out_v, part, 0, out_v, true);
+        if (--*pending == 0)
+          MergePartialResults(nblocks, clear, postprocess);
+      }, (end - begin) * (in_v / extent));
+    }
+  }
+
   void PostprocessAll() {
+    This().PostprocessRange(0, output.num_elements());
+  }
+
+  void PostprocessRange(int64_t begin, int64_t end) {
     if (reinterpret_cast<decltype(&ReduceBaseCPU::Postprocess)>(&Actual::Postprocess) ==
         &ReduceBaseCPU::Postprocess)
       return;  // trivial postprocessing, nothing to do
 
-    int64_t v = output.num_elements();
-    for (int64_t i = 0; i < v; i++)
+    for (int64_t i = begin; i < end; i++)
       output.data[i] = This().Postprocess(output.data[i]);
   }
 
@@ -211,27 +454,135 @@ struct ReduceBaseCPU {
   Dst Postprocess(const Dst &x) const { return x; }
 
  protected:
-  void ReduceAxis(bool clear, span<int64_t> pos, int axis, int64_t offset = 0) {
+  static constexpr int64_t kMinBlockSize = 1 << 16;
+
+  /**
+   * @brief Calculates output values with flat indices in range [begin, end)
+   *
+   * @param out   output buffer, indexed with the flat index of the output value
+   * @param in    the (part of) input to reduce
+   * @param clear if true, the output values are overwritten, otherwise the values are
+   *              accumulated in the existing contents of `out`
+   */
+  void ReduceRange(Dst *out, const reduce_impl::StridedTensor<StorageCPU, const Src> &in,
+                   int64_t begin, int64_t end, bool clear) const {
     auto R = This().GetReduction();
-    if (axis == output.dim()) {
-      Dst &r = *output(pos);
-      if (clear) {
-        r = R.template neutral<Dst>();
+    const Dst neutral = R.template neutral<Dst>();
+    int odim = step.size();  // number of non-reduced dimensions
+    SmallVector<int64_t, 6> pos;
+    pos.resize(output.dim());
+    if (begin >= end)
+      return;
+    if (odim == 0) {  // full reduction
+      if (clear)
+        out[0] = neutral;
+      reduce_impl::reduce(out[0], in, This().GetPreprocessor(make_span(pos)), R, 0);
+      return;
+    }
+
+    int64_t offset = 0;
+    int64_t idx = begin;
+    for (int a = odim - 1; a >= 0; a--) {
+      pos[a] = idx % output.shape[a];
+      idx /= output.shape[a];
+      offset += pos[a] * step[a];
+    }
+
+    const int inner = odim - 1;
+    const int64_t inner_extent = output.shape[inner];
+    const int64_t inner_step = step[inner];
+    for (int64_t i = begin; i < end;) {
+      int64_t run = std::min(end - i, inner_extent - pos[inner]);
+      int64_t j = 0;
+      if (inner_step == 1) {
+        constexpr int C = reduce_impl::kReduceColumns;
+        for (; j + C <= run; j += C)
+          ReduceColumns<C>(out + i + j, in, make_span(pos), inner, offset + j, clear);
       }
-      reduce_impl::reduce(r, strided_in, This().GetPreprocessor(pos), R, offset);
-    } else {
-      for (int64_t i = 0; i < output.shape[axis]; i++) {
-        pos[axis] = i;
-        ReduceAxis(clear, pos, axis+1, offset + i*step[axis]);
+      if (in.dim() == 1 && in.size[0] <= reduce_impl::kTreeReduceThreshold) {
+        // short reductions, e.g. over channels - skip the recursive machinery
+        const Src *data = in.data + offset;
+        const int64_t n = in.size[0], stride = in.stride[0];
+        for (; j < run; j++, pos[inner]++) {
+          auto P = This().GetPreprocessor(make_span(pos));
+          Dst acc = neutral;
+          for (int64_t k = 0; k < n; k++)
+            R(acc, P(data[j * inner_step + k * stride]));
+          if (clear)
+            out[i + j] = acc;
+          else
+            R(out[i + j], acc);
+        }
+      }
+      for (; j < run; j++) {
+        Dst &r = out[i + j];
+        if (clear)
+          r = neutral;
+        reduce_impl::reduce(r, in, This().GetPreprocessor(make_span(pos)), R,
+                            offset + j * inner_step);
+        pos[inner]++;
+      }
+      i += run;
+      offset += run * inner_step;
+      // advance the outer dimensions
+      for (int a = inner; a > 0 && pos[a] == output.shape[a]; a--) {
+        offset -= pos[a] * step[a];
+        pos[a] = 0;
+        pos[a - 1]++;
+        offset += step[a - 1];
       }
     }
   }
 
+  /**
+   * @brief Calculates `columns` adjacent output values, starting at position `pos`, which
+   *        are stored at adjacent addresses in the input, too.
+   *
+   * `pos[inner]` is advanced by `columns`.
+   */
+  template <int columns>
+  void ReduceColumns(Dst *out, const reduce_impl::StridedTensor<StorageCPU, const Src> &in,
+                     span<int64_t> pos, int inner, int64_t offset, bool clear) const {
+    auto R = This().GetReduction();
+    using Preprocessor = decltype(This().GetPreprocessor(pos));
+    Preprocessor P[columns];
+    vec<columns, Dst> acc;
+    for (int c = 0; c < columns; c++, pos[inner]++) {
+      P[c] = This().GetPreprocessor(pos);
+      acc[c] = clear ? R.template neutral<Dst>() : out[c];
+    }
+    reduce_impl::reduce_columns(acc, in, P, R, offset);
+    for (int c = 0; c < columns; c++)
+      out[c] = acc[c];
+  }
+
+  void MergePartialResults(int nblocks, bool clear, bool postprocess) {
+    auto R = This().GetReduction();
+    int64_t out_v = output.num_elements();
+    for (int64_t i = 0; i < out_v; i++) {
+      Dst acc = partial_[i];
+      for (int b = 1; b < nblocks; b++)
+        R(acc, partial_[b * out_v + i]);
+      if (clear)
+        output.data[i] = acc;
+      else
+        R(output.data[i], acc);
+    }
+    if (postprocess)
+      This().PostprocessRange(0, out_v);
+  }
+
   void ReduceForEmptyAxes(span<int64_t> pos) {
     auto P = This().GetPreprocessor(pos);
     for (int64_t i = 0; i < output.num_elements(); i++) {
-      Dst preprocessed = P(input.data[i]);
-      output.data[i] = preprocessed;
+      if constexpr (std::is_convertible<decltype(P(input.data[i])), Dst>::value) {
+        Dst preprocessed = P(input.data[i]);
+        output.data[i] = preprocessed;
+      } else {  // accumulator types, e.g. OnlineMeanVariance
+        auto R = This().GetReduction();
+        output.data[i] = R.template neutral<Dst>();
+        R(output.data[i], P(input.data[i]));
+      }
     }
   }
 
@@ -330,6 +681,7 @@ struct ReduceBaseCPU {
   reduce_impl::StridedTensor<StorageCPU, const Src> strided_in;
   SmallVector<int64_t, 6> step;
   uint64_t axis_mask = 0;
+  std::vector<Dst> partial_;
 };
 
 template <typename Dst, typename Src>
@@ -504,6 +856,18 @@ struct StdDevCPU : ReduceBaseCPU<Dst, Src, StdDevCPU<Dst, Src, MeanType>> {
 };
 
 
+/**
+ * @brief Calculates the mean and the sum of squared deviations from the mean in a single pass
+ *
+ * The output is a tensor of OnlineMeanVariance accumulators, which can be further combined
+ * (e.g. across samples) before calculating the variance.
+ */
+template <typename Src, typename Acc = float>
+struct MeanVarianceCPU
+    : ReduceBaseCPU<OnlineMeanVariance<Acc>, Src, MeanVarianceCPU<Src, Acc>> {
+  reductions::mean_variance GetReduction() const { return {}; }
+};
+
 }  // namespace kernels
 }  // namespace dali
 
@@ -13,8 +13,11 @@
 // limitations under the License.
 
 #include <gtest/gtest.h>
+#include <cmath>
 #include <random>
 #include <chrono>
+#include <vector>
+#include "dali/core/exec/deferred_engine.h"
 #include "dali/kernels/reduce/reduce_cpu.h"
 
 namespace dali {
@@ -242,5 +245,218 @@ TEST(ReduceTest, StdDev) {
   EXPECT_NEAR(s3[0], dev2, 1);
 }
 
+namespace {
+
+/**
+ * @brief Checks that the reduction scheduled in multiple parts gives the same result as
+ *        a double-precision reference.
+ */
+template <typename Reduce, typename Src, typename Ref>
+void TestScheduledReduction(const TensorShape<> &shape, span<const int> axes,
+                            Ref ref_reduce, double eps) {
+  std::mt19937_64 rng(4321);
+  std::uniform_real_distribution<double> dist(0, 100);
+  std::vector<Src> in_v(volume(shape));
+  for (auto &x : in_v)
+    x = static_cast<Src>(dist(rng));
+  auto in = make_tensor_cpu(in_v.data(), shape);
+
+  TensorShape<> out_shape = shape;
+  for (int a : axes)
+    out_shape[a] = 1;
+  int64_t out_v = volume(out_shape);
+  std::vector<float> out_v1(out_v), out_v2(out_v);
+  auto out1 = make_tensor_cpu(out_v1.data(), out_shape);
+  auto out2 = make_tensor_cpu(out_v2.data(), out_shape);
+
+  // reference: reduce each output value separately in double precision
+  std::vector<double> ref(out_v);
+  std::vector<int64_t> count(out_v);
+  auto strides = GetStrides(shape);
+  auto out_strides = GetStrides(out_shape);
+  for (int64_t i = 0; i < volume(shape); i++) {
+    int64_t o = 0;
+    for (int d = 0; d < shape.size(); d++) {
+      int64_t c = i / strides[d] % shape[d];
+      if (out_shape[d] > 1)
+        o += c * out_strides[d];
+    }
+    ref[o] = count[o]++ ? ref_reduce(ref[o], in_v[i]) : in_v[i];
+  }
+
+  Reduce red;
+  red.Setup(out1, in, axes);
+  red.Run();
+
+  DeferredEngine engine;
+  red.Setup(out2, in, axes);
+  red.Schedule(engine, true, true, 7, 1000);
+  EXPECT_GT(engine.NumWorkItems(), 1);
+  engine.RunAll();
+
+  for (int64_t i = 0; i < out_v; i++) {
+    double tol = eps * std::max(1.0, std::abs(ref[i]));
+    ASSERT_NEAR(out_v1[i], ref[i], tol) << " at " << i << " shape " << shape;
+    ASSERT_NEAR(out_v2[i], ref[i], tol) << " at " << i << " shape " << shape;
+  }
+}
+
+template <typename Reduce, typename Src, typename Ref>
+void TestScheduledReductions(Ref ref_reduce, double eps) {
+  std::vector<std::pair<TensorShape<>, std::vector<int>>> cases = {
+    { { 1 << 18 }, { 0 } },
+    { { 300, 401, 3 }, { 0, 1 } },      // per-channel - adjacent outputs reduced together
+    { { 300, 401, 3 }, { 2 } },         // many outputs - the output is split
+    { { 300, 401, 3 }, { 0, 1, 2 } },
+    { { 3, 300, 401 }, { 1, 2 } },      // few outputs - the reduced dimension is split
+    { { 20, 30, 40, 50 }, { 0, 2 } },
+    { { 20, 30, 40, 50 }, { 1, 3 } },
+    { { 7, 11, 13, 101 }, { 0, 1, 2 } },
+  };
+  for (auto &c : cases)
+    TestScheduledReduction<Reduce, Src>(c.first, make_cspan(c.second), ref_reduce, eps);
+}
+
+}  // namespace
+
+TEST(ReduceTest, ScheduledSum) {
+  auto sum = [](double a, double b) { return a + b; };
+  TestScheduledReductions<SumCPU<float, float>, float>(sum, 1e-5);
+  TestScheduledReductions<SumCPU<float, int>, int>(sum, 1e-5);
+}
+
+TEST(ReduceTest, ScheduledMinMax) {
+  auto min = [](double a, double b) { return std::min(a, b); };
+  auto max = [](double a, double b) { return std::max(a, b); };
+  TestScheduledReductions<MinCPU<float, float>, float>(min, 0);
+  TestScheduledReductions<MaxCPU<float, int16_t>, int16_t>(max, 0);
+}
+
+TEST(ReduceTest, ScheduledMeanStdDev) {
+  const int H = 1000, W = 997, C = 3;
+  std::mt19937_64 rng(1234);
+  std::normal_distribution<float> dist(10, 42);
+  std::vector<float> in_v(H * W * C);
+  for (auto &x : in_v)
+    x = dist(rng);
+  auto in = make_tensor_cpu<3>(in_v.data(), { H, W, C });
+  int axes[] = { 0, 1 };
+
+  float mean_ref[C], stddev_ref[C], mean_out[C], stddev_out[C];
+  auto mean_ref_view = make_tensor_cpu<1>(mean_ref, { C });
+  auto stddev_ref_view = make_tensor_cpu<1>(stddev_ref, { C });
+  auto mean_view = make_tensor_cpu<1>(mean_out, { C });
+  auto stddev_view = make_tensor_cpu<1>(stddev_out, { C });
+
+  MeanCPU<float, float> mean;
+  StdDevCPU<float, float> stddev;
+  mean.Setup(mean_ref_view, in, make_cspan(axes));
+  mean.Run();
+  stddev.Setup(stddev_ref_view, in, make_cspan(axes), mean_ref_view);
+  stddev.Run();
+
+  DeferredEngine engine;
+  mean.Setup(mean_view, in, make_cspan(axes));
+  mean.Schedule(engine);
+  EXPECT_EQ(engine.NumWorkItems(), 4);
+  engine.RunAll();
+  stddev.Setup(stddev_view, in, make_cspan(axes), mean_view);
+  stddev.Schedule(engine);
+  EXPECT_EQ(engine.NumWorkItems(), 4);
+  engine.RunAll();
+
+  for (int c = 0; c < C; c++) {
+    EXPECT_NEAR(mean_out[c], mean_ref[c], 1e-4);
+    EXPECT_NEAR(stddev_out[c], stddev_ref[c], 1e-4);
+    EXPECT_NEAR(mean_out[c], 10, 0.5);
+    EXPECT_NEAR(stddev_out[c], 42, 0.5);
+  }
+}
+
+TEST(ReduceTest, SumAccuracy) {
+  // A naive sequential sum of 2^24 values of 0.1 in float would be off by more than 10%.
+  const int64_t N = 1 << 24;
+  std::vector<float> in_v(N, 0.1f);
+  auto in = make_tensor_cpu<1>(in_v.data(), { N });
+  float out = 0;
+  auto out_view = make_tensor_cpu<1>(&out, { 1 });
+  int axes[] = { 0 };
+  SumCPU<float, float> sum;
+  sum.Setup(out_view, in, make_cspan(axes));
+  sum.Run();
+  EXPECT_NEAR(out, N * 0.1, N * 0.1 * 1e-6);
+
+  DeferredEngine engine;
+  sum.Schedule(engine);
+  engine.RunAll();
+  EXPECT_NEAR(out, N * 0.1, N * 0.1 * 1e-6);
+}
+
+TEST(ReduceTest, MeanVariance) {
+  std::vector<std::pair<TensorShape<>, std::vector<int>>> cases = {
+    { { 1 << 18 }, { 0 } },
+    { { 300, 401, 3 }, { 0, 1 } },
+    { { 300, 401, 3 }, { 2 } },
+    { { 3, 300, 401 }, { 1, 2 } },
+    { { 20, 30, 40, 50 }, { 1, 3 } },
+  };
+  std::mt19937_64 rng(1234);
+  std::normal_distribution<float> dist(100, 20);
+  for (auto &c : cases) {
+    auto &shape = c.first;
+    auto axes = make_cspan(c.second);
+    std::vector<float> in_v(volume(shape));
+    for (auto &x : in_v)
+      x = dist(rng);
+    auto in = make_tensor_cpu(in_v.data(), shape);
+    TensorShape<> out_shape = shape;
+    for (int a : axes)
+      out_shape[a] = 1;
+    int64_t out_v = volume(out_shape);
+
+    std::vector<float> mean_ref(out_v), stddev_ref(out_v);
+    auto mean_ref_view = make_tensor_cpu(mean_ref.data(), out_shape);
+    auto stddev_ref_view = make_tensor_cpu(stddev_ref.data(), out_shape);
+    MeanCPU<float, float> mean;
+    StdDevCPU<float, float> stddev;
+    mean.Setup(mean_ref_view, in, axes);
+    mean.Run();
+    stddev.Setup(stddev_ref_view, in, axes, mean_ref_view);
+    stddev.Run();
+
+    std::vector<OnlineMeanVariance<float>> out1(out_v), out2(out_v);
+    MeanVarianceCPU<float> mv;
+    mv.Setup(make_tensor_cpu(out1.data(), out_shape), in, axes);
+    mv.Run();
+
+    DeferredEngine engine;
+    mv.Setup(make_tensor_cpu(out2.data(), out_shape), in, axes);
+    mv.Schedule(engine, true, true, 7, 1000);
+    engine.RunAll();
+
+    int64_t n = volume(shape) / out_v;
+    for (int64_t i = 0; i < out_v; i++) {
+      for (auto *acc : { &out1[i], &out2[i] }) {
+        ASSERT_EQ(acc->count, n) << " at " << i << " shape " << shape;
+        ASSERT_NEAR(acc->mean, mean_ref[i], 1e-3) << " at " << i << " shape " << shape;
+        ASSERT_NEAR(std::sqrt(acc->variance()), stddev_ref[i], 1e-3)
+            << " at " << i << " shape " << shape;
+      }
+    }
+  }
+
+  // no reduced axes - each value forms a group on its own
+  float in_v[] = { 1, 2, 3, 4 };
+  OnlineMeanVariance<float> out_v[4];
+  MeanVarianceCPU<float> mv;
+  mv.Setup(make_tensor_cpu<1>(out_v, { 4 }), make_tensor_cpu<1>(in_v, { 4 }), {});
+  mv.Run();
+  for (int i = 0; i < 4; i++) {
+    EXPECT_EQ(out_v[i].count, 1);
+    EXPECT_EQ(out_v[i].mean, in_v[i]);
+    EXPECT_EQ(out_v[i].m2, 0);
+  }
+}
+
 }  // namespace kernels
 }  // namespace dali
@@ -155,6 +155,28 @@ struct max {
   static constexpr T neutral() noexcept { return max_impl<T>::neutral(); }
 };
 
+/**
+ * @brief Combines OnlineMeanVariance accumulators (or adds single values to them).
+ */
+struct mean_variance {
+  template <typename Acc, typename U>
+  DALI_HOST_DEV DALI_FORCEINLINE
+  void operator()(Acc &acc, const U &val) const noexcept {
+    acc.add(val);
+  }
+
+  template <typename Acc, int N>
+  DALI_HOST_DEV DALI_FORCEINLINE
+  void operator()(vec<N, Acc> &acc, const vec<N, Acc> &val) const noexcept {
+    for (int i = 0; i < N; i++)
+      acc[i].add(val[i]);
+  }
+
+  template <typename T>
+  DALI_HOST_DEV DALI_FORCEINLINE
+  static constexpr T neutral() noexcept { return T(); }
+};
+
 template <typename Reduction>
 struct is_accurate : std::false_type {};
 
@@ -85,6 +85,92 @@ void SliceFlipNormalizePermuteKernelImpl(
   }
 }
 
+/**
+ * @brief Converts interleaved channels to planar ones (e.g. HWC -> CHW), row by row
+ *
+ * The generic implementation iterates in the output order, visiting each input row once
+ * per channel - with large images, the input is evicted from the cache before the next
+ * channel is processed. Here, the three innermost output dimensions are C, H, W and the
+ * channels (or any other dimension in their place, if there are no per-channel parameters)
+ * are adjacent in the input: a single input row is read (and kept in L1) while the output
+ * is written as C sequential streams.
+ */
+template <int NumChannels, bool NeedNormalize, bool HasChannels, typename OutputType,
+          typename InputType>
+void SliceFlipNormalizeDeinterleaveRows(
+    OutputType *output, const InputType *input, const int64_t *in_strides,
+    const int64_t *out_strides, const int64_t *out_shape, const float *mean,
+    const float *inv_stddev) {
+  constexpr int kNumParams = HasChannels ? NumChannels : 1;
+  float ch_mean[kNumParams], ch_inv_stddev[kNumParams];
+  for (int c = 0; c < kNumParams; c++) {
+    ch_mean[c] = NeedNormalize ? mean[c] : 0.0f;
+    ch_inv_stddev[c] = NeedNormalize ? inv_stddev[c] : 1.0f;
+  }
+  int64_t height = out_shape[1], width = out_shape[2];
+  int64_t out_stride_c = out_strides[0], in_stride_x = in_strides[2];
+  for (int64_t y = 0; y < height; y++, input += in_strides[1], output += out_strides[1]) {
+    const InputType *in_pixel = input;
+    for (int64_t x = 0; x < width; x++, in_pixel += in_stride_x) {
+      for (int c = 0; c < NumChannels; c++) {
+        int p = HasChannels ? c : 0;
+        Fill<NeedNormalize>(output[c * out_stride_c + x], in_pixel[c],
+                            &ch_mean[p], &ch_inv_stddev[p]);
+      }
+    }
+  }
+}
+
+template <bool NeedNormalize, bool HasChannels, typename OutputType, typename InputType>
+void SliceFlipNormalizeDeinterleaveImpl(
+    OutputType *output, const InputType *input, const int64_t *in_strides,
+    const int64_t *out_strides, const int64_t *out_shape, const float *mean,
+    const float *inv_stddev, std::integral_constant<int, 3>) {
+  int64_t nchannels = out_shape[0], height = out_shape[1], width = out_shape[2];
+  if (nchannels <= 4) {
+    VALUE_SWITCH(nchannels, NumChannels, (1, 2, 3, 4), (
+      SliceFlipNormalizeDeinterleaveRows<NumChannels, NeedNormalize, HasChannels>(
+          output, input, in_strides, out_strides, out_shape, mean, inv_stddev);
+    ), ());  // NOLINT
+    return;
+  }
+  // many channels - process one row at a time, channel by channel
+  int64_t in_stride_y = in_strides[1], in_stride_x = in_strides[2];
+  for (int64_t y = 0; y < height; y++, input += in_stride_y, output += out_strides[1]) {
+    for (int64_t c = 0; c < nchannels; c++) {
+      OutputType *out_row = output + c * out_strides[0];
+      const InputType *in_row = input + c * in_strides[0];
+      const float *ch_mean = HasChannels ? mean + c : mean;
+      const float *ch_inv_stddev = HasChannels ? inv_stddev + c : inv_stddev;
+      for (int64_t x = 0; x < width; x++)
+        Fill<NeedNormalize>(out_row[x], in_row[x * in_stride_x], ch_mean, ch_inv_stddev);
+    }
+  }
+}
+
+template <bool NeedNormalize, bool HasChannels, typename OutputType, typename InputType,
+          int DimsLeft>
+void SliceFlipNormalizeDeinterleaveImpl(
+    OutputType *output, const InputType *input, const int64_t *in_strides,
+    const int64_t *out_strides, const int64_t *out_shape, const float *mean,
+    const float *inv_stddev, std::integral_constant<int, DimsLeft>) {
+  for (int64_t i = 0; i < out_shape[0]; i++, output += out_strides[0], input += in_strides[0])
+    SliceFlipNormalizeDeinterleaveImpl<NeedNormalize, HasChannels>(
+        output, input, in_strides + 1, out_strides + 1, out_shape + 1, mean, inv_stddev,
+        std::integral_constant<int, DimsLeft - 1>());
+}
+
+/**
+ * @brief Whether SliceFlipNormalizeDeinterleaveImpl can be used
+ *
+ * The channel dimension, if present, must be the one which is deinterleaved.
+ */
+template <int Dims>
+bool CanDeinterleave(const int64_t *in_strides, int channel_dim, bool need_pad) {
+  return Dims >= 3 && !need_pad && in_strides[Dims - 3] == 1 &&
+         (channel_dim < 0 || channel_dim == Dims - 3);
+}
+
 template <bool NeedNormalize, bool HasChannels, bool OutOfBounds, typename OutputType,
           typename InputType>
 void SliceFlipNormalizePermutePadKernelImpl(
@@ -228,6 +314,14 @@ void SliceFlipNormalizePermutePadKernel(
   // Convert switch argument to `int` to avoid compiler warning about unreachable case label
   BOOL_SWITCH(need_normalize, NeedNormalize, (
     BOOL_SWITCH(has_channels, HasChannels, (
+      if constexpr (Dims >= 3) {
+        if (slice_impl::CanDeinterleave<Dims>(in_strides.data(), channel_dim, need_pad)) {
+          slice_impl::SliceFlipNormalizeDeinterleaveImpl<NeedNormalize, HasChannels>(
+              output, input, in_strides.data(), out_strides.data(), out_shape.data(), mean,
+              inv_stddev, std::integral_constant<int, Dims>());
+          return;
+        }
+      }
       if (need_pad) {
         constexpr bool OutOfBounds = false;
         slice_impl::SliceFlipNormalizePermutePadKernelImpl<NeedNormalize, HasChannels, OutOfBounds>(
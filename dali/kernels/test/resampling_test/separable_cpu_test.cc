@@ -14,6 +14,8 @@
 
 #include <gtest/gtest.h>
 #include <opencv2/imgcodecs.hpp>
+#include <random>
+#include <vector>
 #include "dali/kernels/test/test_data.h"
 #include "dali/test/tensor_test_utils.h"
 #include "dali/kernels/test/resampling_test/resampling_test_params.h"
@@ -152,6 +154,94 @@ static std::vector<ResamplingTestEntry> CropResampleTests = {
 INSTANTIATE_TEST_SUITE_P(Basic, ResamplingTestCPU, ::testing::ValuesIn(ResampleTests));
 INSTANTIATE_TEST_SUITE_P(Crop , ResamplingTestCPU, ::testing::ValuesIn(CropResampleTests));
 
+namespace {
+
+ResamplingParams AxisParams(int out_size, FilterDesc filter) {
+  ResamplingParams p;
+  p.output_size = out_size;
+  p.min_filter = p.mag_filter = filter;
+  return p;
+}
+
+ResamplingParams AxisParams(int out_size, FilterDesc filter, float roi_start, float roi_end) {
+  ResamplingParams p = AxisParams(out_size, filter);
+  p.roi = ResamplingParams::ROI(roi_start, roi_end);
+  return p;
+}
+
+/**
+ * Checks that resampling the output in ranges of the outermost dimension, with separate kernel
+ * instances, gives exactly the same result as resampling the whole output at once.
+ */
+template <int spatial_ndim>
+void TestOuterRanges(const TensorShape<spatial_ndim + 1> &in_shape,
+                     const ResamplingParamsND<spatial_ndim> &params, int nranges) {
+  using Kernel = SeparableResampleCPU<uint8_t, uint8_t, spatial_ndim>;
+  std::mt19937_64 rng(1234);
+  std::vector<uint8_t> in_data(volume(in_shape));
+  UniformRandomFill(in_data, rng, 0, 255);
+  InTensorCPU<uint8_t, spatial_ndim + 1> in_view = make_tensor_cpu(in_data.data(), in_shape);
+
+  KernelContext ctx;
+  DynamicScratchpad scratchpad(AccessOrder::host());
+  ctx.scratchpad = &scratchpad;
+
+  Kernel whole;
+  auto req = whole.Setup(ctx, in_view, params);
+  auto out_shape = req.output_shapes[0].template tensor_shape<spatial_ndim + 1>(0);
+  std::vector<uint8_t> ref_data(volume(out_shape)), out_data(volume(out_shape));
+  auto ref = make_tensor_cpu(ref_data.data(), out_shape);
+  auto out = make_tensor_cpu(out_data.data(), out_shape);
+  whole.Run(ctx, ref, in_view, params);
+
+  int64_t extent = out_shape[0];
+  int64_t slice_volume = volume(out_shape) / extent;
+  for (int r = 0; r < nranges; r++) {
+    int begin = extent * r / nranges;
+    int end = extent * (r + 1) / nranges;
+    Kernel part;
+    auto part_req = part.Setup(ctx, in_view, params, begin, end);
+    auto part_shape = part_req.output_shapes[0].template tensor_shape<spatial_ndim + 1>(0);
+    ASSERT_EQ(part_shape[0], end - begin);
+    part.Run(ctx, make_tensor_cpu(out.data + begin * slice_volume, part_shape), in_view, params);
+  }
+
+  Check(out, ref);
+}
+
+}  // namespace
+
+TEST(SeparableResampleCPU, OuterRangesBitExact) {
+  FilterDesc filters[] = {
+    nearest(), lin(), cubic(), tri(), lanczos(),
+    { ResamplingFilterType::Linear, false, 0 },
+    { ResamplingFilterType::Cubic, false, 0 },
+  };
+  for (auto filter : filters) {
+    for (int nranges : { 2, 7, 13 }) {
+      // downscaling, upscaling, with and without a (flipped) ROI; odd sizes throughout
+      TestOuterRanges<2>({ 1021, 763, 3 },
+                         { AxisParams(777, filter), AxisParams(555, filter) }, nranges);
+      TestOuterRanges<2>({ 513, 301, 3 },
+                         { AxisParams(1999, filter), AxisParams(403, filter) }, nranges);
+      TestOuterRanges<2>({ 513, 301, 3 },
+                         { AxisParams(337, filter, 500.3f, 10.7f),
+                           AxisParams(201, filter, 3.3f, 290.1f) }, nranges);
+      TestOuterRanges<2>({ 301, 513, 1 },
+                         { AxisParams(333, filter, 17.25f, 280.5f),
+                           AxisParams(201, filter, 300.0f, 3.0f) }, nranges);
+      TestOuterRanges<3>({ 61, 45, 37, 2 },
+                         { AxisParams(77, filter), AxisParams(31, filter),
+                           AxisParams(41, filter, 2.5f, 30.0f) }, nranges);
+      TestOuterRanges<3>({ 61, 45, 37, 2 },
+                         { AxisParams(29, filter, 60.0f, 1.5f), AxisParams(51, filter),
+                           AxisParams(21, filter) }, nranges);
+      if (HasFailure())
+        FAIL() << "Filter type " << static_cast<int>(filter.type) << ", ranges: " << nranges;
+    }
+  }
+}
+
 }  // namespace resample_test
 }  // namespace kernels
 }  // namespace dali
@@ -15,7 +15,10 @@
 #include <gtest/gtest.h>
 #include <opencv2/imgcodecs.hpp>
 #include <opencv2/imgproc.hpp>
+#include <functional>
+#include <random>
 #include <string>
+#include <thread>
 #include <vector>
 #include "dali/kernels/imgproc/warp_cpu.h"
 #include "dali/kernels/imgproc/warp/affine.h"
@@ -145,5 +148,143 @@ TEST(WarpCPU, Affine_RotateScale) {
   }
 }
 
+namespace {
+
+/**
+ * @brief Runs the work on separate threads, in reverse order
+ */
+class ThreadedTestEngine {
+ public:
+  template <typename FunctionLike>
+  void AddWork(FunctionLike &&f, int64_t priority = 0) {
+    work_.emplace_back(std::forward<FunctionLike>(f));
+  }
+
+  void RunAll() {
+    std::vector<std::thread> threads;
+    for (int i = work_.size() - 1; i >= 0; i--)
+      threads.emplace_back(work_[i], i);
+    for (auto &t : threads)
+      t.join();
+    work_.clear();
+  }
+
+  int NumThreads() const { return 4; }
+
+  int NumWorkItems() const { return work_.size(); }
+
+ private:
+  std::vector<std::function<void(int)>> work_;
+};
+
+/**
+ * @brief Warps the image with the scalar sampler, using the same source coordinates as WarpCPU
+ */
+template <DALIInterpType interp, typename Out, typename In, typename Border>
+void RefWarpAffine(const TensorView<StorageCPU, Out, 3> &out,
+                   const TensorView<StorageCPU, const In, 3> &in,
+                   const AffineMapping2D &mapping, Border border) {
+  auto surf = as_surface_channel_last(in);
+  Sampler2D<interp, In> sampler(surf);
+  vec2 dsdx = mapping.transform.col(0);
+  for (int y = 0; y < out.shape[0]; y++) {
+    vec2 src0 = warp::map_coords(mapping, ivec2(0, y));
+    for (int x = 0; x < out.shape[1]; x++)
+      sampler(out(y, x, 0), warp::affine_row_coords(src0, dsdx, x), border);
+  }
+}
+
+template <typename Out, typename In, typename Border>
+void TestWarpAffineVsSampler(DALIInterpType interp, Border border, double eps) {
+  std::mt19937_64 rng(4321);
+  std::uniform_real_distribution<float> angle_dist(-M_PI, M_PI);
+  std::uniform_real_distribution<float> scale_dist(0.3f, 3.0f);
+  std::uniform_int_distribution<int> size_dist(1, 150);
+  std::uniform_int_distribution<int> value_dist(0, 255);
+
+  for (int iter = 0; iter < 40; iter++) {
+    int C = iter % 6 + 1;
+    TensorShape<3> in_shape = { size_dist(rng), size_dist(rng), C };
+    TensorShape<2> out_size = { size_dist(rng), size_dist(rng) };
+    std::vector<In> in_data(volume(in_shape));
+    for (auto &v : in_data)
+      v = value_dist(rng);
+    TensorView<StorageCPU, const In, 3> in(in_data.data(), in_shape);
+
+    vec2 center(in_shape[1] * 0.5f, in_shape[0] * 0.5f);
+    vec2 out_center(out_size[1] * 0.5f, out_size[0] * 0.5f);
+    float scale = scale_dist(rng);
+    auto tr = translation(center) * rotation2D(angle_dist(rng)) *
+              scaling(vec2(scale, scale)) * translation(-out_center);
+    if (iter % 5 == 0)  // axis-aligned
+      tr = translation(center) * scaling(vec2(scale, scale)) * translation(-out_center);
+    AffineMapping2D mapping = sub<2, 3>(tr, 0, 0);
+
+    auto out_shape = shape_cat(out_size, C);
+    std::vector<Out> out_data(volume(out_shape)), ref_data(volume(out_shape));
+    TensorView<StorageCPU, Out, 3> out(out_data.data(), out_shape);
+    TensorView<StorageCPU, Out, 3> ref(ref_data.data(), out_shape);
+
+    WarpCPU<AffineMapping2D, 2, Out, In, Border> warp;
+    KernelContext ctx = {};
+    warp.Setup(ctx, in, mapping, out_size, interp, border);
+    if (iter % 2) {
+      warp.Run(ctx, out, in, mapping, out_size, interp, border);
+    } else {
+      ThreadedTestEngine engine;
+      warp.Schedule(engine, ctx, out, in, mapping, out_size, interp, border, 7);
+      engine.RunAll();
+    }
+
+    if (interp == DALI_INTERP_NN)
+      RefWarpAffine<DALI_INTERP_NN>(ref, in, mapping, border);
+    else
+      RefWarpAffine<DALI_INTERP_LINEAR>(ref, in, mapping, border);
+    Check(out, ref, EqualEps(eps));
+    if (::testing::Test::HasFailure()) {
+      FAIL() << "Failed for input " << in_shape << " output " << out_shape;
+    }
+  }
+}
+
+}  // namespace
+
+TEST(WarpCPU, Affine_VsSampler_NN) {
+  TestWarpAffineVsSampler<uint8_t, uint8_t>(DALI_INTERP_NN, uint8_t(42), 0);
+  TestWarpAffineVsSampler<float, uint8_t>(DALI_INTERP_NN, BorderClamp(), 0);
+  TestWarpAffineVsSampler<int16_t, int16_t>(DALI_INTERP_NN, int16_t(-1), 0);
+}
+
+TEST(WarpCPU, Affine_VsSampler_Linear) {
+  // the vectorized implementation rounds the halfway cases to even
+  TestWarpAffineVsSampler<uint8_t, uint8_t>(DALI_INTERP_LINEAR, uint8_t(42), 1);
+  TestWarpAffineVsSampler<uint8_t, uint8_t>(DALI_INTERP_LINEAR, BorderClamp(), 1);
+  TestWarpAffineVsSampler<float, uint8_t>(DALI_INTERP_LINEAR, 7.0f, 1e-4);
+  TestWarpAffineVsSampler<float, float>(DALI_INTERP_LINEAR, BorderClamp(), 1e-4);
+  TestWarpAffineVsSampler<int16_t, int16_t>(DALI_INTERP_LINEAR, int16_t(-1), 1);
+  TestWarpAffineVsSampler<int32_t, float>(DALI_INTERP_LINEAR, int32_t(0), 1);
+}
+
+TEST(WarpCPU, Schedule_SplitsLargeImages) {
+  WarpCPU<AffineMapping2D, 2, uint8_t, uint8_t, uint8_t> warp;
+  TensorShape<3> shape = { 1024, 1024, 3 };
+  std::vector<uint8_t> in_data(volume(shape)), out_data(volume(shape));
+  TensorView<StorageCPU, const uint8_t, 3> in(in_data.data(), shape);
+  TensorView<StorageCPU, uint8_t, 3> out(out_data.data(), shape);
+  AffineMapping2D mapping = mat2x3::eye();
+  KernelContext ctx = {};
+  ThreadedTestEngine engine;
+  warp.Schedule(engine, ctx, out, in, mapping, { 1024, 1024 }, DALI_INTERP_LINEAR, 0);
+  EXPECT_EQ(engine.NumWorkItems(), 4 * 8);
+  engine.RunAll();
+
+  TensorShape<3> small_shape = { 16, 16, 3 };
+  warp.Schedule(engine, ctx, make_tensor_cpu(out_data.data(), small_shape),
+                make_tensor_cpu(in_data.data(), small_shape), mapping, { 16, 16 },
+                DALI_INTERP_LINEAR, 0);
+  EXPECT_EQ(engine.NumWorkItems(), 1);
+  engine.RunAll();
+}
+
 }  // namespace kernels
 }  // namespace dali
@@ -15,10 +15,17 @@
 #ifndef DALI_KERNELS_TRANSPOSE_TRANSPOSE_H_
 #define DALI_KERNELS_TRANSPOSE_TRANSPOSE_H_
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include <algorithm>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
+#include "dali/core/exec/engine.h"
+#include "dali/core/force_inline.h"
 #include "dali/core/static_switch.h"
 #include "dali/core/tensor_view.h"
 #include "dali/kernels/common/utils.h"
@@ -111,12 +118,277 @@ void TransposeImpl(T *dst, const T *src, int level, int max_levels, span<const i
   }
 }
 
+/**
+ * @brief Width, in bytes, of a tile of the blocked 2D transposition - one cache line.
+ *
+ * A tile (kTileBytes / sizeof(T) square) of both the source and the destination stays in L1,
+ * so that each cache line is read and written in full.
+ */
+static constexpr int kTileBytes = 64;
+
+/**
+ * @brief The number of channels up to which a transposition with a tiny dimension is done as
+ *        a single-pass (de)interleave instead of tiling.
+ */
+static constexpr int kMaxInterleavedChannels = 4;
+
+#ifdef __SSE2__
+
+template <int elem_bytes>
+DALI_FORCEINLINE __m128i unpacklo(__m128i a, __m128i b);
+template <int elem_bytes>
+DALI_FORCEINLINE __m128i unpackhi(__m128i a, __m128i b);
+
+template <>
+DALI_FORCEINLINE __m128i unpacklo<1>(__m128i a, __m128i b) { return _mm_unpacklo_epi8(a, b); }
+template <>
+DALI_FORCEINLINE __m128i unpackhi<1>(__m128i a, __m128i b) { return _mm_unpackhi_epi8(a, b); }
+template <>
+DALI_FORCEINLINE __m128i unpacklo<2>(__m128i a, __m128i b) { return _mm_unpacklo_epi16(a, b); }
+template <>
+DALI_FORCEINLINE __m128i unpackhi<2>(__m128i a, __m128i b) { return _mm_unpackhi_epi16(a, b); }
+template <>
+DALI_FORCEINLINE __m128i unpacklo<4>(__m128i a, __m128i b) { return _mm_unpacklo_epi32(a, b); }
+template <>
+DALI_FORCEINLINE __m128i unpackhi<4>(__m128i a, __m128i b) { return _mm_unpackhi_epi32(a, b); }
+
+template <typename T>
+constexpr bool HasSIMDTranspose() {
+  return std::is_trivially_copyable<T>::value &&
+         (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4);
+}
+
+/**
+ * @brief Transposes a K x K block, where K = 16 / sizeof(T), in registers.
+ *
+ * `dst[r * dst_stride + c] = src[c * src_stride + r]`
+ *
+ * Interleaving rows i and i + K/2 log2(K) times is equivalent to a transposition.
+ */
+template <typename T>
+DALI_FORCEINLINE void TransposeBlockSIMD(T *dst, int64_t dst_stride,
+                                         const T *src, int64_t src_stride) {
+  constexpr int K = 16 / sizeof(T);
+  __m128i v[K], t[K];  // NOLINT
+  for (int i = 0; i < K; i++)
+    v[i] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i * src_stride));
+  for (int stage = 1; stage < K; stage *= 2) {
+    for (int i = 0; i < K / 2; i++) {
+      t[2 * i] = unpacklo<sizeof(T)>(v[i], v[i + K / 2]);
+      t[2 * i + 1] = unpackhi<sizeof(T)>(v[i], v[i + K / 2]);
+    }
+    for (int i = 0; i < K; i++)
+      v[i] = t[i];
+  }
+  for (int i = 0; i < K; i++)
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i * dst_stride), v[i]);
+}
+
+#else
+
+template <typename T>
+constexpr bool HasSIMDTranspose() {
+  return false;
+}
+
+#endif
+
+/**
+ * @brief Transposes a tile of at most `kTileBytes / sizeof(T)` rows and columns.
+ *
+ * `dst[r * dst_stride + c] = src[c * src_stride + r]`
+ */
+template <typename T>
+DALI_FORCEINLINE void TransposeTile(T *dst, int64_t dst_stride, const T *src, int64_t src_stride,
+                                    int rows, int cols) {
+  int r0 = 0;
+#ifdef __SSE2__
+  if constexpr (HasSIMDTranspose<T>()) {
+    constexpr int K = 16 / sizeof(T);
+    int simd_rows = rows & -K;
+    int simd_cols = cols & -K;
+    for (; r0 < simd_rows; r0 += K) {
+      for (int c = 0; c < simd_cols; c += K)
+        TransposeBlockSIMD(dst + r0 * dst_stride + c, dst_stride, src + c * src_stride + r0,
+                           src_stride);
+      for (int r = r0; r < r0 + K; r++)
+        for (int c = simd_cols; c < cols; c++)
+          dst[r * dst_stride + c] = src[c * src_stride + r];
+    }
+  }
+#endif
+  for (int r = r0; r < rows; r++)
+    for (int c = 0; c < cols; c++)
+      dst[r * dst_stride + c] = src[c * src_stride + r];
+}
+
+/**
+ * @brief Transposition with a small (up to kMaxInterleavedChannels) number of rows,
+ *        e.g. HWC -> CHW; reads the source once, sequentially.
+ *
+ * `dst[r * dst_stride + c] = src[c * src_stride + r]`
+ */
+template <int rows, typename T>
+void Deinterleave(T *dst, int64_t dst_stride, const T *src, int64_t src_stride, int64_t cols) {
+  for (int64_t c = 0; c < cols; c++, src += src_stride) {
+    for (int r = 0; r < rows; r++)
+      dst[r * dst_stride + c] = src[r];
+  }
+}
+
+/**
+ * @brief Transposition with a small (up to kMaxInterleavedChannels) number of columns,
+ *        e.g. CHW -> HWC; writes the destination once, sequentially.
+ *
+ * `dst[r * dst_stride + c] = src[c * src_stride + r]`
+ */
+template <int cols, typename T>
+void Interleave(T *dst, int64_t dst_stride, const T *src, int64_t src_stride, int64_t rows) {
+  for (int64_t r = 0; r < rows; r++, dst += dst_stride) {
+    for (int c = 0; c < cols; c++)
+      dst[c] = src[c * src_stride + r];
+  }
+}
+
+/**
+ * @brief Cache-blocked 2D transposition of a `rows` x `cols` destination.
+ *
+ * `dst[r * dst_stride + c] = src[c * src_stride + r]`
+ */
+template <typename T>
+void Transpose2D(T *dst, int64_t dst_stride, const T *src, int64_t src_stride,
+                 int64_t rows, int64_t cols) {
+  if (rows <= kMaxInterleavedChannels) {
+    VALUE_SWITCH(rows, static_rows, (1, 2, 3, 4),
+      (Deinterleave<static_rows>(dst, dst_stride, src, src_stride, cols);),
+      (assert(!"Unreachable code")));
+    return;
+  }
+  if (cols <= kMaxInterleavedChannels) {
+    VALUE_SWITCH(cols, static_cols, (1, 2, 3, 4),
+      (Interleave<static_cols>(dst, dst_stride, src, src_stride, rows);),
+      (assert(!"Unreachable code")));
+    return;
+  }
+  constexpr int kTile = std::max<int>(kTileBytes / sizeof(T), 1);
+  for (int64_t r0 = 0; r0 < rows; r0 += kTile) {
+    int tile_rows = std::min<int64_t>(kTile, rows - r0);
+    for (int64_t c0 = 0; c0 < cols; c0 += kTile) {
+      int tile_cols = std::min<int64_t>(kTile, cols - c0);
+      TransposeTile(dst + r0 * dst_stride + c0, dst_stride, src + c0 * src_stride + r0,
+                    src_stride, tile_rows, tile_cols);
+    }
+  }
+}
+
+/**
+ * @brief Transposes a (part of a) tensor described by its destination shape and strides.
+ *
+ * All arguments are in the destination order: `src_stride[i]` is the source stride of
+ * the destination dimension `i`.
+ * The source is contiguous in the destination dimension `src_inner` - if it's also the innermost
+ * destination dimension, the data is copied in contiguous runs; otherwise, the planes spanned by
+ * `src_inner` and the innermost destination dimension are transposed with Transpose2D.
+ */
+template <typename T>
+void TransposeBlocked(T *dst, const T *src, span<const int64_t> size,
+                      span<const int64_t> dst_stride, span<const int64_t> src_stride,
+                      int src_inner) {
+  int ndim = size.size();
+  int inner = ndim - 1;
+  SmallVector<int, 6> outer_dims;
+  for (int d = 0; d < inner; d++) {
+    if (d != src_inner)
+      outer_dims.push_back(d);
+  }
+  int64_t outer_volume = 1;
+  for (int d : outer_dims)
+    outer_volume *= size[d];
+  if (outer_volume == 0 || size[inner] == 0 || size[src_inner] == 0)
+    return;
+
+  SmallVector<int64_t, 6> pos;
+  pos.resize(outer_dims.size(), 0);
+  for (int64_t i = 0; i < outer_volume; i++) {
+    if (src_inner == inner) {
+      std::copy(src, src + size[inner], dst);
+    } else {
+      Transpose2D(dst, dst_stride[src_inner], src, src_stride[inner],
+                  size[src_inner], size[inner]);
+    }
+    for (int k = outer_dims.size() - 1; k >= 0; k--) {
+      int d = outer_dims[k];
+      dst += dst_stride[d];
+      src += src_stride[d];
+      if (++pos[k] < size[d])
+        break;
+      dst -= size[d] * dst_stride[d];
+      src -= size[d] * src_stride[d];
+      pos[k] = 0;
+    }
+  }
+}
+
+}  // namespace transpose_impl
+
+/**
+ * @brief Tensors with fewer elements are transposed with a plain strided recursion.
+ */
+static constexpr int64_t kTransposeMinBlockedVolume = 1024;
+
+/**
+ * @brief Default minimum number of elements in a block of a transposition split between threads.
+ */
+static constexpr int64_t kTransposeMinBlockSize = 1 << 16;
+
+namespace transpose_impl {
+
+/**
+ * @brief Transposes the tensor with the (dst-ordered) strides `src_stride`, in blocks along
+ *        the destination dimension `split_dim`, scheduled in the `engine`.
+ */
+template <typename ExecutionEngine, typename T>
+void ScheduleBlocked(ExecutionEngine &engine, T *dst, const T *src, const TensorShape<> &size,
+                     const TensorShape<> &dst_stride, const TensorShape<> &src_stride,
+                     int src_inner, int nblocks) {
+  int ndim = size.size();
+  int split_dim = 0;
+  for (int d = 1; d < ndim; d++) {
+    if (size[d] > size[split_dim])
+      split_dim = d;
+  }
+  // don't split the tiles of the 2D transposition
+  int64_t align = 1;
+  if (split_dim == src_inner || split_dim == ndim - 1)
+    align = std::max<int>(kTileBytes / sizeof(T), 1);
+  nblocks = std::max<int64_t>(1, std::min<int64_t>(nblocks, size[split_dim] / align));
+
+  int64_t start = 0;
+  for (int b = 0; b < nblocks; b++) {
+    int64_t end = b == nblocks - 1 ? size[split_dim]
+                                   : size[split_dim] * (b + 1) / nblocks / align * align;
+    if (end <= start)
+      continue;
+    auto blk_size = size;
+    blk_size[split_dim] = end - start;
+    T *blk_dst = dst + start * dst_stride[split_dim];
+    const T *blk_src = src + start * src_stride[split_dim];
+    engine.AddWork([=](int) {
+      TransposeBlocked(blk_dst, blk_src, make_cspan(blk_size.shape), make_cspan(dst_stride.shape),
+                       make_cspan(src_stride.shape), src_inner);
+    }, volume(blk_size));
+    start = end;
+  }
+}
+
 }  // namespace transpose_impl
 
 /**
  * @brief Transpose `src` Tensor to `dst` wrt to permutation `perm`
  *
  * Source dimension `perm[i]` goes to destination dimension `i`.
+ *
+ * Larger tensors are transposed in cache-sized tiles (see transpose_impl::TransposeBlocked).
  */
 template <typename T>
 void Transpose(const TensorView<StorageCPU, T> &dst, const TensorView<StorageCPU, const T> &src,
@@ -130,6 +402,20 @@ void Transpose(const TensorView<StorageCPU, T> &dst, const TensorView<StorageCPU
   assert(volume(src.shape) == volume(dst.shape));
   auto dst_strides = GetStrides(dst.shape);
   auto src_strides = GetStrides(src.shape);
+  if (volume(dst.shape) >= kTransposeMinBlockedVolume) {
+    TensorShape<> src_strides_perm;
+    src_strides_perm.resize(N);
+    int src_inner = 0;
+    for (int i = 0; i < N; i++) {
+      src_strides_perm[i] = src_strides[perm[i]];
+      if (perm[i] == N - 1)
+        src_inner = i;
+    }
+    transpose_impl::TransposeBlocked(dst.data, src.data, make_cspan(dst.shape.shape),
+                                     make_cspan(dst_strides.shape),
+                                     make_cspan(src_strides_perm.shape), src_inner);
+    return;
+  }
   VALUE_SWITCH(N, static_dims, (1, 2, 3), (
     transpose_impl::TransposeImplStatic<static_dims, static_dims>(
         dst.data, src.data,
@@ -163,6 +449,51 @@ void TransposeGrouped(const TensorView<StorageCPU, T> &dst,
             make_cspan(collapsed_perm));
 }
 
+/**
+ * @brief Transpose `src` Tensor to `dst` wrt to permutation `perm`, splitting the work
+ *        into blocks scheduled in `engine`.
+ *
+ * The work is added to the engine, but not run - the caller is responsible for calling
+ * `engine.RunAll()`. Tensors smaller than `min_blk_sz` are transposed in a single block.
+ *
+ * @param req_nblocks requested number of blocks; by default, 8 per thread of the engine
+ *                    (or 1, if the engine is sequential)
+ */
+template <typename ExecutionEngine, typename T>
+void TransposeGrouped(ExecutionEngine &engine, const TensorView<StorageCPU, T> &dst,
+                      const TensorView<StorageCPU, const T> &src, span<const int> perm,
+                      int64_t min_blk_sz = kTransposeMinBlockSize, int req_nblocks = -1) {
+  int64_t vol = volume(src.shape);
+  if (req_nblocks < 0)
+    req_nblocks = engine.NumThreads() > 1 ? engine.NumThreads() * 8 : 1;
+  int nblocks = std::min<int64_t>(req_nblocks, vol / std::max<int64_t>(min_blk_sz, 1));
+  if (nblocks <= 1 || vol < kTransposeMinBlockedVolume) {
+    SmallVector<int, 6> perm_copy(perm.begin(), perm.end());
+    engine.AddWork([=](int) {
+      TransposeGrouped(dst, src, make_cspan(perm_copy));
+    }, vol);
+    return;
+  }
+
+  TensorShape<> collapsed_src_shape;
+  SmallVector<int, DynamicTensorShapeContainer::static_size> collapsed_perm;
+  transpose_impl::SimplifyPermute(collapsed_src_shape, collapsed_perm, src.shape, perm);
+  int N = collapsed_src_shape.size();
+  auto collapsed_dst_shape = permute(collapsed_src_shape, collapsed_perm);
+  auto dst_strides = GetStrides(collapsed_dst_shape);
+  auto src_strides = GetStrides(collapsed_src_shape);
+  TensorShape<> src_strides_perm;
+  src_strides_perm.resize(N);
+  int src_inner = 0;
+  for (int i = 0; i < N; i++) {
+    src_strides_perm[i] = src_strides[collapsed_perm[i]];
+    if (collapsed_perm[i] == N - 1)
+      src_inner = i;
+  }
+  transpose_impl::ScheduleBlocked(engine, dst.data, src.data, collapsed_dst_shape, dst_strides,
+                                  src_strides_perm, src_inner, nblocks);
+}
+
 }  // namespace kernels
 }  // namespace dali
 
@@ -0,0 +1,136 @@
+// Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+#include "dali/core/exec/deferred_engine.h"
+#include "dali/core/tensor_shape_print.h"
+#include "dali/kernels/transpose/transpose.h"
+#include "dali/kernels/transpose/transpose_test.h"
+
+namespace dali {
+namespace kernels {
+
+namespace {
+
+template <typename T>
+void TestTranspose(const TensorShape<> &in_shape, span<const int> perm,
+                   bool grouped, int req_nblocks = 0) {
+  int N = in_shape.size();
+  auto out_shape = permute(in_shape, perm);
+  int64_t vol = volume(in_shape);
+  std::vector<T> in(vol), out(vol), ref(vol);
+  for (int64_t i = 0; i < vol; i++)
+    in[i] = static_cast<T>(i * 7 + i / 251);
+  testing::RefTranspose(ref.data(), in.data(), in_shape.data(), perm.data(), N);
+
+  TensorView<StorageCPU, T> out_view(out.data(), out_shape);
+  TensorView<StorageCPU, const T> in_view(in.data(), in_shape);
+  if (req_nblocks > 0) {
+    DeferredEngine engine;
+    TransposeGrouped(engine, out_view, in_view, perm, 1, req_nblocks);
+    EXPECT_GT(engine.NumWorkItems(), 1);
+    engine.RunAll();
+  } else if (grouped) {
+    TransposeGrouped(out_view, in_view, perm);
+  } else {
+    Transpose(out_view, in_view, perm);
+  }
+  for (int64_t i = 0; i < vol; i++) {
+    ASSERT_EQ(out[i], ref[i]) << " at offset " << i << " for shape " << in_shape
+                              << " and permutation " << TensorShape<>(perm.begin(), perm.end());
+  }
+}
+
+template <typename T>
+void TestAllPermutations4(int max_extent) {
+  std::mt19937_64 rng(1234);
+  std::uniform_int_distribution<int> shape_dist(1, max_extent);
+  std::uniform_int_distribution<int> small_shape_dist(1, 5);
+  std::bernoulli_distribution small_dim;
+  for (auto &perm : testing::Permutations4) {
+    for (int iter = 0; iter < 3; iter++) {
+      TensorShape<> shape;
+      shape.resize(4);
+      for (int d = 0; d < 4; d++)
+        shape[d] = small_dim(rng) ? small_shape_dist(rng) : shape_dist(rng);
+      TestTranspose<T>(shape, make_cspan(perm), false);
+      TestTranspose<T>(shape, make_cspan(perm), true);
+    }
+  }
+}
+
+}  // namespace
+
+TEST(TransposeCPU, AllPermutations4D) {
+  TestAllPermutations4<uint8_t>(40);
+  TestAllPermutations4<uint16_t>(40);
+  TestAllPermutations4<int>(40);
+  TestAllPermutations4<double>(20);
+}
+
+TEST(TransposeCPU, ImageLayouts) {
+  const int hwc2chw[] = {2, 0, 1};
+  const int chw2hwc[] = {1, 2, 0};
+  for (int c : {1, 2, 3, 4, 5, 8, 16, 17}) {
+    TestTranspose<uint8_t>({67, 131, c}, make_cspan(hwc2chw), true);
+    TestTranspose<uint8_t>({c, 67, 131}, make_cspan(chw2hwc), true);
+    TestTranspose<uint16_t>({67, 131, c}, make_cspan(hwc2chw), true);
+    TestTranspose<uint16_t>({c, 67, 131}, make_cspan(chw2hwc), true);
+    TestTranspose<float>({67, 131, c}, make_cspan(hwc2chw), true);
+    TestTranspose<float>({c, 67, 131}, make_cspan(chw2hwc), true);
+  }
+
+  const int nhwc2nchw[] = {0, 3, 1, 2};
+  const int nchw2nhwc[] = {0, 2, 3, 1};
+  TestTranspose<uint8_t>({5, 33, 65, 3}, make_cspan(nhwc2nchw), true);
+  TestTranspose<uint8_t>({5, 3, 33, 65}, make_cspan(nchw2nhwc), true);
+  TestTranspose<float>({5, 33, 65, 3}, make_cspan(nhwc2nchw), true);
+  TestTranspose<float>({5, 3, 33, 65}, make_cspan(nchw2nhwc), true);
+}
+
+TEST(TransposeCPU, Tiled2D) {
+  const int perm[] = {1, 0};
+  for (auto shape : {TensorShape<>{300, 517}, TensorShape<>{64, 64}, TensorShape<>{17, 1000}}) {
+    TestTranspose<uint8_t>(shape, make_cspan(perm), false);
+    TestTranspose<int16_t>(shape, make_cspan(perm), false);
+    TestTranspose<float>(shape, make_cspan(perm), false);
+    TestTranspose<int64_t>(shape, make_cspan(perm), false);
+  }
+}
+
+TEST(TransposeCPU, Volumes) {
+  const int dhwc2cdhw[] = {3, 0, 1, 2};
+  const int reverse[] = {2, 1, 0};
+  TestTranspose<uint8_t>({20, 30, 40, 3}, make_cspan(dhwc2cdhw), true);
+  TestTranspose<float>({20, 30, 40, 3}, make_cspan(dhwc2cdhw), true);
+  TestTranspose<uint16_t>({35, 40, 45}, make_cspan(reverse), true);
+  TestTranspose<float>({35, 40, 45}, make_cspan(reverse), true);
+}
+
+TEST(TransposeCPU, Scheduled) {
+  const int hwc2chw[] = {2, 0, 1};
+  const int chw2hwc[] = {1, 2, 0};
+  const int reverse[] = {2, 1, 0};
+  const int id[] = {0, 1, 2};
+  TestTranspose<uint8_t>({200, 301, 3}, make_cspan(hwc2chw), true, 7);
+  TestTranspose<uint8_t>({3, 200, 301}, make_cspan(chw2hwc), true, 7);
+  TestTranspose<float>({200, 301, 16}, make_cspan(hwc2chw), true, 5);
+  TestTranspose<float>({35, 40, 45}, make_cspan(reverse), true, 3);
+  TestTranspose<int16_t>({35, 40, 45}, make_cspan(id), true, 4);
+}
+
+}  // namespace kernels
+}  // namespace dali
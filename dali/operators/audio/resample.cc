@@ -19,6 +19,7 @@
 #include "dali/kernels/kernel_params.h"
 #include "dali/kernels/signal/resampling_cpu.h"
 #include "dali/operators/audio/resampling_params.h"
+#include "dali/pipeline/operator/balanced_work.h"
 
 namespace dali {
 
@@ -136,8 +137,9 @@ class ResampleCPU : public ResampleBase<CPUBackend> {
 
     auto &tp = ws.GetThreadPool();
     in_fp32.resize(tp.NumThreads());
+    BalancedWork work(tp, cost_model_);
     for (int s = 0; s < N; s++) {
-      tp.AddWork([&, this, s](int thread_idx) {
+      work.AddWork([&, this, s](int thread_idx) {
         InTensorCPU<float> in_view;
         TYPE_SWITCH(in.type(), type2id, T, (AUDIO_RESAMPLE_TYPES),
           (in_view = ConvertInput(in_fp32[thread_idx], view<const T>(in[s]));),
@@ -147,9 +149,10 @@ class ResampleCPU : public ResampleBase<CPUBackend> {
         TYPE_SWITCH(dtype_, type2id, T, (AUDIO_RESAMPLE_TYPES),
           (ResampleTyped<T>(view<T>(out[s]), in_view, args_[s]);),
           (assert(!"Unreachable code.")));
-      });
+      }, in_shape.tensor_size(s) + out_shape.tensor_size(s));
     }
-    tp.RunAll();
+    work.RunAll();
+    work.ReportImbalance(ws);
   }
 
   template <typename T>
@@ -194,6 +197,7 @@ class ResampleCPU : public ResampleBase<CPUBackend> {
  private:
   kernels::signal::resampling::ResamplerCPU R;
   std::vector<std::vector<float>> in_fp32;
+  SampleCostModel cost_model_;
 };
 
 
@@ -153,8 +153,9 @@ void AudioDecoderCpu::DecodeBatch(Workspace &ws) {
   scratch_decoder_.resize(tp.NumThreads());
   scratch_resampler_.resize(tp.NumThreads());
 
+  BalancedWork work(tp, cost_model_);
   for (int i = 0; i < batch_size; i++) {
-    tp.AddWork([&, i](int thread_id) {
+    work.AddWork([&, i](int thread_id) {
       try {
         DecodeSample<OutputType>(decoded_output[i], thread_id, i);
         sample_rate_output[i].data[0] = use_resampling_
@@ -166,11 +167,13 @@ void AudioDecoderCpu::DecodeBatch(Workspace &ws) {
     }, sample_meta_[i].length * sample_meta_[i].channels);
   }
 
-  tp.RunAll();
+  work.RunAll();
+  work.ReportImbalance(ws);
 }
 
 
 void AudioDecoderCpu::RunImpl(Workspace &ws) {
+  decoded_samples_ += ws.GetInputBatchSize(0);
   TYPE_SWITCH(output_type_, type2id, OutputType, (int16_t, int32_t, float), (
     DecodeBatch<OutputType>(ws);
   ), DALI_FAIL(make_string("Unsupported output type: ", output_type_)))  // NOLINT
@@ -23,6 +23,7 @@
 #include "dali/operators/decoder/audio/generic_decoder.h"
 #include "dali/operators/audio/resampling_params.h"
 #include "dali/pipeline/data/backend.h"
+#include "dali/pipeline/operator/balanced_work.h"
 #include "dali/pipeline/workspace/workspace.h"
 #include "dali/pipeline/operator/checkpointing/stateless_operator.h"
 #include "dali/kernels/signal/resampling_cpu.h"
@@ -49,6 +50,7 @@ class AudioDecoderCpu : public StatelessOperator<CPUBackend> {
       auto params = audio::ResamplingParams::FromQuality(q);
       resampler_.Initialize(params.lobes, params.lookup_size);
     }
+    RegisterDiagnostic("decoded_samples", &decoded_samples_);
   }
 
   inline ~AudioDecoderCpu() override = default;
@@ -87,6 +89,9 @@ class AudioDecoderCpu : public StatelessOperator<CPUBackend> {
   std::vector<vector<float>> scratch_decoder_;
   std::vector<vector<float>> scratch_resampler_;
   std::vector<std::unique_ptr<AudioDecoderBase>> decoders_;
+  SampleCostModel cost_model_;
+  // the number of samples decoded so far; exposed as a diagnostic, which marks the decoders
+  int64_t decoded_samples_ = 0;
 };
 
 }  // namespace dali
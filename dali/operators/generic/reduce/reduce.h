@@ -87,23 +87,17 @@ class Reduce : public StatelessOperator<Backend>, AxesHelper {
 
     auto &thread_pool = ws.GetThreadPool();
     int num_threads = thread_pool.NumThreads();
+    int nsamples = in_view.num_samples();
 
     using Kernel = ReductionType<OutputType, InputType>;
-    kmgr_.template Resize<Kernel>(num_threads);
-
-    for (int sample = 0; sample < in_view.num_samples(); sample++) {
-      int64_t priority = volume(in_view.shape.tensor_shape_span(sample));
-      thread_pool.AddWork(
-        [&, sample](int thread_id) {
-          auto in_sample_view = in_view[sample];
-          auto out_sample_view = out_view[sample];
-          kernels::KernelContext ctx;
-
-          kmgr_.Setup<Kernel>(
-            thread_id, ctx, out_sample_view, in_sample_view, make_cspan(axes_));
-          kmgr_.Run<Kernel>(thread_id, ctx);
-        },
-        priority);
+    kmgr_.template Resize<Kernel>(nsamples);
+
+    // Large samples are reduced by multiple threads, so that small batches use all of them.
+    int req_nblocks = std::max(1, 2 * num_threads / std::max(nsamples, 1));
+    for (int sample = 0; sample < nsamples; sample++) {
+      auto &kernel = kmgr_.Get<Kernel>(sample);
+      kernel.Setup(out_view[sample], in_view[sample], make_cspan(axes_));
+      kernel.Schedule(thread_pool, true, true, req_nblocks);
     }
     thread_pool.RunAll();
   }
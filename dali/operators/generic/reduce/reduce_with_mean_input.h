@@ -100,35 +100,28 @@ class ReduceWithMeanInput : public StatelessOperator<Backend>, AxesHelper {
 
     auto &thread_pool = ws.GetThreadPool();
     int num_threads = thread_pool.NumThreads();
+    int nsamples = in_view.num_samples();
+
+    if (has_empty_axes_arg_) {
+      for (int sample = 0; sample < nsamples; sample++) {
+        auto out_sample_view = out_view[sample];
+        OutputType *data = out_sample_view.data;
+        std::fill(data, data + out_sample_view.num_elements(), 0);
+      }
+      return;
+    }
 
     using Kernel = ReductionType<OutputType, InputType, OutputType>;
-    kmgr_.template Resize<Kernel>(num_threads);
-
-    for (int sample = 0; sample < in_view.num_samples(); sample++) {
-      int64_t priority = volume(in_view.shape.tensor_shape_span(sample));
-      thread_pool.AddWork(
-        [&, sample](int thread_id) {
-          auto in_sample_view = in_view[sample];
-          auto mean_sample_view = mean_view[sample];
-          auto out_sample_view = out_view[sample];
-          kernels::KernelContext ctx;
-
-          kmgr_.Setup<Kernel>(
-            thread_id,
-            ctx,
-            out_sample_view,
-            in_sample_view,
-            make_cspan(axes_),
-            mean_sample_view,
-            ddof_);
-          if (!has_empty_axes_arg_) {
-            kmgr_.Run<Kernel>(thread_id, ctx);
-          } else {
-            OutputType *data = out_sample_view.data;
-            std::fill(data, data + out_sample_view.num_elements(), 0);
-          }
-        },
-        priority);
+    kmgr_.template Resize<Kernel>(nsamples);
+
+    // Large samples are reduced by multiple threads, so that small batches use all of them.
+    int req_nblocks = std::max(1, 2 * num_threads / std::max(nsamples, 1));
+    kernels::KernelContext ctx;
+    for (int sample = 0; sample < nsamples; sample++) {
+      auto &kernel = kmgr_.Get<Kernel>(sample);
+      kernel.Setup(ctx, out_view[sample], in_view[sample], make_cspan(axes_), mean_view[sample],
+                   ddof_);
+      kernel.Schedule(thread_pool, true, true, req_nblocks);
     }
     thread_pool.RunAll();
   }
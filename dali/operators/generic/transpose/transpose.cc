@@ -40,17 +40,18 @@ class TransposeCPU : public Transpose<CPUBackend> {
     auto out_shape = output.shape();
     int nsamples = out_shape.num_samples();
 
+    // Large samples are split into blocks, so that a batch with few (or one) big tensors
+    // still keeps all threads busy.
+    int req_nblocks = std::max(1, 10 * thread_pool.NumThreads() / std::max(nsamples, 1));
     TYPE_SWITCH(input_type, type2id, T, TRANSPOSE_ALLOWED_TYPES, (
       for (int i = 0; i < nsamples; i++) {
-        thread_pool.AddWork(
-          [this, &input, &output, i](int thread_id) {
-            TensorShape<> src_ts = input.shape()[i];
-
-            auto dst_ts = permute(src_ts, perm_);
-            kernels::TransposeGrouped(
-                TensorView<StorageCPU, T>{output.mutable_tensor<T>(i), dst_ts},
-                TensorView<StorageCPU, const T>{input.tensor<T>(i), src_ts}, make_cspan(perm_));
-          }, out_shape.tensor_size(i));
+        TensorShape<> src_ts = input.shape()[i];
+        auto dst_ts = permute(src_ts, perm_);
+        kernels::TransposeGrouped(
+            thread_pool,
+            TensorView<StorageCPU, T>{output.mutable_tensor<T>(i), dst_ts},
+            TensorView<StorageCPU, const T>{input.tensor<T>(i), src_ts}, make_cspan(perm_),
+            kernels::kTransposeMinBlockSize, req_nblocks);
       }
     ), DALI_FAIL(make_string("Unsupported input type: ", input_type)));  // NOLINT
     thread_pool.RunAll();
@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include "dali/operators/image/color/brightness_contrast.h"
+#include "dali/kernels/common/tiling.h"
 #include "dali/kernels/imgproc/pointwise/multiply_add.h"
 #include "dali/pipeline/data/sequence_utils.h"
 
@@ -113,6 +114,7 @@ void BrightnessContrastCpu::RunImplHelper(Workspace &ws) {
 
   auto in_view = view<const InputType, ndim>(input);
   auto out_view = view<OutputType, ndim>(output);
+  BalancedWork work(tp, cost_model_);
   for (int sample_id = 0; sample_id < num_samples; sample_id++) {
     float add, mul;
     OpArgsToKernelArgs<OutputType, InputType>(add, mul, brightness_[sample_id],
@@ -120,16 +122,19 @@ void BrightnessContrastCpu::RunImplHelper(Workspace &ws) {
                                               contrast_center[sample_id]);
     auto planes_range =
         sequence_utils::unfolded_views_range<ndim - 3>(out_view[sample_id], in_view[sample_id]);
-    const auto &in_range = planes_range.template get<1>();
     for (auto &&views : planes_range) {
-      tp.AddWork([&, views, add, mul](int thread_id) {
+      auto &[tvout, tvin] = views;
+      // large planes are split into bands of rows, processed in parallel
+      kernels::ScheduleBands(work, tvin.shape[0], tvin.shape[1] * tvin.shape[2],
+        [this, tvout = tvout, tvin = tvin, add, mul](kernels::Band rows) {
           kernels::KernelContext ctx;
-          auto &[tvout, tvin] = views;
-          kernel_manager_.Run<Kernel>(0, ctx, tvout, tvin, add, mul);
-        }, in_range.SliceSize());
+          kernel_manager_.Run<Kernel>(0, ctx, kernels::BandView(tvout, rows),
+                                      kernels::BandView(tvin, rows), add, mul);
+        });
     }
   }
-  tp.RunAll();
+  work.RunAll();
+  work.ReportImbalance(ws);
 }
 
 void BrightnessContrastCpu::RunImpl(Workspace &ws) {
@@ -56,7 +56,7 @@ void BrightnessContrastGpu::RunImplHelper(Workspace &ws) {
   ctx.gpu.stream = ws.stream();
   kernel_manager_.template Resize<Kernel>(1);
 
-  kernel_manager_.Setup<Kernel>(0, ctx, tvin, brightness_, contrast_);
+  kernel_manager_.Setup<Kernel>(0, ctx, tvin, brightness_.values(), contrast_.values());
   kernel_manager_.Run<Kernel>(0, ctx, tvout, tvin, addends_, multipliers_);
 }
 
@@ -23,6 +23,8 @@
 #include "dali/core/static_switch.h"
 #include "dali/kernels/kernel_manager.h"
 #include "dali/pipeline/data/views.h"
+#include "dali/pipeline/operator/arg_slot.h"
+#include "dali/pipeline/operator/balanced_work.h"
 #include "dali/pipeline/operator/checkpointing/stateless_operator.h"
 #include "dali/pipeline/operator/common.h"
 #include "dali/pipeline/operator/operator.h"
@@ -64,7 +66,13 @@ class BrightnessContrastOp : public SequenceOperator<Backend, StatelessOperator>
 
  protected:
   explicit BrightnessContrastOp(const OpSpec &spec)
-      : Base(spec), output_type_(DALI_NO_TYPE), input_type_(DALI_NO_TYPE) {
+      : Base(spec),
+        brightness_("brightness", spec),
+        brightness_shift_("brightness_shift", spec),
+        contrast_("contrast", spec),
+        contrast_center_("contrast_center", spec),
+        output_type_(DALI_NO_TYPE),
+        input_type_(DALI_NO_TYPE) {
     spec.TryGetArgument(output_type_arg_, "dtype");
   }
 
@@ -95,23 +103,9 @@ class BrightnessContrastOp : public SequenceOperator<Backend, StatelessOperator>
 
   void AcquireArguments(const Workspace &ws) {
     auto curr_batch_size = ws.GetInputBatchSize(0);
-    if (this->spec_.ArgumentDefined("brightness")) {
-      this->GetPerSampleArgument(brightness_, "brightness", ws, curr_batch_size);
-    } else {
-      brightness_ = std::vector<float>(curr_batch_size, kDefaultBrightness);
-    }
-
-    if (this->spec_.ArgumentDefined("brightness_shift")) {
-      this->GetPerSampleArgument(brightness_shift_, "brightness_shift", ws, curr_batch_size);
-    } else {
-      brightness_shift_ = std::vector<float>(curr_batch_size, kDefaultBrightnessShift);
-    }
-
-    if (this->spec_.ArgumentDefined("contrast")) {
-      this->GetPerSampleArgument(contrast_, "contrast", ws, curr_batch_size);
-    } else {
-      contrast_ = std::vector<float>(curr_batch_size, kDefaultContrast);
-    }
+    brightness_.Acquire(ws, curr_batch_size, kDefaultBrightness);
+    brightness_shift_.Acquire(ws, curr_batch_size, kDefaultBrightnessShift);
+    contrast_.Acquire(ws, curr_batch_size, kDefaultContrast);
 
     input_type_ = ws.Input<Backend>(0).type();
     output_type_ = output_type_arg_ != DALI_NO_TYPE ? output_type_arg_ : input_type_;
@@ -119,14 +113,7 @@ class BrightnessContrastOp : public SequenceOperator<Backend, StatelessOperator>
 
   template <typename InputType>
   const vector<float> &GetContrastCenter(const Workspace &ws, int num_samples) {
-    if (this->spec_.ArgumentDefined("contrast_center")) {
-      this->GetPerSampleArgument(contrast_center_, "contrast_center", ws, num_samples);
-    } else {
-      // argument cannot stop being defined in a built pipeline,
-      // so just fill in missing samples if needed
-      contrast_center_.resize(num_samples, brightness_contrast::HalfRange<InputType>());
-    }
-    return contrast_center_;
+    return contrast_center_.Acquire(ws, num_samples, brightness_contrast::HalfRange<InputType>());
   }
 
   bool SetupImpl(std::vector<OutputDesc> &output_desc, const Workspace &ws) override {
@@ -142,7 +129,7 @@ class BrightnessContrastOp : public SequenceOperator<Backend, StatelessOperator>
   }
 
   USE_OPERATOR_MEMBERS();
-  std::vector<float> brightness_, brightness_shift_, contrast_, contrast_center_;
+  ArgSlot<float> brightness_, brightness_shift_, contrast_, contrast_center_;
   DALIDataType output_type_arg_ = DALI_NO_TYPE;
   DALIDataType output_type_ = DALI_NO_TYPE;
   DALIDataType input_type_ = DALI_NO_TYPE;
@@ -170,6 +157,8 @@ class BrightnessContrastCpu : public BrightnessContrastOp<CPUBackend> {
 
   template <typename OutputType, typename InputType, int ndim>
   void RunImplHelper(Workspace &ws);
+
+  SampleCostModel cost_model_;
 };
 
 
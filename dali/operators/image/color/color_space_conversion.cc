@@ -12,9 +12,10 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
-#include <map>
 #include "dali/operators/image/color/color_space_conversion.h"
-#include "dali/util/ocv.h"
+#include "dali/kernels/common/tiling.h"
+#include "dali/kernels/imgproc/color_manipulation/color_space_conversion_cpu.h"
+#include "dali/pipeline/data/views.h"
 
 namespace dali {
 
@@ -36,25 +37,27 @@ void ColorSpaceConversion<CPUBackend>::RunImpl(Workspace &ws) {
   auto in_view = view<const uint8_t>(input);
   auto out_view = view<uint8_t>(output);
   const auto &in_sh = in_view.shape;
-  const auto &out_sh = out_view.shape;
   int nsamples = in_sh.num_samples();
   int ndim = in_sh.sample_dim();
   auto& thread_pool = ws.GetThreadPool();
+  BalancedWork work(thread_pool, cost_model_);
   for (int i = 0; i < nsamples; i++) {
-    thread_pool.AddWork(
-      [&, i](int thread_id) {
-        auto in_sample_sh = in_sh.tensor_shape_span(i);
-        // flatten any leading dimensions together with the height
-        int height = volume(in_sample_sh.begin(), in_sample_sh.end() - 2);
-        int width  = in_sample_sh[ndim - 2];
-        auto cv_in =
-          CreateMatFromPtr(height, width, GetOpenCvChannelType(in_nchannels_), in_view[i].data);
-        auto cv_out =
-          CreateMatFromPtr(height, width, GetOpenCvChannelType(out_nchannels_), out_view[i].data);
-        OpenCvColorConversion(input_type_, cv_in, output_type_, cv_out);
-      }, in_sh.tensor_size(i));
+    auto in_sample_sh = in_sh.tensor_shape_span(i);
+    // flatten any leading dimensions together with the height
+    int64_t height = volume(in_sample_sh.begin(), in_sample_sh.end() - 2);
+    int64_t width  = in_sample_sh[ndim - 2];
+    const uint8_t *in = in_view[i].data;
+    uint8_t *out = out_view[i].data;
+    int64_t in_row_stride = width * in_nchannels_, out_row_stride = width * out_nchannels_;
+    kernels::ScheduleBands(work, height, in_row_stride + out_row_stride,
+      [=, in_type = input_type_, out_type = output_type_](kernels::Band rows) {
+        kernels::color::ConvertRow(out + rows.begin * out_row_stride, out_type,
+                                   in + rows.begin * in_row_stride, in_type,
+                                   rows.size() * width);
+      });
   }
-  thread_pool.RunAll();
+  work.RunAll();
+  work.ReportImbalance(ws);
 }
 
 DALI_REGISTER_OPERATOR(ColorSpaceConversion, ColorSpaceConversion<CPUBackend>, CPU);
@@ -18,6 +18,7 @@
 
 #include <vector>
 
+#include "dali/pipeline/operator/balanced_work.h"
 #include "dali/pipeline/operator/checkpointing/stateless_operator.h"
 #include "dali/pipeline/operator/operator.h"
 
@@ -65,6 +66,7 @@ class ColorSpaceConversion : public StatelessOperator<Backend> {
   const DALIImageType output_type_;
   const int in_nchannels_;
   const int out_nchannels_;
+  SampleCostModel cost_model_;  // used by the CPU backend
 };
 
 }  // namespace dali
@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include "dali/operators/image/color/color_twist.h"
+#include "dali/kernels/common/tiling.h"
 #include "dali/kernels/imgproc/pointwise/linear_transformation_cpu.h"
 #include "dali/pipeline/data/sequence_utils.h"
 
@@ -156,20 +157,22 @@ void ColorTwistCpu::RunImplHelper(Workspace &ws) {
   kernel_manager_.template Resize<Kernel>(num_samples);
   auto in_view = view<const InputType, ndim>(input);
   auto out_view = view<OutputType, ndim>(output);
+  BalancedWork work(tp, cost_model_);
   for (int i = 0; i < num_samples; i++) {
     auto planes_range = sequence_utils::unfolded_views_range<ndim - 3>(out_view[i], in_view[i]);
-    const auto &in_range = planes_range.template get<1>();
     for (auto &&views : planes_range) {
-      tp.AddWork(
-          [&, i, views](int thread_id) {
-            kernels::KernelContext ctx;
-            auto &[tvout, tvin] = views;
-            kernel_manager_.Run<Kernel>(i, ctx, tvout, tvin, tmatrices_[i], toffsets_[i]);
-          },
-          in_range.SliceSize());
+      auto &[tvout, tvin] = views;
+      // large planes are split into bands of rows, processed in parallel
+      kernels::ScheduleBands(work, tvin.shape[0], tvin.shape[1] * tvin.shape[2],
+        [this, i, tvout = tvout, tvin = tvin](kernels::Band rows) {
+          kernels::KernelContext ctx;
+          kernel_manager_.Run<Kernel>(i, ctx, kernels::BandView(tvout, rows),
+                                      kernels::BandView(tvin, rows), tmatrices_[i], toffsets_[i]);
+        });
     }
   }
-  tp.RunAll();
+  work.RunAll();
+  work.ReportImbalance(ws);
 }
 
 void ColorTwistCpu::RunImpl(Workspace &ws) {
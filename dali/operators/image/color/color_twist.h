@@ -24,6 +24,8 @@
 #include "dali/kernels/imgproc/pointwise/linear_transformation_cpu.h"
 #include "dali/kernels/kernel_manager.h"
 #include "dali/pipeline/data/views.h"
+#include "dali/pipeline/operator/arg_slot.h"
+#include "dali/pipeline/operator/balanced_work.h"
 #include "dali/pipeline/operator/common.h"
 #include "dali/pipeline/operator/operator.h"
 #include "dali/pipeline/operator/sequence_operator.h"
@@ -96,6 +98,11 @@ class ColorTwistBase : public SequenceOperator<Backend, StatelessOperator> {
  protected:
   explicit ColorTwistBase(const OpSpec &spec)
       : SequenceOperator<Backend, StatelessOperator>(spec),
+        hue_(color::kHue, spec),
+        saturation_(color::kSaturation, spec),
+        value_(color::kValue, spec),
+        brightness_(color::kBrightness, spec),
+        contrast_(color::kContrast, spec),
         output_type_(DALI_NO_TYPE) {
     spec.TryGetArgument(output_type_arg_, color::kOutputType);
   }
@@ -110,35 +117,11 @@ class ColorTwistBase : public SequenceOperator<Backend, StatelessOperator> {
 
   void AcquireArguments(const Workspace &ws) {
     auto curr_batch_size = ws.GetInputBatchSize(0);
-    if (this->spec_.ArgumentDefined(color::kHue)) {
-      this->GetPerSampleArgument(hue_, color::kHue, ws, curr_batch_size);
-    } else {
-      hue_ = std::vector<float>(curr_batch_size, 0);
-    }
-
-    if (this->spec_.ArgumentDefined(color::kSaturation)) {
-      this->GetPerSampleArgument(saturation_, color::kSaturation, ws, curr_batch_size);
-    } else {
-      saturation_ = std::vector<float>(curr_batch_size, 1);
-    }
-
-    if (this->spec_.ArgumentDefined(color::kValue)) {
-      this->GetPerSampleArgument(value_, color::kValue, ws, curr_batch_size);
-    } else {
-      value_ = std::vector<float>(curr_batch_size, 1);
-    }
-
-    if (this->spec_.ArgumentDefined(color::kBrightness)) {
-      this->GetPerSampleArgument(brightness_, color::kBrightness, ws, curr_batch_size);
-    } else {
-      brightness_ = std::vector<float>(curr_batch_size, 1);
-    }
-
-    if (this->spec_.ArgumentDefined(color::kContrast)) {
-      this->GetPerSampleArgument(contrast_, color::kContrast, ws, curr_batch_size);
-    } else {
-      contrast_ = std::vector<float>(curr_batch_size, 1);
-    }
+    hue_.Acquire(ws, curr_batch_size, 0.0f);
+    saturation_.Acquire(ws, curr_batch_size, 1.0f);
+    value_.Acquire(ws, curr_batch_size, 1.0f);
+    brightness_.Acquire(ws, curr_batch_size, 1.0f);
+    contrast_.Acquire(ws, curr_batch_size, 1.0f);
 
     auto in_type = ws.Input<Backend>(0).type();
     output_type_ = output_type_arg_ != DALI_NO_TYPE ? output_type_arg_ : in_type;
@@ -158,10 +141,10 @@ class ColorTwistBase : public SequenceOperator<Backend, StatelessOperator> {
     AcquireArguments(ws);
     assert(hue_.size() == saturation_.size() && hue_.size() == brightness_.size());
     assert(hue_.size() == contrast_.size());
-    auto size = hue_.size();
+    int size = hue_.size();
     tmatrices_.resize(size);
     toffsets_.resize(size);
-    for (size_t i = 0; i < size; i++) {
+    for (int i = 0; i < size; i++) {
       tmatrices_[i] =
                mat3(brightness_[i]) * mat3(contrast_[i]) *
                Yiq2Rgb * hue_mat(hue_[i]) * sat_mat(saturation_[i]) * mat3(value_[i]) * Rgb2Yiq;
@@ -184,7 +167,7 @@ class ColorTwistBase : public SequenceOperator<Backend, StatelessOperator> {
 
   USE_OPERATOR_MEMBERS();
   float half_range_ = 0.0f;
-  std::vector<float> hue_, saturation_, value_, brightness_, contrast_;
+  ArgSlot<float> hue_, saturation_, value_, brightness_, contrast_;
   std::vector<mat3> tmatrices_;
   std::vector<vec3> toffsets_;
   DALIDataType output_type_arg_ = DALI_NO_TYPE, output_type_ = DALI_NO_TYPE;
@@ -212,6 +195,8 @@ class ColorTwistCpu : public ColorTwistBase<CPUBackend> {
 
   template <typename OutputType, typename InputType, int ndim>
   void RunImplHelper(Workspace &ws);
+
+  SampleCostModel cost_model_;
 };
 
 
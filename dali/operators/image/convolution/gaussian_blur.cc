@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <cstring>
 #include <functional>
 #include <memory>
 #include <string>
@@ -19,6 +20,8 @@
 #include <vector>
 
 #include "dali/core/static_switch.h"
+#include "dali/kernels/common/tiling.h"
+#include "dali/kernels/dynamic_scratchpad.h"
 #include "dali/kernels/imgproc/convolution/separable_convolution_cpu.h"
 #include "dali/kernels/kernel_manager.h"
 #include "dali/operators/image/convolution/gaussian_blur.h"
@@ -117,26 +120,46 @@ class GaussianBlurOpCpu : public OpImplBase<CPUBackend> {
 
     int nsamples = input.num_samples();
     for (int sample_idx = 0; sample_idx < nsamples; sample_idx++) {
-      auto elem_volume = volume(input.tensor_shape(sample_idx));
-      thread_pool.AddWork(
-          [this, &input, &output, sample_idx](int thread_id) {
-            auto gaussian_windows = windows_[sample_idx].GetWindows();
-            const auto &shape = input.tensor_shape(sample_idx);
-            auto in_view = TensorView<StorageCPU, const In, ndim>{
-                input.template tensor<In>(sample_idx), shape};
-            auto out_view = TensorView<StorageCPU, Out, ndim>{
-                output.template mutable_tensor<Out>(sample_idx), shape};
-            // I need a context for that particular run (or rather matching the thread &
-            // scratchpad)
-            auto ctx = ctx_;
-            kmgr_.Run<Kernel>(sample_idx, ctx, out_view, in_view, gaussian_windows);
-          },
-          elem_volume);
+      auto shape = input.tensor_shape(sample_idx).template to_static<ndim>();
+      auto in_view = TensorView<StorageCPU, const In, ndim>{
+          input.template tensor<In>(sample_idx), shape};
+      auto out_view = TensorView<StorageCPU, Out, ndim>{
+          output.template mutable_tensor<Out>(sample_idx), shape};
+      // Large samples are split into bands along the outermost axis. Each band is convolved
+      // with a halo of the outermost window's radius, so the border handling is only applied
+      // at the actual edges of the sample.
+      int halo = params_[sample_idx].window_sizes[0] / 2;
+      int64_t slice_volume = volume(shape.begin() + 1, shape.end());
+      kernels::ScheduleBands(thread_pool, shape[0], slice_volume,
+        [this, in_view, out_view, halo, sample_idx](kernels::Band band) {
+          RunBand(sample_idx, out_view, in_view, band, halo);
+        }, halo);
     }
     thread_pool.RunAll();
   }
 
  private:
+  void RunBand(int sample_idx, const TensorView<StorageCPU, Out, ndim> &out,
+               const TensorView<StorageCPU, const In, ndim> &in, kernels::Band band, int halo) {
+    auto gaussian_windows = windows_[sample_idx].GetWindows();
+    auto ctx = ctx_;
+    kernels::DynamicScratchpad scratchpad(AccessOrder::host());
+    ctx.scratchpad = &scratchpad;
+    auto ext = band.extended(halo, in.shape[0]);
+    auto in_band = kernels::BandView(in, ext);
+    if (ext.begin == band.begin && ext.end == band.end) {
+      kmgr_.Run<Kernel>(sample_idx, ctx, kernels::BandView(out, band), in_band, gaussian_windows);
+      return;
+    }
+    // the halo is calculated redundantly, to a temporary buffer, and discarded
+    auto *tmp = scratchpad.AllocateHost<Out>(volume(in_band.shape));
+    TensorView<StorageCPU, Out, ndim> tmp_view{tmp, in_band.shape};
+    kmgr_.Run<Kernel>(sample_idx, ctx, tmp_view, in_band, gaussian_windows);
+    auto tmp_band = kernels::BandView(tmp_view, { band.begin - ext.begin, band.end - ext.begin });
+    std::memcpy(kernels::BandView(out, band).data, tmp_band.data,
+                tmp_band.num_elements() * sizeof(Out));
+  }
+
   const OpSpec &spec_;
 
   kernels::KernelManager kmgr_;
@@ -0,0 +1,98 @@
+// Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <cstring>
+#include <random>
+#include <vector>
+#include "dali/pipeline/pipeline.h"
+#include "dali/test/tensor_test_utils.h"
+
+namespace dali {
+namespace test {
+
+namespace {
+
+/**
+ * Runs `spec` on `input` in a CPU-only pipeline with the given number of threads.
+ * With one thread, the samples are blurred whole; with more, large samples are split into bands.
+ */
+void RunBlur(TensorList<CPUBackend> &out, const TensorList<CPUBackend> &input,
+             const OpSpec &spec, int num_threads) {
+  Pipeline pipe(input.num_samples(), num_threads, CPU_ONLY_DEVICE_ID, 1234);
+  pipe.AddExternalInput("data");
+  pipe.AddOperator(OpSpec(spec)
+                   .AddArg("device", "cpu")
+                   .AddInput("data", StorageDevice::CPU)
+                   .AddOutput("blurred", StorageDevice::CPU), "blur");
+  pipe.Build({{"blurred", "cpu"}});
+  pipe.SetExternalInput("data", input);
+  pipe.Run();
+  Workspace ws;
+  pipe.Outputs(&ws);
+  out.Copy(ws.Output<CPUBackend>(0));
+}
+
+void CheckBandsBitExact(const TensorListShape<> &shape, const TensorLayout &layout,
+                        const OpSpec &spec) {
+  TensorList<CPUBackend> input;
+  input.Resize(shape, DALI_UINT8);
+  input.SetLayout(layout);
+  std::mt19937_64 rng(4321);
+  UniformRandomFill(view<uint8_t>(input), rng, 0, 255);
+
+  TensorList<CPUBackend> whole, bands;
+  RunBlur(whole, input, spec, 1);
+  RunBlur(bands, input, spec, 4);
+
+  ASSERT_EQ(whole.type(), bands.type());
+  ASSERT_EQ(whole.shape(), bands.shape());
+  for (int i = 0; i < whole.num_samples(); i++) {
+    size_t bytes = whole.shape()[i].num_elements() * whole.type_info().size();
+    EXPECT_EQ(std::memcmp(whole.raw_tensor(i), bands.raw_tensor(i), bytes), 0)
+        << "Sample " << i << " differs when blurred in bands.";
+  }
+}
+
+}  // namespace
+
+TEST(GaussianBlurBandsTest, Image) {
+  CheckBandsBitExact(uniform_list_shape(1, { 1021, 763, 3 }), "HWC",
+                     OpSpec("GaussianBlur").AddArg("sigma", 3.0f));
+}
+
+TEST(GaussianBlurBandsTest, AnisotropicFloat) {
+  CheckBandsBitExact(uniform_list_shape(1, { 1013, 601, 1 }), "HWC",
+                     OpSpec("GaussianBlur")
+                     .AddArg("sigma", std::vector<float>{ 5.5f, 1.5f })
+                     .AddArg("dtype", DALI_FLOAT));
+}
+
+TEST(GaussianBlurBandsTest, ChannelFirst) {
+  CheckBandsBitExact(uniform_list_shape(1, { 3, 777, 555 }), "CHW",
+                     OpSpec("GaussianBlur").AddArg("window_size", 9));
+}
+
+TEST(GaussianBlurBandsTest, Volume) {
+  CheckBandsBitExact(uniform_list_shape(1, { 67, 129, 95, 2 }), "DHWC",
+                     OpSpec("GaussianBlur").AddArg("sigma", 1.5f));
+}
+
+TEST(GaussianBlurBandsTest, UnevenBatch) {
+  TensorListShape<> shape = {{ 1021, 763, 3 }, { 97, 65, 3 }, { 333, 1555, 3 }};
+  CheckBandsBitExact(shape, "HWC", OpSpec("GaussianBlur").AddArg("sigma", 2.0f));
+}
+
+}  // namespace test
+}  // namespace dali
@@ -87,7 +87,14 @@ Possible values are:
 * | ``"truncate"`` - Discards the fractional part of the number (truncates towards zero).)code",
         "round");
 
-CropAttr::CropAttr(const OpSpec& spec) {
+CropAttr::CropAttr(const OpSpec& spec)
+    : crop_arg_("crop", spec),
+      crop_w_arg_("crop_w", spec),
+      crop_h_arg_("crop_h", spec),
+      crop_d_arg_("crop_d", spec),
+      crop_pos_x_arg_("crop_pos_x", spec),
+      crop_pos_y_arg_("crop_pos_y", spec),
+      crop_pos_z_arg_("crop_pos_z", spec) {
   auto max_batch_size = spec.GetArgument<int>("max_batch_size");
   bool has_crop_arg = spec.ArgumentDefined("crop");
   bool has_crop_w_arg = spec.ArgumentDefined("crop_w");
@@ -174,6 +181,58 @@ void CropAttr::ProcessArguments(const OpSpec& spec, const ArgumentWorkspace* ws,
     crop_z_norm_[data_idx] = spec.GetArgument<float>("crop_pos_z", ws, data_idx);
   }
 
+  SetCropWindowGenerator(data_idx);
+}
+
+void CropAttr::ProcessArguments(const OpSpec& spec, const ArgumentWorkspace& ws, int nsamples) {
+  DALI_ENFORCE(nsamples <= static_cast<int>(crop_window_generators_.size()),
+               make_string("The batch size ", nsamples, " exceeds the maximum batch size ",
+                           crop_window_generators_.size()));
+  if (crop_arg_.HasArgumentInput())
+    crop_arg_.Acquire(spec, ws, nsamples);
+  if (crop_w_arg_.HasExplicitValue()) {
+    crop_w_arg_.Acquire(ws, nsamples);
+    crop_h_arg_.Acquire(ws, nsamples);
+  }
+  if (crop_d_arg_.HasExplicitValue())
+    crop_d_arg_.Acquire(ws, nsamples);
+  crop_pos_x_arg_.Acquire(ws, nsamples);
+  crop_pos_y_arg_.Acquire(ws, nsamples);
+  crop_pos_z_arg_.Acquire(ws, nsamples);
+
+  for (int data_idx = 0; data_idx < nsamples; data_idx++) {
+    if (crop_arg_.HasArgumentInput()) {
+      auto crop_arg = crop_arg_[data_idx];
+      int crop_arg_len = crop_arg.shape[0];
+      DALI_ENFORCE(crop_arg_len >= 2 && crop_arg_len <= 3,
+                   "`crop` argument should have 2 or 3 elements depending on the input data shape");
+      int idx = 0;
+      if (crop_arg_len == 3) {
+        crop_depth_[data_idx] = static_cast<int>(crop_arg.data[idx++]);
+      }
+      crop_height_[data_idx] = static_cast<int>(crop_arg.data[idx++]);
+      crop_width_[data_idx] = static_cast<int>(crop_arg.data[idx++]);
+    }
+
+    if (crop_w_arg_.HasExplicitValue()) {
+      crop_width_[data_idx] = static_cast<int>(crop_w_arg_[data_idx]);
+      crop_height_[data_idx] = static_cast<int>(crop_h_arg_[data_idx]);
+    }
+    if (crop_d_arg_.HasExplicitValue()) {
+      crop_depth_[data_idx] = static_cast<int>(crop_d_arg_[data_idx]);
+    }
+
+    crop_x_norm_[data_idx] = crop_pos_x_arg_[data_idx];
+    crop_y_norm_[data_idx] = crop_pos_y_arg_[data_idx];
+    if (crop_d_arg_.HasExplicitValue() || crop_depth_[data_idx] != kNoCrop) {
+      crop_z_norm_[data_idx] = crop_pos_z_arg_[data_idx];
+    }
+
+    SetCropWindowGenerator(data_idx);
+  }
+}
+
+void CropAttr::SetCropWindowGenerator(std::size_t data_idx) {
   crop_window_generators_[data_idx] = [this, data_idx](const TensorShape<>& input_shape,
                                                        const TensorLayout& shape_layout) {
     DALI_ENFORCE(input_shape.size() == shape_layout.size());
@@ -240,10 +299,7 @@ TensorShape<> CropAttr::CalculateAnchor(const span<float>& anchor_norm,
 }
 
 void CropAttr::ProcessArguments(const OpSpec& spec, const Workspace& ws) {
-  int batch_size = ws.GetInputBatchSize(0);
-  for (int data_idx = 0; data_idx < batch_size; data_idx++) {
-    ProcessArguments(spec, &ws, data_idx);
-  }
+  ProcessArguments(spec, ws, ws.GetInputBatchSize(0));
 }
 
 void CropAttr::ProcessArguments(const OpSpec& spec, const SampleWorkspace& ws) {
@@ -17,6 +17,8 @@
 
 #include <vector>
 #include "dali/core/common.h"
+#include "dali/pipeline/operator/arg_helper.h"
+#include "dali/pipeline/operator/arg_slot.h"
 #include "dali/pipeline/operator/common.h"
 #include "dali/pipeline/workspace/workspace.h"
 #include "dali/pipeline/workspace/sample_workspace.h"
@@ -38,6 +40,13 @@ class CropAttr {
 
   void ProcessArguments(const OpSpec& spec, const ArgumentWorkspace* ws, std::size_t data_idx);
 
+  /**
+   * @brief Processes the arguments for a whole batch
+   *
+   * The argument inputs are acquired once, rather than looked up for each sample.
+   */
+  void ProcessArguments(const OpSpec& spec, const ArgumentWorkspace& ws, int nsamples);
+
   TensorShape<> CalculateAnchor(const span<float>& anchor_norm, const TensorShape<>& crop_shape,
                                 const TensorShape<>& input_shape);
 
@@ -59,6 +68,13 @@ class CropAttr {
   std::vector<CropWindowGenerator> crop_window_generators_;
   bool is_whole_image_ = false;
   std::function<int64_t(double)> round_fn_;
+
+ private:
+  void SetCropWindowGenerator(std::size_t data_idx);
+
+  ArgValue<float, 1> crop_arg_;
+  ArgSlot<float> crop_w_arg_, crop_h_arg_, crop_d_arg_;
+  ArgSlot<float> crop_pos_x_arg_, crop_pos_y_arg_, crop_pos_z_arg_;
 };
 
 }  // namespace dali
@@ -15,6 +15,7 @@
 #include "dali/operators/image/crop/crop_mirror_normalize.h"
 #include "dali/core/static_switch.h"
 #include "dali/core/tensor_layout.h"
+#include "dali/kernels/common/tiling.h"
 #include "dali/kernels/slice/slice_flip_normalize_permute_pad_cpu.h"
 #include "dali/pipeline/data/views.h"
 
@@ -130,14 +131,21 @@ void CropMirrorNormalize<CPUBackend>::RunImpl(Workspace &ws) {
         auto &kernel_sample_args = std::any_cast<std::vector<Args>&>(kernel_sample_args_);
         auto in_view = view<const InputType, Dims>(input);
         auto out_view = view<OutputType, Dims>(output);
-        int req_nblocks = std::max(1, 10 * thread_pool.NumThreads() / nsamples);
+        // the blocks are distributed proportionally to the sample sizes, so that large samples
+        // are split more finely and the blocks have similar cost
+        int64_t total_volume = std::max<int64_t>(out_shape.num_elements(), 1);
+        int64_t max_nblocks = thread_pool.NumThreads() * kernels::kBandsPerThread;
         kernels::KernelContext ctx;
+        BalancedWork work(thread_pool, cost_model_);
         for (int sample_idx = 0; sample_idx < nsamples; sample_idx++) {
+          int req_nblocks = std::max<int64_t>(
+              1, div_ceil(max_nblocks * out_shape.tensor_size(sample_idx), total_volume));
           Kernel().Schedule(ctx, out_view[sample_idx], in_view[sample_idx],
                             kernel_sample_args[sample_idx],
-                            thread_pool, kernels::kSliceMinBlockSize, req_nblocks);
+                            work, kernels::kSliceMinBlockSize, req_nblocks);
         }
-        thread_pool.RunAll();
+        work.RunAll();
+        work.ReportImbalance(ws);
       ), DALI_FAIL(make_string("Not supported number of dimensions:", ndim));); // NOLINT
     ), DALI_FAIL(make_string("Not supported output type:", output_type_));); // NOLINT
   ), DALI_FAIL(make_string("Not supported input type:", input_type_));); // NOLINT
@@ -29,6 +29,8 @@
 #include "dali/operators/generic/slice/out_of_bounds_policy.h"
 #include "dali/operators/image/crop/crop_attr.h"
 #include "dali/pipeline/operator/arg_helper.h"
+#include "dali/pipeline/operator/arg_slot.h"
+#include "dali/pipeline/operator/balanced_work.h"
 #include "dali/pipeline/operator/common.h"
 #include "dali/pipeline/operator/checkpointing/stateless_operator.h"
 
@@ -103,6 +105,7 @@ class CropMirrorNormalize : public StatelessOperator<Backend> {
         out_of_bounds_policy_(GetOutOfBoundsPolicy(spec, { boundary::BoundaryType::CONSTANT })),
         mean_arg_("mean", spec),
         std_arg_("std", spec),
+        mirror_arg_("mirror", spec),
         scale_(spec.GetArgument<float>("scale")),
         shift_(spec.GetArgument<float>("shift")) {
     if (out_of_bounds_policy_.shape_policy == OutOfBoundsShapePolicy::Pad) {
@@ -174,6 +177,7 @@ class CropMirrorNormalize : public StatelessOperator<Backend> {
       "This operator expects an explicit channel dimension, even for monochrome images");
 
     crop_attr_.ProcessArguments(spec, ws);
+    auto &mirror = mirror_arg_.Acquire(ws, nsamples);
 
     ArgValueFlags flags = ArgValue_EnforceUniform;
     mean_arg_.Acquire(spec_, ws, nsamples, flags);
@@ -197,7 +201,7 @@ class CropMirrorNormalize : public StatelessOperator<Backend> {
       assert(crop_win_gen);
 
       CropWindow crop_window = crop_win_gen(in_shape[data_idx], input_layout_);
-      bool horizontal_flip = this->spec_.template GetArgument<int>("mirror", &ws, data_idx);
+      bool horizontal_flip = mirror[data_idx];
 
       ApplySliceBoundsPolicy(
           out_of_bounds_policy_.shape_policy,
@@ -240,6 +244,7 @@ class CropMirrorNormalize : public StatelessOperator<Backend> {
 
   ArgValue<float, 1> mean_arg_;
   ArgValue<float, 1> std_arg_;
+  ArgSlot<int> mirror_arg_;
   float scale_ = 1.0f;
   float shift_ = 0.0f;
   bool const_norm_args_read_ = false;
@@ -248,6 +253,7 @@ class CropMirrorNormalize : public StatelessOperator<Backend> {
 
   kernels::KernelManager kmgr_;
   std::any kernel_sample_args_;
+  SampleCostModel cost_model_;
 
   USE_OPERATOR_MEMBERS();
 };
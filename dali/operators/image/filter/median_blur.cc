@@ -12,28 +12,26 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
-#include <optional>
-#include <nvcv/Image.hpp>
-#include <nvcv/ImageBatch.hpp>
-#include <nvcv/Tensor.hpp>
-#include <cvcuda/OpMedianBlur.hpp>
-#include "dali/core/dev_buffer.h"
-#include "dali/kernels/dynamic_scratchpad.h"
+#include <vector>
 #include "dali/core/static_switch.h"
-#include "dali/kernels/common/utils.h"
+#include "dali/kernels/imgproc/filter/median_blur_cpu.h"
+#include "dali/pipeline/data/views.h"
+#include "dali/pipeline/operator/arg_helper.h"
 #include "dali/pipeline/operator/checkpointing/stateless_operator.h"
 #include "dali/pipeline/operator/operator.h"
-#include "dali/pipeline/operator/arg_helper.h"
+#include "dali/pipeline/operator/sequence_operator.h"
 
-#include "dali/operators/nvcvop/nvcvop.h"
+#define MEDIAN_BLUR_CPU_SUPPORTED_TYPES (uint8_t, uint16_t, int16_t, float)
 
 namespace dali {
 
-
 DALI_SCHEMA(experimental__MedianBlur)
   .DocStr(R"doc(
 Median blur performs smoothing of an image or sequence of images by replacing each pixel
 with the median color of a surrounding rectangular region.
+
+The pixels outside of the image are replicated from the nearest edge.
+The CPU variant supports uint8, uint16, int16 and float32 inputs and requires odd window sizes.
   )doc")
   .NumInput(1)
   .InputDox(0, "input", "TensorList",
@@ -47,50 +45,61 @@ with the median color of a surrounding rectangular region.
     std::vector<int>({3, 3}),
     true);
 
-
-class MedianBlur : public nvcvop::NVCVSequenceOperator<StatelessOperator> {
+/**
+ * @brief Median blur on the CPU
+ *
+ * The channel-first and sequence inputs are expanded, so the kernel only sees HW or HWC images.
+ */
+class MedianBlurCpu : public SequenceOperator<CPUBackend, StatelessOperator> {
  public:
-  explicit MedianBlur(const OpSpec &spec) :
-    nvcvop::NVCVSequenceOperator<StatelessOperator>(spec) {}
+  explicit MedianBlurCpu(const OpSpec &spec)
+      : SequenceOperator<CPUBackend, StatelessOperator>(spec) {}
 
   bool ShouldExpandChannels(int input_idx) const override {
     return true;
   }
 
+ protected:
   bool SetupImpl(std::vector<OutputDesc> &output_desc, const Workspace &ws) override {
-    const auto &input = ws.Input<GPUBackend>(0);
-    auto sh = input.shape();
+    const auto &input = ws.Input<CPUBackend>(0);
+    ksize_arg_.Acquire(spec_, ws, input.num_samples(), TensorShape<1>(2));
     output_desc.resize(1);
-    output_desc[0] = {sh, input.type()};
+    output_desc[0] = {input.shape(), input.type()};
     return true;
   }
 
   void RunImpl(Workspace &ws) override {
-    const auto &input = ws.Input<GPUBackend>(0);
-    auto &output = ws.Output<GPUBackend>(0);
-    output.SetLayout(input.GetLayout());
-
-    kernels::DynamicScratchpad scratchpad(AccessOrder(ws.stream()));
-    auto ksize = AcquireTensorArgument<int32_t>(ws, scratchpad, ksize_arg_,
-                                                TensorShape<1>(2),
-                                                nvcvop::GetDataType<int32_t>(), "W");
+    const auto &input = ws.Input<CPUBackend>(0);
+    TYPE_SWITCH(input.type(), type2id, T, MEDIAN_BLUR_CPU_SUPPORTED_TYPES, (
+      RunTyped<T>(ws);
+    ), DALI_FAIL(make_string("Unsupported input type: ", input.type())));  // NOLINT
+  }
 
-    auto input_images = GetInputBatch(ws, 0);
-    auto output_images = GetOutputBatch(ws, 0);
-    if (!median_blur_ || input.num_samples() > op_batch_size_) {
-      op_batch_size_ = std::max(op_batch_size_ * 2, input.num_samples());
-      median_blur_.emplace(op_batch_size_);
+ private:
+  template <typename T>
+  void RunTyped(Workspace &ws) {
+    const auto &input = ws.Input<CPUBackend>(0);
+    auto &output = ws.Output<CPUBackend>(0);
+    output.SetLayout(input.GetLayout());
+    auto &tp = ws.GetThreadPool();
+    auto in_view = view<const T>(input);
+    auto out_view = view<T>(output);
+    kernels::MedianBlurCPU<T> kernel;
+    kernels::KernelContext ctx;
+    for (int i = 0; i < in_view.num_samples(); i++) {
+      const auto &sh = in_view.shape[i];
+      TensorShape<3> hwc{ sh[0], sh[1], sh.size() == 3 ? sh[2] : 1 };
+      auto in = make_tensor_cpu<3>(in_view.data[i], hwc);
+      auto out = make_tensor_cpu<3>(out_view.data[i], hwc);
+      ivec2 window(ksize_arg_[i].data[0], ksize_arg_[i].data[1]);
+      kernel.Schedule(tp, ctx, out, in, window);
     }
-    (*median_blur_)(ws.stream(), input_images, output_images, ksize);
+    tp.RunAll();
   }
 
- private:
-  USE_OPERATOR_MEMBERS();
   ArgValue<int, 1> ksize_arg_{"window_size", spec_};
-  int op_batch_size_ = 0;
-  std::optional<cvcuda::MedianBlur> median_blur_{};
 };
 
-DALI_REGISTER_OPERATOR(experimental__MedianBlur, MedianBlur, GPU);
+DALI_REGISTER_OPERATOR(experimental__MedianBlur, MedianBlurCpu, CPU);
 
 }  // namespace dali
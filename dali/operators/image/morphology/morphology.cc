@@ -12,43 +12,19 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
-#include "dali/operators/image/morphology/morphology.h"
+#include <string>
+#include <vector>
+#include "dali/core/static_switch.h"
+#include "dali/kernels/imgproc/morphology/morphology_cpu.h"
+#include "dali/pipeline/data/views.h"
+#include "dali/pipeline/operator/arg_helper.h"
+#include "dali/pipeline/operator/checkpointing/stateless_operator.h"
+#include "dali/pipeline/operator/operator.h"
+#include "dali/pipeline/operator/sequence_operator.h"
 
-namespace dali {
-
-bool Morphology::SetupImpl(std::vector<OutputDesc> &output_desc, const Workspace &ws) {
-  const auto &input = ws.Input<GPUBackend>(0);
-  auto sh = input.shape();
-  output_desc.resize(1);
-  output_desc[0] = {sh, input.type()};
-  return true;
-}
+#define MORPHOLOGY_CPU_SUPPORTED_TYPES (uint8_t, uint16_t, int16_t, float)
 
-void Morphology::RunImpl(Workspace &ws) {
-  const auto &input = ws.Input<GPUBackend>(0);
-  auto &output = ws.Output<GPUBackend>(0);
-  output.SetLayout(input.GetLayout());
-
-  kernels::DynamicScratchpad scratchpad(AccessOrder(ws.stream()));
-  auto mask = AcquireTensorArgument<int32_t>(ws, scratchpad, mask_arg_,
-                                             TensorShape<1>(2), nvcvop::GetDataType<int32_t>(2));
-  auto anchor = AcquireTensorArgument<int32_t>(ws, scratchpad, anchor_arg_,
-                                               TensorShape<1>(2), nvcvop::GetDataType<int32_t>(2));
-
-  if (!op_workspace_ || (op_workspace_.capacity() < input.num_samples())) {
-    int current_size = (op_workspace_) ? op_workspace_.capacity() : 0;
-    op_workspace_ =
-        nvcv::ImageBatchVarShape(std::max(current_size * 2, input.num_samples()));
-  }
-  op_workspace_.clear();
-  nvcvop::AllocateImagesLike(op_workspace_, input, scratchpad);
-
-  auto input_images = GetInputBatch(ws, 0);
-  auto output_images = GetOutputBatch(ws, 0);
-  cvcuda::Morphology op{};
-  op(ws.stream(), input_images, output_images, op_workspace_, morph_type_, mask, anchor, iteration_,
-     border_mode_);
-}
+namespace dali {
 
 DALI_SCHEMA(Morphology)
   .MakeAbstract()
@@ -70,7 +46,9 @@ DALI_SCHEMA(Morphology)
 
 DALI_SCHEMA(experimental__Dilate)
   .AddParent("Morphology")
-  .DocStr("Performs a dilation operation on the input image.")
+  .DocStr(R"doc(Performs a dilation operation on the input image.
+
+The CPU variant supports uint8, uint16, int16 and float32 inputs.)doc")
   .NumInput(1)
   .NumOutput(1)
   .InputDox(0, "input", "TensorList",
@@ -80,7 +58,9 @@ DALI_SCHEMA(experimental__Dilate)
 
 DALI_SCHEMA(experimental__Erode)
   .AddParent("Morphology")
-  .DocStr("Performs an erosion operation on the input image.")
+  .DocStr(R"doc(Performs an erosion operation on the input image.
+
+The CPU variant supports uint8, uint16, int16 and float32 inputs.)doc")
   .NumInput(1)
   .NumOutput(1)
   .InputDox(0, "input", "TensorList",
@@ -88,9 +68,103 @@ DALI_SCHEMA(experimental__Erode)
   .AllowSequences()
   .InputLayout({"HW", "HWC", "FHWC", "CHW", "FCHW"});
 
+namespace {
+
+boundary::BoundaryType GetMorphologyBorder(const std::string &border_mode) {
+  if (border_mode == "constant")
+    return boundary::BoundaryType::CONSTANT;
+  else if (border_mode == "replicate")
+    return boundary::BoundaryType::CLAMP;
+  else if (border_mode == "reflect")
+    return boundary::BoundaryType::REFLECT_1001;
+  else if (border_mode == "reflect_101")
+    return boundary::BoundaryType::REFLECT_101;
+  else if (border_mode == "wrap")
+    return boundary::BoundaryType::WRAP;
+  DALI_FAIL("Unknown border mode: " + border_mode);
+}
+
+}  // namespace
+
+/**
+ * @brief Erosion or dilation on the CPU
+ *
+ * The channel-first and sequence inputs are expanded, so the kernel only sees HW or HWC images.
+ * Repeated iterations are folded into a single pass with a larger structuring element - the cost
+ * of the kernel doesn't depend on the mask size.
+ */
+template <kernels::MorphologyOp op>
+class MorphologyCpu : public SequenceOperator<CPUBackend, StatelessOperator> {
+ public:
+  explicit MorphologyCpu(const OpSpec &spec)
+      : SequenceOperator<CPUBackend, StatelessOperator>(spec),
+        border_(GetMorphologyBorder(spec.GetArgument<std::string>("border_mode"))),
+        iterations_(spec.GetArgument<int>("iterations")) {
+    DALI_ENFORCE(iterations_ >= 1, "iterations must be >= 1");
+  }
+
+  bool ShouldExpandChannels(int input_idx) const override {
+    return true;
+  }
+
+ protected:
+  bool SetupImpl(std::vector<OutputDesc> &output_desc, const Workspace &ws) override {
+    const auto &input = ws.Input<CPUBackend>(0);
+    int nsamples = input.num_samples();
+    mask_arg_.Acquire(spec_, ws, nsamples, TensorShape<1>(2));
+    anchor_arg_.Acquire(spec_, ws, nsamples, TensorShape<1>(2));
+    output_desc.resize(1);
+    output_desc[0] = {input.shape(), input.type()};
+    return true;
+  }
+
+  void RunImpl(Workspace &ws) override {
+    const auto &input = ws.Input<CPUBackend>(0);
+    TYPE_SWITCH(input.type(), type2id, T, MORPHOLOGY_CPU_SUPPORTED_TYPES, (
+      RunTyped<T>(ws);
+    ), DALI_FAIL(make_string("Unsupported input type: ", input.type())));  // NOLINT
+  }
+
+ private:
+  template <typename T>
+  void RunTyped(Workspace &ws) {
+    const auto &input = ws.Input<CPUBackend>(0);
+    auto &output = ws.Output<CPUBackend>(0);
+    output.SetLayout(input.GetLayout());
+    auto &tp = ws.GetThreadPool();
+    auto in_view = view<const T>(input);
+    auto out_view = view<T>(output);
+    kernels::MorphologyCPU<T> kernel;
+    kernels::KernelContext ctx;
+    for (int i = 0; i < in_view.num_samples(); i++) {
+      const auto &sh = in_view.shape[i];
+      TensorShape<3> hwc{ sh[0], sh[1], sh.size() == 3 ? sh[2] : 1 };
+      auto in = make_tensor_cpu<3>(in_view.data[i], hwc);
+      auto out = make_tensor_cpu<3>(out_view.data[i], hwc);
+      ivec2 mask(mask_arg_[i].data[0], mask_arg_[i].data[1]);
+      ivec2 anchor(anchor_arg_[i].data[0], anchor_arg_[i].data[1]);
+      for (int d = 0; d < 2; d++) {
+        if (anchor[d] < 0)
+          anchor[d] = mask[d] / 2;
+      }
+      mask = mask + (iterations_ - 1) * (mask - 1);
+      anchor = anchor * iterations_;
+      kernel.Schedule(tp, ctx, out, in, op, mask, anchor, border_);
+    }
+    tp.RunAll();
+  }
+
+  ArgValue<int32_t, 1> mask_arg_{"mask_size", spec_};
+  ArgValue<int32_t, 1> anchor_arg_{"anchor", spec_};
+  boundary::BoundaryType border_;
+  int iterations_ = 1;
+};
+
+using DilateCpu = MorphologyCpu<kernels::MorphologyOp::Dilate>;
+using ErodeCpu = MorphologyCpu<kernels::MorphologyOp::Erode>;
 
-DALI_REGISTER_OPERATOR(experimental__Dilate, Dilate, GPU);
+DALI_REGISTER_OPERATOR(experimental__Dilate, DilateCpu, CPU);
 
-DALI_REGISTER_OPERATOR(experimental__Erode, Erode, GPU);
+DALI_REGISTER_OPERATOR(experimental__Erode, ErodeCpu, CPU);
 
 }  // namespace dali
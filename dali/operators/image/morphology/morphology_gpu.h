@@ -12,8 +12,8 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
-#ifndef DALI_OPERATORS_IMAGE_MORPHOLOGY_MORPHOLOGY_H_
-#define DALI_OPERATORS_IMAGE_MORPHOLOGY_MORPHOLOGY_H_
+#ifndef DALI_OPERATORS_IMAGE_MORPHOLOGY_MORPHOLOGY_GPU_H_
+#define DALI_OPERATORS_IMAGE_MORPHOLOGY_MORPHOLOGY_GPU_H_
 
 #include <vector>
 #include <string>
@@ -70,4 +70,4 @@ class Erode : public Morphology {
 
 }  // namespace dali
 
-#endif  // DALI_OPERATORS_IMAGE_MORPHOLOGY_MORPHOLOGY_H_
+#endif  // DALI_OPERATORS_IMAGE_MORPHOLOGY_MORPHOLOGY_GPU_H_
@@ -13,7 +13,7 @@
 // limitations under the License.
 
 #include "dali/operators/image/paste/multipaste.h"
-#include "dali/kernels/imgproc/paste/paste.h"
+#include "dali/kernels/imgproc/paste/paste_cpu.h"
 #include "dali/core/tensor_view.h"
 
 namespace dali {
@@ -100,36 +100,17 @@ the same shape is used as the canvas size.)code",
 template <typename OutputType, typename InputType>
 void MultiPasteCPU::SetupTyped(const Workspace & /*ws*/,
                                const TensorListShape<> & /*out_shape*/) {
-  using Kernel = kernels::PasteCPU<OutputType, InputType>;
+  using Kernel = kernels::MultiPasteCPU<OutputType, InputType>;
   kernel_manager_.Initialize<Kernel>();
 }
 
-template <typename OutputType, typename InputType>
-void MultiPasteCPU::CopyPatch(TensorListView<StorageCPU, OutputType, 3> &out_view,
-                              std::vector<TensorListView<StorageCPU, const InputType, 3>> &in_views,
-                              int out_sample_idx, int paste_idx) {
-  using Kernel = kernels::PasteCPU<OutputType, InputType>;
-  kernels::KernelContext ctx;
-
-  bool hasInIdx = in_idx_.HasExplicitValue();
-  int input_idx = hasInIdx ? 0 : paste_idx;
-  int in_sample_idx = hasInIdx ? in_idx_[out_sample_idx].data[paste_idx] : out_sample_idx;
-  auto tvin = in_views[input_idx][in_sample_idx];
-  auto tvout = out_view[out_sample_idx];
-
-  Coords region_shape_view{&region_shapes_data_[out_sample_idx][paste_idx][0], coords_sh_};
-  Coords in_anchor_view{&in_anchors_data_[out_sample_idx][paste_idx][0], coords_sh_};
-  Coords out_anchor_view{&out_anchors_data_[out_sample_idx][paste_idx][0], coords_sh_};
-  kernel_manager_.Run<Kernel>(out_sample_idx, ctx, tvout, tvin, in_anchor_view, region_shape_view,
-                              out_anchor_view);
-}
-
 template <typename OutputType, typename InputType>
 void MultiPasteCPU::RunTyped(Workspace &ws) {
+  using Kernel = kernels::MultiPasteCPU<OutputType, InputType>;
+  using Patch = typename Kernel::Patch;
   auto &output = ws.Output<CPUBackend>(0);
 
   output.SetLayout(ws.Input<CPUBackend>(0).GetLayout());
-  auto out_shape = output.shape();
 
   auto& tp = ws.GetThreadPool();
 
@@ -143,29 +124,31 @@ void MultiPasteCPU::RunTyped(Workspace &ws) {
   }
   auto out_view = view<OutputType, 3>(output);
 
+  bool has_in_idx = in_idx_.HasExplicitValue();
+  std::vector<TensorView<StorageCPU, const InputType, 3>> patch_inputs;
+  std::vector<Patch> patches;
+  BalancedWork work(tp, cost_model_);
   for (int i = 0; i < batch_size; i++) {
-    auto paste_count = GetPasteCount(ws, i);
-    memset(out_view[i].data, 0, out_view[i].num_elements() * sizeof(OutputType));
-
-    if (!HasIntersections(ws, i)) {
-      for (int iter = 0; iter < paste_count; iter++) {
-        tp.AddWork(
-          [&, i, iter](int thread_id) {
-            CopyPatch(out_view, in_views, i, iter);
-          },
-          out_shape.tensor_size(i));
-      }
-    } else {
-      tp.AddWork(
-        [&, i, paste_count](int thread_id) {
-          for (int iter = 0; iter < paste_count; iter++) {
-            CopyPatch(out_view, in_views, i, iter);
-          }
-        },
-        paste_count * out_shape.tensor_size(i));
+    int paste_count = GetPasteCount(ws, i);
+    patch_inputs.resize(paste_count);
+    patches.resize(paste_count);
+    for (int iter = 0; iter < paste_count; iter++) {
+      int input_idx = has_in_idx ? 0 : iter;
+      int in_sample_idx = has_in_idx ? in_idx_[i].data[iter] : i;
+      patch_inputs[iter] = in_views[input_idx][in_sample_idx];
+      auto &patch = patches[iter];
+      patch.size = region_shapes_data_[i][iter];
+      patch.in_anchor = in_anchors_data_[i][iter];
+      patch.out_anchor = out_anchors_data_[i][iter];
+      patch.batch_idx = input_idx;
+      patch.in_idx = in_sample_idx;
     }
+    // all the pastes and the background are written in one pass over the output, in row bands
+    kernel_manager_.Get<Kernel>(i).Schedule(work, out_view[i], make_cspan(patch_inputs),
+                                            make_cspan(patches));
   }
-  tp.RunAll();
+  work.RunAll();
+  work.ReportImbalance(ws);
 }
 
 DALI_REGISTER_OPERATOR(MultiPaste, MultiPasteCPU, CPU)
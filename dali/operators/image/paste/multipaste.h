@@ -29,6 +29,7 @@
 #include "dali/pipeline/data/types.h"
 #include "dali/pipeline/data/views.h"
 #include "dali/pipeline/operator/arg_helper.h"
+#include "dali/pipeline/operator/balanced_work.h"
 #include "dali/pipeline/operator/checkpointing/stateless_operator.h"
 #include "dali/pipeline/operator/common.h"
 #include "dali/pipeline/operator/operator.h"
@@ -111,17 +112,6 @@ class MultiPasteOp : public SequenceOperator<Backend, StatelessOperator> {
     }
   }
 
-  bool Intersects(ivec2 anchors1, ivec2 shapes1,
-                  ivec2 anchors2, ivec2 shapes2) const {
-    for (int i = 0; i < 2; i++) {
-      if (anchors1[i] + shapes1[i] <= anchors2[i]
-          || anchors2[i] + shapes2[i] <= anchors1[i]) {
-        return false;
-      }
-    }
-    return true;
-  }
-
   void ValidateFactor(float factor, const std::string &arg_name, int out_sample_idx,
                       int paste_idx) {
     DALI_ENFORCE(0.f <= factor && factor <= 1.f,
@@ -533,22 +523,6 @@ class MultiPasteCPU : public MultiPasteOp<CPUBackend, MultiPasteCPU> {
  public:
   explicit MultiPasteCPU(const OpSpec &spec) : MultiPasteOp(spec) {}
 
-  bool HasIntersections(const Workspace &ws, int sample_idx) {
-    int paste_count = GetPasteCount(ws, sample_idx);
-    for (int i = 0; i < paste_count; i++) {
-      auto out_anchor_i = out_anchors_data_[sample_idx][i];
-      auto shape_i = region_shapes_data_[sample_idx][i];
-      for (int j = 0; j < i; j++) {
-        auto out_anchor_j = out_anchors_data_[sample_idx][j];
-        auto shape_j = region_shapes_data_[sample_idx][j];
-        if (Intersects(out_anchor_i, shape_i, out_anchor_j, shape_j)) {
-          return true;
-        }
-      }
-    }
-    return false;
-  }
-
  private:
   template<typename OutputType, typename InputType>
   void RunTyped(Workspace &ws);
@@ -557,10 +531,7 @@ class MultiPasteCPU : public MultiPasteOp<CPUBackend, MultiPasteCPU> {
   void SetupTyped(const Workspace &ws,
                   const TensorListShape<> &out_shape);
 
-  template <typename OutputType, typename InputType>
-  void CopyPatch(TensorListView<StorageCPU, OutputType, 3> &out_view,
-                 std::vector<TensorListView<StorageCPU, const InputType, 3>> &in_views,
-                 int sample_idx, int paste_idx);
+  SampleCostModel cost_model_;
 
   friend class MultiPasteOp<CPUBackend, MultiPasteCPU>;
 };
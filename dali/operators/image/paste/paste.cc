@@ -12,7 +12,9 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <vector>
 #include "dali/operators/image/paste/paste.h"
+#include "dali/kernels/imgproc/paste/paste_cpu.h"
 
 namespace dali {
 
@@ -50,50 +52,32 @@ struct PasteParameters {
   int paste_x;
 };
 
-void PasteKernel(ConstSampleView<CPUBackend> input, SampleView<CPUBackend> output,
-                 const Tensor<CPUBackend> &fill_value, const PasteParameters &params) {
-  const auto img_C = input.shape()[2];
-  const auto fill_C = fill_value.size();
-
-  // Fill output row with the fill value
-  auto fill_range = [&](std::size_t offset, std::size_t nelem) {
-    if (fill_C == 1) {
-      std::memset(output.mutable_data<uint8_t>() + offset, fill_value.data<uint8_t>()[0],
-                  nelem * img_C);
-    }
-    for (std::size_t w = 0; w < nelem; ++w) {
-      std::copy(fill_value.data<uint8_t>(), fill_value.data<uint8_t>() + fill_C,
-                output.mutable_data<uint8_t>() + offset + w * fill_C);
-    }
-  };
-
-  for (int h = 0; h < params.out_H; ++h) {
-    const auto out_row_offset = h * params.out_W * img_C;
-    if (h < params.paste_y || h >= params.paste_y + params.in_H) {
-      fill_range(out_row_offset, params.out_W);
-    } else {
-      fill_range(out_row_offset, params.paste_x);
-      std::memcpy(output.mutable_data<uint8_t>() + out_row_offset + params.paste_x * img_C,
-                  input.data<uint8_t>() + (h - params.paste_y) * params.in_W * img_C,
-                  params.in_W * img_C);
-      fill_range(out_row_offset + (params.paste_x + params.in_W) * img_C,
-                 params.out_W - params.paste_x - params.in_W);
-    }
-  }
-}
-
 template <>
 void Paste<CPUBackend>::RunHelper(Workspace &ws) {
+  using Kernel = kernels::MultiPasteCPU<uint8_t, uint8_t>;
   auto &tp = ws.GetThreadPool();
   const auto &input = ws.Input<CPUBackend>(0);
   auto &output = ws.Output<CPUBackend>(0);
+  int nsamples = input.num_samples();
 
-  for (int sampleIdx = 0; sampleIdx < input.num_samples(); sampleIdx++) {
-    tp.AddWork([&, sampleIdx](int) {
-      const auto *pasteParams =
-          static_cast<const PasteParameters *>(in_out_dims_paste_yx_.raw_data()) + sampleIdx;
-      PasteKernel(input[sampleIdx], output[sampleIdx], fill_value_, *pasteParams);
-    });
+  // The whole canvas is written in a single pass - the fill and the pasted image are split into
+  // horizontal bands, which are distributed among the threads along with the other samples.
+  span<const uint8_t> fill(fill_value_.data<uint8_t>(), fill_value_.size());
+  std::vector<Kernel> kernels(nsamples);
+  std::vector<InTensorCPU<uint8_t, 3>> inputs(nsamples);
+  std::vector<Kernel::Patch> patches(nsamples);
+  for (int i = 0; i < nsamples; i++) {
+    const auto &params =
+        static_cast<const PasteParameters *>(in_out_dims_paste_yx_.raw_data())[i];
+    int C = input.tensor_shape_span(i)[2];
+    inputs[i] = make_tensor_cpu<3>(input.tensor<uint8_t>(i), { params.in_H, params.in_W, C });
+    auto &patch = patches[i];
+    patch.in_anchor = { 0, 0 };
+    patch.out_anchor = { params.paste_y, params.paste_x };
+    patch.size = { params.in_H, params.in_W };
+    auto out = make_tensor_cpu<3>(output.mutable_tensor<uint8_t>(i),
+                                  { params.out_H, params.out_W, C });
+    kernels[i].Schedule(tp, out, make_cspan(&inputs[i], 1), make_cspan(&patches[i], 1), fill);
   }
   tp.RunAll();
 }
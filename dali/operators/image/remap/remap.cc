@@ -31,6 +31,10 @@ Handles only HWC layout.
 
 Currently picking border policy is not supported.
 The ``DALIBorderType`` will always be ``CONSTANT`` with the value ``0``.
+
+The CPU variant supports only nearest neighbor and linear interpolation. It converts the maps
+to a fixed-point representation (with 1/32 pixel precision) and caches the result, so maps which
+don't change between iterations are converted only once.
 )doc")
         .NumInput(3)
         .NumOutput(1)
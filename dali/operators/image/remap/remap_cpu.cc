@@ -0,0 +1,87 @@
+// Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <memory>
+#include <vector>
+#include "dali/kernels/imgproc/geom/remap_cpu.h"
+#include "dali/operators/image/remap/remap.h"
+
+namespace dali {
+namespace remap {
+
+/**
+ * @brief Remap on the CPU
+ *
+ * The floating point maps are converted to fixed-point coordinates and interpolation weights.
+ * The converted maps are cached, so a map which doesn't change between iterations (or is shared
+ * by several samples) is converted only once.
+ */
+class RemapCpu : public Remap<CPUBackend> {
+  using B = CPUBackend;
+
+ public:
+  explicit RemapCpu(const OpSpec &spec) : Remap<B>(spec) {}
+
+  void RunImpl(Workspace &ws) override {
+    const auto &input = ws.template Input<B>(0);
+    TYPE_SWITCH(input.type(), type2id, InputType, REMAP_SUPPORTED_TYPES, (
+    {
+      RunImplTyped<InputType>(ws);
+    }
+    ), DALI_FAIL(make_string("Unsupported input type: ", input.type())))  // NOLINT
+  }
+
+ private:
+  template<typename InputType>
+  void RunImplTyped(Workspace &ws) {
+    const auto &input = ws.template Input<B>(0);
+    const auto &mapx = ws.template Input<B>(1);
+    const auto &mapy = ws.template Input<B>(2);
+    auto &output = ws.template Output<B>(0);
+    output.SetLayout(input.GetLayout());
+    auto in_view = view<const InputType, 3>(input);
+    auto out_view = view<InputType, 3>(output);
+    auto mapx_view = view<const float>(mapx);
+    auto mapy_view = view<const float>(mapy);
+    auto &tp = ws.GetThreadPool();
+    kernels::RemapCPU<InputType> kernel;
+    kernels::KernelContext ctx;
+    int nsamples = in_view.num_samples();
+    maps_.resize(nsamples);
+    map_cache_.BeginBatch();
+    for (int i = 0; i < nsamples; i++) {
+      const auto &sh = in_view.shape[i];
+      TensorShape<2> map_shape{ sh[0], sh[1] };
+      DALI_ENFORCE(mapx_view.shape[i] == mapy_view.shape[i] &&
+                   volume(mapx_view.shape[i]) == volume(map_shape), make_string(
+                   "The maps must have the same spatial shape as the input. Got mapx: ",
+                   mapx_view.shape[i], ", mapy: ", mapy_view.shape[i], ", input: ", sh,
+                   " for sample ", i));
+      maps_[i] = map_cache_.Get(mapx_view.data[i], mapy_view.data[i], map_shape,
+                                { sh[1], sh[0] }, interps_[i],
+                                shift_pixels_ ? shift_value_ : 0.0f);
+      kernel.Schedule(tp, ctx, out_view[i], in_view[i], *maps_[i]);
+    }
+    tp.RunAll();
+    map_cache_.EndBatch();
+  }
+
+  kernels::remap::FixedPointMapCache map_cache_;
+  std::vector<std::shared_ptr<const kernels::remap::FixedPointMap>> maps_;
+};
+
+DALI_REGISTER_OPERATOR(experimental__Remap, RemapCpu, CPU);
+
+}  // namespace remap
+}  // namespace dali
@@ -15,6 +15,7 @@
 #ifndef DALI_OPERATORS_IMAGE_REMAP_WARP_H_
 #define DALI_OPERATORS_IMAGE_REMAP_WARP_H_
 
+#include <algorithm>
 #include <cassert>
 #include <memory>
 #include <string>
@@ -165,20 +166,23 @@ class WarpOpImpl : public OpImplInterface<Backend> {
 
     ThreadPool &pool = ws.GetThreadPool();
     auto interp_types = param_provider_->InterpTypes();
+    auto context = GetContext(ws);
 
-    for (int i = 0; i < input_.num_samples(); i++) {
-      pool.AddWork([&, i](int tid) {
-        DALIInterpType interp_type = interp_types.size() > 1 ? interp_types[i] : interp_types[0];
-        auto context = GetContext(ws);
-        kmgr_.Run<Kernel>(
-            i, context,
-            output[i],
-            input_[i],
-            *param_provider_->ParamsCPU()(i),
-            param_provider_->OutputSizes()[i],
-            interp_type,
-            param_provider_->Border());
-      }, output.shape.tensor_size(i));
+    // Large images are split into bands of rows, so that batches with few samples
+    // can still use all threads.
+    int nsamples = input_.num_samples();
+    int req_nblocks = std::max(1, 10 * pool.NumThreads() / std::max(nsamples, 1));
+    for (int i = 0; i < nsamples; i++) {
+      DALIInterpType interp_type = interp_types.size() > 1 ? interp_types[i] : interp_types[0];
+      kmgr_.Get<Kernel>(i).Schedule(
+          pool, context,
+          output[i],
+          input_[i],
+          *param_provider_->ParamsCPU()(i),
+          param_provider_->OutputSizes()[i],
+          interp_type,
+          param_provider_->Border(),
+          req_nblocks);
     }
     pool.RunAll();
   }
@@ -95,7 +95,7 @@ void ResizeBase<CPUBackend>::SetupResizeStatic(
       span<const kernels::ResamplingParams> params,
       int first_spatial_dim) {
   using ImplType = ResizeOpImplCPU<OutputType, InputType, spatial_ndim>;
-  SetImpl<ImplType>([&]{ return std::make_unique<ImplType>(kmgr_); });
+  SetImpl<ImplType>([&]{ return std::make_unique<ImplType>(kmgr_, num_threads_); });
   impl_->Setup(out_shape, in_shape, first_spatial_dim, params);
 }
 
@@ -79,10 +79,10 @@ void ResizeCropMirrorAttr::PrepareResizeParams(
   // First, proceed as with normal resize
   ResizeAttr::PrepareResizeParams(spec, ws, input_shape);
   mirror_.Acquire(spec, ws, batch_size_);
+  CropAttr::ProcessArguments(spec, ws, batch_size_);
 
   // Then get the crop windows and back-project them
   for (int i = 0; i < batch_size_; i++) {
-    CropAttr::ProcessArguments(spec, &ws, i);
     auto &params = params_[i];
     TensorShape<> resized_input_shape = input_shape[i];
     for (int d = 0; d < spatial_ndim_; d++)
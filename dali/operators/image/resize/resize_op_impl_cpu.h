@@ -23,14 +23,17 @@
 #include <cmath>
 #include <vector>
 #include "dali/operators/image/resize/resize_op_impl.h"
+#include "dali/kernels/common/tiling.h"
 #include "dali/kernels/imgproc/resample_cpu.h"
+#include "dali/pipeline/operator/balanced_work.h"
 
 namespace dali {
 
 template <typename Out, typename In, int spatial_ndim>
 class ResizeOpImplCPU : public ResizeBase<CPUBackend>::Impl {
  public:
-  explicit ResizeOpImplCPU(kernels::KernelManager &kmgr) : kmgr_(kmgr) {}
+  explicit ResizeOpImplCPU(kernels::KernelManager &kmgr, int num_threads = 1)
+  : kmgr_(kmgr), num_threads_(num_threads) {}
 
   static_assert(spatial_ndim == 2 || spatial_ndim == 3, "Only 2D and 3D resizing is supported");
 
@@ -54,6 +57,9 @@ class ResizeOpImplCPU : public ResizeBase<CPUBackend>::Impl {
     // effective frames (from videos, channel planes, etc).
     GetResizedShape(out_shape_, in_shape_, make_cspan(params_), 0);
 
+    // Large frames are divided into slabs, which are resized independently.
+    SplitFrames();
+
     // Now that we know how many logical frames there are, calculate batch subdivision.
     OnNumFramesUpdated();
 
@@ -64,11 +70,13 @@ class ResizeOpImplCPU : public ResizeBase<CPUBackend>::Impl {
     const int dim = in_shape_.sample_dim();
     kernels::KernelContext ctx;
 
-    for (int i = 0; i < GetNumFrames(); i++) {
+    for (int i = 0; i < GetNumSlabs(); i++) {
       kernels::InTensorCPU<In, frame_ndim> dummy_input;
-      dummy_input.shape = in_shape_[i];
-      kernels::KernelRequirements &req = kmgr_.Setup<Kernel>(i, ctx, dummy_input, params_[i]);
-      assert(req.output_shapes[0][0] == out_shape_[i]);
+      dummy_input.shape = in_shape_[slabs_[i].frame];
+      const Slab &slab = slabs_[i];
+      kernels::KernelRequirements &req = kmgr_.Setup<Kernel>(
+          i, ctx, dummy_input, params_[slab.frame], slab.out_rows.begin, slab.out_rows.end);
+      assert(req.output_shapes[0][0] == slab_out_shape_[i]);
     }
   }
 
@@ -80,35 +88,122 @@ class ResizeOpImplCPU : public ResizeBase<CPUBackend>::Impl {
     auto out_frames_view = reshape(out_view, out_shape_, true);
 
     ThreadPool &tp = ws.GetThreadPool();
+    BalancedWork balanced_work(tp, cost_model_);
 
-    for (int i = 0; i < GetNumFrames(); i++) {
+    for (int i = 0; i < GetNumSlabs(); i++) {
       auto work = [&, i](int tid) {
         kernels::KernelContext ctx;
-        auto out_frame = out_frames_view[i];
-        auto in_frame = in_frames_view[i];
-        kmgr_.Run<Kernel>(i, ctx, out_frame, in_frame, params_[i]);
+        const Slab &slab = slabs_[i];
+        auto out_slab = make_tensor_cpu<frame_ndim>(
+            out_frames_view.data[slab.frame] + slab.out_offset, slab_out_shape_[i]);
+        auto in_frame = in_frames_view[slab.frame];
+        kmgr_.Run<Kernel>(i, ctx, out_slab, in_frame, params_[slab.frame]);
       };
+      balanced_work.AddWork(work, std::llround(slabs_[i].cost));
+    }
+    balanced_work.RunAll();
+    balanced_work.ReportImbalance(ws);
+  }
+
+  /**
+   * @brief Estimates the cost of resizing a frame
+   */
+  double FrameCost(int frame) const {
+    double out_size = volume(out_shape_.tensor_shape_span(frame));
+    double in_size = volume(in_shape_.tensor_shape_span(frame));
+    double cost = 0;
+    double root = 1.0 / spatial_ndim;
+    for (int i = 0; i < spatial_ndim; i++) {
+      // Approximation for isotropic scaling - each resize stage takes time
+      // proportional to the output size of the stage, and the scaling volume ratio
+      // is divided equally (geometrically) among stages. Hence, the weighted
+      // geometric mean of rank spatial_ndim_.
+      //
+      // NOTE: This does not account for cost of antialiasing!
+      cost += std::pow(std::pow(out_size, spatial_ndim - i) * pow(in_size, i), root);
+    }
+    return cost;
+  }
 
-      double out_size = volume(out_frames_view.shape.tensor_shape_span(i));
-      double in_size = volume(in_frames_view.shape.tensor_shape_span(i));
-      double cost = 0;
-      double root = 1.0 / spatial_ndim;
-      for (int i = 0; i < spatial_ndim; i++) {
-        // Approximation for isotropic scaling - each resize stage takes time
-        // proportional to the output size of the stage, and the scaling volume ratio
-        // is divided equally (geometrically) among stages. Hence, the weighted
-        // geometric mean of rank spatial_ndim_.
-        //
-        // NOTE: This does not account for cost of antialiasing!
-        cost += std::pow(std::pow(out_size, spatial_ndim - i) * pow(in_size, i), root);
+  /**
+   * @brief Divides the frames into slabs along the outermost spatial dimension
+   *
+   * A frame gets the number of slabs proportional to its share in the total cost - with many
+   * frames in a batch, no frame is split. Each slab is a range of rows of the output frame; the
+   * kernel calculates the source coordinates of the slab in the coordinate system of the whole
+   * frame, so the slabs stitch exactly into the unsplit result.
+   */
+  void SplitFrames() {
+    int nframes = in_shape_.num_samples();
+    std::vector<double> frame_cost(nframes);
+    double total_cost = 0;
+    for (int i = 0; i < nframes; i++)
+      total_cost += frame_cost[i] = FrameCost(i);
+
+    slabs_.clear();
+    std::vector<TensorShape<frame_ndim>> slab_shapes;
+    int max_slabs = num_threads_ > 1 ? num_threads_ * kernels::kBandsPerThread : 1;
+    for (int i = 0; i < nframes; i++) {
+      auto out_frame_shape = out_shape_[i];
+      int64_t out_extent = out_frame_shape[0];
+      int nslabs = 1;
+      int req_slabs = total_cost > 0 ? std::ceil(max_slabs * frame_cost[i] / total_cost) : 1;
+      if (req_slabs > 1 && out_extent > 1) {
+        // The filter footprint, in output rows, is calculated redundantly by adjacent slabs.
+        int halo = std::ceil(OuterFilterRadius(i) * out_extent / std::max(OuterInExtent(i), 1.0));
+        int64_t row_cost = frame_cost[i] / out_extent;
+        nslabs = kernels::PlanBands(out_extent, row_cost, num_threads_, halo, req_slabs);
+      }
+      int64_t row_volume = volume(out_frame_shape) / std::max<int64_t>(out_extent, 1);
+      for (int b = 0; b < nslabs; b++) {
+        auto band = kernels::GetBand(out_extent, nslabs, b);
+        Slab slab;
+        slab.frame = i;
+        slab.out_rows = band;
+        slab.out_offset = band.begin * row_volume;
+        slab.cost = frame_cost[i] * band.size() / std::max<int64_t>(out_extent, 1);
+        slabs_.push_back(slab);
+        auto slab_shape = out_frame_shape;
+        slab_shape[0] = band.size();
+        slab_shapes.push_back(slab_shape);
       }
-      tp.AddWork(work, std::llround(cost));
     }
-    tp.RunAll();
+    slab_out_shape_ = slab_shapes;
+  }
+
+  /**
+   * @brief The extent of the input region, in the outermost dimension of a frame
+   */
+  double OuterInExtent(int frame) const {
+    const auto &p = params_[frame][0];
+    return p.roi.use_roi ? std::abs(static_cast<double>(p.roi.end) - p.roi.start)
+                         : in_shape_[frame][0];
+  }
+
+  /**
+   * @brief The radius, in input rows, of the filter used in the outermost dimension of a frame
+   *
+   * This follows the filter selection in the resampling setup; it's only used for estimating
+   * the redundant work at the slab boundaries.
+   */
+  double OuterFilterRadius(int frame) const {
+    const auto &p = params_[frame][0];
+    double in_size = OuterInExtent(frame);
+    double out_size = out_shape_[frame][0];
+    auto filter = out_size < in_size ? p.min_filter : p.mag_filter;
+    if (filter.radius == 0) {
+      auto type = filter.type;
+      if (filter.antialias && type == kernels::ResamplingFilterType::Linear)
+        type = kernels::ResamplingFilterType::Triangular;
+      else if (!filter.antialias && type == kernels::ResamplingFilterType::Triangular)
+        type = kernels::ResamplingFilterType::Linear;
+      return kernels::DefaultFilterRadius(type, filter.antialias, in_size, out_size);
+    }
+    return filter.radius;
   }
 
   void OnNumFramesUpdated() {
-    int N = GetNumFrames();
+    int N = GetNumSlabs();
     if (static_cast<int>(kmgr_.NumInstances()) < N)
       kmgr_.Resize<Kernel>(N);
   }
@@ -117,10 +212,28 @@ class ResizeOpImplCPU : public ResizeBase<CPUBackend>::Impl {
     return in_shape_.num_samples();
   }
 
+  int GetNumSlabs() const {
+    return slabs_.size();
+  }
+
   kernels::KernelManager &kmgr_;
+  int num_threads_ = 1;
 
   TensorListShape<frame_ndim> in_shape_, out_shape_;
   std::vector<ResamplingParamsND<spatial_ndim>> params_;
+
+  /// A part of a frame, resized by a separate kernel instance
+  struct Slab {
+    int frame;
+    /// the rows of the output frame (outermost dimension) calculated in this slab
+    kernels::Band out_rows;
+    /// offset of the slab in the output frame, in elements
+    int64_t out_offset;
+    double cost;
+  };
+  std::vector<Slab> slabs_;
+  TensorListShape<frame_ndim> slab_out_shape_;
+  SampleCostModel cost_model_;
 };
 
 }  // namespace dali
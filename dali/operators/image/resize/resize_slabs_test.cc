@@ -0,0 +1,109 @@
+// Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <vector>
+#include "dali/pipeline/pipeline.h"
+#include "dali/test/tensor_test_utils.h"
+
+namespace dali {
+namespace test {
+
+namespace {
+
+/**
+ * Runs `spec` on `input` in a CPU-only pipeline with the given number of threads.
+ * With one thread, the frames are resized whole; with more, large frames are split into slabs.
+ */
+void RunResize(TensorList<CPUBackend> &out, const TensorList<CPUBackend> &input,
+               const OpSpec &spec, int num_threads) {
+  Pipeline pipe(input.num_samples(), num_threads, CPU_ONLY_DEVICE_ID, 1234);
+  pipe.AddExternalInput("data");
+  pipe.AddOperator(OpSpec(spec)
+                   .AddArg("device", "cpu")
+                   .AddInput("data", StorageDevice::CPU)
+                   .AddOutput("resized", StorageDevice::CPU), "resize");
+  pipe.Build({{"resized", "cpu"}});
+  pipe.SetExternalInput("data", input);
+  pipe.Run();
+  Workspace ws;
+  pipe.Outputs(&ws);
+  out.Copy(ws.Output<CPUBackend>(0));
+}
+
+void CheckSlabsBitExact(const TensorListShape<> &shape, const OpSpec &spec) {
+  TensorList<CPUBackend> input;
+  input.Resize(shape, DALI_UINT8);
+  input.SetLayout("HWC");
+  std::mt19937_64 rng(4321);
+  UniformRandomFill(view<uint8_t>(input), rng, 0, 255);
+
+  TensorList<CPUBackend> whole, slabs;
+  RunResize(whole, input, spec, 1);
+  RunResize(slabs, input, spec, 4);
+
+  ASSERT_EQ(whole.shape(), slabs.shape());
+  for (int i = 0; i < whole.num_samples(); i++) {
+    EXPECT_EQ(std::memcmp(whole.raw_tensor(i), slabs.raw_tensor(i),
+                          whole.shape()[i].num_elements()), 0)
+        << "Sample " << i << " differs when resized in slabs.";
+  }
+}
+
+}  // namespace
+
+class ResizeSlabsTest : public ::testing::TestWithParam<DALIInterpType> {};
+
+TEST_P(ResizeSlabsTest, Downscale) {
+  CheckSlabsBitExact(uniform_list_shape(1, { 1021, 763, 3 }),
+                     OpSpec("Resize")
+                     .AddArg("interp_type", GetParam())
+                     .AddArg("resize_x", 555.0f)
+                     .AddArg("resize_y", 777.0f));
+}
+
+TEST_P(ResizeSlabsTest, Upscale) {
+  CheckSlabsBitExact(uniform_list_shape(1, { 513, 301, 3 }),
+                     OpSpec("Resize")
+                     .AddArg("interp_type", GetParam())
+                     .AddArg("resize_x", 403.0f)
+                     .AddArg("resize_y", 1999.0f));
+}
+
+TEST_P(ResizeSlabsTest, FlippedROI) {
+  CheckSlabsBitExact(uniform_list_shape(1, { 1013, 601, 1 }),
+                     OpSpec("Resize")
+                     .AddArg("interp_type", GetParam())
+                     .AddArg("resize_x", 301.0f)
+                     .AddArg("resize_y", 733.0f)
+                     .AddArg("roi_start", std::vector<float>{ 1000.3f, 10.7f })
+                     .AddArg("roi_end", std::vector<float>{ 3.3f, 590.1f }));
+}
+
+TEST_P(ResizeSlabsTest, UnevenBatch) {
+  // the large sample is split into more slabs than the small ones
+  TensorListShape<> shape = {{ 1021, 763, 3 }, { 97, 65, 3 }, { 333, 1555, 3 }};
+  CheckSlabsBitExact(shape, OpSpec("Resize")
+                            .AddArg("interp_type", GetParam())
+                            .AddArg("resize_shorter", 401.0f));
+}
+
+INSTANTIATE_TEST_SUITE_P(Interp, ResizeSlabsTest, ::testing::Values(
+    DALI_INTERP_NN, DALI_INTERP_LINEAR, DALI_INTERP_CUBIC, DALI_INTERP_LANCZOS3));
+
+}  // namespace test
+}  // namespace dali
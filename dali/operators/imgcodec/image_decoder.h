@@ -18,6 +18,7 @@
 #include <utility>
 #include <vector>
 #include "dali/core/call_at_exit.h"
+#include "dali/core/exec/timeline.h"
 #include "dali/core/mm/memory.h"
 #include "dali/operators.h"
 #include "dali/operators/decoder/cache/cached_decoder_impl.h"
@@ -231,6 +232,7 @@ class ImageDecoder : public StatelessOperator<Backend> {
     max_batch_size_ = spec.GetArgument<int>("max_batch_size");
     num_threads_ = spec.GetArgument<int>("num_threads");
     GetDecoderSpecificArguments(spec);
+    this->RegisterDiagnostic("decoded_samples", &decoded_samples_);
 
     if (std::is_same<MixedBackend, Backend>::value) {
       thread_pool_ = std::make_unique<OldThreadPool>(num_threads_, device_id_,
@@ -696,6 +698,7 @@ class ImageDecoder : public StatelessOperator<Backend> {
   void RunImplImpl(Workspace &ws) {
     const auto &input = ws.Input<CPUBackend>(0);
     int nsamples = input.num_samples();
+    decoded_samples_ += nsamples;
     auto &output = ws.template Output<typename OutBackend<Backend>::type>(0);
     // it complains if we try to set the sample dim after it is already allocated
     // even if the sample dim didn't change
@@ -906,6 +909,9 @@ class ImageDecoder : public StatelessOperator<Backend> {
 
       {
         DomainTimeRange tr("nvimgcodecDecoderDecode", DomainTimeRange::kOrange);
+        static const int timeline_name =
+            TimelineTracer::instance().Intern("nvimgcodecDecoderDecode");
+        TimelineScope timeline_scope(timeline_name, TimelineCategory::Decoder);
         CHECK_NVIMGCODEC(nvimgcodecDecoderDecode(decoder_, batch_encoded_streams_.data(),
                                                  batch_images_.data(), nsamples_decode,
                                                  &decode_params, &future));
@@ -953,7 +959,7 @@ class ImageDecoder : public StatelessOperator<Backend> {
                     st.host_buf.reset();
                   }
                 },
-                -idx);
+                volume(st_ptr->out_shape));  // largest first
           }
         }
         tp_->RunAll(true);
@@ -1011,6 +1017,8 @@ class ImageDecoder : public StatelessOperator<Backend> {
   bool roi_orient_war_ = false;
   int max_batch_size_ = 1;
   int num_threads_ = -1;
+  // the number of samples decoded so far; exposed as a diagnostic, which marks the decoders
+  int64_t decoded_samples_ = 0;
   ThreadPool *tp_ = nullptr;
   std::vector<std::unique_ptr<SampleState>> state_;
   std::vector<nvimgcodecCodeStream_t> batch_encoded_streams_;
@@ -12,6 +12,8 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
+#include <vector>
 #include "dali/operators/math/normalize/normalize.h"
 #include "dali/core/math_util.h"
 #include "dali/core/tensor_layout.h"
@@ -134,11 +136,24 @@ class Normalize<CPUBackend> : public NormalizeBase<CPUBackend> {
   template <typename OutputType, typename InputType>
   void RunTyped(Workspace &ws);
 
+  using MeanVariance = kernels::OnlineMeanVariance<float>;
+
   void AllocTempStorage();
   void FoldMeans();
   void FoldStdDev();
+  void FoldMeanVariance();
+  void BatchSumSquare2InvStdDev();
+  void StoreMeanAndSumSquare(int sample_idx);
+
+  TensorView<StorageCPU, MeanVariance> MeanVarianceView(int sample_idx) {
+    return make_tensor_cpu(mean_var_.data() + mean_var_offsets_[sample_idx],
+                           mean_.shape()[sample_idx]);
+  }
 
   kernels::KernelManager kmgr_;
+  /// Per-sample mean and variance accumulators, used when both are calculated
+  std::vector<MeanVariance> mean_var_;
+  std::vector<int64_t> mean_var_offsets_;
 };
 
 DALI_REGISTER_OPERATOR(Normalize, Normalize<CPUBackend>, CPU);
@@ -202,6 +217,13 @@ void Normalize<CPUBackend>::AllocTempStorage() {
       }
     }
   }
+  if (ShouldCalcMean() && ShouldCalcStdDev()) {
+    mean_var_offsets_.resize(n + 1);
+    mean_var_offsets_[0] = 0;
+    for (int i = 0; i < n; i++)
+      mean_var_offsets_[i + 1] = mean_var_offsets_[i] + volume(tmp_shape[i]);
+    mean_var_.resize(mean_var_offsets_[n]);
+  }
 }
 
 
@@ -224,6 +246,31 @@ void Normalize<CPUBackend>::FoldMeans() {
 void Normalize<CPUBackend>::FoldStdDev() {
   assert(inv_stddev_.num_samples() > 0);
   SumSamples(view<float>(inv_stddev_));
+  BatchSumSquare2InvStdDev();
+}
+
+/**
+ * @brief Combines the per-sample mean and variance accumulators and stores the batch mean
+ *        and the inverse standard deviation in the first sample of mean_ and inv_stddev_.
+ */
+void Normalize<CPUBackend>::FoldMeanVariance() {
+  int nsamples = mean_.num_samples();
+  assert(nsamples > 0);
+  auto acc0 = MeanVarianceView(0);
+  for (int i = 1; i < nsamples; i++) {
+    auto acc = MeanVarianceView(i);
+    for (int64_t j = 0; j < acc0.num_elements(); j++)
+      acc0.data[j].add(acc.data[j]);
+  }
+  StoreMeanAndSumSquare(0);
+  BatchSumSquare2InvStdDev();
+}
+
+/**
+ * @brief Converts the sum of squared deviations (in the first sample of inv_stddev_),
+ *        calculated for the whole batch, to the inverse of the standard deviation.
+ */
+void Normalize<CPUBackend>::BatchSumSquare2InvStdDev() {
   // calculate the normalization factor in double, then cast to float
   auto v = ReducedVolume(data_shape_, make_span(axes_));
   if (v == 0) {
@@ -244,6 +291,16 @@ void Normalize<CPUBackend>::FoldStdDev() {
   ScaleRSqrtKeepZero(sample0.data, elems, epsilon_, rdiv, scale);
 }
 
+void Normalize<CPUBackend>::StoreMeanAndSumSquare(int sample_idx) {
+  auto acc = MeanVarianceView(sample_idx);
+  float *mean = mean_.mutable_tensor<float>(sample_idx);
+  float *sum_sq = inv_stddev_.mutable_tensor<float>(sample_idx);
+  for (int64_t j = 0; j < acc.num_elements(); j++) {
+    mean[j] = acc.data[j].mean;
+    sum_sq[j] = acc.data[j].m2;
+  }
+}
+
 template <typename OutputType, typename InputType>
 void Normalize<CPUBackend>::RunTyped(Workspace &ws) {
   ThreadPool &tp = ws.GetThreadPool();
@@ -317,35 +374,62 @@ void Normalize<CPUBackend>::RunTyped(Workspace &ws) {
   // When using batch normalization, we need to reduce the per-sample results
   // between calculating mean and standard deviation and between standard deviation
   // and rescaling the input.
-
-  if (batch_norm_) {
+  // When there are fewer samples than threads, the statistics are calculated before
+  // normalization, with each sample split across multiple threads.
+  bool split_samples = nsamples < nthreads;
+  int req_nblocks = std::max(1, 2 * nthreads / std::max(nsamples, 1));
+  // When both the mean and the standard deviation are calculated, it's done in a single pass.
+  bool calc_mean_variance = ShouldCalcMean() && ShouldCalcStdDev();
+
+  if (calc_mean_variance && (batch_norm_ || split_samples)) {
+    std::vector<kernels::MeanVarianceCPU<InputType>> mean_vars(nsamples);
+    for (int i = 0; i < nsamples; i++) {
+      mean_vars[i].Setup(MeanVarianceView(i), in_view[i], make_span(axes_));
+      mean_vars[i].Schedule(tp, true, true, req_nblocks);
+    }
+    tp.RunAll();
+    if (batch_norm_) {
+      FoldMeanVariance();
+    } else {
+      for (int i = 0; i < nsamples; i++) {
+        StoreMeanAndSumSquare(i);
+        SumSquare2InvStdDev(mutable_stddev[i], data_shape_[i],
+                            degrees_of_freedom_, epsilon_, scale_);
+      }
+    }
+  } else if (batch_norm_ || split_samples) {
     if (ShouldCalcMean()) {
+      std::vector<kernels::MeanCPU<float, InputType>> means(nsamples);
       for (int i = 0; i < nsamples; i++) {
-        tp.AddWork([&, i](int thread_idx) {
-          kernels::MeanCPU<float, InputType> mean;
-          mean.Setup(mutable_mean[i], in_view[i], make_span(axes_));
-          // Reset per-sample values, but don't postprocess
-          mean.Run(true, false);
-        }, in_shape.tensor_size(i));
+        means[i].Setup(mutable_mean[i], in_view[i], make_span(axes_));
+        // In batch mode, reset per-sample values, but don't postprocess
+        means[i].Schedule(tp, true, !batch_norm_, req_nblocks);
       }
       tp.RunAll();
       // Aggregate and postprocess now
-      FoldMeans();
+      if (batch_norm_)
+        FoldMeans();
     }
 
     if (ShouldCalcStdDev()) {
-      auto sample_mean = mean_view[0];
+      std::vector<kernels::VarianceCPU<float, InputType>> stddevs(nsamples);
       for (int i = 0; i < nsamples; i++) {
-        tp.AddWork([&, i](int thread_idx) {
-          kernels::VarianceCPU<float, InputType> stddev;
-          stddev.Setup(mutable_stddev[i], in_view[i], make_span(axes_), sample_mean);
-          // Reset per-sample values, but don't postprocess
-          stddev.Run(true, false);
-        }, in_shape.tensor_size(i));
+        auto sample_mean = mean_view.num_samples() == 1 || batch_norm_
+                                ? mean_view[0]
+                                : mean_view[i];
+        stddevs[i].Setup(mutable_stddev[i], in_view[i], make_span(axes_), sample_mean);
+        // Reset per-sample values, but don't postprocess
+        stddevs[i].Schedule(tp, true, false, req_nblocks);
       }
       tp.RunAll();
-      // Aggregate and postprocess now - use inverse square root.
-      FoldStdDev();
+      if (batch_norm_) {
+        // Aggregate and postprocess now - use inverse square root.
+        FoldStdDev();
+      } else {
+        for (int i = 0; i < nsamples; i++)
+          SumSquare2InvStdDev(mutable_stddev[i], data_shape_[i],
+                              degrees_of_freedom_, epsilon_, scale_);
+      }
     }
   }
 
@@ -363,7 +447,15 @@ void Normalize<CPUBackend>::RunTyped(Workspace &ws) {
                               ? inv_stddev_view[0]
                               : inv_stddev_view[i];
 
-      if (!batch_norm_) {
+      if (!batch_norm_ && !split_samples && calc_mean_variance) {
+        kernels::MeanVarianceCPU<InputType> mean_var;
+        mean_var.Setup(MeanVarianceView(i), in_view[i], make_span(axes_));
+        mean_var.Run();
+        StoreMeanAndSumSquare(i);
+        // Fused postprocessing with inverse square root.
+        SumSquare2InvStdDev(mutable_stddev[i], data_shape_[i],
+                            degrees_of_freedom_, epsilon_, scale_);
+      } else if (!batch_norm_ && !split_samples) {
         if (ShouldCalcMean()) {
           kernels::MeanCPU<float, InputType> mean;
           mean.Setup(mutable_mean[i], in_view[i], make_span(axes_));
@@ -112,7 +112,8 @@ properties.
     global shuffle across all shards.
 
 .. note::
-    This argument has no effect unless `shuffle_after_epoch` is set to ``True``.)",
+    This argument has no effect unless `shuffle_after_epoch` or `global_shuffle`
+    is set to ``True``.)",
       nullptr, false)
   .AddOptionalArg<vector<string>>("files", R"(A list of file paths to read the data from.
 
@@ -82,14 +82,18 @@ class FileReader : public DataReader<CPUBackend, ImageLabelWrapper, ImageLabelWr
         // Read the first sample (the next are repeated)
         auto &sample = *samples[sample_idx];
         if (sample.file_stream != nullptr) {
-          sample.file_stream->SeekRead(0, SEEK_SET);
           int64_t sample_sz = sample.file_stream->Size();
-          int64_t read_nbytes =
-              sample.file_stream->Read(file_output.raw_mutable_tensor(sample_idx), sample_sz);
+          void *dst = file_output.raw_mutable_tensor(sample_idx);
+          if (!sample.prefetcher ||
+              !sample.prefetcher->Take(sample.file_stream->path(), 0, sample_sz, dst)) {
+            sample.file_stream->SeekRead(0, SEEK_SET);
+            int64_t read_nbytes = sample.file_stream->Read(dst, sample_sz);
+            DALI_ENFORCE(read_nbytes == sample_sz,
+                         make_string("Failed to read file: ", sample.file_stream->path()));
+          }
           sample.file_stream->Close();
-          DALI_ENFORCE(read_nbytes == sample_sz,
-                       make_string("Failed to read file: ", sample.file_stream->path()));
           sample.file_stream.reset();
+          sample.prefetcher.reset();
         } else {
           std::memcpy(file_output.raw_mutable_tensor(sample_idx), sample.image.raw_data(),
                       sample.image.size());
@@ -32,13 +32,14 @@ void FileLabelLoaderBase<checkpointing_supported>::PrepareEmpty(ImageLabelWrappe
 
 template<bool checkpointing_supported>
 void FileLabelLoaderBase<checkpointing_supported>::ReadSample(ImageLabelWrapper &image_label) {
-  auto entry = file_label_entries_[current_index_++];
+  auto entry = file_label_entries_[SampleIndex(current_index_++)];
 
   // handle wrap-around
   MoveToNextShard(current_index_);
 
   // should be cleared by now
   assert(image_label.file_stream == nullptr);
+  image_label.prefetcher.reset();
 
   // copy the label
   image_label.label = entry.label.value();
@@ -82,6 +83,9 @@ void FileLabelLoaderBase<checkpointing_supported>::ReadSample(ImageLabelWrapper
     } else {
       // if URI, defer reading
       image_label.file_stream = std::move(current_file);
+      image_label.prefetcher = GetLookaheadPrefetcher();
+      if (image_label.prefetcher)
+        LookAhead(*image_label.prefetcher, opts, path, file_size);
     }
   } else {
     auto p = current_file->Get(file_size);
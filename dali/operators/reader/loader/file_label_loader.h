@@ -42,6 +42,8 @@ struct ImageLabelWrapper {
 
   // Deferred file read: If not null, means image was not read yet
   std::unique_ptr<FileStream> file_stream;
+  // If not null, the deferred read may have been already issued ahead of time
+  std::shared_ptr<LookaheadPrefetcher> prefetcher;
 };
 
 
@@ -61,9 +63,12 @@ class DLL_PUBLIC FileLabelLoaderBase : public Loader<CPUBackend, ImageLabelWrapp
     int64_t seed_arg = kDaliDataloaderSeed;
     bool has_seed_arg = spec.TryGetArgument(seed_arg, "shuffle_after_epoch_seed");
     shuffle_after_epoch_seed_ = seed_arg;
-    if (has_seed_arg && !shuffle_after_epoch_) {
-      DALI_WARN("`shuffle_after_epoch_seed` has no effect when `shuffle_after_epoch` is False.");
+    if (has_seed_arg && !shuffle_after_epoch_ && !GlobalShuffleRequested()) {
+      DALI_WARN("`shuffle_after_epoch_seed` has no effect when neither `shuffle_after_epoch` "
+                "nor `global_shuffle` is True.");
     }
+    if (GlobalShuffleRequested())
+      EnableGlobalShuffle(shuffle_after_epoch_);
 
     vector<string> files;
     vector<int> labels;
@@ -218,6 +223,30 @@ class DLL_PUBLIC FileLabelLoaderBase : public Loader<CPUBackend, ImageLabelWrapp
     MoveToNextShard(++current_index_);
   }
 
+  /**
+   * @brief Issues the reads of the file which was just read (deferred) and of up to
+   *        `lookahead_` files that will be read next, stopping at the end of the shard.
+   *
+   * Only the files with a known size (e.g. discovered in S3) are read ahead.
+   */
+  void LookAhead(LookaheadPrefetcher &prefetcher, const FileStream::Options &opts,
+                 const std::string &current_path, Index current_size) {
+    if (!prefetcher.Prefetch(current_path, 0, current_size, opts, current_size))
+      return;
+    for (int k = 1; k <= lookahead_; k++) {
+      Index idx = current_index_ - 1 + k;
+      if (IsNextShard(idx))
+        break;
+      auto &entry = file_label_entries_[SampleIndex(idx)];
+      // the cached images are skipped - they'd never be taken
+      if (!entry.size.has_value() || ShouldSkipImage(entry.filename))
+        continue;
+      auto path = filesystem::join_path(file_root_, entry.filename);
+      if (!prefetcher.Prefetch(path, 0, *entry.size, opts, entry.size))
+        break;  // the cache is full
+    }
+  }
+
   void Reset(bool wrap_to_shard) override {
     if (wrap_to_shard) {
       current_index_ = start_index(virtual_shard_id_, num_shards_, SizeImpl());
@@ -238,12 +267,30 @@ class DLL_PUBLIC FileLabelLoaderBase : public Loader<CPUBackend, ImageLabelWrapp
       std::mt19937_64 g(seed);
       std::shuffle(file_label_entries_.begin(), file_label_entries_.end(), g);
     }
+    ShuffleGlobally(shuffle_after_epoch_seed_, current_epoch_);
   }
 
   void RestoreStateImpl(const LoaderStateSnapshot &state) override {
     current_epoch_ = state.current_epoch;
   }
 
+  bool SupportsRandomAccess() const override {
+    return true;
+  }
+
+  LoaderReadPosition GetReadPosition() const override {
+    return {current_epoch_, current_index_};
+  }
+
+  void SetReadPosition(const LoaderReadPosition &pos) override {
+    if (pos.epoch != current_epoch_) {
+      // with checkpointing enabled, the order of the samples depends only on the epoch
+      current_epoch_ = pos.epoch - 1;
+      Reset(true);
+    }
+    current_index_ = pos.index;
+  }
+
   using Base::shard_id_;
   using Base::virtual_shard_id_;
   using Base::num_shards_;
@@ -257,6 +304,13 @@ class DLL_PUBLIC FileLabelLoaderBase : public Loader<CPUBackend, ImageLabelWrapp
   using Base::PrepareEmptyTensor;
   using Base::MoveToNextShard;
   using Base::ShouldSkipImage;
+  using Base::GetLookaheadPrefetcher;
+  using Base::IsNextShard;
+  using Base::lookahead_;
+  using Base::EnableGlobalShuffle;
+  using Base::GlobalShuffleRequested;
+  using Base::ShuffleGlobally;
+  using Base::SampleIndex;
 
   string file_root_, file_list_;
   vector<FileLabelEntry> file_label_entries_;
@@ -178,6 +178,23 @@ class FileLoader : public Loader<Backend, Target, true> {
     current_epoch_ = state.current_epoch;
   }
 
+  bool SupportsRandomAccess() const override {
+    return true;
+  }
+
+  LoaderReadPosition GetReadPosition() const override {
+    return {current_epoch_, current_index_};
+  }
+
+  void SetReadPosition(const LoaderReadPosition &pos) override {
+    if (pos.epoch != current_epoch_) {
+      // with checkpointing enabled, the order of the samples depends only on the epoch
+      current_epoch_ = pos.epoch - 1;
+      Reset(true);
+    }
+    current_index_ = pos.index;
+  }
+
   using Loader<Backend, Target, true>::shard_id_;
   using Loader<Backend, Target, true>::virtual_shard_id_;
   using Loader<Backend, Target, true>::num_shards_;
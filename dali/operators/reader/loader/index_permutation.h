@@ -0,0 +1,94 @@
+// Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DALI_OPERATORS_READER_LOADER_INDEX_PERMUTATION_H_
+#define DALI_OPERATORS_READER_LOADER_INDEX_PERMUTATION_H_
+
+#include <cassert>
+#include <cstdint>
+
+namespace dali {
+
+/**
+ * @brief A pseudo-random permutation of the range [0, size), computed on the fly.
+ *
+ * The permutation is a balanced Feistel network over the smallest power-of-4 domain that
+ * covers `size`, restricted to [0, size) by cycle walking: values falling outside of the range
+ * are encrypted again until they land inside it. Since the domain is less than 4x larger than
+ * the range, this takes less than 4 rounds of the network on average.
+ *
+ * It takes O(1) memory and time per index and the result depends only on `size` and `key`,
+ * so multiple instances (e.g. in different shards or processes) produce the same order.
+ */
+class IndexPermutation {
+ public:
+  IndexPermutation() = default;
+
+  IndexPermutation(uint64_t size, uint64_t key) : size_(size), key_(key) {
+    half_bits_ = 1;
+    while ((uint64_t(1) << (2 * half_bits_)) < size_)
+      half_bits_++;
+    half_mask_ = (uint64_t(1) << half_bits_) - 1;
+  }
+
+  uint64_t size() const {
+    return size_;
+  }
+
+  /**
+   * @brief Returns the element at position `pos` of the permuted sequence.
+   */
+  uint64_t operator()(uint64_t pos) const {
+    assert(pos < size_);
+    if (size_ <= 1)
+      return pos;
+    uint64_t x = pos;
+    do {
+      x = Encrypt(x);
+    } while (x >= size_);
+    return x;
+  }
+
+ private:
+  static constexpr int kRounds = 6;
+
+  static uint64_t Mix(uint64_t x) {
+    // splitmix64 finalizer
+    x += 0x9e3779b97f4a7c15ull;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+    return x ^ (x >> 31);
+  }
+
+  uint64_t Encrypt(uint64_t x) const {
+    uint64_t left = x >> half_bits_;
+    uint64_t right = x & half_mask_;
+    for (int r = 0; r < kRounds; r++) {
+      uint64_t f = Mix(key_ ^ Mix(right + (static_cast<uint64_t>(r) << 56))) & half_mask_;
+      uint64_t new_right = left ^ f;
+      left = right;
+      right = new_right;
+    }
+    return (left << half_bits_) | right;
+  }
+
+  uint64_t size_ = 0;
+  uint64_t key_ = 0;
+  int half_bits_ = 1;
+  uint64_t half_mask_ = 1;
+};
+
+}  // namespace dali
+
+#endif  // DALI_OPERATORS_READER_LOADER_INDEX_PERMUTATION_H_
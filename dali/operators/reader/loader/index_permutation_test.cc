@@ -0,0 +1,71 @@
+// Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <vector>
+#include "dali/operators/reader/loader/index_permutation.h"
+
+namespace dali {
+
+TEST(IndexPermutationTest, IsPermutation) {
+  for (uint64_t size : {1, 2, 3, 4, 5, 17, 100, 1000, 4096, 4097, 65535}) {
+    IndexPermutation perm(size, 12345);
+    std::vector<bool> seen(size, false);
+    for (uint64_t i = 0; i < size; i++) {
+      uint64_t x = perm(i);
+      ASSERT_LT(x, size);
+      ASSERT_FALSE(seen[x]) << "Duplicate value " << x << " for size " << size;
+      seen[x] = true;
+    }
+  }
+}
+
+TEST(IndexPermutationTest, Deterministic) {
+  const uint64_t size = 10000;
+  IndexPermutation a(size, 42), b(size, 42), c(size, 43);
+  int different = 0;
+  for (uint64_t i = 0; i < size; i++) {
+    ASSERT_EQ(a(i), b(i));
+    different += a(i) != c(i);
+  }
+  EXPECT_GT(different, size * 9 / 10);
+}
+
+TEST(IndexPermutationTest, Shuffled) {
+  // The permutation should not keep the positions close to each other - check that the
+  // displacement of the elements is similar to that of a random permutation (size / 3).
+  const uint64_t size = 100000;
+  IndexPermutation perm(size, 7);
+  double total_displacement = 0;
+  int fixed_points = 0;
+  for (uint64_t i = 0; i < size; i++) {
+    uint64_t x = perm(i);
+    total_displacement += std::abs(static_cast<double>(x) - static_cast<double>(i));
+    fixed_points += x == i;
+  }
+  double mean_displacement = total_displacement / size;
+  EXPECT_NEAR(mean_displacement, size / 3.0, size * 0.02);
+  EXPECT_LT(fixed_points, 20);
+
+  // consecutive positions should land in different parts of the range
+  int close_neighbors = 0;
+  for (uint64_t i = 1; i < size; i++) {
+    if (std::abs(static_cast<double>(perm(i)) - static_cast<double>(perm(i - 1))) < 100)
+      close_neighbors++;
+  }
+  EXPECT_LT(close_neighbors, size / 100);
+}
+
+}  // namespace dali
@@ -20,6 +20,7 @@
 #include <memory>
 #include <mutex>
 #include <numeric>
+#include <optional>
 #include <queue>
 #include <random>
 #include <string>
@@ -45,7 +46,11 @@ struct IndexedFileLoaderSample {
 
 class IndexedFileLoader : public Loader<CPUBackend, IndexedFileLoaderSample, true> {
  public:
-  explicit IndexedFileLoader(const OpSpec& spec)
+  /**
+   * @param open_file The function which opens the data files (not the index files);
+   *                  FileStream::Open, if empty. Used in tests to emulate remote storage.
+   */
+  explicit IndexedFileLoader(const OpSpec& spec, FileStream::OpenFunc open_file = {})
       : Loader(spec),
         paths_(spec.GetRepeatedArgument<std::string>("path")),
         index_paths_(spec.GetRepeatedArgument<std::string>("index_path")),
@@ -61,14 +66,19 @@ class IndexedFileLoader : public Loader<CPUBackend, IndexedFileLoaderSample, tru
     int64_t seed_arg = kDaliDataloaderSeed;
     bool has_seed_arg = spec.TryGetArgument(seed_arg, "shuffle_after_epoch_seed");
     shuffle_after_epoch_seed_ = seed_arg;
-    if (has_seed_arg && !shuffle_after_epoch_) {
-      DALI_WARN("`shuffle_after_epoch_seed` has no effect when `shuffle_after_epoch` is False.");
+    if (has_seed_arg && !shuffle_after_epoch_ && !GlobalShuffleRequested()) {
+      DALI_WARN("`shuffle_after_epoch_seed` has no effect when neither `shuffle_after_epoch` "
+                "nor `global_shuffle` is True.");
     }
+    if (GlobalShuffleRequested())
+      EnableGlobalShuffle(shuffle_after_epoch_);
     DALI_ENFORCE(!(shuffle_after_epoch_ && stick_to_shard_),
                  "shuffle_after_epoch and stick_to_shard cannot be both true");
     if (shuffle_after_epoch_) {
       stick_to_shard_ = true;
     }
+    if (open_file)
+      open_file_ = std::move(open_file);
   }
 
   void PrepareEmpty(IndexedFileLoaderSample &sample) override {
@@ -81,7 +91,7 @@ class IndexedFileLoader : public Loader<CPUBackend, IndexedFileLoaderSample, tru
 
     int64_t seek_pos, size;
     size_t file_index;
-    std::tie(seek_pos, size, file_index) = indices_[current_index_];
+    std::tie(seek_pos, size, file_index) = indices_[SampleIndex(current_index_)];
     ++current_index_;
 
     const auto& path = paths_[file_index];
@@ -100,7 +110,7 @@ class IndexedFileLoader : public Loader<CPUBackend, IndexedFileLoaderSample, tru
 
     if (file_index != current_file_index_) {
       current_file_.reset();
-      current_file_ = FileStream::Open(path, opts);
+      current_file_ = open_file_(path, opts, std::nullopt);
       current_file_sz_ = current_file_->Size();
       current_file_index_ = file_index;
       // invalidate the buffer
@@ -203,8 +213,14 @@ class IndexedFileLoader : public Loader<CPUBackend, IndexedFileLoaderSample, tru
         sample.tensor.Resize({size}, DALI_UINT8);
         auto* out_data_ptr = static_cast<uint8_t*>(sample.tensor.raw_mutable_data());
         auto file_sz = current_file_sz_;
-        auto work = [path, out_data_ptr, seek_pos, size, opts, file_sz]() {
-          auto file = FileStream::Open(path, opts, file_sz);
+        auto prefetcher = GetLookaheadPrefetcher();
+        if (prefetcher)
+          LookAhead(*prefetcher, opts);
+        auto work = [path, out_data_ptr, seek_pos, size, opts, file_sz, prefetcher,
+                     open_file = open_file_]() {
+          if (prefetcher && prefetcher->Take(path, seek_pos, size, out_data_ptr))
+            return;
+          auto file = open_file(path, opts, file_sz);
           auto file_cleanup = AtScopeExit([&file] {
             if (file)
               file->Close();
@@ -229,6 +245,31 @@ class IndexedFileLoader : public Loader<CPUBackend, IndexedFileLoaderSample, tru
     MoveToNextShard(current_index_++);
   }
 
+  /**
+   * @brief Issues the reads of the sample which was just read (deferred) and of up to
+   *        `lookahead_` samples that will be read next, stopping at the end of the shard.
+   */
+  void LookAhead(LookaheadPrefetcher &prefetcher, const FileStream::Options &opts) {
+    for (int k = 0; k <= lookahead_; k++) {
+      size_t idx = current_index_ - 1 + k;
+      if (k > 0 && IsNextShard(idx))
+        break;
+      int64_t seek_pos, size;
+      size_t file_index;
+      std::tie(seek_pos, size, file_index) = indices_[SampleIndex(idx)];
+      if (!remote_files_[file_index])
+        continue;
+      // the cached images are skipped - they'd never be taken
+      if (k > 0 && ShouldSkipImage(paths_[file_index] + " at index " + to_string(seek_pos)))
+        continue;
+      std::optional<size_t> file_sz;
+      if (file_index == current_file_index_)
+        file_sz = current_file_sz_;
+      if (!prefetcher.Prefetch(paths_[file_index], seek_pos, size, opts, file_sz))
+        break;  // the cache is full
+    }
+  }
+
   ~IndexedFileLoader() override {
     current_file_.reset();
   }
@@ -266,6 +307,11 @@ class IndexedFileLoader : public Loader<CPUBackend, IndexedFileLoaderSample, tru
     copy_read_data_ = dont_use_mmap_ || !mmap_reserver_.CanShareMappedData();
 
     DALI_ENFORCE(!paths_.empty(), "No files specified.");
+    remote_files_.resize(paths_.size());
+    for (size_t i = 0; i < paths_.size(); i++) {
+      auto uri = URI::Parse(paths_[i], URI::ParseOpts::AllowNonEscaped);
+      remote_files_[i] = uri.valid() && uri.scheme() != "file";
+    }
     ReadIndexFile(index_paths_);
     DALI_ENFORCE(!indices_.empty(), "Content of index files should not be empty");
     if (shuffle_after_epoch_) {
@@ -297,6 +343,7 @@ class IndexedFileLoader : public Loader<CPUBackend, IndexedFileLoaderSample, tru
         }
       }
     }
+    ShuffleGlobally(shuffle_after_epoch_seed_, current_epoch_);
 
     int64_t seek_pos, size;
     size_t file_index;
@@ -305,7 +352,7 @@ class IndexedFileLoader : public Loader<CPUBackend, IndexedFileLoaderSample, tru
     } else {
       current_index_ = 0;
     }
-    std::tie(seek_pos, size, file_index) = indices_[current_index_];
+    std::tie(seek_pos, size, file_index) = indices_[SampleIndex(current_index_)];
     if (file_index != current_file_index_) {
       current_file_.reset();
       const auto& path = paths_[file_index];
@@ -313,7 +360,7 @@ class IndexedFileLoader : public Loader<CPUBackend, IndexedFileLoaderSample, tru
       opts.read_ahead = read_ahead_;
       opts.use_mmap = !copy_read_data_;
       opts.use_odirect = use_o_direct_;
-      current_file_ = FileStream::Open(path, opts);
+      current_file_ = open_file_(path, opts, std::nullopt);
       current_file_sz_ = current_file_->Size();
       current_file_index_ = file_index;
       // invalidate the buffer
@@ -327,7 +374,26 @@ class IndexedFileLoader : public Loader<CPUBackend, IndexedFileLoaderSample, tru
     current_epoch_ = state.current_epoch;
   }
 
+  bool SupportsRandomAccess() const override {
+    return true;
+  }
+
+  LoaderReadPosition GetReadPosition() const override {
+    return {current_epoch_, static_cast<Index>(current_index_)};
+  }
+
+  void SetReadPosition(const LoaderReadPosition &pos) override {
+    if (pos.epoch != current_epoch_) {
+      // the order of the samples depends only on the epoch
+      current_epoch_ = pos.epoch - 1;
+      Reset(true);
+    }
+    current_index_ = pos.index;
+    should_seek_ = true;
+  }
+
   std::vector<std::string> paths_;
+  std::vector<bool> remote_files_;
   std::vector<std::string> index_paths_;
   std::vector<std::tuple<int64_t, int64_t, size_t>> indices_;
   // Per-file index groups used for file-level shuffling (populated only when
@@ -343,6 +409,7 @@ class IndexedFileLoader : public Loader<CPUBackend, IndexedFileLoaderSample, tru
   int64_t next_seek_pos_ = 0;
   bool use_o_direct_ = false;
   bool shuffle_after_epoch_ = false;
+  // also used as the seed of the global shuffle
   int64_t shuffle_after_epoch_seed_ = kDaliDataloaderSeed;
   int current_epoch_ = 0;
   size_t o_direct_chunk_size_ = 0;
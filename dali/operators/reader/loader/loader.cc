@@ -73,7 +73,40 @@ the file in memory.
 
 Mapping provides a small performance benefit when accessing a local file system, but most network file
 systems, do not provide optimum performance.
-)code", false);
+)code", false)
+  .AddOptionalArg("lookahead",
+      R"code(Number of samples, following the one being read, that are fetched ahead of time
+from remote storage (e.g. S3).
+
+The Loader reads the samples in a deterministic order (shuffling happens later, in the
+shuffle buffer), so the reads of the upcoming samples can be issued while the current batch is
+processed, hiding the storage latency. Only applies to readers which defer remote reads
+(``readers.file`` and ``readers.tfrecord``) and only to remote files. 0 disables the lookahead.)code",
+      0)
+  .AddOptionalArg("lookahead_cache_size",
+      R"code(Maximum number of bytes fetched ahead of time with `lookahead` and not consumed yet.
+
+When the limit is reached, no more reads are issued until the prefetched data is consumed.)code",
+      static_cast<int64_t>(256 << 20))
+  .AddOptionalArg("global_shuffle",
+      R"code(If set to True, the reader shuffles the entire dataset in every epoch without a
+shuffle buffer.
+
+The order of the samples is a pseudo-random permutation of the whole dataset, different in every
+epoch, computed on the fly (in constant memory) from `shuffle_after_epoch_seed` and the epoch
+number - `shuffle_after_epoch_seed` is the seed of that permutation. Each shard reads its own part
+of that order, so all pipeline instances must use the same seed. The data is read directly in the
+permuted order, so there's no warmup - `random_shuffle` can be left disabled, in which case the
+shuffle buffer is not used.
+
+The samples are accessed randomly, which is efficient with local or memory-mapped storage, but may
+be slow with network storage - consider `shuffle_after_epoch` there.
+
+`stick_to_shard` and `shuffle_after_epoch` cannot be used when this argument is set to True.
+
+.. note::
+  Not all readers support this argument - the ones which don't raise an error when it's set.)code",
+      false);
 
 size_t start_index(const size_t shard_id,
                    const size_t shard_num,
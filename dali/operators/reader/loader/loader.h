@@ -15,10 +15,13 @@
 #ifndef DALI_OPERATORS_READER_LOADER_LOADER_H_
 #define DALI_OPERATORS_READER_LOADER_LOADER_H_
 
+#include <algorithm>
 #include <list>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <numeric>
+#include <optional>
 #include <random>
 #include <string>
 #include <type_traits>
@@ -28,6 +31,7 @@
 #include <atomic>
 #include <unordered_set>
 
+#include "dali/core/call_at_exit.h"
 #include "dali/core/call_once.h"
 #include "dali/core/nvtx.h"
 #include "dali/core/common.h"
@@ -35,6 +39,8 @@
 #include "dali/pipeline/operator/op_spec.h"
 #include "dali/pipeline/data/tensor.h"
 #include "dali/operators/decoder/cache/image_cache_factory.h"
+#include "dali/operators/reader/loader/index_permutation.h"
+#include "dali/operators/reader/loader/lookahead_prefetcher.h"
 
 namespace dali {
 
@@ -45,13 +51,54 @@ DLL_PUBLIC size_t start_index(const size_t shard_id,
 DLL_PUBLIC Index num_samples(const size_t shard_num,
                              const size_t size);
 
+/**
+ * @brief Position of a Loader in its data source, see Loader::SetReadPosition.
+ */
+struct LoaderReadPosition {
+  /** The loader's own epoch counter, i.e. the number of times it wrapped around the data */
+  int epoch = 0;
+  /** Index of the next sample to be read, as understood by the loader */
+  Index index = 0;
+};
+
+/**
+ * @brief Complete state of the Loader's sample buffer and counters.
+ *
+ * Along with the read positions of the buffered samples, it allows restoring the Loader
+ * by reading only the samples that are in the buffer, regardless of how far into the epoch
+ * the snapshot was taken.
+ */
+struct LoaderBufferState {
+  struct Sample {
+    Index idx = 0;
+    LoaderReadPosition pos;
+  };
+
+  std::default_random_engine rng;
+  int consumer_epoch = 0;
+  int virtual_shard_id = 0;
+  Index returned_sample_counter = 0;
+  Index read_sample_counter = 0;
+  Index total_read_sample_counter = 0;
+  /** Start and end of each (virtual) shard present in the sample buffer */
+  std::vector<std::pair<Index, Index>> shards;
+  std::vector<Sample> buffer;
+  /** The last returned sample, kept only if it may be needed for padding */
+  std::optional<Sample> last_sample;
+  LoaderReadPosition next_read;
+};
+
 /**
  * @brief Structure describing Loader base state, at the begining of an epoch.
+ *
+ * If the loader supports random access, the snapshot also carries the complete
+ * buffer state, so that it can be restored without replaying `age` reads.
 */
 struct LoaderStateSnapshot {
   std::default_random_engine rng;
   int current_epoch;
   Index age;
+  std::optional<LoaderBufferState> buffer_state = std::nullopt;
 };
 
 /**
@@ -72,6 +119,8 @@ class Loader {
   struct IndexedLoadTargetSharedPtr {
     Index idx;
     LoadTargetSharedPtr ptr;
+    // where the sample was read from, tracked only if SupportsFastRestore()
+    LoaderReadPosition pos = {};
   };
 
   explicit Loader(const OpSpec& options)
@@ -93,8 +142,14 @@ class Loader {
       pad_last_batch_(options.GetArgument<bool>("pad_last_batch")),
       dont_use_mmap_(options.GetArgument<bool>("dont_use_mmap")),
       checkpointing_(options.GetArgument<bool>("checkpointing")),
-      max_batch_size_(options.GetArgument<int>("max_batch_size")) {
+      max_batch_size_(options.GetArgument<int>("max_batch_size")),
+      lookahead_(options.GetArgument<int>("lookahead")),
+      lookahead_cache_size_(options.GetArgument<Index>("lookahead_cache_size")),
+      global_shuffle_requested_(options.GetArgument<bool>("global_shuffle")) {
     DALI_ENFORCE(initial_empty_size_ > 0, "Batch size needs to be greater than 0");
+    DALI_ENFORCE(lookahead_ >= 0, "lookahead must be non-negative");
+    DALI_ENFORCE(lookahead_ == 0 || lookahead_cache_size_ > 0,
+                 "lookahead_cache_size must be positive when lookahead is enabled");
     DALI_ENFORCE(num_shards_ > shard_id_, "num_shards needs to be greater than shard_id");
     // initialize a random distribution -- this will be
     // used to pick from our sample buffer
@@ -163,18 +218,38 @@ class Loader {
     if constexpr (!supports_checkpointing) {
       DALI_FAIL("Checkpointing is not supported by this loader.");
     } else {
-      return current_snapshot_;
+      LoaderStateSnapshot snapshot = current_snapshot_;
+      // Before the initial buffer fill there's nothing to replay anyway.
+      if (SupportsFastRestore() && initial_buffer_filled_)
+        snapshot.buffer_state = GetBufferState();
+      return snapshot;
     }
   }
 
   /**
    * @brief Restores the loader's state from a snapshot.
+   *
+   * If the snapshot contains the buffer state (see LoaderBufferState), only the samples
+   * present in the buffer are read. Otherwise, the loader is rewound to the beginning
+   * of the epoch and fast-forwarded by `state.age` samples.
    */
   void RestoreStateFromSnapshot(const LoaderStateSnapshot& state) {
     DALI_ENFORCE(IsCheckpointingEnabled(),
                  "Checkpointing was not enabled. Please make sure you set"
                  " enable_checkpointing to True when creating the pipeline.");
 
+    // The ranges prefetched so far won't be read anymore. The samples read while restoring
+    // are not consecutive (some are skipped), so they're not prefetched either.
+    if (lookahead_prefetcher_)
+      lookahead_prefetcher_->Clear();
+    lookahead_suspended_ = true;
+    auto resume_lookahead = AtScopeExit([this]() { lookahead_suspended_ = false; });
+
+    if (state.buffer_state && SupportsFastRestore()) {
+      RestoreBufferState(state);
+      return;
+    }
+
     RestoreEpochState(state);
     SaveStateSnapshot(current_snapshot_);
 
@@ -237,6 +312,7 @@ class Loader {
       int skipped_initial_samples = 0;
       for (int i = 0; i < initial_buffer_fill_; ++i) {
         LoadTargetSharedPtr tensor_ptr = nullptr;
+        auto pos = TrackedReadPosition();
         if (filter(total_read_sample_counter_)) {
           tensor_ptr = LoadTargetSharedPtr(
             new LoadTarget,
@@ -250,7 +326,7 @@ class Loader {
           Skip();
           skipped_initial_samples++;
         }
-        sample_buffer_.push_back({total_read_sample_counter_, std::move(tensor_ptr)});
+        sample_buffer_.push_back({total_read_sample_counter_, std::move(tensor_ptr), pos});
         IncreaseReadSampleCounter();
         ++shards_.back().end;
       }
@@ -301,6 +377,7 @@ class Loader {
 
     std::swap(sample_buffer_[idx], sample_buffer_[shards_.front().start % sample_buffer_.size()]);
     LoadTargetSharedPtr tensor_ptr = nullptr;
+    auto pos = TrackedReadPosition();
     if (filter(total_read_sample_counter_)) {
       // now grab an empty tensor, fill it and add to filled buffers
       // empty_tensors_ needs to be thread-safe w.r.t. RecycleTensor()
@@ -322,7 +399,7 @@ class Loader {
     } else {
       Skip();
     }
-    IndexedLoadTargetSharedPtr sample = {total_read_sample_counter_, std::move(tensor_ptr)};
+    IndexedLoadTargetSharedPtr sample = {total_read_sample_counter_, std::move(tensor_ptr), pos};
     IncreaseReadSampleCounter();
     std::swap(sample_buffer_[shards_.back().end % sample_buffer_.size()], sample);
     ++shards_.back().end;
@@ -369,6 +446,8 @@ class Loader {
     if (!loading_flag_) {
       std::lock_guard<std::mutex> l(prepare_metadata_mutex_);
       if (!loading_flag_) {
+        DALI_ENFORCE(!global_shuffle_requested_ || global_shuffle_,
+                     "This reader doesn't support global_shuffle.");
         PrepareMetadataImpl();
         std::atomic_thread_fence(std::memory_order_release);
         loading_flag_ = true;
@@ -424,6 +503,34 @@ class Loader {
   // Method for saving the state to the checkpoint in subclasses
   virtual void SaveStateImpl(LoaderStateSnapshot &state) {}
 
+  /**
+   * @brief Returns true if the loader can jump to an arbitrary read position.
+   *
+   * Such loaders can be restored from a checkpoint without replaying the reads from
+   * the beginning of the epoch - see GetReadPosition and SetReadPosition.
+   */
+  virtual bool SupportsRandomAccess() const {
+    return false;
+  }
+
+  /**
+   * @brief Returns the position of the next sample to be read (or skipped).
+   */
+  virtual LoaderReadPosition GetReadPosition() const {
+    return {};
+  }
+
+  /**
+   * @brief Moves the loader to a position previously obtained with GetReadPosition,
+   *        so that the next ReadSample reads the same sample as it did back then.
+   *
+   * The position may come from a different loader instance, constructed with the same
+   * arguments, and belong to a different epoch than the current one.
+   */
+  virtual void SetReadPosition(const LoaderReadPosition &pos) {
+    DALI_FAIL("This loader doesn't support random access.");
+  }
+
   // Check if given reader moved to the next shard
   virtual inline bool IsNextShard(Index current_index) {
      return current_index >= Size() ||
@@ -463,6 +570,67 @@ class Loader {
   }
 
 
+  /**
+   * @brief Returns the prefetcher used to read ahead the deferred (remote) reads,
+   *        or nullptr if `lookahead` is disabled (or suspended, when restoring a checkpoint).
+   *
+   * The prefetcher is shared with the deferred read work, which may outlive the loader's batch.
+   */
+  std::shared_ptr<LookaheadPrefetcher> GetLookaheadPrefetcher() {
+    if (lookahead_suspended_)
+      return nullptr;
+    if (lookahead_ > 0 && !lookahead_prefetcher_) {
+      int num_threads = std::min(lookahead_, kMaxLookaheadThreads);
+      lookahead_prefetcher_ =
+          std::make_shared<LookaheadPrefetcher>(num_threads, lookahead_cache_size_, open_file_);
+    }
+    return lookahead_prefetcher_;
+  }
+
+  /**
+   * @brief Enables the global shuffle mode.
+   *
+   * In every epoch, the samples are read in the order of a pseudo-random permutation of the
+   * whole dataset, computed on the fly (see IndexPermutation) and identical in all shards.
+   * Each shard reads its own, fixed range of positions in that order, so the shards stay
+   * disjoint while each of them sees a different subset of the data in every epoch.
+   *
+   * Derived loaders translate the read position with SampleIndex and call ShuffleGlobally
+   * whenever the epoch changes.
+   */
+  void EnableGlobalShuffle(bool shuffle_after_epoch) {
+    DALI_ENFORCE(!stick_to_shard_, "global_shuffle and stick_to_shard cannot be both true");
+    DALI_ENFORCE(!shuffle_after_epoch,
+                 "global_shuffle and shuffle_after_epoch cannot be both true");
+    global_shuffle_ = true;
+    stick_to_shard_ = true;
+  }
+
+  /**
+   * @brief Whether the `global_shuffle` argument is set; the loaders which support it call
+   *        EnableGlobalShuffle then.
+   */
+  bool GlobalShuffleRequested() const {
+    return global_shuffle_requested_;
+  }
+
+  /**
+   * @brief Generates the sample permutation for given epoch; no-op unless global shuffle is on.
+   */
+  void ShuffleGlobally(int64_t seed, int epoch) {
+    if (global_shuffle_) {
+      uint64_t key = static_cast<uint64_t>(seed) + (static_cast<uint64_t>(epoch) << 32);
+      sample_permutation_ = IndexPermutation(SizeImpl(), key);
+    }
+  }
+
+  /**
+   * @brief Translates the position in the reading order into the index of the sample.
+   */
+  Index SampleIndex(Index pos) const {
+    return global_shuffle_ ? static_cast<Index>(sample_permutation_(pos)) : pos;
+  }
+
   bool ShouldSkipImage(const ImageCache::ImageKey& key) {
     if (!skip_cached_images_)
       return false;
@@ -497,6 +665,112 @@ class Loader {
     Reset(true);
   }
 
+  bool SupportsFastRestore() {
+    return IsCheckpointingEnabled() && SupportsRandomAccess();
+  }
+
+  LoaderReadPosition TrackedReadPosition() {
+    return SupportsFastRestore() ? GetReadPosition() : LoaderReadPosition{};
+  }
+
+  LoaderBufferState GetBufferState() {
+    LoaderBufferState state;
+    state.rng = e_;
+    state.consumer_epoch = consumer_epoch_;
+    state.virtual_shard_id = virtual_shard_id_;
+    state.returned_sample_counter = returned_sample_counter_;
+    state.read_sample_counter = read_sample_counter_;
+    state.total_read_sample_counter = total_read_sample_counter_;
+    for (auto &shard : shards_)
+      state.shards.emplace_back(shard.start, shard.end);
+    state.buffer.reserve(sample_buffer_.size());
+    for (auto &sample : sample_buffer_)
+      state.buffer.push_back({sample.idx, sample.pos});
+    if (pad_last_batch_ && last_sample_ptr_tmp.ptr) {
+      state.last_sample = LoaderBufferState::Sample{last_sample_ptr_tmp.idx,
+                                                    last_sample_ptr_tmp.pos};
+    }
+    state.next_read = GetReadPosition();
+    return state;
+  }
+
+  // Restores the complete state, reading only the samples present in the buffer.
+  void RestoreBufferState(const LoaderStateSnapshot &state) {
+    PrepareMetadata();
+    const auto &buffer_state = *state.buffer_state;
+    e_ = buffer_state.rng;
+    consumer_epoch_ = buffer_state.consumer_epoch;
+    virtual_shard_id_ = buffer_state.virtual_shard_id;
+    returned_sample_counter_ = buffer_state.returned_sample_counter;
+    read_sample_counter_ = buffer_state.read_sample_counter;
+    total_read_sample_counter_ = buffer_state.total_read_sample_counter;
+    shards_.clear();
+    for (auto &shard : buffer_state.shards)
+      shards_.push_back({shard.first, shard.second});
+
+    // The tensors released from the old buffer return to the empty pile - reuse them.
+    sample_buffer_.clear();
+    auto take_tensor = [this]() {
+      LoadTargetUniquePtr tensor;
+      {
+        std::lock_guard<std::mutex> lock(empty_tensors_mutex_);
+        if (!empty_tensors_.empty()) {
+          tensor = std::move(empty_tensors_.back());
+          empty_tensors_.pop_back();
+        }
+      }
+      if (!tensor) {
+        tensor.reset(new LoadTarget());
+        PrepareEmpty(*tensor);
+      }
+      return LoadTargetSharedPtr(tensor.release(), [this](LoadTarget* sample) {
+        LoadTargetUniquePtr recycle_ptr(sample);
+        RecycleTensor(std::move(recycle_ptr));
+      });
+    };
+
+    // Read the buffered samples in the order of their positions - this keeps the access to
+    // the data source (mostly) sequential and limits the number of epoch changes.
+    int n = buffer_state.buffer.size();
+    std::vector<int> order(n);
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](int a, int b) {
+      auto &pa = buffer_state.buffer[a].pos, &pb = buffer_state.buffer[b].pos;
+      return std::make_pair(pa.epoch, pa.index) < std::make_pair(pb.epoch, pb.index);
+    });
+    std::vector<IndexedLoadTargetSharedPtr> buffer(n);
+    for (int i : order) {
+      auto &sample = buffer_state.buffer[i];
+      auto tensor_ptr = take_tensor();
+      SetReadPosition(sample.pos);
+      ReadSample(*tensor_ptr);
+      buffer[i] = {sample.idx, std::move(tensor_ptr), sample.pos};
+    }
+    sample_buffer_ = std::move(buffer);
+
+    last_sample_ptr_tmp = {0, nullptr};
+    if (buffer_state.last_sample) {
+      auto &sample = *buffer_state.last_sample;
+      auto tensor_ptr = take_tensor();
+      SetReadPosition(sample.pos);
+      ReadSample(*tensor_ptr);
+      last_sample_ptr_tmp = {sample.idx, std::move(tensor_ptr), sample.pos};
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(empty_tensors_mutex_);
+      while (static_cast<int>(empty_tensors_.size()) < initial_empty_size_) {
+        auto tensor_ptr = LoadTargetUniquePtr(new LoadTarget());
+        PrepareEmpty(*tensor_ptr);
+        empty_tensors_.push_back(std::move(tensor_ptr));
+      }
+    }
+
+    SetReadPosition(buffer_state.next_read);
+    initial_buffer_filled_ = true;
+    current_snapshot_ = {state.rng, state.current_epoch, state.age};
+  }
+
   /* Returns indices of samples present in the buffer but with no content read. */
   std::unordered_set<Index> GetMissingSamples() {
     std::unordered_set<Index> missing;
@@ -581,6 +855,22 @@ class Loader {
   // Keeps pointer to the last returned sample just in case it needs to be cloned
   IndexedLoadTargetSharedPtr last_sample_ptr_tmp;
 
+  // If true, the samples are read in the order of sample_permutation_, see EnableGlobalShuffle
+  bool global_shuffle_ = false;
+  // The value of the global_shuffle argument
+  bool global_shuffle_requested_ = false;
+  IndexPermutation sample_permutation_;
+
+  // Number of samples, following the one being read, whose deferred reads are issued ahead of time
+  int lookahead_;
+  // Maximum number of bytes read ahead and not consumed yet
+  Index lookahead_cache_size_;
+  static constexpr int kMaxLookaheadThreads = 16;
+  std::shared_ptr<LookaheadPrefetcher> lookahead_prefetcher_;
+  bool lookahead_suspended_ = false;
+  // Opens the data files read by the loaders which support it and by the prefetcher
+  FileStream::OpenFunc open_file_ = FileStream::Open;
+
   struct ShardBoundaries {
     Index start;
     Index end;
@@ -13,8 +13,17 @@
 // limitations under the License.
 
 #include <gtest/gtest.h>
+#include <unistd.h>
+#include <cstdio>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
 
+#include "dali/core/call_at_exit.h"
 #include "dali/core/common.h"
 #include "dali/pipeline/data/backend.h"
 #include "dali/pipeline/operator/op_spec.h"
@@ -191,6 +200,7 @@ class DummyCountingLoader : public Loader<CPUBackend, Tensor<CPUBackend>, true>
     size_(size), counter_(0), mark_epoch_(mark_epoch) {}
 
   void ReadSample(Tensor<CPUBackend> &t) override {
+    num_reads_++;
     t.Resize({1}, DALI_UINT64);
     *t.mutable_data<uint64_t>() = (counter_++) + epoch_ * mark_epoch_;
     if (counter_ % size_ == 0) Reset(stick_to_shard_);
@@ -223,11 +233,34 @@ class DummyCountingLoader : public Loader<CPUBackend, Tensor<CPUBackend>, true>
     return result;
   }
 
- private:
+  int NumReads() const {
+    return num_reads_;
+  }
+
+ protected:
   uint64_t size_;
   uint64_t counter_;
   uint64_t mark_epoch_;
   uint64_t epoch_ = 1;
+  int num_reads_ = 0;
+};
+
+class DummyRandomAccessLoader : public DummyCountingLoader {
+ public:
+  using DummyCountingLoader::DummyCountingLoader;
+
+  bool SupportsRandomAccess() const override {
+    return true;
+  }
+
+  LoaderReadPosition GetReadPosition() const override {
+    return {static_cast<int>(epoch_), static_cast<Index>(counter_)};
+  }
+
+  void SetReadPosition(const LoaderReadPosition &pos) override {
+    epoch_ = pos.epoch;
+    counter_ = pos.index;
+  }
 };
 
 void TestLoaderCheckpointing(const std::unique_ptr<DummyCountingLoader> &loader, int n) {
@@ -258,6 +291,7 @@ TEST(LoaderCheckpointingTest, TestCheckpoint) {
                 .AddArg("pad_last_batch", true);
 
   TestLoaderCheckpointing(InitLoader<DummyCountingLoader>(spec, 30), 20);
+  TestLoaderCheckpointing(InitLoader<DummyRandomAccessLoader>(spec, 30), 20);
 }
 
 TEST(LoaderCheckpointingTest, TestCheckpointShuffled) {
@@ -271,6 +305,7 @@ TEST(LoaderCheckpointingTest, TestCheckpointShuffled) {
                 .AddArg("pad_last_batch", true);
 
   TestLoaderCheckpointing(InitLoader<DummyCountingLoader>(spec, 30), 20);
+  TestLoaderCheckpointing(InitLoader<DummyRandomAccessLoader>(spec, 30), 20);
 }
 
 TEST(LoaderCheckpointingTest, TestCheckpointNoPadding) {
@@ -283,6 +318,7 @@ TEST(LoaderCheckpointingTest, TestCheckpointNoPadding) {
                 .AddArg("checkpointing", true);
 
   TestLoaderCheckpointing(InitLoader<DummyCountingLoader>(spec, 10), 20);
+  TestLoaderCheckpointing(InitLoader<DummyRandomAccessLoader>(spec, 10), 20);
 }
 
 /* This test represents an unlikely situation where dataset is much smaller than sample buffer,
@@ -304,6 +340,167 @@ TEST(LoaderCheckpointingTest, TestCheckpointShortEpoch) {
     8   /* epoch size, that's 3 epochs in a sample buffer! */,
     100 /* add 100*current_epoch to each output to differentiate samples */),
   32);
+  TestLoaderCheckpointing(InitLoader<DummyRandomAccessLoader>(spec, 8, 100), 32);
+}
+
+/* A loader supporting random access should be restored by reading just the samples
+   in the sample buffer, no matter how far into the epoch the snapshot was taken. */
+TEST(LoaderCheckpointingTest, TestFastRestore) {
+  auto spec = OpSpec("FileReader")
+                .AddArg("device_id", 0)
+                .AddArg("max_batch_size", 4)
+                .AddArg("seed", 123)
+                .AddArg("random_shuffle", true)
+                .AddArg("initial_fill", 10)
+                .AddArg("checkpointing", true)
+                .AddArg("pad_last_batch", true);
+
+  auto loader = InitLoader<DummyRandomAccessLoader>(spec, 1001, 10000);
+  loader->ReadInts(900);
+  auto snapshot = loader->GetStateSnapshot();
+  ASSERT_TRUE(snapshot.buffer_state.has_value());
+  auto reference = loader->ReadInts(300);  // goes to the next epoch
+
+  auto restored = InitLoader<DummyRandomAccessLoader>(spec, 1001, 10000);
+  restored->RestoreStateFromSnapshot(snapshot);
+  // the buffer and the last sample (kept for padding)
+  EXPECT_LE(restored->NumReads(), 10 + 1);
+  EXPECT_EQ(restored->ReadInts(300), reference);
+
+  // A snapshot without the buffer state (e.g. created by an older version) is still restored,
+  // by replaying the reads - and the loader can be quickly restored again afterwards.
+  auto legacy_snapshot = snapshot;
+  legacy_snapshot.buffer_state.reset();
+  auto replayed = InitLoader<DummyRandomAccessLoader>(spec, 1001, 10000);
+  replayed->RestoreStateFromSnapshot(legacy_snapshot);
+  EXPECT_GE(replayed->NumReads(), 900);
+  auto snapshot2 = replayed->GetStateSnapshot();
+  EXPECT_EQ(replayed->ReadInts(300), reference);
+  restored->RestoreStateFromSnapshot(snapshot2);
+  EXPECT_EQ(restored->ReadInts(300), reference);
+}
+
+namespace {
+
+/** Forwards the reads to a local file and counts them, by the position they start at. */
+class CountingFileStream : public FileStream {
+ public:
+  CountingFileStream(const std::string &uri, std::unique_ptr<FileStream> file,
+                     std::map<int64_t, int> &reads, std::mutex &mtx)
+  : FileStream(uri), file_(std::move(file)), reads_(reads), mtx_(mtx) {}
+
+  void Close() override {
+    file_->Close();
+  }
+
+  size_t Read(void *buf, size_t n) override {
+    {
+      std::lock_guard<std::mutex> g(mtx_);
+      reads_[file_->TellRead()]++;
+    }
+    return file_->Read(buf, n);
+  }
+
+  void SeekRead(ptrdiff_t pos, int whence = SEEK_SET) override {
+    file_->SeekRead(pos, whence);
+  }
+
+  ptrdiff_t TellRead() const override {
+    return file_->TellRead();
+  }
+
+  size_t Size() const override {
+    return file_->Size();
+  }
+
+ private:
+  std::unique_ptr<FileStream> file_;
+  std::map<int64_t, int> &reads_;
+  std::mutex &mtx_;
+};
+
+class LookaheadTestLoader : public IndexedFileLoader {
+ public:
+  using IndexedFileLoader::IndexedFileLoader;
+  using IndexedFileLoader::GetLookaheadPrefetcher;
+};
+
+}  // namespace
+
+/* With a lookahead cache much smaller than the lookahead window, the prefetcher must not
+   drop the prefetched records before they're consumed - every record is read exactly once,
+   either by the prefetcher or directly. */
+TEST(LoaderLookaheadTest, EachRecordReadOnce) {
+  const int kNumRecords = 64, kRecordSize = 1000, kBatchSize = 8;
+  std::string data_path = "/tmp/lookahead_records_XXXXXX";
+  std::string index_path = "/tmp/lookahead_index_XXXXXX";
+  int data_fd = mkstemp(&data_path[0]);
+  ASSERT_NE(data_fd, -1);
+  int index_fd = mkstemp(&index_path[0]);
+  ASSERT_NE(index_fd, -1);
+  auto cleanup = AtScopeExit([&]() {
+    std::remove(data_path.c_str());
+    std::remove(index_path.c_str());
+  });
+
+  std::vector<uint8_t> content(kNumRecords * kRecordSize);
+  for (size_t i = 0; i < content.size(); i++)
+    content[i] = static_cast<uint8_t>(i * 7 + i / kRecordSize);
+  ASSERT_EQ(write(data_fd, content.data(), content.size()),
+            static_cast<ssize_t>(content.size()));
+  close(data_fd);
+  std::string index;
+  for (int r = 0; r < kNumRecords; r++)
+    index += make_string(r * kRecordSize, ' ', kRecordSize, '\n');
+  ASSERT_EQ(write(index_fd, index.data(), index.size()), static_cast<ssize_t>(index.size()));
+  close(index_fd);
+
+  std::mutex mtx;
+  std::map<int64_t, int> reads;
+  auto open_counting =
+      [&](const std::string &uri, FileStream::Options opts, std::optional<size_t> size) {
+        auto path = uri.substr(std::string("counting://").size());
+        return std::make_unique<CountingFileStream>(uri, FileStream::Open(path), reads, mtx);
+      };
+
+  auto loader = std::make_shared<LookaheadTestLoader>(
+      OpSpec("TFRecordReader")
+      .AddArg("path", std::vector<std::string>{ "counting://" + data_path })
+      .AddArg("index_path", std::vector<std::string>{ index_path })
+      .AddArg("max_batch_size", kBatchSize)
+      .AddArg("device_id", 0)
+      .AddArg("dont_use_mmap", true)
+      .AddArg("lookahead", 16)
+      .AddArg("lookahead_cache_size", static_cast<int64_t>(3 * kRecordSize)),
+      open_counting);
+  loader->PrepareMetadata();
+
+  for (int b = 0; b < kNumRecords / kBatchSize; b++) {
+    std::vector<std::shared_ptr<IndexedFileLoaderSample>> batch;
+    for (int i = 0; i < kBatchSize; i++)
+      batch.push_back(loader->ReadOne(i == 0, i == kBatchSize - 1));
+    // the deferred reads are executed in parallel, like in the reader operator
+    std::vector<std::thread> threads;
+    for (auto &sample : batch)
+      threads.emplace_back([&sample]() { sample->work(); });
+    for (auto &t : threads)
+      t.join();
+    for (int i = 0; i < kBatchSize; i++) {
+      int r = b * kBatchSize + i;
+      auto *data = batch[i]->tensor.data<uint8_t>();
+      ASSERT_EQ(batch[i]->tensor.shape(), TensorShape<>{kRecordSize});
+      for (int j = 0; j < kRecordSize; j++)
+        ASSERT_EQ(data[j], content[r * kRecordSize + j]) << "Record " << r << " byte " << j;
+    }
+  }
+
+  for (int r = 0; r < kNumRecords; r++)
+    EXPECT_EQ(reads[r * kRecordSize], 1) << "Record " << r << " read more than once.";
+  EXPECT_EQ(reads.size(), static_cast<size_t>(kNumRecords));
+  auto prefetcher = loader->GetLookaheadPrefetcher();
+  ASSERT_NE(prefetcher, nullptr);
+  EXPECT_GT(prefetcher->NumHits(), 0);
+  EXPECT_LE(prefetcher->CachedBytes(), prefetcher->MaxBytes());
 }
 
 };  // namespace dali
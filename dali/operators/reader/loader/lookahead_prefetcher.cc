@@ -0,0 +1,178 @@
+// Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dali/operators/reader/loader/lookahead_prefetcher.h"
+#include <cstring>
+#include <utility>
+#include "dali/core/call_at_exit.h"
+#include "dali/core/error_handling.h"
+#include "dali/core/format.h"
+
+namespace dali {
+
+LookaheadPrefetcher::LookaheadPrefetcher(int num_threads, int64_t max_bytes,
+                                         FileStream::OpenFunc open_file)
+    : max_bytes_(max_bytes), open_file_(std::move(open_file)) {
+  if (!open_file_)
+    open_file_ = FileStream::Open;
+  DALI_ENFORCE(num_threads > 0, "The prefetcher needs at least one thread.");
+  DALI_ENFORCE(max_bytes > 0, "The prefetch cache size must be positive.");
+  threads_.reserve(num_threads);
+  for (int i = 0; i < num_threads; i++)
+    threads_.emplace_back(&LookaheadPrefetcher::ThreadMain, this);
+}
+
+LookaheadPrefetcher::~LookaheadPrefetcher() {
+  {
+    std::lock_guard<std::mutex> g(mtx_);
+    running_ = false;
+  }
+  work_cv_.notify_all();
+  for (auto &t : threads_)
+    t.join();
+}
+
+std::string LookaheadPrefetcher::Key(const std::string &path, int64_t offset, int64_t size) {
+  return make_string(path, '@', offset, ':', size);
+}
+
+bool LookaheadPrefetcher::Prefetch(const std::string &path, int64_t offset, int64_t size,
+                                   FileStream::Options opts, std::optional<size_t> file_size) {
+  if (size <= 0 || size > max_bytes_)
+    return false;
+  auto key = Key(path, offset, size);
+  {
+    std::lock_guard<std::mutex> g(mtx_);
+    if (index_.count(key))
+      return true;
+    if (cached_bytes_ + size > max_bytes_)
+      return false;
+    auto entry = std::make_shared<Entry>();
+    entry->path = path;
+    entry->offset = offset;
+    entry->size = size;
+    entry->opts = opts;
+    entry->file_size = file_size;
+    entries_.push_back(entry);
+    index_.emplace(std::move(key), std::prev(entries_.end()));
+    cached_bytes_ += size;
+    queue_.push_back(std::move(entry));
+  }
+  work_cv_.notify_one();
+  return true;
+}
+
+bool LookaheadPrefetcher::Take(const std::string &path, int64_t offset, int64_t size,
+                               void *dst) {
+  std::shared_ptr<Entry> entry;
+  {
+    std::unique_lock<std::mutex> lock(mtx_);
+    auto it = index_.find(Key(path, offset, size));
+    if (it == index_.end()) {
+      misses_++;
+      return false;
+    }
+    entry = *it->second;
+    done_cv_.wait(lock, [&]() { return entry->done; });
+    // The entry may have been cleared while we were waiting - we still hold the data, though.
+    it = index_.find(Key(path, offset, size));
+    if (it != index_.end() && *it->second == entry)
+      Remove(it->second);
+    if (entry->failed) {
+      misses_++;
+      return false;
+    }
+    hits_++;
+  }
+  std::memcpy(dst, entry->data.data(), size);
+  return true;
+}
+
+int64_t LookaheadPrefetcher::CachedBytes() const {
+  std::lock_guard<std::mutex> g(mtx_);
+  return cached_bytes_;
+}
+
+int64_t LookaheadPrefetcher::NumHits() const {
+  std::lock_guard<std::mutex> g(mtx_);
+  return hits_;
+}
+
+int64_t LookaheadPrefetcher::NumMisses() const {
+  std::lock_guard<std::mutex> g(mtx_);
+  return misses_;
+}
+
+void LookaheadPrefetcher::Clear() {
+  {
+    std::lock_guard<std::mutex> g(mtx_);
+    // The reads which haven't started are abandoned - wake up whoever waits for them
+    for (auto &entry : queue_) {
+      entry->failed = true;
+      entry->done = true;
+    }
+    queue_.clear();
+    entries_.clear();
+    index_.clear();
+    cached_bytes_ = 0;
+  }
+  done_cv_.notify_all();
+}
+
+void LookaheadPrefetcher::Remove(EntryList::iterator it) {
+  auto &entry = **it;
+  cached_bytes_ -= entry.size;
+  index_.erase(Key(entry.path, entry.offset, entry.size));
+  entries_.erase(it);
+}
+
+void LookaheadPrefetcher::ThreadMain() {
+  for (;;) {
+    std::shared_ptr<Entry> entry;
+    {
+      std::unique_lock<std::mutex> lock(mtx_);
+      work_cv_.wait(lock, [&]() { return !running_ || !queue_.empty(); });
+      if (!running_)
+        return;
+      entry = std::move(queue_.front());
+      queue_.pop_front();
+    }
+
+    bool failed = false;
+    try {
+      auto file = open_file_(entry->path, entry->opts, entry->file_size);
+      auto file_cleanup = AtScopeExit([&file] {
+        if (file)
+          file->Close();
+      });
+      entry->data.resize(entry->size);
+      file->SeekRead(entry->offset, SEEK_SET);
+      int64_t n_read = file->Read(entry->data.data(), entry->size);
+      failed = n_read != entry->size;
+    } catch (...) {
+      // The error is not reported here - the consumer falls back to a direct read,
+      // which reports it in the usual way.
+      failed = true;
+    }
+
+    {
+      std::lock_guard<std::mutex> g(mtx_);
+      entry->failed = failed;
+      entry->done = true;
+    }
+    done_cv_.notify_all();
+  }
+}
+
+}  // namespace dali
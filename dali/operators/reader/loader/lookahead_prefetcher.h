@@ -0,0 +1,141 @@
+// Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DALI_OPERATORS_READER_LOADER_LOOKAHEAD_PREFETCHER_H_
+#define DALI_OPERATORS_READER_LOADER_LOOKAHEAD_PREFETCHER_H_
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "dali/core/api_helper.h"
+#include "dali/util/file.h"
+
+namespace dali {
+
+/**
+ * @brief Reads byte ranges of (typically remote) files ahead of time into a bounded cache.
+ *
+ * The loaders read the samples in a deterministic order - shuffling happens later, in the
+ * Loader's sample buffer - so when a sample's read is deferred, the loader can tell which
+ * ranges will be needed next and request them with `Prefetch`. The reads are issued
+ * asynchronously by a small set of I/O threads. When the deferred read is finally executed,
+ * it calls `Take`, which waits for the prefetched data (if it's still being read) and copies it
+ * to the destination, releasing the cache space.
+ *
+ * The total size of the ranges being read or waiting to be taken never exceeds `max_bytes`.
+ * When a new range doesn't fit, the request is dropped and the sample is later read directly.
+ * Nothing is evicted to make room: the ranges are requested in the order of consumption, so
+ * the ones already in the cache are needed sooner than the new one - evicting them would only
+ * make the same data be read twice. The ranges which won't be taken anymore (e.g. after
+ * a checkpoint restore) must be discarded explicitly, with `Clear`.
+ */
+class DLL_PUBLIC LookaheadPrefetcher {
+ public:
+  /**
+   * @param open_file The function which opens the files; FileStream::Open, if empty.
+   */
+  LookaheadPrefetcher(int num_threads, int64_t max_bytes, FileStream::OpenFunc open_file = {});
+  ~LookaheadPrefetcher();
+
+  LookaheadPrefetcher(const LookaheadPrefetcher &) = delete;
+  LookaheadPrefetcher &operator=(const LookaheadPrefetcher &) = delete;
+
+  /**
+   * @brief Schedules reading `size` bytes at `offset` of the file `path`.
+   *
+   * Does nothing if the range is already scheduled or can't fit in the cache - the caller
+   * should then stop requesting the ranges needed after this one.
+   *
+   * @param file_size If provided, it's passed to FileStream::Open, avoiding a metadata query.
+   * @return true if the range is (or already was) scheduled
+   */
+  bool Prefetch(const std::string &path, int64_t offset, int64_t size,
+                FileStream::Options opts, std::optional<size_t> file_size = std::nullopt);
+
+  /**
+   * @brief Copies a prefetched range to `dst` and removes it from the cache.
+   *
+   * If the read is still in progress, waits for it to complete.
+   *
+   * @return false if the range was not scheduled or the read failed - the caller is
+   *         expected to read the data directly in that case.
+   */
+  bool Take(const std::string &path, int64_t offset, int64_t size, void *dst);
+
+  /**
+   * @brief Discards all scheduled ranges.
+   *
+   * The reads in progress are not interrupted, but their results are dropped, unless
+   * a concurrent `Take` is already waiting for them.
+   */
+  void Clear();
+
+  /**
+   * @brief Total size of the ranges which are being read or waiting to be taken.
+   */
+  int64_t CachedBytes() const;
+
+  int64_t MaxBytes() const {
+    return max_bytes_;
+  }
+
+  int64_t NumHits() const;
+
+  int64_t NumMisses() const;
+
+ private:
+  struct Entry {
+    std::string path;
+    int64_t offset = 0;
+    int64_t size = 0;
+    FileStream::Options opts = {false, false, false};
+    std::optional<size_t> file_size;
+    std::vector<uint8_t> data;
+    bool done = false;
+    bool failed = false;
+  };
+  using EntryList = std::list<std::shared_ptr<Entry>>;
+
+  static std::string Key(const std::string &path, int64_t offset, int64_t size);
+
+  void Remove(EntryList::iterator it);
+
+  void ThreadMain();
+
+  const int64_t max_bytes_;
+  FileStream::OpenFunc open_file_;
+  int64_t cached_bytes_ = 0;
+  int64_t hits_ = 0, misses_ = 0;
+  bool running_ = true;
+
+  mutable std::mutex mtx_;
+  std::condition_variable work_cv_, done_cv_;
+  EntryList entries_;  // in the order of scheduling
+  std::unordered_map<std::string, EntryList::iterator> index_;
+  std::deque<std::shared_ptr<Entry>> queue_;
+  std::vector<std::thread> threads_;
+};
+
+}  // namespace dali
+
+#endif  // DALI_OPERATORS_READER_LOADER_LOOKAHEAD_PREFETCHER_H_
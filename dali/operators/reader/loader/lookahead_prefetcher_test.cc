@@ -0,0 +1,151 @@
+// Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+#include <atomic>
+#include <cstdio>
+#include <optional>
+#include <string>
+#include <vector>
+#include "dali/operators/reader/loader/lookahead_prefetcher.h"
+
+namespace dali {
+
+namespace {
+
+class LookaheadPrefetcherTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    filename_ = "/tmp/lookahead_prefetcher_XXXXXX";
+    int fd = mkstemp(&filename_[0]);
+    ASSERT_NE(-1, fd);
+    content_.resize(kFileSize);
+    for (int i = 0; i < kFileSize; i++)
+      content_[i] = static_cast<uint8_t>(i * 7 + 3);
+    ASSERT_EQ(write(fd, content_.data(), content_.size()), kFileSize);
+    close(fd);
+  }
+
+  void TearDown() override {
+    std::remove(filename_.c_str());
+  }
+
+  void CheckRange(const std::vector<uint8_t> &out, int64_t offset) {
+    for (size_t i = 0; i < out.size(); i++)
+      ASSERT_EQ(out[i], content_[offset + i]) << " at offset " << offset + i;
+  }
+
+  static constexpr int kFileSize = 1 << 16;
+  FileStream::Options opts_ = {false, false, false};
+  std::string filename_;
+  std::vector<uint8_t> content_;
+};
+
+}  // namespace
+
+TEST_F(LookaheadPrefetcherTest, PrefetchAndTake) {
+  LookaheadPrefetcher prefetcher(4, kFileSize);
+  const int kRange = 1000;
+  for (int i = 0; i < 16; i++)
+    EXPECT_TRUE(prefetcher.Prefetch(filename_, i * kRange, kRange, opts_));
+  // scheduling the same range twice is a no-op
+  EXPECT_TRUE(prefetcher.Prefetch(filename_, 0, kRange, opts_));
+  EXPECT_EQ(prefetcher.CachedBytes(), 16 * kRange);
+
+  std::vector<uint8_t> out(kRange);
+  for (int i = 15; i >= 0; i--) {
+    ASSERT_TRUE(prefetcher.Take(filename_, i * kRange, kRange, out.data()));
+    CheckRange(out, i * kRange);
+  }
+  EXPECT_EQ(prefetcher.CachedBytes(), 0);
+  EXPECT_EQ(prefetcher.NumHits(), 16);
+
+  // already taken
+  EXPECT_FALSE(prefetcher.Take(filename_, 0, kRange, out.data()));
+  EXPECT_EQ(prefetcher.NumMisses(), 1);
+}
+
+TEST_F(LookaheadPrefetcherTest, CustomOpenFunc) {
+  std::atomic<int> opened{0};
+  LookaheadPrefetcher prefetcher(2, kFileSize,
+      [&](const std::string &uri, FileStream::Options opts, std::optional<size_t> size) {
+        opened++;
+        return FileStream::Open(uri.substr(std::string("fake://").size()), opts, size);
+      });
+  const int kRange = 1000;
+  std::string uri = "fake://" + filename_;
+  for (int i = 0; i < 4; i++)
+    EXPECT_TRUE(prefetcher.Prefetch(uri, i * kRange, kRange, opts_));
+  std::vector<uint8_t> out(kRange);
+  for (int i = 0; i < 4; i++) {
+    ASSERT_TRUE(prefetcher.Take(uri, i * kRange, kRange, out.data()));
+    CheckRange(out, i * kRange);
+  }
+  EXPECT_EQ(opened, 4);
+}
+
+TEST_F(LookaheadPrefetcherTest, BoundedSize) {
+  const int kRange = 1000;
+  LookaheadPrefetcher prefetcher(2, 4 * kRange + kRange / 2);
+  EXPECT_FALSE(prefetcher.Prefetch(filename_, 0, 5 * kRange, opts_));
+  // The budget is full after 4 ranges - the next ones are dropped, nothing is evicted
+  for (int i = 0; i < 16; i++) {
+    EXPECT_EQ(prefetcher.Prefetch(filename_, i * kRange, kRange, opts_), i < 4);
+    EXPECT_LE(prefetcher.CachedBytes(), prefetcher.MaxBytes());
+  }
+
+  std::vector<uint8_t> out(kRange);
+  ASSERT_TRUE(prefetcher.Take(filename_, 0, kRange, out.data()));
+  CheckRange(out, 0);
+  // taking a range makes room for another one
+  EXPECT_TRUE(prefetcher.Prefetch(filename_, 4 * kRange, kRange, opts_));
+  EXPECT_FALSE(prefetcher.Prefetch(filename_, 5 * kRange, kRange, opts_));
+  for (int i = 1; i < 5; i++) {
+    ASSERT_TRUE(prefetcher.Take(filename_, i * kRange, kRange, out.data()));
+    CheckRange(out, i * kRange);
+  }
+  EXPECT_FALSE(prefetcher.Take(filename_, 5 * kRange, kRange, out.data()));
+  EXPECT_EQ(prefetcher.CachedBytes(), 0);
+  EXPECT_EQ(prefetcher.NumHits(), 5);
+}
+
+TEST_F(LookaheadPrefetcherTest, Clear) {
+  const int kRange = 1000;
+  LookaheadPrefetcher prefetcher(1, 4 * kRange);
+  for (int i = 0; i < 4; i++)
+    EXPECT_TRUE(prefetcher.Prefetch(filename_, i * kRange, kRange, opts_));
+  EXPECT_FALSE(prefetcher.Prefetch(filename_, 4 * kRange, kRange, opts_));
+  prefetcher.Clear();
+  EXPECT_EQ(prefetcher.CachedBytes(), 0);
+  std::vector<uint8_t> out(kRange);
+  EXPECT_FALSE(prefetcher.Take(filename_, 0, kRange, out.data()));
+  EXPECT_TRUE(prefetcher.Prefetch(filename_, 4 * kRange, kRange, opts_));
+  ASSERT_TRUE(prefetcher.Take(filename_, 4 * kRange, kRange, out.data()));
+  CheckRange(out, 4 * kRange);
+}
+
+TEST_F(LookaheadPrefetcherTest, FailedRead) {
+  LookaheadPrefetcher prefetcher(1, kFileSize);
+  std::string missing = filename_ + "_does_not_exist";
+  EXPECT_TRUE(prefetcher.Prefetch(missing, 0, 100, opts_));
+  // reading past the end of the file
+  EXPECT_TRUE(prefetcher.Prefetch(filename_, kFileSize - 50, 100, opts_));
+  std::vector<uint8_t> out(100);
+  EXPECT_FALSE(prefetcher.Take(missing, 0, 100, out.data()));
+  EXPECT_FALSE(prefetcher.Take(filename_, kFileSize - 50, 100, out.data()));
+  EXPECT_EQ(prefetcher.CachedBytes(), 0);
+}
+
+}  // namespace dali
@@ -89,7 +89,7 @@ class RecordIOLoader : public IndexedFileLoader {
 
     int64_t seek_pos, size;
     size_t file_index;
-    std::tie(seek_pos, size, file_index) = indices_[current_index_];
+    std::tie(seek_pos, size, file_index) = indices_[SampleIndex(current_index_)];
 
     ++current_index_;
 
@@ -109,7 +109,7 @@ class RecordIOLoader : public IndexedFileLoader {
     }
 
     // Reopen the correct file when the index jumps to a different one.
-    // This is needed when shuffle_after_epoch reorders records across files.
+    // This is needed when shuffle_after_epoch or global_shuffle reorders records across files.
     if (file_index != current_file_index_) {
       current_file_.reset();
       FileStream::Options switch_opts;
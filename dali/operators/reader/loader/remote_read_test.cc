@@ -0,0 +1,220 @@
+// Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fcntl.h>
+#include <gtest/gtest.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+#include "dali/operators/reader/loader/filesystem.h"
+#include "dali/operators/reader/loader/indexed_file_loader.h"
+#include "dali/operators/reader/loader/webdataset/tar_utils.h"
+#include "dali/test/dali_test_config.h"
+#include "dali/util/remote_file.h"
+
+namespace dali {
+
+namespace {
+
+/**
+ * @brief Serves the local files as remote objects, `fakes3://<path>`, counting the requests.
+ *
+ * The streams are the same as the ones reading from S3 - only the range requests differ.
+ */
+class FakeObjectStore {
+ public:
+  FakeObjectStore(const RangeReader::Options &opts, bool shared_cache) : opts_(opts) {
+    if (shared_cache)
+      cache_ = std::make_shared<BlockCache>(opts.block_size, opts.max_cached_blocks);
+  }
+
+  int64_t requests() const { return requests_; }
+  int64_t fetched_bytes() const { return fetched_bytes_; }
+
+  /** The function which opens the objects, to be passed to the loaders */
+  FileStream::OpenFunc OpenFunc() {
+    return [this](const std::string &uri, FileStream::Options, std::optional<size_t>) {
+      return Open(uri);
+    };
+  }
+
+  std::unique_ptr<FileStream> Open(const std::string &uri) {
+    std::string path = uri.substr(std::string("fakes3://").size());
+    int fd = open(path.c_str(), O_RDONLY);
+    DALI_ENFORCE(fd >= 0, make_string("Cannot open ", path));
+    std::shared_ptr<int> fd_guard(new int(fd), [](int *fd) {
+      close(*fd);
+      delete fd;
+    });
+    struct stat st;
+    DALI_ENFORCE(fstat(fd, &st) == 0);
+    auto fetch = [this, fd_guard](void *buf, size_t n, size_t offset) -> size_t {
+      ssize_t ret = pread(*fd_guard, buf, n, offset);
+      DALI_ENFORCE(ret >= 0, "Read failed.");
+      requests_++;
+      fetched_bytes_ += ret;
+      return ret;
+    };
+    return std::make_unique<RemoteFileStream>(uri, fetch, st.st_size, opts_, cache_);
+  }
+
+ private:
+  RangeReader::Options opts_;
+  std::shared_ptr<BlockCache> cache_;
+  std::atomic<int64_t> requests_{0}, fetched_bytes_{0};
+};
+
+RangeReader::Options TestOptions(bool detect_sequential) {
+  RangeReader::Options opts;
+  opts.block_size = 16 << 10;
+  opts.max_cached_blocks = 8;
+  opts.detect_sequential = detect_sequential;
+  return opts;
+}
+
+class RemoteTFRecordTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    data_path_ = "/tmp/remote_records_XXXXXX";
+    index_path_ = "/tmp/remote_index_XXXXXX";
+    int data_fd = mkstemp(&data_path_[0]);
+    ASSERT_NE(data_fd, -1);
+    int index_fd = mkstemp(&index_path_[0]);
+    ASSERT_NE(index_fd, -1);
+    content_.resize(kNumRecords * kRecordSize);
+    for (size_t i = 0; i < content_.size(); i++)
+      content_[i] = static_cast<uint8_t>(i * 7 + 3);
+    // each record starts with its index
+    for (int r = 0; r < kNumRecords; r++)
+      std::memcpy(&content_[r * kRecordSize], &r, sizeof(r));
+    ASSERT_EQ(write(data_fd, content_.data(), content_.size()),
+              static_cast<ssize_t>(content_.size()));
+    close(data_fd);
+    std::string index;
+    for (int r = 0; r < kNumRecords; r++)
+      index += make_string(r * kRecordSize, ' ', kRecordSize, '\n');
+    ASSERT_EQ(write(index_fd, index.data(), index.size()), static_cast<ssize_t>(index.size()));
+    close(index_fd);
+  }
+
+  void TearDown() override {
+    std::remove(data_path_.c_str());
+    std::remove(index_path_.c_str());
+  }
+
+  /** Reads one epoch with a TFRecord loader, executing the deferred reads. */
+  void ReadEpoch(FakeObjectStore &store, bool global_shuffle) {
+    IndexedFileLoader loader(
+        OpSpec("TFRecordReader")
+        .AddArg("path", std::vector<std::string>{ "fakes3://" + data_path_ })
+        .AddArg("index_path", std::vector<std::string>{ index_path_ })
+        .AddArg("max_batch_size", 8)
+        .AddArg("device_id", 0)
+        .AddArg("dont_use_mmap", true)
+        .AddArg("global_shuffle", global_shuffle),
+        store.OpenFunc());
+    loader.PrepareMetadata();
+    std::vector<bool> seen(kNumRecords);
+    for (int i = 0; i < kNumRecords; i++) {
+      auto sample = loader.ReadOne(i % 8 == 0, i % 8 == 7);
+      ASSERT_TRUE(sample->work);
+      sample->work();
+      ASSERT_EQ(sample->tensor.shape(), TensorShape<>{kRecordSize});
+      auto *data = sample->tensor.data<uint8_t>();
+      int r;
+      std::memcpy(&r, data, sizeof(r));
+      ASSERT_TRUE(r >= 0 && r < kNumRecords && !seen[r]) << "Unexpected record " << r;
+      seen[r] = true;
+      ASSERT_EQ(std::memcmp(data, &content_[r * kRecordSize], kRecordSize), 0)
+          << "Record " << r << " differs.";
+    }
+  }
+
+  static constexpr int kNumRecords = 256;
+  static constexpr int kRecordSize = 1000;
+  std::string data_path_, index_path_;
+  std::vector<uint8_t> content_;
+};
+
+}  // namespace
+
+/* The loader opens a new stream for every record. With a block cache per stream, every record
+   cost a request for a whole block; with the shared cache, it's one request per block. */
+TEST_F(RemoteTFRecordTest, SequentialRecords) {
+  int64_t per_stream_bytes;
+  {
+    FakeObjectStore store(TestOptions(false), false);
+    ReadEpoch(store, false);
+    EXPECT_EQ(store.requests(), kNumRecords);
+    per_stream_bytes = store.fetched_bytes();
+  }
+  {
+    FakeObjectStore store(TestOptions(true), true);
+    ReadEpoch(store, false);
+    int64_t size = content_.size();
+    int64_t num_blocks = (size + (16 << 10) - 1) / (16 << 10);
+    // the first record is read directly - it's not known to be followed by the next ones
+    EXPECT_LE(store.requests(), num_blocks + 1);
+    EXPECT_LE(store.fetched_bytes(), size + kRecordSize);
+    EXPECT_LT(store.fetched_bytes() * 4, per_stream_bytes);
+  }
+}
+
+/* In random order, the records are fetched individually, without rounding up to whole blocks. */
+TEST_F(RemoteTFRecordTest, ShuffledRecords) {
+  FakeObjectStore store(TestOptions(true), true);
+  ReadEpoch(store, true);
+  int64_t size = content_.size();
+  // occasionally, two records read one after another are adjacent and go through the cache
+  EXPECT_LE(store.fetched_bytes(), 2 * size);
+  EXPECT_LE(store.requests(), kNumRecords);
+}
+
+TEST(RemoteWebdatasetTest, TarArchive) {
+  std::string path = filesystem::join_path(testing::dali_extra_path(),
+                                           "db/webdataset/MNIST/devel-0.tar");
+  FakeObjectStore store(TestOptions(true), true);
+  detail::TarArchive local(FileStream::Open(path));
+  detail::TarArchive remote(store.Open("fakes3://" + path));
+  int num_files = 0;
+  while (!local.EndOfArchive()) {
+    ASSERT_FALSE(remote.EndOfArchive());
+    ASSERT_EQ(remote.GetFileName(), local.GetFileName());
+    ASSERT_EQ(remote.GetFileSize(), local.GetFileSize());
+    std::vector<uint8_t> expected(local.GetFileSize()), actual(remote.GetFileSize());
+    ASSERT_EQ(local.Read(expected.data(), expected.size()), expected.size());
+    ASSERT_EQ(remote.Read(actual.data(), actual.size()), actual.size());
+    ASSERT_EQ(actual, expected) << "File " << local.GetFileName();
+    local.NextFile();
+    remote.NextFile();
+    num_files++;
+  }
+  EXPECT_TRUE(remote.EndOfArchive());
+  EXPECT_GT(num_files, 0);
+
+  struct stat st;
+  ASSERT_EQ(stat(path.c_str(), &st), 0);
+  int64_t num_blocks = (st.st_size + (16 << 10) - 1) / (16 << 10);
+  // the headers and the files are read with one request per block, not per read
+  EXPECT_LE(store.requests(), num_blocks + 2);
+  EXPECT_LE(store.fetched_bytes(), st.st_size + (16 << 10));
+}
+
+}  // namespace dali
@@ -243,9 +243,12 @@ WebdatasetLoader::WebdatasetLoader(const OpSpec& spec)
   int64_t seed_arg = kDaliDataloaderSeed;
   bool has_seed_arg = spec.TryGetArgument(seed_arg, "shuffle_after_epoch_seed");
   shuffle_after_epoch_seed_ = seed_arg;
-  if (has_seed_arg && !shuffle_after_epoch_) {
-    DALI_WARN("`shuffle_after_epoch_seed` has no effect when `shuffle_after_epoch` is False.");
+  if (has_seed_arg && !shuffle_after_epoch_ && !GlobalShuffleRequested()) {
+    DALI_WARN("`shuffle_after_epoch_seed` has no effect when neither `shuffle_after_epoch` "
+              "nor `global_shuffle` is True.");
   }
+  if (GlobalShuffleRequested())
+    EnableGlobalShuffle(shuffle_after_epoch_);
   DALI_ENFORCE(!(shuffle_after_epoch_ && stick_to_shard_),
                "shuffle_after_epoch and stick_to_shard cannot be both true");
   if (shuffle_after_epoch_) {
@@ -305,7 +308,7 @@ std::string WebdatasetLoader::GetSampleSource(const detail::wds::SampleDesc& sam
 
 void WebdatasetLoader::ReadSample(vector<Tensor<CPUBackend>>& sample) {
   MoveToNextShard(sample_index_);
-  detail::wds::SampleDesc& current_sample = samples_[sample_index_];
+  detail::wds::SampleDesc& current_sample = samples_[SampleIndex(sample_index_)];
   auto& current_wds_shard = wds_shards_[current_sample.wds_shard_index];
 
   for (auto& component : current_sample.components) {
@@ -512,6 +515,8 @@ void WebdatasetLoader::PrepareMetadataImpl() {
       per_shard_samples_[s.wds_shard_index].push_back(s);
     }
     Reset(true);
+  } else if (global_shuffle_) {
+    Reset(true);
   } else {
     // Preserve the original shard_id_-based start position when not shuffling.
     sample_index_ = start_index(shard_id_, num_shards_, samples_.size());
@@ -536,6 +541,7 @@ void WebdatasetLoader::Reset(bool wrap_to_shard) {
       }
     }
   }
+  ShuffleGlobally(shuffle_after_epoch_seed_, current_epoch_);
   sample_index_ = wrap_to_shard ? start_index(virtual_shard_id_, num_shards_, samples_.size()) : 0;
 }
 
@@ -543,4 +549,21 @@ void WebdatasetLoader::RestoreStateImpl(const LoaderStateSnapshot &state) {
   current_epoch_ = state.current_epoch;
 }
 
+bool WebdatasetLoader::SupportsRandomAccess() const {
+  return true;
+}
+
+LoaderReadPosition WebdatasetLoader::GetReadPosition() const {
+  return {current_epoch_, static_cast<Index>(sample_index_)};
+}
+
+void WebdatasetLoader::SetReadPosition(const LoaderReadPosition &pos) {
+  if (pos.epoch != current_epoch_) {
+    // the order of the samples depends only on the epoch
+    current_epoch_ = pos.epoch - 1;
+    Reset(true);
+  }
+  sample_index_ = pos.index;
+}
+
 }  // namespace dali
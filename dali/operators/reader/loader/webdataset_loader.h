@@ -102,6 +102,9 @@ class DLL_PUBLIC WebdatasetLoader : public Loader<CPUBackend, vector<Tensor<CPUB
   void PrepareMetadataImpl() override;
   void Reset(bool wrap_to_shard) override;
   void RestoreStateImpl(const LoaderStateSnapshot &state) override;
+  bool SupportsRandomAccess() const override;
+  LoaderReadPosition GetReadPosition() const override;
+  void SetReadPosition(const LoaderReadPosition &pos) override;
 
   std::vector<std::string> paths_;
   std::vector<std::string> index_paths_;
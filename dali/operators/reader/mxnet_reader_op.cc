@@ -56,7 +56,8 @@ properties.
     global file-order shuffle across all shards.
 
 .. note::
-    This argument has no effect unless ``shuffle_after_epoch`` is set to ``True``.)code",
+    This argument has no effect unless ``shuffle_after_epoch`` or ``global_shuffle``
+    is set to ``True``.)code",
       nullptr, false)
   .AddParent("LoaderBase");
 
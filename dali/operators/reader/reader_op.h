@@ -16,6 +16,7 @@
 #define DALI_OPERATORS_READER_READER_OP_H_
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <memory>
 #include <optional>
@@ -26,6 +27,7 @@
 #include <unordered_map>
 
 #include "dali/core/nvtx.h"
+#include "dali/core/exec/timeline.h"
 #include "dali/operators/reader/loader/loader.h"
 #include "dali/operators/reader/parser/parser.h"
 #include "dali/pipeline/operator/checkpointing/snapshot_serializer.h"
@@ -77,6 +79,8 @@ class DataReader : public Operator<Backend> {
           if (std::is_same<Backend, GPUBackend>::value) {
             device_id_ = spec.GetArgument<int>("device_id");
           }
+          this->RegisterDiagnostic("starved_batches", &starved_batches_);
+          this->RegisterDiagnostic("starvation_time_ns", &starvation_time_ns_);
         }
 
   ~DataReader() noexcept override {
@@ -141,10 +145,13 @@ class DataReader : public Operator<Backend> {
   // Main prefetch work loop
   void PrefetchWorker() {
     SetThreadName(make_string("PrefetchWorker ", spec_.SchemaName()).c_str());
+    int timeline_name = TimelineTracer::instance().Intern(
+        make_string("Prefetch ", spec_.SchemaName()));
     DeviceGuard g(device_id_);
     ProducerWait();
     while (!finished_) {
       try {
+        TimelineScope timeline_scope(timeline_name, TimelineCategory::Reader);
         Prefetch();
       } catch (const std::exception& e) {
         ProducerStop(std::current_exception());
@@ -390,7 +397,19 @@ class DataReader : public Operator<Backend> {
     DomainTimeRange tr("[DALI][DataReader] ConsumerWait #" + to_string(curr_batch_consumer_),
                  DomainTimeRange::kMagenta);
     std::unique_lock<std::mutex> prefetch_lock(prefetch_access_mutex_);
-    consumer_.wait(prefetch_lock, [this]() { return finished_ || !IsPrefetchQueueEmpty(); });
+    if (!finished_ && IsPrefetchQueueEmpty()) {
+      // The prefetching thread didn't keep up - the reader is starved
+      auto start = std::chrono::steady_clock::now();
+      consumer_.wait(prefetch_lock, [this]() { return finished_ || !IsPrefetchQueueEmpty(); });
+      // The first batch is always awaited, as the prefetching has just started - it's not
+      // counted as starvation
+      if (warmed_up_) {
+        starved_batches_++;
+        starvation_time_ns_ += std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start).count();
+      }
+    }
+    warmed_up_ = true;
     if (prefetch_error_) std::rethrow_exception(prefetch_error_);
   }
 
@@ -447,6 +466,13 @@ class DataReader : public Operator<Backend> {
   // keep track of how many samples have been processed over all threads.
   std::atomic<int> samples_processed_;
 
+  // the number of batches for which the consumer had to wait and the total waiting time;
+  // updated by the consumer, exposed as diagnostics
+  int64_t starved_batches_ = 0;
+  int64_t starvation_time_ns_ = 0;
+  // whether the first batch has been awaited
+  bool warmed_up_ = false;
+
   // stores any catched exceptions in the prefetch worker
   std::exception_ptr prefetch_error_;
 
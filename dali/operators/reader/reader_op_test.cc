@@ -155,6 +155,26 @@ TYPED_TEST(ReaderTest, PrefetchQueueTest) {
   return;
 }
 
+TYPED_TEST(ReaderTest, FirstBatchIsNotStarvation) {
+  // A single iteration, run synchronously - the reader waits only for the first batch
+  Pipeline pipe(128, 1, 0, -1, false, 1, false);
+
+  pipe.AddOperator(
+      OpSpec("DummyDataReader")
+      .AddOutput("data_out", StorageDevice::CPU), "reader");
+
+  std::vector<std::pair<string, string>> outputs = {{"data_out", "cpu"}};
+  pipe.Build(outputs);
+
+  Workspace ws;
+  pipe.Run();
+  pipe.Outputs(&ws);
+  auto *reader = pipe.GetOperator("reader");
+  ASSERT_NE(reader, nullptr);
+  EXPECT_EQ(reader->GetDiagnostic<int64_t>("starved_batches"), 0);
+  EXPECT_EQ(reader->GetDiagnostic<int64_t>("starvation_time_ns"), 0);
+}
+
 TYPED_TEST(ReaderTest, LazyInitTest) {
   Pipeline eager_pipe(32, 1, 0);
   Pipeline lazy_pipe(32, 1, 0);
@@ -178,7 +178,8 @@ properties.
     global shard-order shuffle across all shards.
 
 .. note::
-    This argument has no effect unless ``shuffle_after_epoch`` is set to ``True``.)code",
+    This argument has no effect unless ``shuffle_after_epoch`` or ``global_shuffle``
+    is set to ``True``.)code",
         nullptr, false)
     .AddParent("LoaderBase");
 
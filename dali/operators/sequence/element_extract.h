@@ -87,8 +87,13 @@ class ElementExtract : public StatelessOperator<Backend> {
     const auto &input = ws.Input<Backend>(0);
     output_desc.resize(element_map_.size());
     auto output_shape = detail::GetOutputShape(input.shape(), element_map_, input.GetLayout());
-    for (auto &desc : output_desc) {
-      desc.shape = output_shape;
+    for (int k = 0; k < static_cast<int>(output_desc.size()); k++) {
+      auto &desc = output_desc[k];
+      // The unused outputs are not extracted - they consist of empty samples
+      if (this->IsOutputUsed(k))
+        desc.shape = output_shape;
+      else
+        desc.shape = TensorListShape<>(output_shape.num_samples(), output_shape.sample_dim());
       desc.type = input.type();
     }
     return true;
@@ -102,6 +107,9 @@ class ElementExtract : public StatelessOperator<Backend> {
     for (int k = 0; k < elements_per_sample; k++) {
       int element = element_map_[k];
       auto &output = ws.Output<Backend>(k);
+      output.SetLayout(element_layout);
+      if (!this->IsOutputUsed(k))
+        continue;
       for (int i = 0; i < input.num_samples(); i++) {
         auto tensor_shape = input.tensor_shape(i);
         auto element_size = volume(tensor_shape.begin() + 1, tensor_shape.end());
@@ -111,7 +119,6 @@ class ElementExtract : public StatelessOperator<Backend> {
             static_cast<const uint8_t *>(input.raw_tensor(i)) + input_offset_bytes,
             element_size * data_type.size());
       }
-      output.SetLayout(element_layout);
     }
     RunCopies(ws);
   }
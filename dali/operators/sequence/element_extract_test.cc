@@ -13,8 +13,15 @@
 // limitations under the License.
 
 #include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
 #include "dali/test/dali_operator_test.h"
 #include "dali/pipeline/data/tensor.h"
+#include "dali/pipeline/operator/operator.h"
+#include "dali/pipeline/pipeline.h"
+#include "dali/pipeline/util/thread_pool.h"
 
 namespace dali {
 namespace testing {
@@ -153,6 +160,124 @@ TYPED_TEST(ElementExtractGPUTest, DISABLED_ExtractEvenElement) {
     this->Run(EvenNumbersTill(this->F_));
 }
 
+namespace {
+
+constexpr int kUnusedTestBatchSize = 3;
+constexpr int kUnusedTestFrames = 6;
+const std::vector<int> kUnusedTestElementMap = {1, 3, 5};
+
+/** Sequences of different frame sizes; the values encode the sample, frame and position. */
+std::shared_ptr<TensorList<CPUBackend>> MakeSequences() {
+    auto data = std::make_shared<TensorList<CPUBackend>>();
+    TensorListShape<> shape(kUnusedTestBatchSize, 4);
+    for (int i = 0; i < kUnusedTestBatchSize; i++)
+        shape.set_tensor_shape(i, TensorShape<>{kUnusedTestFrames, 2 + i, 3, 2});
+    data->Resize(shape, DALI_INT32);
+    data->SetLayout("FHWC");
+    for (int i = 0; i < kUnusedTestBatchSize; i++) {
+        auto *sample = data->mutable_tensor<int32_t>(i);
+        int64_t frame_size = volume(shape.tensor_shape_span(i)) / kUnusedTestFrames;
+        for (int f = 0; f < kUnusedTestFrames; f++)
+            for (int64_t k = 0; k < frame_size; k++)
+                sample[f * frame_size + k] = i * 10000 + f * 100 + k;
+    }
+    return data;
+}
+
+void CheckExtracted(const TensorList<CPUBackend> &out, int element) {
+    ASSERT_EQ(out.num_samples(), kUnusedTestBatchSize);
+    EXPECT_EQ(out.GetLayout(), "HWC");
+    for (int i = 0; i < kUnusedTestBatchSize; i++) {
+        ASSERT_EQ(out.tensor_shape(i), TensorShape<>(2 + i, 3, 2));
+        const auto *data = out.tensor<int32_t>(i);
+        for (int64_t k = 0; k < volume(out.tensor_shape(i)); k++)
+            ASSERT_EQ(data[k], i * 10000 + element * 100 + k) << "sample " << i << " index " << k;
+    }
+}
+
+/** A pipeline extracting three frames, which returns only the outputs listed in `used` */
+std::unique_ptr<Pipeline> ElementExtractPipeline(const std::vector<int> &used) {
+    auto pipe = std::make_unique<Pipeline>(kUnusedTestBatchSize, 1, CPU_ONLY_DEVICE_ID, 42);
+    pipe->AddExternalInput("seq");
+    pipe->AddOperator(OpSpec("ElementExtract")
+                      .AddArg("device", "cpu")
+                      .AddArg("element_map", kUnusedTestElementMap)
+                      .AddInput("seq", StorageDevice::CPU)
+                      .AddOutput("e0", StorageDevice::CPU)
+                      .AddOutput("e1", StorageDevice::CPU)
+                      .AddOutput("e2", StorageDevice::CPU), "extract");
+    std::vector<std::pair<std::string, std::string>> outputs;
+    for (int k : used)
+        outputs.emplace_back(make_string("e", k), "cpu");
+    pipe->Build(outputs);
+    return pipe;
+}
+
+}  // namespace
+
+TEST(ElementExtractUnusedOutputTest, PipelineOutputsUnchanged) {
+    auto seq = MakeSequences();
+    auto full = ElementExtractPipeline({0, 1, 2});
+    auto partial = ElementExtractPipeline({0, 2});
+    EXPECT_EQ(full->GetGraphOptimizationStats().unused_outputs, 0);
+    EXPECT_EQ(partial->GetGraphOptimizationStats().unused_outputs, 1);
+    auto *op = partial->GetOperator("extract");
+    ASSERT_NE(op, nullptr);
+    EXPECT_TRUE(op->IsOutputUsed(0));
+    EXPECT_FALSE(op->IsOutputUsed(1));
+    EXPECT_TRUE(op->IsOutputUsed(2));
+
+    Workspace full_ws, partial_ws;
+    for (auto *p : {full.get(), partial.get()}) {
+        p->SetExternalInput("seq", *seq);
+        p->Run();
+    }
+    full->Outputs(&full_ws);
+    partial->Outputs(&partial_ws);
+    ASSERT_EQ(full_ws.NumOutput(), 3);
+    ASSERT_EQ(partial_ws.NumOutput(), 2);
+    for (int k = 0; k < 3; k++)
+        CheckExtracted(full_ws.Output<CPUBackend>(k), kUnusedTestElementMap[k]);
+    CheckExtracted(partial_ws.Output<CPUBackend>(0), kUnusedTestElementMap[0]);
+    CheckExtracted(partial_ws.Output<CPUBackend>(1), kUnusedTestElementMap[2]);
+}
+
+TEST(ElementExtractUnusedOutputTest, UnusedOutputIsEmpty) {
+    auto spec = OpSpec("ElementExtract")
+        .AddArg("device", "cpu")
+        .AddArg("max_batch_size", kUnusedTestBatchSize)
+        .AddArg("num_threads", 1)
+        .AddArg("element_map", kUnusedTestElementMap)
+        .AddArg("_unused_outputs", std::vector<int>{1})
+        .AddInput("seq", StorageDevice::CPU)
+        .AddOutput("e0", StorageDevice::CPU)
+        .AddOutput("e1", StorageDevice::CPU)
+        .AddOutput("e2", StorageDevice::CPU);
+    auto op = InstantiateOperator(spec);
+
+    OldThreadPool tp(1, CPU_ONLY_DEVICE_ID, false, "ElementExtractTest");
+    Workspace ws;
+    ws.SetThreadPool(&tp);
+    ws.AddInput(MakeSequences());
+    for (int k = 0; k < 3; k++)
+        ws.AddOutput(std::make_shared<TensorList<CPUBackend>>());
+    ws.SetBatchSizes(kUnusedTestBatchSize);
+    std::vector<OutputDesc> output_descs;
+    ASSERT_TRUE(op->Setup(output_descs, ws));
+    ASSERT_EQ(output_descs.size(), 3u);
+    for (int k = 0; k < 3; k++)
+        ws.Output<CPUBackend>(k).Resize(output_descs[k].shape, output_descs[k].type);
+    op->Run(ws);
+
+    CheckExtracted(ws.Output<CPUBackend>(0), kUnusedTestElementMap[0]);
+    CheckExtracted(ws.Output<CPUBackend>(2), kUnusedTestElementMap[2]);
+    auto &unused = ws.Output<CPUBackend>(1);
+    ASSERT_EQ(unused.num_samples(), kUnusedTestBatchSize);
+    EXPECT_EQ(unused.type(), DALI_INT32);
+    EXPECT_EQ(unused.sample_dim(), 3);
+    for (int i = 0; i < kUnusedTestBatchSize; i++)
+        EXPECT_EQ(volume(unused.tensor_shape(i)), 0);
+}
 
 }  // namespace testing
 }  // namespace dali
@@ -28,6 +28,7 @@
 #include "dali/core/span.h"
 #include "dali/kernels/common/copy.h"
 #include "dali/kernels/common/memset.h"
+#include "dali/operators/video/frames_decoder_cpu.h"
 #include "dali/operators/video/video_utils.h"
 #include "dali/pipeline/operator/arg_helper.h"
 #include "dali/pipeline/operator/common.h"
@@ -62,8 +63,17 @@ class DLL_PUBLIC VideoDecoderBase : public Operator<Backend> {
     DALI_ENFORCE(!(sequence_length_.HasValue() && end_frame_.HasValue()),
                  "Cannot specify both `sequence_length` and `end_frame` arguments");
 
+    if constexpr (std::is_same_v<Backend, CPUBackend>) {
+      codec_threads_ = spec_.template GetArgument<int>("codec_threads");
+      DALI_ENFORCE(codec_threads_ >= 0,
+                   make_string("codec_threads must be non-negative, got ", codec_threads_));
+      codec_thread_type_ =
+          ParseCodecThreadType(spec_.template GetArgument<std::string>("codec_thread_type"));
+    }
+
     boundary_type_ = GetBoundaryType(spec_);
     build_index_ = spec_.template GetArgument<bool>("build_index");
+    this->RegisterDiagnostic("decoded_samples", &decoded_samples_);
 
     if (boundary_type_ == boundary::BoundaryType::CONSTANT) {
       auto tmp = spec_.template GetRepeatedArgument<int>("fill_value");
@@ -92,14 +102,27 @@ class DLL_PUBLIC VideoDecoderBase : public Operator<Backend> {
 
   std::unique_ptr<FramesDecoderImpl> CreateDecoder(const char *data, size_t size, bool build_index,
                                                    std::string_view source_info,
-                                                   cudaStream_t stream = 0) {
+                                                   cudaStream_t stream = 0,
+                                                   CodecThreadingParams threading = {}) {
     if constexpr (std::is_same_v<Backend, CPUBackend>) {
-      return std::make_unique<FramesDecoderImpl>(data, size, source_info);
+      return std::make_unique<FramesDecoderImpl>(data, size, source_info, DALI_RGB, threading);
     } else {
       return std::make_unique<FramesDecoderImpl>(data, size, source_info, stream);
     }
   }
 
+  /**
+   * @brief Returns the codec threading configuration for a batch of a given size
+   *
+   * See SplitCodecThreads.
+   */
+  CodecThreadingParams GetCodecThreading(int num_pool_threads, int batch_size) const {
+    CodecThreadingParams threading;
+    threading.thread_type = codec_thread_type_;
+    threading.num_threads = codec_threads_;
+    return SplitCodecThreads(threading, num_pool_threads, batch_size);
+  }
+
   void AcquireArguments(const Workspace &ws, int batch_size) {
     if (start_frame_.HasValue())
       start_frame_.Acquire(spec_, ws, batch_size);
@@ -234,6 +257,7 @@ class DLL_PUBLIC VideoDecoderBase : public Operator<Backend> {
     // Create decoders in parallel
     ThreadPool &thread_pool = GetThreadPool(ws);
     ctx_.resize(thread_pool.NumThreads());
+    auto codec_threading = GetCodecThreading(thread_pool.NumThreads(), batch_size);
     TensorListShape<4> out_shape(batch_size);
     for (int s = 0; s < batch_size; ++s) {
       thread_pool.AddWork(
@@ -242,7 +266,8 @@ class DLL_PUBLIC VideoDecoderBase : public Operator<Backend> {
             size_t size = input[s].shape().num_elements();
             auto source_info = input.GetMeta(s).GetSourceInfo();
             frames_decoders_[s] = CreateDecoder(data, size, build_index_, source_info,
-                                                ws.has_stream() ? ws.stream() : 0);
+                                                ws.has_stream() ? ws.stream() : 0,
+                                                codec_threading);
             DALI_ENFORCE(frames_decoders_[s]->IsValid(),
                          make_string("Failed to create video decoder for \"",
                                      frames_decoders_[s]->Filename(), "\""));
@@ -279,6 +304,7 @@ class DLL_PUBLIC VideoDecoderBase : public Operator<Backend> {
     auto &output = ws.Output<OutBackend>(0);
     const auto &input = ws.Input<InBackend>(0);
     int batch_size = input.num_samples();
+    decoded_samples_ += batch_size;
 
     output.SetLayout("FHWC");
 
@@ -331,6 +357,10 @@ class DLL_PUBLIC VideoDecoderBase : public Operator<Backend> {
   ArgValue<int> end_frame_{"end_frame", spec_};
   ArgValue<int, 1> frames_{"frames", spec_};
   bool build_index_;
+  int codec_threads_ = 1;
+  int codec_thread_type_ = FF_THREAD_FRAME | FF_THREAD_SLICE;
+  // the number of samples decoded so far; exposed as a diagnostic, which marks the decoders
+  int64_t decoded_samples_ = 0;
 
   std::vector<WorkerContext> ctx_;
 };
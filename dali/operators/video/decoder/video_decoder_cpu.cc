@@ -136,6 +136,22 @@ Example 5: Pad the sequence with a constant RGB value of (118, 185, 0), until 10
 If True, each thread in the internal thread pool will be pinned to a specific CPU core.
 If False, threads can migrate between cores based on OS scheduling.)code",
                     true)
+    .AddOptionalArg("codec_threads",
+                    R"code(Number of libavcodec threads used to decode a single video (CPU backend only).
+
+If 0, the threads of the operator's thread pool are divided between the samples of the batch,
+so that a batch with fewer videos than threads still uses all the cores.
+If 1, each video is decoded on a single thread and only different videos of the batch are decoded
+in parallel.)code",
+                    1)
+    .AddOptionalArg("codec_thread_type",
+                    R"code(Kind of threading used by libavcodec when ``codec_threads`` is not 1 (CPU backend only).
+
+* ``'frame'``: Decode several consecutive frames at once.
+* ``'slice'``: Decode the slices of a single frame in parallel (only applies to videos encoded
+  with multiple slices).
+* ``'frame_slice'``: Use both, as supported by the codec.)code",
+                    std::string("frame_slice"))
     .AddOptionalArg<std::vector<int>>(
         "frames",
         R"code(Specifies which frames to extract from each video by their indices.
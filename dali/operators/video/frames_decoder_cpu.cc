@@ -24,13 +24,35 @@
 
 namespace dali {
 
-FramesDecoderCpu::FramesDecoderCpu(const std::string &filename, DALIImageType image_type)
-    : FramesDecoderBase(filename, image_type) {
+int ParseCodecThreadType(const std::string &thread_type) {
+  if (thread_type == "frame")
+    return FF_THREAD_FRAME;
+  if (thread_type == "slice")
+    return FF_THREAD_SLICE;
+  if (thread_type == "frame_slice")
+    return FF_THREAD_FRAME | FF_THREAD_SLICE;
+  DALI_FAIL(make_string("Invalid codec thread type: '", thread_type,
+                        "'. Valid values are: 'frame', 'slice', 'frame_slice'."));
+}
+
+CodecThreadingParams SplitCodecThreads(CodecThreadingParams threading,
+                                       int num_pool_threads, int num_videos) {
+  if (threading.num_threads == 0)
+    threading.num_threads = std::max(1, num_pool_threads / std::max(1, num_videos));
+  return threading;
+}
+
+FramesDecoderCpu::FramesDecoderCpu(const std::string &filename, DALIImageType image_type,
+                                   CodecThreadingParams threading)
+    : FramesDecoderBase(filename, image_type), threading_(threading) {
   is_valid_ = is_valid_ && SelectVideoStream();
 }
 
-FramesDecoderCpu::FramesDecoderCpu(const char *memory_file, size_t memory_file_size, std::string_view source_info, DALIImageType image_type)
-  : FramesDecoderBase(memory_file, memory_file_size, source_info, image_type) {
+FramesDecoderCpu::FramesDecoderCpu(const char *memory_file, size_t memory_file_size,
+                                   std::string_view source_info, DALIImageType image_type,
+                                   CodecThreadingParams threading)
+  : FramesDecoderBase(memory_file, memory_file_size, source_info, image_type),
+    threading_(threading) {
   is_valid_ = is_valid_ && SelectVideoStream();
 }
 
@@ -243,6 +265,16 @@ bool FramesDecoderCpu::SelectVideoStream(int stream_id) {
   DALI_ENFORCE(ret >= 0, make_string("Could not fill the codec based on parameters: ",
                                      av_error_string(ret)));
 
+  // Threading has to be configured before the codec is opened. libavcodec falls back to
+  // single-threaded decoding for the codecs which don't support the requested thread type.
+  DALI_ENFORCE(threading_.num_threads >= 0,
+               make_string("Number of codec threads must be non-negative, got ",
+                           threading_.num_threads));
+  codec_ctx_->thread_count = threading_.num_threads;
+  codec_ctx_->thread_type = threading_.thread_type;
+  LOG_LINE << "Codec threading: thread_count=" << codec_ctx_->thread_count
+           << ", thread_type=" << codec_ctx_->thread_type << std::endl;
+
   ret = avcodec_open2(codec_ctx_, codec_, nullptr);
   if (ret != 0) {
     DALI_WARN(make_string("Could not initialize codec context: ", av_error_string(ret)));
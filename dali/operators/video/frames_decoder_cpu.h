@@ -21,6 +21,42 @@
 
 namespace dali {
 
+/**
+ * @brief Threading configuration of the libavcodec decoder used by FramesDecoderCpu.
+ */
+struct CodecThreadingParams {
+  /**
+   * @brief Number of threads used by libavcodec to decode a single video.
+   *
+   * 1 disables codec threading, 0 lets libavcodec pick the number of threads
+   * based on the number of available cores.
+   */
+  int num_threads = 1;
+  /**
+   * @brief Combination of FF_THREAD_FRAME and FF_THREAD_SLICE.
+   *
+   * Frame threading decodes several frames at once, at the cost of a decoding delay
+   * of num_threads - 1 frames. Slice threading splits a single frame between the threads,
+   * but only helps with videos encoded with multiple slices.
+   */
+  int thread_type = FF_THREAD_FRAME | FF_THREAD_SLICE;
+};
+
+/**
+ * @brief Parses codec thread type, as passed to the operators ("frame", "slice" or "frame_slice").
+ */
+int ParseCodecThreadType(const std::string &thread_type);
+
+/**
+ * @brief Resolves the codec threading for videos decoded concurrently on a pool of threads.
+ *
+ * With num_threads=0, the threads of the pool are split evenly between the videos, so that a few
+ * long clips are decoded with codec-level parallelism, while at least as many videos as threads
+ * are decoded with one thread per video. Other values are returned unchanged.
+ */
+CodecThreadingParams SplitCodecThreads(CodecThreadingParams threading,
+                                       int num_pool_threads, int num_videos);
+
 class DLL_PUBLIC FramesDecoderCpu : public FramesDecoderBase {
  public:
   /**
@@ -28,8 +64,10 @@ class DLL_PUBLIC FramesDecoderCpu : public FramesDecoderBase {
    *
    * @param filename Path to a video file.
    * @param image_type Image type of the video.
+   * @param threading Threading configuration of the codec.
    */
-   explicit FramesDecoderCpu(const std::string &filename, DALIImageType image_type = DALI_RGB);
+  explicit FramesDecoderCpu(const std::string &filename, DALIImageType image_type = DALI_RGB,
+                            CodecThreadingParams threading = {});
 
   /**
    * @brief Construct a new FramesDecoder object.
@@ -38,11 +76,13 @@ class DLL_PUBLIC FramesDecoderCpu : public FramesDecoderBase {
    * @param memory_file_size Size of memory_file in bytes.
    * @param source_info Source info of the video file.
    * @param image_type Image type of the video.
+   * @param threading Threading configuration of the codec.
    *
    * @note This constructor assumes that the `memory_file` and
    * `memory_file_size` arguments cover the entire video file, including the header.
    */
-  FramesDecoderCpu(const char *memory_file, size_t memory_file_size, std::string_view = {}, DALIImageType image_type = DALI_RGB);
+  FramesDecoderCpu(const char *memory_file, size_t memory_file_size, std::string_view = {},
+                   DALIImageType image_type = DALI_RGB, CodecThreadingParams threading = {});
 
   FramesDecoderCpu(FramesDecoderCpu&&) = default;
 
@@ -59,6 +99,7 @@ class DLL_PUBLIC FramesDecoderCpu : public FramesDecoderBase {
   bool ReadRegularFrame(uint8_t *data);
   bool ReadFlushFrame(uint8_t *data);
   bool flush_state_ = false;
+  CodecThreadingParams threading_;
 
   const AVCodec *codec_ = nullptr;
   std::unique_ptr<SwsContext, decltype(&sws_freeContext)> sws_ctx_{
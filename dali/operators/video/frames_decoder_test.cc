@@ -218,6 +218,19 @@ TEST_F(FramesDecoderTest_CpuOnlyTests, VariableFrameRateHevc) {
   RunTest(decoder, vfr_hevc_videos_[0]);
 }
 
+TEST_F(FramesDecoderTest_CpuOnlyTests, ConstantFrameRateFrameThreading) {
+  FramesDecoderCpu decoder(cfr_videos_paths_[0], DALI_RGB, {4, FF_THREAD_FRAME});
+  decoder.BuildIndex();
+  RunTest(decoder, cfr_videos_[0]);
+}
+
+TEST_F(FramesDecoderTest_CpuOnlyTests, VariableFrameRateHevcFrameSliceThreading) {
+  auto memory_video = MemoryVideo(vfr_hevc_videos_paths_[0]);
+  FramesDecoderCpu decoder(memory_video.data(), memory_video.size(), {}, DALI_RGB,
+                           {0, FF_THREAD_FRAME | FF_THREAD_SLICE});
+  RunTest(decoder, vfr_hevc_videos_[0], false);
+}
+
 TEST_F(FramesDecoderTest_CpuOnlyTests, InvalidSeek) {
   FramesDecoderCpu decoder(cfr_videos_paths_[0]);
   decoder.BuildIndex();
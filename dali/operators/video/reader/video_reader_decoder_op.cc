@@ -15,6 +15,7 @@
 #include <string>
 #include <shared_mutex>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "dali/core/boundary.h"
@@ -26,6 +27,7 @@
 #include "dali/operators/video/frames_decoder_cpu.h"
 #include "dali/operators/video/frames_decoder_gpu.h"
 #include "dali/operators/video/video_utils.h"
+#include "dali/pipeline/util/thread_pool.h"
 
 #include "libavutil/rational.h"
 
@@ -57,19 +59,25 @@ class FrameIndexCache {
     return cache;
   }
 
-  std::unordered_map<std::string, FrameIndex>::iterator find(const std::string& filename) {
+  /**
+   * @brief Returns the cached index of a file or nullptr, if there's none.
+   *
+   * The returned pointer stays valid, because the entries are never replaced nor removed
+   * (rehashing doesn't invalidate pointers to the elements of an unordered_map).
+   */
+  const FrameIndex* get(const std::string& filename) const {
     std::shared_lock<std::shared_mutex> read_lock(rw_mutex_);
-    return index_cache_.find(filename);
-  }
-
-  std::unordered_map<std::string, FrameIndex>::iterator end() {
-    std::shared_lock<std::shared_mutex> read_lock(rw_mutex_);
-    return index_cache_.end();
+    auto it = index_cache_.find(filename);
+    return it != index_cache_.end() ? &it->second : nullptr;
   }
 
+  /**
+   * @brief Stores the index of a file. If the index was already cached (e.g. built concurrently
+   *        by another thread), the existing entry is kept.
+   */
   void insert(const std::string& filename, const FrameIndex& index) {
     std::unique_lock<std::shared_mutex> write_lock(rw_mutex_);
-    index_cache_[filename] = index;
+    index_cache_.emplace(filename, index);
   }
 };
 
@@ -277,14 +285,13 @@ class VideoLoaderDecoder : public Loader<Backend, Sample, true> {
         LOG_LINE << "Invalid video file: " << entry.filename << std::endl;
         continue;
       }
-      auto it = FrameIndexCache::instance().find(entry.filename);
-      if (it == FrameIndexCache::instance().end()) {
+      if (auto *index = FrameIndexCache::instance().get(entry.filename)) {
+        LOG_LINE << "Reusing index for " << entry.filename << std::endl;
+        decoder->SetIndex(*index);
+      } else {
         LOG_LINE << "Building index for " << entry.filename << std::endl;
         decoder->BuildIndex();
         FrameIndexCache::instance().insert(entry.filename, decoder->GetIndex());
-      } else {
-        LOG_LINE << "Reusing index for " << entry.filename << std::endl;
-        decoder->SetIndex(it->second);
       }
       int64_t num_frames = decoder->NumFrames();
       entry.start_frame = 0;
@@ -437,6 +444,25 @@ class VideoReaderDecoder
         has_timestamps_(spec.GetArgument<bool>("enable_timestamps")),
         boundary_type_(GetBoundaryType(spec)),
         image_type_(spec.GetArgument<DALIImageType>("image_type")) {
+    if constexpr (std::is_same_v<Backend, CPUBackend>) {
+      codec_threading_.num_threads = spec.GetArgument<int>("codec_threads");
+      DALI_ENFORCE(codec_threading_.num_threads >= 0,
+                   make_string("codec_threads must be non-negative, got ",
+                               codec_threading_.num_threads));
+      codec_threading_.thread_type =
+          ParseCodecThreadType(spec.GetArgument<std::string>("codec_thread_type"));
+      int num_threads = spec.GetArgument<int>("num_threads");
+      if (num_threads > 1) {
+        // Prefetch runs on the reader's own thread, so decoding the clips of a batch in parallel
+        // requires a separate pool.
+        thread_pool_ = std::make_unique<OldThreadPool>(
+            num_threads, spec.GetArgument<int>("device_id"), false, "VideoReaderDecoder");
+      }
+    }
+    ctx_.resize(thread_pool_ ? thread_pool_->NumThreads() : 1);
+    for (auto &ctx : ctx_)
+      ctx.constant_frame.set_pinned(std::is_same_v<Backend, GPUBackend>);
+
     loader_ = InitLoader<VideoLoaderImpl>(spec);
     this->SetInitialSnapshot();
 
@@ -456,8 +482,6 @@ class VideoReaderDecoder
     StreamInitialization(spec);
     DALI_ENFORCE(image_type_ == DALI_RGB || image_type_ == DALI_YCbCr,
                  make_string("Invalid image_type: ", image_type_));
-
-    constant_frame_.set_pinned(std::is_same_v<Backend, GPUBackend>);
   }
 
   ~VideoReaderDecoder() override {
@@ -595,123 +619,181 @@ class VideoReaderDecoder
   void Prefetch() override {
     Base::Prefetch();
     auto &current_batch = prefetched_batch_queue_[curr_batch_producer_];
-    size_t i = 0;
-    for (auto &sample : current_batch) {
-      LOG_LINE << "Processing sample " << i++ << " with filename " << sample->video_file_meta_->filename
-               << " and previous decoder " << decoder_.get() << " filename "
-               << (decoder_ ? decoder_->Filename() : "none") << std::endl;
-      auto prev_filename = decoder_ ? decoder_->Filename() : "";
-      const auto &filename = sample->video_file_meta_->filename;
-      if (prev_filename != filename) {
-        if constexpr (std::is_same_v<Backend, CPUBackend>) {
-          decoder_ = std::make_unique<FramesDecoderImpl>(filename, image_type_);
-        } else {
-          decoder_ = std::make_unique<FramesDecoderImpl>(filename, cuda_stream_, image_type_);
-        }
-        LOG_LINE << "Initialized decoder to " << decoder_->Filename() << " ptr: " << decoder_.get()
-                 << " num_frames: " << decoder_->NumFrames() << std::endl;
-        auto it = FrameIndexCache::instance().find(filename);
-        if (it == FrameIndexCache::instance().end()) {
-          LOG_LINE << "Building index for " << filename << std::endl;
-          decoder_->BuildIndex();
-          FrameIndexCache::instance().insert(filename, decoder_->GetIndex());
-        } else {
-          LOG_LINE << "Reusing index for " << filename << std::endl;
-          decoder_->SetIndex(it->second);
+    if (thread_pool_) {
+      // Different clips of the batch are decoded concurrently, each worker keeping its own
+      // decoder open. Consecutive samples usually come from the same file, so they are assigned
+      // to the same worker, to reuse the decoder and avoid seeking back and forth.
+      int num_samples = current_batch.size();
+      std::vector<std::pair<int, int>> groups;
+      int i = 0;
+      while (i < num_samples) {
+        int group_begin = i;
+        const auto &filename = current_batch[i]->video_file_meta_->filename;
+        while (i < num_samples && current_batch[i]->video_file_meta_->filename == filename)
+          i++;
+        groups.emplace_back(group_begin, i);
+      }
+      // The threads of the pool are split between the videos decoded concurrently
+      auto threading = GetCodecThreading(groups.size());
+      for (auto [group_begin, group_end] : groups) {
+        int64_t cost = 0;
+        for (int j = group_begin; j < group_end; j++) {
+          auto &sample = *current_batch[j];
+          cost += sample.frame_idxs_.empty() ? sample.end_ - sample.start_
+                                             : static_cast<int64_t>(sample.frame_idxs_.size());
         }
-      } else {
-        LOG_LINE << "Reusing decoder for " << decoder_->Filename() << " ptr: " << decoder_.get()
-                 << " num_frames: " << decoder_->NumFrames() << std::endl;
+        thread_pool_->AddWork([&, group_begin = group_begin, group_end = group_end](int tid) {
+          for (int j = group_begin; j < group_end; j++)
+            DecodeSample(*current_batch[j], ctx_[tid], threading);
+        }, cost);
       }
-      DALI_ENFORCE(decoder_->IsValid(),
-                   make_string("Invalid decoder for filename ", filename));
-
-      int64_t num_frames = sample->frame_idxs_.empty()
-          ? (sample->end_ - sample->start_ + sample->stride_ - 1) / sample->stride_
-          : static_cast<int64_t>(sample->frame_idxs_.size());
-      sample->data_.Resize(
-          {num_frames, decoder_->Height(), decoder_->Width(), decoder_->Channels()}, DALI_UINT8);
-      sample->data_.SetSourceInfo(decoder_->Filename());
-      sample->data_.SetLayout("FHWC");
-
-      const uint8_t *constant_frame =
-          boundary_type_ == boundary::BoundaryType::CONSTANT ?
-              ConstantFrame(constant_frame_, decoder_->FrameShape(), make_cspan(fill_value_),
-                            cuda_stream_, true) :
-              nullptr;
-      if (has_timestamps_) {
-        sample->timestamps_.resize(num_frames);
+      thread_pool_->RunAll();
+    } else {
+      auto threading = GetCodecThreading(1);
+      for (auto &sample : current_batch)
+        DecodeSample(*sample, ctx_[0], threading);
+    }
+
+    if (cuda_stream_) {
+      CUDA_CALL(cudaStreamSynchronize(cuda_stream_.get()));
+    }
+    LOG_LINE << "Prefetch done" << std::endl;
+  }
+
+ private:
+  struct DecoderContext {
+    std::unique_ptr<FramesDecoderImpl> decoder;  // keeping one decoder open.
+    Tensor<Backend> constant_frame;
+    std::vector<int> frame_idxs;
+  };
+
+  /**
+   * @brief Returns the codec threading for the given number of videos decoded concurrently
+   *
+   * See SplitCodecThreads.
+   */
+  CodecThreadingParams GetCodecThreading(int num_videos) const {
+    int num_pool_threads = thread_pool_ ? thread_pool_->NumThreads() : 1;
+    return SplitCodecThreads(codec_threading_, num_pool_threads, num_videos);
+  }
+
+  /**
+   * @brief Decodes the sample, opening the file if it's not the one open in the context
+   *
+   * The codec threading applies only when the file is opened.
+   */
+  void DecodeSample(VideoSample<Backend> &sample, DecoderContext &ctx,
+                    const CodecThreadingParams &threading) {
+    LOG_LINE << "Processing sample with filename " << sample.video_file_meta_->filename
+             << " and previous decoder " << ctx.decoder.get() << " filename "
+             << (ctx.decoder ? ctx.decoder->Filename() : "none") << std::endl;
+    auto prev_filename = ctx.decoder ? ctx.decoder->Filename() : "";
+    const auto &filename = sample.video_file_meta_->filename;
+    if (prev_filename != filename) {
+      if constexpr (std::is_same_v<Backend, CPUBackend>) {
+        ctx.decoder = std::make_unique<FramesDecoderImpl>(filename, image_type_, threading);
       } else {
-        sample->timestamps_.clear();
+        ctx.decoder = std::make_unique<FramesDecoderImpl>(filename, cuda_stream_, image_type_);
       }
-      if (!sample->frame_idxs_.empty()) {
-        LOG_LINE << "Decoding frames (uniform) num_frames=" << num_frames
-                 << ", frame_idxs=[" << sample->frame_idxs_.front() << ".."
-                 << sample->frame_idxs_.back() << "]"
-                 << ", filename=" << sample->video_file_meta_->filename
-                 << ", label=" << sample->video_file_meta_->label
-                 << ", boundary_type=" << to_string(boundary_type_) << std::endl;
+      LOG_LINE << "Initialized decoder to " << ctx.decoder->Filename()
+               << " ptr: " << ctx.decoder.get()
+               << " num_frames: " << ctx.decoder->NumFrames() << std::endl;
+      if (auto *index = FrameIndexCache::instance().get(filename)) {
+        LOG_LINE << "Reusing index for " << filename << std::endl;
+        ctx.decoder->SetIndex(*index);
       } else {
-        LOG_LINE << "Decoding frames start=" << sample->start_ << ", end=" << sample->end_
-                 << ", stride=" << sample->stride_ << ", num_frames=" << num_frames
-                 << ", filename=" << sample->video_file_meta_->filename
-                 << ", label=" << sample->video_file_meta_->label
-                 << ", start=" << sample->video_file_meta_->start_frame
-                 << ", end=" << sample->video_file_meta_->end_frame
-                 << ", boundary_type=" << to_string(boundary_type_) << std::endl;
+        LOG_LINE << "Building index for " << filename << std::endl;
+        ctx.decoder->BuildIndex();
+        FrameIndexCache::instance().insert(filename, ctx.decoder->GetIndex());
       }
-      int roi_start = sample->video_file_meta_->start_frame;
-      int roi_end = sample->video_file_meta_->end_frame;
-      if (frame_num_policy_ == FrameNumPolicy::Sequence) {
-        sample->frame_idx_.resize(num_frames);
-        if (!sample->frame_idxs_.empty()) {
-          // Uniform indices are always within [roi_start, roi_end-1], so HandleBoundary
-          // is a no-op here — but we call it for consistency with the stride path below.
-          for (int64_t i = 0; i < num_frames; ++i) {
-            sample->frame_idx_[i] = static_cast<int32_t>(decoder_->HandleBoundary(
-                boundary_type_, sample->frame_idxs_[i], roi_start, roi_end));
-          }
-        } else {
-          for (int64_t i = 0; i < num_frames; ++i) {
-            sample->frame_idx_[i] = static_cast<int32_t>(decoder_->HandleBoundary(
-                boundary_type_,
-                static_cast<int>(sample->start_ + i * sample->stride_),
-                roi_start, roi_end));
-          }
+    } else {
+      LOG_LINE << "Reusing decoder for " << ctx.decoder->Filename()
+               << " ptr: " << ctx.decoder.get()
+               << " num_frames: " << ctx.decoder->NumFrames() << std::endl;
+    }
+    DALI_ENFORCE(ctx.decoder->IsValid(),
+                 make_string("Invalid decoder for filename ", filename));
+
+    int64_t num_frames = sample.frame_idxs_.empty()
+        ? (sample.end_ - sample.start_ + sample.stride_ - 1) / sample.stride_
+        : static_cast<int64_t>(sample.frame_idxs_.size());
+    sample.data_.Resize(
+        {num_frames, ctx.decoder->Height(), ctx.decoder->Width(), ctx.decoder->Channels()},
+        DALI_UINT8);
+    sample.data_.SetSourceInfo(ctx.decoder->Filename());
+    sample.data_.SetLayout("FHWC");
+
+    const uint8_t *constant_frame =
+        boundary_type_ == boundary::BoundaryType::CONSTANT ?
+            ConstantFrame(ctx.constant_frame, ctx.decoder->FrameShape(), make_cspan(fill_value_),
+                          cuda_stream_, true) :
+            nullptr;
+    if (has_timestamps_) {
+      sample.timestamps_.resize(num_frames);
+    } else {
+      sample.timestamps_.clear();
+    }
+    if (!sample.frame_idxs_.empty()) {
+      LOG_LINE << "Decoding frames (uniform) num_frames=" << num_frames
+               << ", frame_idxs=[" << sample.frame_idxs_.front() << ".."
+               << sample.frame_idxs_.back() << "]"
+               << ", filename=" << sample.video_file_meta_->filename
+               << ", label=" << sample.video_file_meta_->label
+               << ", boundary_type=" << to_string(boundary_type_) << std::endl;
+    } else {
+      LOG_LINE << "Decoding frames start=" << sample.start_ << ", end=" << sample.end_
+               << ", stride=" << sample.stride_ << ", num_frames=" << num_frames
+               << ", filename=" << sample.video_file_meta_->filename
+               << ", label=" << sample.video_file_meta_->label
+               << ", start=" << sample.video_file_meta_->start_frame
+               << ", end=" << sample.video_file_meta_->end_frame
+               << ", boundary_type=" << to_string(boundary_type_) << std::endl;
+    }
+    int roi_start = sample.video_file_meta_->start_frame;
+    int roi_end = sample.video_file_meta_->end_frame;
+    if (frame_num_policy_ == FrameNumPolicy::Sequence) {
+      sample.frame_idx_.resize(num_frames);
+      if (!sample.frame_idxs_.empty()) {
+        // Uniform indices are always within [roi_start, roi_end-1], so HandleBoundary
+        // is a no-op here — but we call it for consistency with the stride path below.
+        for (int64_t i = 0; i < num_frames; ++i) {
+          sample.frame_idx_[i] = static_cast<int32_t>(ctx.decoder->HandleBoundary(
+              boundary_type_, sample.frame_idxs_[i], roi_start, roi_end));
         }
       } else {
-        sample->frame_idx_.clear();
-      }
-      if (!sample->frame_idxs_.empty()) {
-        // Uniform sampling: explicit frame indices already include ROI offset (start_frame)
-        decoder_->DecodeFrames(sample->data_.template mutable_data<uint8_t>(),
-                               make_cspan(sample->frame_idxs_), boundary_type_, constant_frame,
-                               make_span(sample->timestamps_));
-      } else if (roi_start != 0 || roi_end != decoder_->NumFrames()) {
-        frame_idxs_.clear();
-        for (int frame_idx = sample->start_; frame_idx < sample->end_;
-             frame_idx += sample->stride_) {
-          frame_idxs_.push_back(decoder_->HandleBoundary(
-              boundary_type_, frame_idx, roi_start, roi_end));
+        for (int64_t i = 0; i < num_frames; ++i) {
+          sample.frame_idx_[i] = static_cast<int32_t>(ctx.decoder->HandleBoundary(
+              boundary_type_,
+              static_cast<int>(sample.start_ + i * sample.stride_),
+              roi_start, roi_end));
         }
-        decoder_->DecodeFrames(sample->data_.template mutable_data<uint8_t>(),
-                               make_cspan(frame_idxs_), boundary_type_, constant_frame,
-                               make_span(sample->timestamps_));
-      } else {
-        decoder_->DecodeFrames(sample->data_.template mutable_data<uint8_t>(), sample->start_,
-                               sample->end_, sample->stride_, boundary_type_, constant_frame,
-                               make_span(sample->timestamps_));
       }
-      LOG_LINE << "Decoding frames done" << std::endl;
+    } else {
+      sample.frame_idx_.clear();
     }
-
-    if (cuda_stream_) {
-      CUDA_CALL(cudaStreamSynchronize(cuda_stream_.get()));
+    if (!sample.frame_idxs_.empty()) {
+      // Uniform sampling: explicit frame indices already include ROI offset (start_frame)
+      ctx.decoder->DecodeFrames(sample.data_.template mutable_data<uint8_t>(),
+                                make_cspan(sample.frame_idxs_), boundary_type_, constant_frame,
+                                make_span(sample.timestamps_));
+    } else if (roi_start != 0 || roi_end != ctx.decoder->NumFrames()) {
+      ctx.frame_idxs.clear();
+      for (int frame_idx = sample.start_; frame_idx < sample.end_;
+           frame_idx += sample.stride_) {
+        ctx.frame_idxs.push_back(ctx.decoder->HandleBoundary(
+            boundary_type_, frame_idx, roi_start, roi_end));
+      }
+      ctx.decoder->DecodeFrames(sample.data_.template mutable_data<uint8_t>(),
+                                make_cspan(ctx.frame_idxs), boundary_type_, constant_frame,
+                                make_span(sample.timestamps_));
+    } else {
+      ctx.decoder->DecodeFrames(sample.data_.template mutable_data<uint8_t>(), sample.start_,
+                                sample.end_, sample.stride_, boundary_type_, constant_frame,
+                                make_span(sample.timestamps_));
     }
-    LOG_LINE << "Prefetch done" << std::endl;
+    LOG_LINE << "Decoding frames done" << std::endl;
   }
 
- private:
   FrameNumPolicy frame_num_policy_;
   bool has_timestamps_;
   boundary::BoundaryType boundary_type_;
@@ -719,10 +801,10 @@ class VideoReaderDecoder
   std::vector<uint8_t> fill_value_;
   bool has_labels_ = false;
 
-  Tensor<Backend> constant_frame_;
   CUDAStreamLease cuda_stream_;
-  std::unique_ptr<FramesDecoderImpl> decoder_;  // keeping one decoder open.
-  std::vector<int> frame_idxs_;
+  CodecThreadingParams codec_threading_;
+  std::unique_ptr<ThreadPool> thread_pool_;  // Used only for CPU backend
+  std::vector<DecoderContext> ctx_;
 };
 
 DALI_SCHEMA(experimental__readers__Video)
@@ -865,6 +947,27 @@ Otherwise, the number of values must match the number of channels in the video.)
                     })
     .AddOptionalArg("image_type", R"(The color space of the output frames (RGB or YCbCr).)",
                     DALI_RGB)
+    .AddOptionalArg("codec_threads",
+                    R"code(Number of libavcodec threads used to decode a single video (CPU backend only).
+
+If 0, the ``num_threads`` threads are divided between the videos decoded concurrently,
+so that a batch with fewer videos than threads still uses all the threads.
+If 1, each video is decoded on a single thread and only different videos of the batch are decoded
+in parallel.
+
+The CPU backend decodes the videos in the prefetching thread of the reader, so, if
+``num_threads`` is greater than 1, it creates an additional pool of ``num_threads`` threads
+to decode the videos of a batch in parallel. The libavcodec threads are created on top of
+this pool.)code",
+                    1)
+    .AddOptionalArg("codec_thread_type",
+                    R"code(Kind of threading used by libavcodec when ``codec_threads`` is not 1 (CPU backend only).
+
+* ``'frame'``: Decode several consecutive frames at once.
+* ``'slice'``: Decode the slices of a single frame in parallel (only applies to videos encoded
+  with multiple slices).
+* ``'frame_slice'``: Use both, as supported by the codec.)code",
+                    std::string("frame_slice"))
     .AddParent("LoaderBase")
     .OutputNDim(0, 4)
     .OutputDType(0, DALI_UINT8)
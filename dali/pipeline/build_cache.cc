@@ -0,0 +1,322 @@
+// Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dali/pipeline/build_cache.h"
+#include <google/protobuf/io/coded_stream.h>
+#include <unistd.h>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include "dali/core/error_handling.h"
+#include "dali/pipeline/build_info.h"
+#include "dali/pipeline/dali.pb.h"
+#include "dali/pipeline/operator/argument.h"
+#include "dali/pipeline/proto/dali_proto_intern.h"
+
+namespace dali {
+
+namespace {
+
+/** Bumped whenever the meaning of the cached data or the result of any graph pass changes.
+ *
+ * The version must be bumped in the same change which modifies a pass - the stamp below doesn't
+ * distinguish between development builds made from uncommitted sources.
+ */
+constexpr int kBuildCacheVersion = 2;
+
+/** Distinguishes the releases of DALI - the passes and the operators may differ between them.
+ *
+ * Unlike a build time, it's the same for all builds of a given revision, so the entries stored
+ * on disk remain valid after rebuilding (or reinstalling) the same version.
+ */
+constexpr const char kBinaryStamp[] = DALI_BUILD_VERSION "-" DALI_BUILD_GIT_SHA;
+
+/** Serializes an operator with all of its arguments.
+ *
+ * Unlike the serialization of the pipeline, no argument is skipped - the specification must
+ * be restored exactly as it was after the pipeline had prepared it.
+ */
+void SerializeOp(dali_proto::OpDef *def, const graph::OpNode &node) {
+  auto &spec = node.spec;
+  def->set_name(spec.SchemaName());
+  def->set_inst_name(node.instance_name);
+
+  for (int i = 0; i < spec.NumInput(); i++) {
+    auto *in = def->add_input();
+    in->set_name(spec.InputName(i));
+    in->set_device(to_string(spec.InputDevice(i)));
+    if (spec.IsArgumentInput(i))
+      in->set_arg_name(spec.ArgumentInputName(i));
+    in->set_is_argument_input(spec.IsArgumentInput(i));
+  }
+
+  for (int i = 0; i < spec.NumOutput(); i++) {
+    auto *out = def->add_output();
+    out->set_name(spec.OutputName(i));
+    out->set_device(to_string(spec.OutputDevice(i)));
+    out->set_is_argument_input(false);
+  }
+
+  for (auto &a : spec.Arguments()) {
+    dali_proto::Argument *arg = def->add_args();
+    DaliProtoPriv arg_wrap(arg);
+    a->SerializeToProtobuf(&arg_wrap);
+  }
+}
+
+OpSpec DeserializeOp(const dali_proto::OpDef &def) {
+  OpSpec spec(def.name());
+  for (auto &arg : def.args())
+    spec.AddInitializedArg(arg.name(), DeserializeProtobuf(DaliProtoPriv(&arg)));
+
+  // The inputs are stored in the order in which they appear in the spec; the regular inputs
+  // always precede the argument inputs.
+  for (auto &in : def.input()) {
+    if (in.is_argument_input())
+      spec.AddArgumentInput(in.arg_name(), in.name());
+    else
+      spec.AddInput(in.name(), ParseStorageDevice(in.device()));
+  }
+
+  for (auto &out : def.output())
+    spec.AddOutput(out.name(), ParseStorageDevice(out.device()));
+  return spec;
+}
+
+bool SerializeGraph(const graph::OpGraph &graph, dali_proto::BuildCacheEntry &entry) {
+  for (auto &node : graph.OpNodes()) {
+    if (!node.spec.GetSchemaOrDefault().IsSerializable())
+      return false;
+    SerializeOp(entry.add_op(), node);
+  }
+  for (auto output : graph.Outputs())
+    entry.add_outputs(std::string(output));
+  return true;
+}
+
+bool ParseEntry(const std::string &data, dali_proto::BuildCacheEntry &entry) {
+  google::protobuf::io::CodedInputStream coded_input(
+      reinterpret_cast<const uint8_t *>(data.data()), data.size());
+  coded_input.SetTotalBytesLimit(data.size());
+  return entry.ParseFromCodedStream(&coded_input);
+}
+
+bool EnvFlag(const char *name) {
+  const char *env = getenv(name);
+  return env && atoi(env) != 0;
+}
+
+}  // namespace
+
+BuildCache &BuildCache::instance() {
+  static BuildCache cache;
+  return cache;
+}
+
+BuildCache::BuildCache() {
+  if (const char *dir = getenv("DALI_BUILD_CACHE_DIR")) {
+    directory_ = dir;
+    enabled_ = !directory_.empty();
+  }
+  if (EnvFlag("DALI_BUILD_CACHE"))
+    enabled_ = true;
+}
+
+bool BuildCache::Enabled() const {
+  std::lock_guard g(mtx_);
+  return enabled_;
+}
+
+void BuildCache::SetEnabled(bool enabled) {
+  std::lock_guard g(mtx_);
+  enabled_ = enabled;
+}
+
+void BuildCache::SetDirectory(std::string directory) {
+  std::lock_guard g(mtx_);
+  directory_ = std::move(directory);
+}
+
+std::string BuildCache::Directory() const {
+  std::lock_guard g(mtx_);
+  return directory_;
+}
+
+void BuildCache::Clear() {
+  std::lock_guard g(mtx_);
+  entries_.clear();
+  order_.clear();
+  stats_ = {};
+}
+
+BuildCache::Stats BuildCache::GetStats() const {
+  std::lock_guard g(mtx_);
+  return stats_;
+}
+
+std::string BuildCache::Key(const graph::OpGraph &graph, std::string_view settings) {
+  dali_proto::BuildCacheEntry key;
+  key.set_key(make_string("v", kBuildCacheVersion, ";", kBinaryStamp, ";", settings));
+  try {
+    if (!SerializeGraph(graph, key))
+      return {};
+    std::string serialized;
+    if (!key.SerializeToString(&serialized))
+      return {};
+    return serialized;
+  } catch (...) {
+    // Some argument couldn't be serialized - the graph is not cacheable
+    return {};
+  }
+}
+
+std::string BuildCache::FilePath(const std::string &key) const {
+  std::stringstream ss;
+  ss << "dali_build_" << std::hex << std::setw(16) << std::setfill('0')
+     << std::hash<std::string>()(key) << ".bin";
+  return (std::filesystem::path(directory_) / ss.str()).string();
+}
+
+bool BuildCache::ReadFile(const std::string &key, std::string &entry) const {
+  std::ifstream f(FilePath(key), std::ios::binary);
+  if (!f)
+    return false;
+  std::stringstream ss;
+  ss << f.rdbuf();
+  entry = ss.str();
+  return !f.bad();
+}
+
+void BuildCache::WriteFile(const std::string &key, const std::string &entry) const {
+  std::string path = FilePath(key);
+  // Write to a temporary file and rename it, so that other processes never see a partial entry
+  std::string tmp_path = make_string(path, ".tmp.", getpid());
+  {
+    std::ofstream f(tmp_path, std::ios::binary | std::ios::trunc);
+    if (!f)
+      return;
+    f.write(entry.data(), entry.size());
+    if (!f) {
+      f.close();
+      std::remove(tmp_path.c_str());
+      return;
+    }
+  }
+  std::error_code ec;
+  std::filesystem::rename(tmp_path, path, ec);
+  if (ec)
+    std::remove(tmp_path.c_str());
+}
+
+void BuildCache::Insert(const std::string &key, std::string entry) {
+  bool inserted = entries_.insert_or_assign(key, std::move(entry)).second;
+  if (!inserted)
+    return;
+  order_.push_back(key);
+  while (static_cast<int>(order_.size()) > kMaxMemoryEntries) {
+    entries_.erase(order_.front());
+    order_.pop_front();
+  }
+}
+
+bool BuildCache::Load(const std::string &key,
+                      graph::OpGraph &graph,
+                      graph::OptimizationStats &stats) {
+  std::unique_lock lock(mtx_);
+  std::string data;
+  bool from_disk = false;
+  auto it = entries_.find(key);
+  if (it != entries_.end()) {
+    data = it->second;
+  } else if (!directory_.empty() && ReadFile(key, data)) {
+    from_disk = true;
+  } else {
+    stats_.misses++;
+    return false;
+  }
+  lock.unlock();
+
+  dali_proto::BuildCacheEntry entry;
+  graph::OpGraph cached;
+  try {
+    // The file name is just a hash of the key - the key stored in the entry must match exactly.
+    if (!ParseEntry(data, entry) || entry.key() != key)
+      throw std::runtime_error("Invalid build cache entry.");
+    graph::OpGraph::Builder builder;
+    for (auto &def : entry.op())
+      builder.Add(def.inst_name(), DeserializeOp(def));
+    for (auto &output : entry.outputs())
+      builder.AddOutput(output);
+    cached = std::move(builder).GetGraph(true);
+  } catch (...) {
+    // A stale or corrupted entry is treated as a miss
+    lock.lock();
+    stats_.misses++;
+    return false;
+  }
+
+  graph = {};
+  graph = std::move(cached);
+  stats = {};
+  stats.cse_merged_ops = entry.cse_merged_ops();
+  stats.folded_ops = entry.folded_ops();
+  stats.constant_nodes = entry.constant_nodes();
+  stats.unused_outputs = entry.unused_outputs();
+  stats.ops_with_unused_outputs = entry.ops_with_unused_outputs();
+  stats.cached = true;
+
+  lock.lock();
+  stats_.hits++;
+  if (from_disk) {
+    stats_.disk_hits++;
+    Insert(key, std::move(data));
+  }
+  return true;
+}
+
+void BuildCache::Store(const std::string &key,
+                       const graph::OpGraph &graph,
+                       const graph::OptimizationStats &stats) {
+  dali_proto::BuildCacheEntry entry;
+  std::string data;
+  try {
+    entry.set_key(key);
+    if (!SerializeGraph(graph, entry))
+      return;
+    entry.set_cse_merged_ops(stats.cse_merged_ops);
+    entry.set_folded_ops(stats.folded_ops);
+    entry.set_constant_nodes(stats.constant_nodes);
+    entry.set_unused_outputs(stats.unused_outputs);
+    entry.set_ops_with_unused_outputs(stats.ops_with_unused_outputs);
+    if (!entry.SerializeToString(&data))
+      return;
+  } catch (...) {
+    return;
+  }
+
+  std::lock_guard g(mtx_);
+  if (!directory_.empty())
+    WriteFile(key, data);
+  Insert(key, std::move(data));
+  stats_.stores++;
+}
+
+}  // namespace dali
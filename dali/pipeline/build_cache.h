@@ -0,0 +1,129 @@
+// Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DALI_PIPELINE_BUILD_CACHE_H_
+#define DALI_PIPELINE_BUILD_CACHE_H_
+
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include "dali/core/api_helper.h"
+#include "dali/pipeline/graph/op_graph2.h"
+#include "dali/pipeline/graph/optimization_stats.h"
+
+namespace dali {
+
+/** Stores the results of graph optimization, so that subsequent builds of the same pipeline
+ *  can skip it.
+ *
+ * The cache maps the graph, as it is before optimization (with fully prepared operator
+ * specifications), to the optimized graph and the optimization statistics. The entries are kept
+ * in memory and, if a directory is set, also on disk, so that they survive the process.
+ *
+ * Only the graph passes (common subexpression elimination, constant folding and marking of
+ * the unused outputs) are cached. The following phases of the build run every time:
+ * - the computation of the data node metadata, which is cheap;
+ * - the lowering to the executor graph, since it creates the operator instances;
+ * - the stream assignment, since it depends on the stream policy of the executor and the
+ *   streams belong to the executor.
+ *
+ * Any change to the result of a cached pass must be accompanied by a bump of the cache
+ * version (`kBuildCacheVersion` in build_cache.cc).
+ *
+ * The key contains all arguments of all operators (including the seeds of random operators),
+ * so a pipeline which is created without a fixed seed will not hit the cache.
+ * Pipelines with unserializable operators (e.g. Python functions) are not cached.
+ *
+ * The cache is disabled by default. It can be enabled with the environment variables:
+ * - `DALI_BUILD_CACHE=1` enables the in-memory cache;
+ * - `DALI_BUILD_CACHE_DIR=<path>` enables the cache and stores the entries in the given
+ *   directory.
+ */
+class DLL_PUBLIC BuildCache {
+ public:
+  struct Stats {
+    /** The number of successful lookups */
+    int64_t hits = 0;
+    /** The number of lookups which didn't find a matching entry */
+    int64_t misses = 0;
+    /** The number of hits which were served by reading a file */
+    int64_t disk_hits = 0;
+    /** The number of entries stored */
+    int64_t stores = 0;
+  };
+
+  /** The maximum number of entries kept in memory */
+  static constexpr int kMaxMemoryEntries = 64;
+
+  /** Returns the process-wide instance of the cache */
+  static BuildCache &instance();
+
+  bool Enabled() const;
+  void SetEnabled(bool enabled);
+
+  /** Sets the directory where the entries are stored; empty disables the on-disk storage. */
+  void SetDirectory(std::string directory);
+  std::string Directory() const;
+
+  /** Removes all entries kept in memory and resets the statistics.
+   *
+   * The files stored on disk are not removed.
+   */
+  void Clear();
+
+  Stats GetStats() const;
+
+  /** Computes the cache key of an unoptimized graph.
+   *
+   * @param graph     the graph before optimization
+   * @param settings  a string describing the optimizations which are applied to the graph
+   * @return the key or an empty string, if the graph can't be cached
+   */
+  static std::string Key(const graph::OpGraph &graph, std::string_view settings);
+
+  /** Looks up the entry for the key and, if found, replaces the graph with the cached one.
+   *
+   * @return true, if the entry was found
+   */
+  bool Load(const std::string &key, graph::OpGraph &graph, graph::OptimizationStats &stats);
+
+  /** Stores the optimized graph and the optimization statistics under the key. */
+  void Store(const std::string &key,
+             const graph::OpGraph &graph,
+             const graph::OptimizationStats &stats);
+
+ private:
+  BuildCache();
+
+  std::string FilePath(const std::string &key) const;
+  bool ReadFile(const std::string &key, std::string &entry) const;
+  void WriteFile(const std::string &key, const std::string &entry) const;
+  void Insert(const std::string &key, std::string entry);
+
+  mutable std::mutex mtx_;
+  bool enabled_ = false;
+  std::string directory_;
+  /** Serialized entries, by key */
+  std::unordered_map<std::string, std::string> entries_;
+  /** The keys in the order of insertion, used for eviction */
+  std::list<std::string> order_;
+  Stats stats_;
+};
+
+}  // namespace dali
+
+#endif  // DALI_PIPELINE_BUILD_CACHE_H_
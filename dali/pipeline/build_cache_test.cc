@@ -0,0 +1,212 @@
+// Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dali/pipeline/build_cache.h"
+#include <gtest/gtest.h>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#include "dali/pipeline/pipeline.h"
+#include "dali/test/dali_test_utils.h"
+
+namespace dali {
+namespace test {
+
+namespace {
+
+OpSpec CPUSpec(const std::string &schema) {
+  OpSpec spec(schema);
+  spec.AddArg("device", "cpu");
+  spec.AddArg("max_batch_size", 4);
+  spec.AddArg("num_threads", 1);
+  return spec;
+}
+
+graph::OpGraph MakeGraph(DALIDataType cast_type) {
+  graph::OpGraph::Builder b;
+  b.Add("c", CPUSpec("Constant")
+             .AddArg("idata", std::vector<int>{ 1, 2, 3 })
+             .AddOutput("c", StorageDevice::CPU));
+  b.Add("cast", CPUSpec("Cast")
+                .AddArg("dtype", cast_type)
+                .AddInput("c_cpu", StorageDevice::CPU)
+                .AddOutput("f", StorageDevice::CPU));
+  b.AddOutput("f_cpu");
+  return std::move(b).GetGraph(true);
+}
+
+std::unique_ptr<Pipeline> MakePipeline() {
+  auto pipe = std::make_unique<Pipeline>(4, 1, CPU_ONLY_DEVICE_ID, 1234);
+  pipe->AddExternalInput("data");
+  pipe->AddOperator(OpSpec("Constant")
+                    .AddArg("device", "cpu")
+                    .AddArg("idata", std::vector<int>{ 1, 2, 3 })
+                    .AddOutput("c", StorageDevice::CPU), "c");
+  pipe->AddOperator(OpSpec("Cast")
+                    .AddArg("device", "cpu")
+                    .AddArg("dtype", DALI_FLOAT)
+                    .AddInput("c", StorageDevice::CPU)
+                    .AddOutput("f", StorageDevice::CPU), "cast");
+  pipe->AddOperator(OpSpec("CoinFlip")
+                    .AddArg("device", "cpu")
+                    .AddOutput("flip", StorageDevice::CPU), "flip");
+  pipe->AddOperator(OpSpec("Copy")
+                    .AddArg("device", "cpu")
+                    .AddInput("data", StorageDevice::CPU)
+                    .AddOutput("copied", StorageDevice::CPU), "copy");
+  pipe->Build({{"f", "cpu"}, {"flip", "cpu"}, {"copied", "cpu"}});
+  return pipe;
+}
+
+void RunAndGetOutputs(Pipeline &pipe, const TensorList<CPUBackend> &input, Workspace &ws) {
+  pipe.SetExternalInput("data", input);
+  pipe.Run();
+  pipe.Outputs(&ws);
+}
+
+}  // namespace
+
+class BuildCacheTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    auto &cache = BuildCache::instance();
+    was_enabled_ = cache.Enabled();
+    directory_ = cache.Directory();
+    cache.SetEnabled(true);
+    cache.SetDirectory("");
+    cache.Clear();
+  }
+
+  void TearDown() override {
+    auto &cache = BuildCache::instance();
+    cache.Clear();
+    cache.SetEnabled(was_enabled_);
+    cache.SetDirectory(directory_);
+  }
+
+  bool was_enabled_ = false;
+  std::string directory_;
+};
+
+TEST_F(BuildCacheTest, StoreAndLoad) {
+  auto &cache = BuildCache::instance();
+  auto g = MakeGraph(DALI_FLOAT);
+  std::string key = BuildCache::Key(g, "test");
+  ASSERT_FALSE(key.empty());
+  EXPECT_EQ(BuildCache::Key(MakeGraph(DALI_FLOAT), "test"), key);
+  EXPECT_NE(BuildCache::Key(MakeGraph(DALI_INT16), "test"), key);
+  EXPECT_NE(BuildCache::Key(g, "other settings"), key);
+
+  graph::OpGraph loaded;
+  graph::OptimizationStats stats;
+  EXPECT_FALSE(cache.Load(key, loaded, stats));
+
+  graph::OptimizationStats stored_stats;
+  stored_stats.folded_ops = 1;
+  stored_stats.constant_nodes = 1;
+  cache.Store(key, g, stored_stats);
+
+  ASSERT_TRUE(cache.Load(key, loaded, stats));
+  EXPECT_TRUE(stats.cached);
+  EXPECT_EQ(stats.folded_ops, 1);
+  EXPECT_EQ(stats.constant_nodes, 1);
+  EXPECT_EQ(stats.cse_merged_ops, 0);
+
+  ASSERT_EQ(loaded.OpNodes().size(), 2u);
+  auto *cast = loaded.GetOp("cast");
+  ASSERT_NE(cast, nullptr);
+  EXPECT_EQ(cast->spec.SchemaName(), "Cast");
+  EXPECT_EQ(cast->spec.GetArgument<DALIDataType>("dtype"), DALI_FLOAT);
+  EXPECT_EQ(cast->spec.GetArgument<int>("max_batch_size"), 4);
+  ASSERT_EQ(cast->inputs.size(), 1u);
+  EXPECT_EQ(cast->inputs[0]->producer.op, loaded.GetOp("c"));
+  ASSERT_EQ(loaded.Outputs().size(), 1u);
+  EXPECT_EQ(loaded.Outputs()[0], "f_cpu");
+  EXPECT_EQ(loaded.GetOp("c")->spec.GetRepeatedArgument<int>("idata"),
+            std::vector<int>({ 1, 2, 3 }));
+
+  auto cache_stats = cache.GetStats();
+  EXPECT_EQ(cache_stats.hits, 1);
+  EXPECT_EQ(cache_stats.misses, 1);
+  EXPECT_EQ(cache_stats.stores, 1);
+  EXPECT_EQ(cache_stats.disk_hits, 0);
+}
+
+TEST_F(BuildCacheTest, Disk) {
+  std::string tmpl = (std::filesystem::temp_directory_path() / "dali_build_cache_XXXXXX").string();
+  std::string dir = mkdtemp(&tmpl[0]);
+  auto &cache = BuildCache::instance();
+  cache.SetDirectory(dir);
+
+  auto g = MakeGraph(DALI_FLOAT);
+  std::string key = BuildCache::Key(g, "test");
+  cache.Store(key, g, {});
+  cache.Clear();  // drop the in-memory entries
+
+  graph::OpGraph loaded;
+  graph::OptimizationStats stats;
+  EXPECT_TRUE(cache.Load(key, loaded, stats));
+  EXPECT_TRUE(stats.cached);
+  EXPECT_EQ(loaded.OpNodes().size(), 2u);
+  EXPECT_EQ(cache.GetStats().disk_hits, 1);
+
+  // the entry is now in memory
+  EXPECT_TRUE(cache.Load(key, loaded, stats));
+  EXPECT_EQ(cache.GetStats().disk_hits, 1);
+  EXPECT_EQ(cache.GetStats().hits, 2);
+
+  std::filesystem::remove_all(dir);
+}
+
+TEST_F(BuildCacheTest, Pipeline) {
+  auto &cache = BuildCache::instance();
+  TensorList<CPUBackend> input;
+  MakeRandomBatch(input, 4);
+
+  auto pipe1 = MakePipeline();
+  EXPECT_FALSE(pipe1->GetGraphOptimizationStats().cached);
+  EXPECT_EQ(cache.GetStats().stores, 1);
+
+  auto pipe2 = MakePipeline();
+  auto &stats1 = pipe1->GetGraphOptimizationStats();
+  auto &stats2 = pipe2->GetGraphOptimizationStats();
+  EXPECT_TRUE(stats2.cached);
+  EXPECT_EQ(cache.GetStats().hits, 1);
+  EXPECT_EQ(stats2.folded_ops, stats1.folded_ops);
+  EXPECT_EQ(stats2.constant_nodes, stats1.constant_nodes);
+
+  Workspace ws1, ws2;
+  RunAndGetOutputs(*pipe1, input, ws1);
+  RunAndGetOutputs(*pipe2, input, ws2);
+  ASSERT_EQ(ws1.NumOutput(), 3);
+  ASSERT_EQ(ws2.NumOutput(), 3);
+  for (int o = 0; o < 3; o++) {
+    auto &out1 = ws1.Output<CPUBackend>(o);
+    auto &out2 = ws2.Output<CPUBackend>(o);
+    ASSERT_EQ(out1.type(), out2.type());
+    ASSERT_EQ(out1.shape(), out2.shape());
+    for (int i = 0; i < out1.num_samples(); i++) {
+      size_t bytes = out1.shape()[i].num_elements() * out1.type_info().size();
+      EXPECT_EQ(std::memcmp(out1.raw_tensor(i), out2.raw_tensor(i), bytes), 0)
+          << "Output " << o << " sample " << i << " differs.";
+    }
+  }
+}
+
+}  // namespace test
+}  // namespace dali
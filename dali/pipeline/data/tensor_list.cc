@@ -240,30 +240,38 @@ TensorList<Backend> &TensorList<Backend>::operator=(TensorList<Backend> &&other)
 
 template <typename Backend>
 void TensorList<Backend>::VerifySampleShareCompatibility(DALIDataType type, int sample_dim,
-                                                         TensorLayout layout, bool pinned,
-                                                         int device_id,
-                                                         const std::string &error_suffix) {
+                                                         const TensorLayout &layout, bool pinned,
+                                                         int device_id, int sample_idx,
+                                                         int src_sample_idx) {
+  // The suffix is built only when the check fails - this is called for every sample set
+  auto error_suffix = [&]() {
+    if (src_sample_idx >= 0)
+      return make_string(" for source sample idx: ", src_sample_idx,
+                         " and target sample idx: ", sample_idx, ".");
+    else
+      return make_string(" for sample idx: ", sample_idx, ".");
+  };
   // Checks in the order of class members
   DALI_ENFORCE(this->type() == type,
                make_string("Sample must have the same type as the target batch, current: ",
-                           this->type(), ", new: ", type, error_suffix));
+                           this->type(), ", new: ", type, error_suffix()));
 
   DALI_ENFORCE(this->sample_dim() == sample_dim,
                make_string("Sample must have the same sample dim as the target batch, current: ",
-                           this->sample_dim(), ", new: ", sample_dim, error_suffix));
+                           this->sample_dim(), ", new: ", sample_dim, error_suffix()));
 
   DALI_ENFORCE(this->GetLayout() == layout || layout.empty(),
                make_string("Sample must have the same layout as the target batch current: ",
                            this->GetLayout(), ", new: ", layout, " or come with empty layout ",
-                           error_suffix));
+                           error_suffix()));
 
   DALI_ENFORCE(this->is_pinned() == pinned,
                make_string("Sample must have the same pinned status as target batch, current: ",
-                           this->is_pinned(), ", new: ", pinned, error_suffix));
+                           this->is_pinned(), ", new: ", pinned, error_suffix()));
 
   DALI_ENFORCE(this->device_id() == device_id,
                make_string("Sample must have the same device id as target batch, current: ",
-                           this->device_id(), ", new: ", device_id, error_suffix));
+                           this->device_id(), ", new: ", device_id, error_suffix()));
 }
 
 
@@ -278,9 +286,7 @@ void TensorList<Backend>::SetSample(int sample_idx, const TensorList<Backend> &s
   if (&src.tensors_[src_sample_idx] == &tensors_[sample_idx])
     return;
   VerifySampleShareCompatibility(src.type(), src.shape().sample_dim(), src.GetLayout(),
-                                 src.is_pinned(), src.device_id(),
-                                 make_string(" for source sample idx: ", src_sample_idx,
-                                             " and target sample idx: ", sample_idx, "."));
+                                 src.is_pinned(), src.device_id(), sample_idx, src_sample_idx);
 
   shape_.set_tensor_shape(sample_idx, src.shape().tensor_shape_span(src_sample_idx));
 
@@ -306,8 +312,7 @@ void TensorList<Backend>::SetSample(int sample_idx, const Tensor<Backend> &owner
   // Setting any individual sample converts the batch to non-contiguous mode
   MakeNoncontiguous();
   VerifySampleShareCompatibility(owner.type(), owner.shape().sample_dim(), owner.GetLayout(),
-                                 owner.is_pinned(), owner.device_id(),
-                                 make_string(" for sample idx: ", sample_idx, "."));
+                                 owner.is_pinned(), owner.device_id(), sample_idx);
 
   shape_.set_tensor_shape(sample_idx, owner.shape());
 
@@ -335,7 +340,7 @@ void TensorList<Backend>::SetSample(int sample_idx, shared_ptr<void> ptr, size_t
   // Setting any individual sample converts the batch to non-contiguous mode
   MakeNoncontiguous();
   VerifySampleShareCompatibility(type, shape.sample_dim(), layout, pinned, device_id,
-                                 make_string(" for sample idx: ", sample_idx, "."));
+                                 sample_idx);
 
   DALI_ENFORCE(!IsContiguous());
   shape_.set_tensor_shape(sample_idx, shape);
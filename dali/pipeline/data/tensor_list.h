@@ -788,11 +788,13 @@ class DLL_PUBLIC TensorList {
    *
    * When setting new sample the `shape_` must be adjusted.
    *
-   * @param error_suffix Additional description added to the error message
+   * @param sample_idx     Index of the sample being set, used in the error message
+   * @param src_sample_idx Index of the sample in the source batch (if any), used in the error
+   *                       message
    */
-  void VerifySampleShareCompatibility(DALIDataType type, int sample_dim, TensorLayout layout,
-                                      bool pinned, int device_id,
-                                      const std::string &error_suffix = ".");
+  void VerifySampleShareCompatibility(DALIDataType type, int sample_dim,
+                                      const TensorLayout &layout, bool pinned, int device_id,
+                                      int sample_idx, int src_sample_idx = -1);
 
   /**
    * @brief Check if the metadata provided for new sample match the ones currently set for the batch
@@ -23,6 +23,7 @@
 #include "dali/pipeline/workspace/workspace.h"
 #include "dali/pipeline/operator/checkpointing/checkpoint.h"
 #include "dali/pipeline/graph/op_graph2.h"
+#include "dali/pipeline/executor/stall_report.h"
 
 namespace dali {
 
@@ -54,6 +55,8 @@ class DLL_PUBLIC ExecutorBase {
   DLL_PUBLIC virtual void EnableMemoryStats(bool enable_memory_stats = false) = 0;
   DLL_PUBLIC virtual void EnableCheckpointing(bool checkpointing = false) = 0;
   DLL_PUBLIC virtual ExecutorMetaMap GetExecutorMeta() = 0;
+  /** Returns the analysis of the pipeline stalls; empty if not supported or not enabled. */
+  DLL_PUBLIC virtual StallReport GetStallReport() { return {}; }
   DLL_PUBLIC virtual void Shutdown() = 0;
   DLL_PUBLIC virtual Checkpoint& GetCurrentCheckpoint() = 0;
   DLL_PUBLIC virtual void RestoreStateFromCheckpoint(const Checkpoint &cpt) = 0;
@@ -0,0 +1,271 @@
+// Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DALI_PIPELINE_EXECUTOR_EXECUTOR2_ADAPTIVE_TUNER_H_
+#define DALI_PIPELINE_EXECUTOR_EXECUTOR2_ADAPTIVE_TUNER_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include "dali/core/format.h"
+
+namespace dali {
+namespace exec2 {
+
+/** The limits within which the executor may adjust its queue depth and thread count. */
+struct AdaptiveTuningLimits {
+  /** The maximum number of iterations scheduled ahead of the consumer.
+   *
+   * The queue depth requested in the executor's configuration is the lower limit.
+   */
+  int max_queue_depth = 4;
+  /** The minimum number of active threads in the CPU thread pool.
+   *
+   * The thread pool size requested in the executor's configuration is the upper limit.
+   */
+  int min_threads = 1;
+  /** The maximum amount of host memory held by the queued outputs; 0 means no limit. */
+  size_t max_host_memory = 0;
+  /** The number of iterations over which the measurements are aggregated for one decision. */
+  int window = 16;
+};
+
+/** The measurements taken by the executor when an iteration's outputs are consumed. */
+struct IterationTiming {
+  /** The time the consumer waited for the outputs to be ready, in microseconds */
+  double consumer_wait = 0;
+  /** The time since the previous outputs were consumed, in microseconds */
+  double interval = 0;
+  /** The time the CPU operators were running during the interval, in microseconds */
+  double cpu_busy = 0;
+  /** The host memory occupied by the outputs of one iteration, in bytes */
+  size_t host_memory = 0;
+};
+
+/** Adjusts the queue depth and the number of active CPU threads based on measured stalls.
+ *
+ * The measurements are aggregated over a window of iterations. When the consumer of the outputs
+ * keeps waiting for them, the pipeline is the bottleneck:
+ *  - if the CPU stage is busy most of the time, more threads are activated,
+ *  - otherwise, the stalls are caused by uneven iteration times and the queue is made deeper.
+ * A change that doesn't reduce the stalls is reverted and the value becomes a cap for further
+ * growth, so that resources are not overcommitted for no gain.
+ * When the consumer doesn't wait for a few consecutive windows, the resources are gradually
+ * released: first the threads that the CPU stage doesn't need, then the surplus queue depth.
+ */
+class AdaptiveTuner {
+ public:
+  /** The fraction of time the consumer may wait before more resources are used. */
+  static constexpr double kStallThreshold = 0.05;
+  /** The fraction of time the consumer waits below which resources can be released. */
+  static constexpr double kIdleThreshold = 0.01;
+  /** The CPU stage utilization above which it's considered the bottleneck. */
+  static constexpr double kCPUBoundThreshold = 0.8;
+  /** The CPU stage utilization below which some threads can be deactivated. */
+  static constexpr double kCPUIdleThreshold = 0.5;
+  /** The relative reduction in stalls that justifies keeping a change. */
+  static constexpr double kMinImprovement = 0.2;
+  /** The number of consecutive idle windows after which the resources are released. */
+  static constexpr int kIdleWindows = 4;
+  /** The maximum number of idle windows before an attempt to reduce the queue depth. */
+  static constexpr int kMaxIdleWindows = 64;
+
+  enum class Knob {
+    None,
+    QueueDepth,
+    Threads,
+  };
+
+  /**
+   * @param limits          the limits of the adjustment
+   * @param queue_depth     the initial (and minimum) queue depth
+   * @param max_threads     the number of threads in the thread pool; 0 if there's no pool
+   */
+  AdaptiveTuner(const AdaptiveTuningLimits &limits, int queue_depth, int max_threads)
+  : limits_(limits), min_depth_(queue_depth), max_threads_(max_threads) {
+    if (queue_depth < 1)
+      throw std::invalid_argument(make_string("Invalid queue depth: ", queue_depth));
+    if (limits.window < 1)
+      throw std::invalid_argument(make_string("Invalid tuning window: ", limits.window));
+    limits_.max_queue_depth = std::max(limits.max_queue_depth, queue_depth);
+    limits_.min_threads = std::clamp(limits.min_threads, std::min(1, max_threads), max_threads);
+    depth_ = max_depth_reached_ = min_depth_;
+    depth_cap_ = limits_.max_queue_depth;
+    threads_ = thread_cap_ = min_threads_reached_ = max_threads_;
+  }
+
+  /** Records the measurements of an iteration and updates the decisions, if due.
+   *
+   * @return `true` if the queue depth or the thread count has changed.
+   */
+  bool Observe(const IterationTiming &t) {
+    iterations_++;
+    wait_sum_ += t.consumer_wait;
+    interval_sum_ += t.interval;
+    cpu_busy_sum_ += t.cpu_busy;
+    host_memory_ = std::max(host_memory_, t.host_memory);
+    if (++window_size_ < limits_.window)
+      return false;
+
+    double stall = interval_sum_ > 0 ? wait_sum_ / interval_sum_ : 0;
+    double cpu_util = interval_sum_ > 0 ? cpu_busy_sum_ / interval_sum_ : 0;
+    window_size_ = 0;
+    wait_sum_ = interval_sum_ = cpu_busy_sum_ = 0;
+    last_stall_ = stall;
+    last_cpu_utilization_ = cpu_util;
+    return Decide(stall, cpu_util);
+  }
+
+  int QueueDepth() const { return depth_; }
+  int Threads() const { return threads_; }
+
+  int MinQueueDepth() const { return min_depth_; }
+  int MaxQueueDepth() const { return limits_.max_queue_depth; }
+  int MaxQueueDepthReached() const { return max_depth_reached_; }
+  int MinThreads() const { return limits_.min_threads; }
+  int MaxThreads() const { return max_threads_; }
+  int MinThreadsReached() const { return min_threads_reached_; }
+
+  int64_t NumIterations() const { return iterations_; }
+  int64_t NumChanges() const { return num_changes_; }
+  /** The knob that was changed most recently. */
+  Knob LastChange() const { return last_knob_; }
+  /** The fraction of time the consumer waited for the outputs in the last window. */
+  double LastStall() const { return last_stall_; }
+  /** The fraction of time the CPU stage was busy in the last window. */
+  double LastCPUUtilization() const { return last_cpu_utilization_; }
+
+ private:
+  bool MemoryAllows(int depth) const {
+    return limits_.max_host_memory == 0 || depth * host_memory_ <= limits_.max_host_memory;
+  }
+
+  bool Decide(double stall, double cpu_util) {
+    // Never exceed the memory budget, even if it means stalls
+    if (depth_ > min_depth_ && !MemoryAllows(depth_)) {
+      while (depth_ > min_depth_ && !MemoryAllows(depth_))
+        depth_--;
+      depth_cap_ = depth_;
+      return Changed(Knob::QueueDepth);
+    }
+
+    // Evaluate the previous growth - revert it if it didn't help
+    if (pending_knob_ != Knob::None) {
+      Knob knob = pending_knob_;
+      pending_knob_ = Knob::None;
+      if (stall > stall_before_change_ * (1 - kMinImprovement) && stall >= kStallThreshold) {
+        if (knob == Knob::QueueDepth) {
+          depth_--;
+          depth_cap_ = depth_;
+        } else {
+          threads_--;
+          thread_cap_ = threads_;
+        }
+        idle_windows_ = 0;
+        return Changed(knob);
+      }
+    }
+
+    // The queue was too shallow after all - restore it and try again after a longer time
+    if (depth_shrunk_) {
+      depth_shrunk_ = false;
+      if (stall >= kStallThreshold) {
+        depth_++;
+        depth_idle_windows_ = std::min(2 * depth_idle_windows_, kMaxIdleWindows);
+        idle_windows_ = 0;
+        return Changed(Knob::QueueDepth);
+      }
+    }
+
+    if (stall >= kStallThreshold) {
+      idle_windows_ = 0;
+      bool more_threads = threads_ < thread_cap_;
+      bool deeper_queue = depth_ < depth_cap_ && MemoryAllows(depth_ + 1);
+      Knob knob = Knob::None;
+      if (more_threads && (cpu_util >= kCPUBoundThreshold || !deeper_queue))
+        knob = Knob::Threads;
+      else if (deeper_queue)
+        knob = Knob::QueueDepth;
+      if (knob == Knob::None)
+        return false;
+      if (knob == Knob::Threads)
+        threads_++;
+      else
+        depth_++;
+      pending_knob_ = knob;
+      stall_before_change_ = stall;
+      return Changed(knob);
+    }
+
+    if (stall < kIdleThreshold) {
+      if (++idle_windows_ < kIdleWindows)
+        return false;
+      // The conditions may have changed - allow growing again
+      depth_cap_ = limits_.max_queue_depth;
+      thread_cap_ = max_threads_;
+      if (threads_ > limits_.min_threads && cpu_util < kCPUIdleThreshold) {
+        idle_windows_ = 0;
+        threads_--;
+        return Changed(Knob::Threads);
+      }
+      if (depth_ > min_depth_ && idle_windows_ >= depth_idle_windows_) {
+        idle_windows_ = 0;
+        depth_--;
+        depth_shrunk_ = true;
+        return Changed(Knob::QueueDepth);
+      }
+      return false;
+    }
+
+    idle_windows_ = 0;
+    return false;
+  }
+
+  bool Changed(Knob knob) {
+    last_knob_ = knob;
+    num_changes_++;
+    max_depth_reached_ = std::max(max_depth_reached_, depth_);
+    min_threads_reached_ = std::min(min_threads_reached_, threads_);
+    return true;
+  }
+
+  AdaptiveTuningLimits limits_;
+  int min_depth_ = 1;
+  int max_threads_ = 0;
+
+  int depth_ = 1, depth_cap_ = 1, max_depth_reached_ = 1;
+  int threads_ = 0, thread_cap_ = 0, min_threads_reached_ = 0;
+
+  int window_size_ = 0;
+  double wait_sum_ = 0, interval_sum_ = 0, cpu_busy_sum_ = 0;
+  size_t host_memory_ = 0;
+
+  Knob pending_knob_ = Knob::None;
+  double stall_before_change_ = 0;
+  int idle_windows_ = 0;
+  /** The number of idle windows before the queue depth is reduced - grows on failed attempts */
+  int depth_idle_windows_ = kIdleWindows;
+  bool depth_shrunk_ = false;
+
+  int64_t iterations_ = 0;
+  int64_t num_changes_ = 0;
+  Knob last_knob_ = Knob::None;
+  double last_stall_ = 0, last_cpu_utilization_ = 0;
+};
+
+}  // namespace exec2
+}  // namespace dali
+
+#endif  // DALI_PIPELINE_EXECUTOR_EXECUTOR2_ADAPTIVE_TUNER_H_
@@ -0,0 +1,168 @@
+// Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include "dali/pipeline/executor/executor2/adaptive_tuner.h"
+
+namespace dali {
+namespace exec2 {
+namespace test {
+
+namespace {
+
+/** A model of a pipeline which stalls unless it has the required threads and queue depth. */
+struct PipelineModel {
+  int required_threads = 1;
+  int required_depth = 1;
+  /** The stall that can't be fixed by adding resources */
+  double base_stall = 0;
+  size_t host_memory = 0;
+
+  IterationTiming Measure(int threads, int depth) const {
+    IterationTiming t;
+    t.interval = 1000;
+    double stall = base_stall;
+    double cpu_util;
+    if (threads < required_threads) {
+      stall += 0.1 * (required_threads - threads);
+      cpu_util = 1;
+    } else {
+      cpu_util = 0.9 * required_threads / threads;
+    }
+    stall += 0.1 * std::max(required_depth - depth, 0);
+    t.consumer_wait = t.interval * stall;
+    t.cpu_busy = t.interval * cpu_util;
+    t.host_memory = host_memory;
+    return t;
+  }
+};
+
+void Simulate(AdaptiveTuner &tuner, const PipelineModel &model, int iterations,
+              int *max_depth = nullptr, int *max_threads = nullptr) {
+  for (int i = 0; i < iterations; i++) {
+    tuner.Observe(model.Measure(tuner.Threads(), tuner.QueueDepth()));
+    if (max_depth)
+      *max_depth = std::max(*max_depth, tuner.QueueDepth());
+    if (max_threads)
+      *max_threads = std::max(*max_threads, tuner.Threads());
+  }
+}
+
+}  // namespace
+
+TEST(Exec2AdaptiveTuner, ReleasesUnneededThreads) {
+  AdaptiveTuningLimits limits;
+  limits.min_threads = 2;
+  limits.window = 4;
+  AdaptiveTuner tuner(limits, 2, 8);
+  EXPECT_EQ(tuner.Threads(), 8);
+  PipelineModel model;
+  model.required_threads = 1;
+  Simulate(tuner, model, 1000);
+  EXPECT_EQ(tuner.Threads(), 2);
+  EXPECT_EQ(tuner.MinThreadsReached(), 2);
+  EXPECT_EQ(tuner.QueueDepth(), 2);
+}
+
+TEST(Exec2AdaptiveTuner, AddsThreadsWhenCPUBound) {
+  AdaptiveTuningLimits limits;
+  limits.window = 4;
+  AdaptiveTuner tuner(limits, 2, 8);
+  PipelineModel model;
+  model.required_threads = 3;
+  Simulate(tuner, model, 1000);
+  EXPECT_EQ(tuner.Threads(), 5) << "The CPU utilization should stay between 50% and 100%";
+
+  // the load increases
+  model.required_threads = 7;
+  int max_threads = 0;
+  Simulate(tuner, model, 1000, nullptr, &max_threads);
+  EXPECT_EQ(tuner.Threads(), 7);
+  EXPECT_EQ(max_threads, 7);
+  EXPECT_EQ(tuner.QueueDepth(), 2);
+}
+
+TEST(Exec2AdaptiveTuner, DeepensQueueOnStalls) {
+  AdaptiveTuningLimits limits;
+  limits.max_queue_depth = 6;
+  limits.window = 4;
+  AdaptiveTuner tuner(limits, 2, 4);
+  PipelineModel model;
+  model.required_depth = 4;
+  int max_depth = 0;
+  Simulate(tuner, model, 1000, &max_depth);
+  EXPECT_EQ(max_depth, 4);
+  // The tuner occasionally checks whether a shallower queue would do
+  int shallow = 0;
+  for (int i = 0; i < 1000; i++) {
+    tuner.Observe(model.Measure(tuner.Threads(), tuner.QueueDepth()));
+    EXPECT_GE(tuner.QueueDepth(), 3);
+    EXPECT_LE(tuner.QueueDepth(), 4);
+    if (tuner.QueueDepth() < 4)
+      shallow++;
+  }
+  EXPECT_LT(shallow, 50);
+
+  // the stalls are gone - the surplus depth is released
+  model.required_depth = 1;
+  Simulate(tuner, model, 1000);
+  EXPECT_EQ(tuner.QueueDepth(), 2);
+  EXPECT_EQ(tuner.MaxQueueDepthReached(), 4);
+}
+
+TEST(Exec2AdaptiveTuner, RevertsUselessChanges) {
+  AdaptiveTuningLimits limits;
+  limits.max_queue_depth = 8;
+  limits.window = 4;
+  AdaptiveTuner tuner(limits, 2, 4);
+  PipelineModel model;
+  model.base_stall = 0.2;  // e.g. the consumer is fed from a slow source
+  int max_depth = 0;
+  Simulate(tuner, model, 1000, &max_depth);
+  EXPECT_EQ(tuner.QueueDepth(), 2);
+  EXPECT_EQ(max_depth, 3);
+  EXPECT_EQ(tuner.NumChanges(), 2);
+}
+
+TEST(Exec2AdaptiveTuner, RespectsMemoryLimit) {
+  AdaptiveTuningLimits limits;
+  limits.max_queue_depth = 8;
+  limits.max_host_memory = 350;
+  limits.window = 4;
+  AdaptiveTuner tuner(limits, 1, 4);
+  PipelineModel model;
+  model.required_depth = 6;
+  model.host_memory = 100;
+  int max_depth = 0;
+  Simulate(tuner, model, 1000, &max_depth);
+  EXPECT_EQ(tuner.QueueDepth(), 3);
+  EXPECT_EQ(max_depth, 3);
+
+  // the outputs grow - the queue must shrink
+  model.host_memory = 150;
+  Simulate(tuner, model, 100);
+  EXPECT_EQ(tuner.QueueDepth(), 2);
+}
+
+TEST(Exec2AdaptiveTuner, InvalidArguments) {
+  AdaptiveTuningLimits limits;
+  EXPECT_THROW(AdaptiveTuner(limits, 0, 4), std::invalid_argument);
+  limits.window = 0;
+  EXPECT_THROW(AdaptiveTuner(limits, 1, 4), std::invalid_argument);
+}
+
+}  // namespace test
+}  // namespace exec2
+}  // namespace dali
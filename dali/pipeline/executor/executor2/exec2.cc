@@ -12,16 +12,22 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <chrono>
+#include <deque>
 #include <functional>
 #include <map>
+#include <mutex>
 #include <queue>
+#include <string>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include "dali/core/cuda_stream_pool.h"
 #include "dali/core/nvtx.h"
+#include "dali/core/exec/timeline.h"
 #include "dali/pipeline/executor/executor2/exec2.h"
 #include "dali/pipeline/executor/executor2/exec_graph.h"
+#include "dali/pipeline/executor/executor2/stall_analyzer.h"
 #include "dali/pipeline/executor/executor2/stream_assignment.h"
 #include "dali/pipeline/operator/builtin/input_operator.h"
 #include "dali/pipeline/util/new_thread_pool.h"
@@ -117,6 +123,8 @@ class Executor2::Impl {
     ApplyConcurrencyLimit(graph_, config_.concurrency);
     SetupStreams();
     SetupThreadPool();
+    SetupAdaptiveTuning();
+    SetupStallAnalysis();
 
     last_iter_data_ = InitIterationData(-1);
     if (last_iter_data_->checkpoint)
@@ -130,15 +138,28 @@ class Executor2::Impl {
     DeviceGuard dg(config_.device.value_or(CPU_ONLY_DEVICE_ID));
     if (state_ != State::Running)
       throw std::runtime_error("The executor is not initialized.");
-    InitIteration();
-    DomainTimeRange tr("[DALI][Executor] Launch");
-    pending_outputs_.push(graph_.Launch(*exec_));
+    if (!tuner_) {
+      Launch();
+      return;
+    }
+    // The iterations launched on top of the prefetch depth are never expected by the caller,
+    // so they can be taken back by skipping a launch when the queue becomes shallower.
+    int extra = tuner_->QueueDepth() - prefetch_depth_;
+    if (extra_iterations_ > extra) {
+      extra_iterations_--;
+      return;
+    }
+    Launch();
+    for (; extra_iterations_ < extra; extra_iterations_++)
+      Launch();
   }
 
   void Prefetch() {
     DeviceGuard dg(config_.device.value_or(CPU_ONLY_DEVICE_ID));
+    if (state_ != State::Running)
+      throw std::runtime_error("The executor is not initialized.");
     for (int i = 0; i < prefetch_depth_; i++) {
-      Run();
+      Launch();
     }
   }
 
@@ -149,9 +170,21 @@ class Executor2::Impl {
     DeviceGuard dg(config_.device.value_or(CPU_ONLY_DEVICE_ID));
     auto fut = std::move(pending_outputs_.front());
     pending_outputs_.pop();
+    auto wait_start = tuner_ ? clock::now() : clock::time_point();
+    ConsumerTiming consumer_timing;
+    std::shared_ptr<IterationProfile> profile;
+    if (analyzer_) {
+      consumer_timing = CheckOutputQueue();
+      profile = std::move(pending_profiles_.front());
+      pending_profiles_.pop_front();
+    }
     auto &pipe_out = fut.Value<const PipelineOutput &>();
     auto ws = pipe_out.workspace;
     last_iter_data_ = ws.GetIterationData();
+    if (tuner_)
+      ObserveIteration(wait_start, ws);
+    if (profile)
+      AnalyzeIteration(*profile, consumer_timing);
     if (ws.has_event()) {
       if (output_order.has_value() && output_order != ws.output_order())
         output_order.wait(ws.event());
@@ -197,9 +230,17 @@ class Executor2::Impl {
 
   void InitIteration() {
     DomainTimeRange tr("[DALI][Executor] InitIteration");
+    auto &tracer = TimelineTracer::instance();
+    tracer.BeginIteration(iter_index_);
+    static const int timeline_name = tracer.Intern("InitIteration");
+    TimelineScope timeline_scope(timeline_name, TimelineCategory::Executor, iter_index_);
     WorkspaceParams params{};
     params.max_batch_size = config_.max_batch_size;
     params.iter_data = InitIterationData(iter_index_++);
+    if (auto &profile = params.iter_data->profile) {
+      profile->launch_time = ProfileNow();
+      pending_profiles_.push_back(profile);
+    }
     graph_.PrepareIteration(params);
   }
 
@@ -260,15 +301,51 @@ class Executor2::Impl {
     return config_.checkpointing;
   }
 
+  ExecutorMetaMap GetExecutorMeta() const {
+    ExecutorMetaMap meta;
+    if (tuner_) {
+      auto entry = [](int value, int extreme, int min, int max) {
+        ExecutorMeta m{};
+        m.real_size = value;
+        m.max_real_size = extreme;
+        m.reserved = min;
+        m.max_reserved = max;
+        return std::vector<ExecutorMeta>{ m };
+      };
+      meta["adaptive_tuning.queue_depth"] = entry(
+          tuner_->QueueDepth(), tuner_->MaxQueueDepthReached(),
+          tuner_->MinQueueDepth(), tuner_->MaxQueueDepth());
+      meta["adaptive_tuning.thread_pool_threads"] = entry(
+          tuner_->Threads(), tuner_->MinThreadsReached(),
+          tuner_->MinThreads(), tuner_->MaxThreads());
+    }
+    return meta;
+  }
+
+  StallReport GetStallReport() const {
+    std::lock_guard g(analysis_mutex_);
+    return analyzer_ ? analyzer_->Report() : StallReport{};
+  }
+
  private:
+  using clock = std::chrono::steady_clock;
+
   State state_ = State::New;
 
+  void Launch() {
+    InitIteration();
+    DomainTimeRange tr("[DALI][Executor] Launch");
+    pending_outputs_.push(graph_.Launch(*exec_));
+  }
+
   std::shared_ptr<IterationData> InitIterationData(int iter_index) {
     auto iter_data = std::make_shared<IterationData>();
     iter_data->iteration_index = iter_index;
     if (config_.checkpointing) {
       iter_data->checkpoint = CreateCheckpoint(iter_data->iteration_index);
     }
+    if (analyzer_)
+      iter_data->profile = std::make_shared<IterationProfile>(graph_.Nodes().size());
     return iter_data;
   }
 
@@ -381,6 +458,113 @@ class Executor2::Impl {
     }
   }
 
+  void SetupAdaptiveTuning() {
+    tuner_.reset();
+    if (!config_.adaptive_tuning)
+      return;
+    AdaptiveTuningLimits limits = *config_.adaptive_tuning;
+    for (auto &n : graph_.Nodes()) {
+      if (!n.op)
+        continue;
+      // The number of inputs fed ahead of time is tied to the initial prefetch depth
+      if (IsInputOperator(n.op.get()))
+        limits.max_queue_depth = prefetch_depth_;
+      if (n.backend == OpType::CPU)
+        n.measure_time = true;
+    }
+    // Only the threads of the old thread pool can be parked
+    int threads = old_tp_ ? old_tp_->NumThreads() : 0;
+    tuner_.emplace(limits, prefetch_depth_, threads);
+  }
+
+  /** Measures the stalls and the CPU load, as seen by the consumer of the outputs. */
+  void ObserveIteration(clock::time_point wait_start, const Workspace &ws) {
+    auto now = clock::now();
+    int64_t busy_ns = 0;
+    for (auto &n : graph_.Nodes()) {
+      if (n.measure_time)
+        busy_ns += n.busy_time_ns.load(std::memory_order_relaxed);
+    }
+    auto prev_pop = last_pop_;
+    int64_t prev_busy_ns = last_busy_ns_;
+    last_pop_ = now;
+    last_busy_ns_ = busy_ns;
+    if (prev_pop == clock::time_point())
+      return;  // the first iteration - there's no interval to measure
+
+    auto us = [](clock::duration d) {
+      return std::chrono::duration<double, std::micro>(d).count();
+    };
+    IterationTiming t;
+    t.consumer_wait = us(now - wait_start);
+    t.interval = us(now - prev_pop);
+    t.cpu_busy = (busy_ns - prev_busy_ns) * 1e-3;
+    std::unordered_set<const void *> counted;
+    for (int i = 0; i < ws.NumOutput(); i++) {
+      if (ws.OutputIsType<CPUBackend>(i)) {
+        auto &out = ws.Output<CPUBackend>(i);
+        if (counted.insert(&out).second)
+          t.host_memory += out.nbytes();
+      }
+    }
+    if (tuner_->Observe(t) && old_tp_ && tuner_->Threads() != old_tp_->NumActiveThreads())
+      old_tp_->SetActiveThreads(tuner_->Threads());
+  }
+
+  void SetupStallAnalysis() {
+    analyzer_.reset();
+    if (config_.stall_analysis_window <= 0)
+      return;
+    int index = 0;
+    for (auto &n : graph_.Nodes())
+      n.stats_index = index++;
+    std::vector<StallAnalyzer::NodeInfo> nodes;
+    nodes.reserve(index);
+    for (auto &n : graph_.Nodes()) {
+      auto &info = nodes.emplace_back();
+      info.name = n.instance_name;
+      if (n.is_pipeline_output) {
+        info.kind = StallAnalyzer::NodeKind::Output;
+      } else if (n.op) {
+        // The readers and the decoders are recognized by the diagnostics they expose
+        if (n.op->HasDiagnostic("starved_batches"))
+          info.kind = StallAnalyzer::NodeKind::Reader;
+        else if (n.op->HasDiagnostic("decoded_samples"))
+          info.kind = StallAnalyzer::NodeKind::Decoder;
+      }
+      for (auto *edge : n.inputs) {
+        if (edge && edge->producer)
+          info.producers.push_back(edge->producer->stats_index);
+      }
+    }
+    analyzer_.emplace(std::move(nodes), config_.stall_analysis_window);
+  }
+
+  /** Checks the state of the queued iterations before waiting for the oldest one. */
+  ConsumerTiming CheckOutputQueue() const {
+    ConsumerTiming t;
+    t.wait = ProfileNow();  // the start of the wait - replaced with the duration later
+    assert(!pending_profiles_.empty());
+    t.queue_empty = !pending_profiles_.front()->completion_time.load(std::memory_order_acquire);
+    t.queue_full = true;
+    for (auto &p : pending_profiles_) {
+      if (!p->completion_time.load(std::memory_order_acquire)) {
+        t.queue_full = false;
+        break;
+      }
+    }
+    return t;
+  }
+
+  void AnalyzeIteration(const IterationProfile &profile, ConsumerTiming t) {
+    int64_t now = ProfileNow();
+    t.wait = now - t.wait;
+    t.interval = last_analysis_pop_ ? now - last_analysis_pop_ : 0;
+    last_analysis_pop_ = now;
+    std::lock_guard g(analysis_mutex_);
+    analyzer_->Observe(profile, t);
+  }
+
   void Start() {
     if (state_ != State::Built)
       throw std::logic_error("Incorrect state transition.");
@@ -456,6 +640,22 @@ class Executor2::Impl {
 
   int64_t iter_index_ = 0;
   SharedIterData last_iter_data_;
+
+  // adaptive tuning
+
+  std::optional<AdaptiveTuner> tuner_;
+  /** The number of iterations launched on top of the prefetch depth */
+  int extra_iterations_ = 0;
+  clock::time_point last_pop_;
+  int64_t last_busy_ns_ = 0;
+
+  // stall analysis
+
+  std::optional<StallAnalyzer> analyzer_;
+  mutable std::mutex analysis_mutex_;
+  /** The profiles of the iterations whose outputs haven't been popped yet */
+  std::deque<std::shared_ptr<IterationProfile>> pending_profiles_;
+  int64_t last_analysis_pop_ = 0;
 };
 
 
@@ -508,8 +708,12 @@ void Executor2::EnableCheckpointing(bool checkpointing) {
 }
 
 ExecutorMetaMap Executor2::GetExecutorMeta() {
-  // not supported - the "meta" thing assumed persistence of allocations
-  return {};
+  // Memory statistics are not supported - the "meta" thing assumed persistence of allocations
+  return impl_->GetExecutorMeta();
+}
+
+StallReport Executor2::GetStallReport() {
+  return impl_->GetStallReport();
 }
 
 void Executor2::Shutdown() {
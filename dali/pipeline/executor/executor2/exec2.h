@@ -21,6 +21,7 @@
 #include "dali/pipeline/graph/op_graph2.h"
 #include "dali/pipeline/workspace/workspace.h"
 #include "dali/pipeline/executor/executor.h"
+#include "dali/pipeline/executor/executor2/adaptive_tuner.h"
 
 namespace dali {
 namespace exec2 {
@@ -92,6 +93,22 @@ class DLL_PUBLIC Executor2 : public ExecutorBase {
     QueueDepthPolicy queue_policy = QueueDepthPolicy::Legacy;
     OperatorConcurrency concurrency = OperatorConcurrency::Backend;
     StreamPolicy stream_policy = StreamPolicy::PerBackend;
+
+    /** If set, the queue depth and the number of active thread pool threads are adjusted
+     *  at run time, within the given limits.
+     *
+     * The queue depth requested above is the lower limit of the queue depth and
+     * thread_pool_threads is the upper limit of the number of active threads.
+     * The queue depth is not adjusted in pipelines with input operators, because the number of
+     * inputs that need to be fed in advance depends on it.
+     */
+    std::optional<AdaptiveTuningLimits> adaptive_tuning;
+
+    /** If positive, the executor analyzes the stalls and the critical path of the iterations.
+     *
+     * The statistics are aggregated over windows of the given number of iterations.
+     */
+    int stall_analysis_window = 0;
   };
 
   explicit Executor2(const Config &config);
@@ -112,7 +129,17 @@ class DLL_PUBLIC Executor2 : public ExecutorBase {
   void ReleaseOutputs() override;
   void EnableMemoryStats(bool enable_memory_stats = false) override;
   void EnableCheckpointing(bool checkpointing = false) override;
+  /** Returns the state of adaptive tuning, if enabled.
+   *
+   * The map contains the entries "adaptive_tuning.queue_depth" and
+   * "adaptive_tuning.thread_pool_threads", each with one element, where:
+   * - real_size is the current value,
+   * - reserved and max_reserved are the lower and upper limits,
+   * - max_real_size is the maximum (queue depth) or minimum (threads) value reached so far.
+   */
   ExecutorMetaMap GetExecutorMeta() override;
+  /** Returns the stall analysis from the most recent complete window, if enabled. */
+  StallReport GetStallReport() override;
   void Shutdown() override;
   Checkpoint& GetCurrentCheckpoint() override;
   void RestoreStateFromCheckpoint(const Checkpoint &cpt) override;
@@ -146,6 +146,87 @@ TEST_P(Exec2Test, Graph3_SinkOnly) {
   }
 }
 
+TEST(Exec2AdaptiveTest, Graph1_CPUOnly) {
+  Executor2::Config config;
+  config.thread_pool_threads = 4;
+  config.operator_threads = 4;
+  config.cpu_queue_depth = 2;
+  config.adaptive_tuning = AdaptiveTuningLimits{};
+  config.adaptive_tuning->max_queue_depth = 4;
+  config.adaptive_tuning->window = 2;
+  Executor2 exec(config);
+  graph::OpGraph graph = GetTestGraph1();
+  exec.Build(graph);
+  exec.Prefetch();
+  Workspace ws;
+  for (int i = 0; i < 200; i++) {
+    ws.Clear();
+    exec.Outputs(&ws);
+    CheckTestGraph1Results(ws, config.max_batch_size);
+    exec.Run();
+  }
+  // all iterations launched on behalf of the caller can be retrieved
+  for (int i = 0; i < 2; i++) {
+    ws.Clear();
+    exec.Outputs(&ws);
+    CheckTestGraph1Results(ws, config.max_batch_size);
+  }
+
+  auto meta = exec.GetExecutorMeta();
+  ASSERT_EQ(meta.count("adaptive_tuning.queue_depth"), 1u);
+  ASSERT_EQ(meta.count("adaptive_tuning.thread_pool_threads"), 1u);
+  auto depth = meta["adaptive_tuning.queue_depth"][0];
+  EXPECT_GE(depth.real_size, 2u);
+  EXPECT_LE(depth.real_size, 4u);
+  EXPECT_EQ(depth.reserved, 2u);
+  EXPECT_EQ(depth.max_reserved, 4u);
+  auto threads = meta["adaptive_tuning.thread_pool_threads"][0];
+  EXPECT_GE(threads.real_size, 1u);
+  EXPECT_LE(threads.real_size, 4u);
+  EXPECT_EQ(threads.max_reserved, 4u);
+}
+
+TEST(Exec2StallAnalysisTest, Graph1_CPUOnly) {
+  Executor2::Config config;
+  config.thread_pool_threads = 4;
+  config.operator_threads = 4;
+  config.stall_analysis_window = 10;
+  Executor2 exec(config);
+  graph::OpGraph graph = GetTestGraph1();
+  exec.Build(graph);
+  EXPECT_EQ(exec.GetStallReport().iterations, 0);
+  exec.Prefetch();
+  Workspace ws;
+  for (int i = 0; i < 25; i++) {
+    ws.Clear();
+    exec.Outputs(&ws);
+    CheckTestGraph1Results(ws, config.max_batch_size);
+    exec.Run();
+  }
+
+  auto report = exec.GetStallReport();
+  EXPECT_EQ(report.iterations, 10);
+  EXPECT_GT(report.duration_ns, 0);
+  EXPECT_LE(report.queue_empty_stalls + report.queue_full_stalls, 10);
+  EXPECT_GT(report.critical_path_ns, 0);
+  EXPECT_FALSE(report.bottleneck.empty());
+  EXPECT_NE(report.bound, PipelineBound::Reader);
+  EXPECT_NE(report.bound, PipelineBound::Decoder);
+  EXPECT_EQ(report.reader_starved_iterations, 0);
+  int found = 0;
+  int critical = 0;
+  for (auto &op : report.operators) {
+    if (op.name == "op0" || op.name == "op1" || op.name == "op2" || op.name == "op3") {
+      found++;
+      EXPECT_EQ(op.iterations, 10) << op.name;
+      EXPECT_GT(op.busy_ns, 0) << op.name;
+    }
+    critical += op.critical_path_iterations;
+  }
+  EXPECT_EQ(found, 4);
+  // there's at least one operator on each iteration's critical path
+  EXPECT_GE(critical, 10);
+}
 
 Executor2::Config MakeCfg(QueueDepthPolicy q, OperatorConcurrency c, StreamPolicy s) {
   Executor2::Config cfg;
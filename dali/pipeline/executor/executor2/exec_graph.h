@@ -16,6 +16,7 @@
 #define DALI_PIPELINE_EXECUTOR_EXECUTOR2_EXEC_GRAPH_H_
 
 #include <any>
+#include <atomic>
 #include <cassert>
 #include <functional>
 #include <list>
@@ -174,6 +175,15 @@ class DLL_PUBLIC ExecNode {
   /** Data-independent execution environment (thread pool, stream, etc). */
   ExecEnv env = {};
 
+  /** If true, the time spent in the operator's Setup and Run is accumulated in busy_time_ns. */
+  bool measure_time = false;
+
+  /** The total (host) time spent in the operator's Setup and Run, in nanoseconds. */
+  std::atomic<int64_t> busy_time_ns{0};
+
+  /** The index of the node in IterationProfile, or -1 if the node's timing is not recorded. */
+  int stats_index = -1;
+
   /** Obtains the cached workspace, if present, or creates a new one.
    *
    * There can be only one workspace per node. The workspace is removed and then put back.
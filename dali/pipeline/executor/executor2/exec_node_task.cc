@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <chrono>
 #include <memory>
 #include <unordered_set>
 #include <utility>
@@ -19,8 +20,10 @@
 #include <vector>
 #include "dali/pipeline/executor/executor2/exec_node_task.h"
 #include "dali/pipeline/executor/executor2/exec_graph.h"
+#include "dali/pipeline/executor/executor2/stall_analyzer.h"
 #include "dali/pipeline/executor/source_info_propagation.h"
 #include "dali/core/nvtx.h"
+#include "dali/core/exec/timeline.h"
 #include "dali/pipeline/operator/operator.h"
 #include "dali/pipeline/operator/checkpointing/checkpoint.h"
 #include "dali/core/call_at_exit.h"
@@ -110,6 +113,11 @@ class OpTask : public ExecNodeTask {
       std::string init_ws_range_name, setup_range_name, run_range_name;
       uint32_t range_color;
     } nvtx;
+    /** The identifier of the instance name in the timeline */
+    int timeline_name = 0;
+    /** Whether the operator reports the starvation of a reader */
+    bool reader_stats = false;
+    int64_t starved_batches = 0, starvation_time_ns = 0;
   };
   Meta *meta_ = nullptr;
 
@@ -139,9 +147,23 @@ class OpTask : public ExecNodeTask {
       meta->nvtx.init_ws_range_name = make_string("[DALI][Executor] InitWorkspace ", op_name);
       meta->nvtx.setup_range_name   = make_string("[DALI][", device, " op] Setup ", op_name);
       meta->nvtx.run_range_name     = make_string("[DALI][", device, " op] Run ", op_name);
+      meta->timeline_name = TimelineTracer::instance().Intern(
+          node_->instance_name.empty() ? op_name : node_->instance_name);
+      meta->reader_stats = node_->op->HasDiagnostic("starved_batches");
     }
   }
 
+  /** Stores the reader starvation since the previous iteration. */
+  void GetReaderStats(NodeTiming &timing) {
+    auto &op = *node_->op;
+    int64_t starved = op.GetDiagnostic<int64_t>("starved_batches");
+    int64_t wait = op.GetDiagnostic<int64_t>("starvation_time_ns");
+    timing.starved = starved != meta_->starved_batches;
+    timing.reader_wait = wait - meta_->starvation_time_ns;
+    meta_->starved_batches = starved;
+    meta_->starvation_time_ns = wait;
+  }
+
   SmallVector<int, 4> reset_input_layouts_;
 };
 
@@ -161,8 +183,30 @@ OpTask::OpTaskOutputs OpTask::Run() {
   ws_init_tr.reset();  // the range ends here
 
   try {
-    SetupOp();
-    RunOp();
+    auto &iter_data = ws_params_.iter_data;
+    NodeTiming *timing = nullptr;
+    if (node_->stats_index >= 0 && iter_data && iter_data->profile)
+      timing = &iter_data->profile->nodes[node_->stats_index];
+    int64_t start = 0;
+    if (node_->measure_time || timing)
+      start = ProfileNow();
+    {
+      TimelineScope timeline_scope(meta_->timeline_name, TimelineCategory::Operator,
+                                   iter_data ? iter_data->iteration_index : -1);
+      SetupOp();
+      RunOp();
+    }
+    if (node_->measure_time || timing) {
+      int64_t end = ProfileNow();
+      if (node_->measure_time)
+        node_->busy_time_ns.fetch_add(end - start, std::memory_order_relaxed);
+      if (timing) {
+        timing->start = start;
+        timing->end = end;
+        if (meta_->reader_stats)
+          GetReaderStats(*timing);
+      }
+    }
     auto &&ret = GetWorkspaceOutputs();
     return ret;
   } catch (...) {
@@ -562,6 +606,15 @@ PipelineOutput OutputTask::Run() {
     CUDA_CALL(cudaEventRecord(ws_->event(), ws_->output_order().stream()));
   }
 
+  if (auto &iter_data = ws_params_.iter_data; iter_data && iter_data->profile) {
+    int64_t now = ProfileNow();
+    if (node_->stats_index >= 0) {
+      auto &timing = iter_data->profile->nodes[node_->stats_index];
+      timing.start = timing.end = now;
+    }
+    iter_data->profile->completion_time.store(now, std::memory_order_release);
+  }
+
   PipelineOutput ret{ *ws_, event_, device };
   return ret;
 }
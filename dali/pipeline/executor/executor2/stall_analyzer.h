@@ -0,0 +1,258 @@
+// Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DALI_PIPELINE_EXECUTOR_EXECUTOR2_STALL_ANALYZER_H_
+#define DALI_PIPELINE_EXECUTOR_EXECUTOR2_STALL_ANALYZER_H_
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include "dali/core/format.h"
+#include "dali/pipeline/executor/stall_report.h"
+
+namespace dali {
+namespace exec2 {
+
+/** The current time, in nanoseconds, as used in IterationProfile */
+inline int64_t ProfileNow() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/** The host-side timestamps of a node in one iteration, in nanoseconds; 0 if it didn't run. */
+struct NodeTiming {
+  int64_t start = 0;
+  int64_t end = 0;
+  /** The time a reader waited for the prefetching thread */
+  int64_t reader_wait = 0;
+  /** Whether a reader found its prefetch queue empty */
+  bool starved = false;
+};
+
+/** The timing of all nodes in one iteration.
+ *
+ * The nodes are written by the tasks of the iteration and read when its outputs are popped.
+ */
+struct IterationProfile {
+  explicit IterationProfile(int num_nodes) : nodes(num_nodes) {}
+
+  /** The time when the iteration was launched */
+  int64_t launch_time = 0;
+  /** Indexed with ExecNode::stats_index */
+  std::vector<NodeTiming> nodes;
+  /** The time when the outputs of the iteration became ready; can be polled by the executor */
+  std::atomic<int64_t> completion_time{0};
+};
+
+/** The measurements taken by the executor when the outputs of an iteration are popped. */
+struct ConsumerTiming {
+  /** The time the consumer waited for the outputs, in nanoseconds */
+  int64_t wait = 0;
+  /** The time since the previous outputs were popped, in nanoseconds */
+  int64_t interval = 0;
+  /** The outputs were not ready when requested */
+  bool queue_empty = false;
+  /** All queued iterations were ready when the outputs were requested */
+  bool queue_full = false;
+};
+
+/** Computes the critical path of the iterations and aggregates per-operator statistics.
+ *
+ * The critical path is traced back from the pipeline output, always following the producer
+ * which finished last. The statistics are aggregated over a window of iterations; when the window
+ * is complete, it becomes the current report and a new one is started.
+ */
+class StallAnalyzer {
+ public:
+  enum class NodeKind {
+    Other,
+    Reader,
+    Decoder,
+    Output,
+  };
+
+  struct NodeInfo {
+    std::string name;
+    NodeKind kind = NodeKind::Other;
+    /** The indices of the nodes which produce the inputs of this node */
+    std::vector<int> producers;
+  };
+
+  /** The fraction of iterations with a full output queue above which the consumer is the
+   *  bottleneck. */
+  static constexpr double kConsumerBoundThreshold = 0.5;
+
+  StallAnalyzer(std::vector<NodeInfo> nodes, int window)
+  : nodes_(std::move(nodes)), window_(window) {
+    if (window < 1)
+      throw std::invalid_argument(make_string("Invalid stall analysis window: ", window));
+    int n = nodes_.size();
+    op_index_.resize(n, -1);
+    for (int i = 0; i < n; i++) {
+      for (int p : nodes_[i].producers) {
+        if (p < 0 || p >= n)
+          throw std::out_of_range(make_string("Invalid producer index ", p, " of node ", i));
+      }
+      if (nodes_[i].kind == NodeKind::Output) {
+        output_ = i;
+      } else {
+        op_index_[i] = num_ops_++;
+      }
+    }
+    ready_.resize(n);
+    ResetWindow();
+  }
+
+  /** Adds the measurements of an iteration. */
+  void Observe(const IterationProfile &profile, const ConsumerTiming &consumer) {
+    int n = nodes_.size();
+    if (static_cast<int>(profile.nodes.size()) != n)
+      throw std::invalid_argument("The profile doesn't match the graph.");
+
+    bool starved = false;
+    for (int i = 0; i < n; i++) {
+      auto &t = profile.nodes[i];
+      if (!t.end)
+        continue;
+      int64_t ready = profile.launch_time;
+      for (int p : nodes_[i].producers)
+        ready = std::max(ready, profile.nodes[p].end);
+      ready_[i] = ready;
+      if (op_index_[i] < 0)
+        continue;
+      auto &op = current_.operators[op_index_[i]];
+      op.iterations++;
+      op.busy_ns += t.end - t.start;
+      op.blocked_ns += std::max<int64_t>(t.start - ready, 0);
+      if (t.starved) {
+        op.starved_iterations++;
+        starved = true;
+      }
+      op.starvation_ns += t.reader_wait;
+    }
+
+    if (output_ >= 0 && profile.nodes[output_].end)
+      current_.critical_path_ns += TraceCriticalPath(profile);
+
+    current_.iterations++;
+    current_.duration_ns += consumer.interval;
+    current_.consumer_wait_ns += consumer.wait;
+    current_.queue_empty_stalls += consumer.queue_empty;
+    current_.queue_full_stalls += consumer.queue_full;
+    current_.reader_starved_iterations += starved;
+
+    if (current_.iterations >= window_) {
+      Finalize(current_);
+      report_ = std::move(current_);
+      has_report_ = true;
+      ResetWindow();
+    }
+  }
+
+  /** Returns the report from the last complete window or, if there's none, the current one. */
+  StallReport Report() const {
+    if (has_report_)
+      return report_;
+    StallReport r = current_;
+    Finalize(r);
+    return r;
+  }
+
+  int Window() const { return window_; }
+
+ private:
+  /** Marks the operators on the critical path and returns the length of the path. */
+  int64_t TraceCriticalPath(const IterationProfile &profile) {
+    int64_t length = 0;
+    int node = output_;
+    for (;;) {
+      int last = -1;
+      for (int p : nodes_[node].producers) {
+        if (profile.nodes[p].end && (last < 0 || profile.nodes[p].end > profile.nodes[last].end))
+          last = p;
+      }
+      if (last < 0)
+        break;
+      node = last;
+      auto &t = profile.nodes[node];
+      if (op_index_[node] >= 0) {
+        auto &op = current_.operators[op_index_[node]];
+        op.critical_path_iterations++;
+        op.critical_path_ns += t.end - t.start;
+      }
+      length += t.end - std::min(t.start, ready_[node]);
+    }
+    return length;
+  }
+
+  void Finalize(StallReport &r) const {
+    const OperatorStallStats *bottleneck = nullptr;
+    NodeKind kind = NodeKind::Other;
+    for (int i = 0; i < static_cast<int>(nodes_.size()); i++) {
+      if (op_index_[i] < 0)
+        continue;
+      auto &op = r.operators[op_index_[i]];
+      op.idle_ns = std::max<int64_t>(r.duration_ns - op.busy_ns - op.blocked_ns, 0);
+      if (op.critical_path_ns > 0 &&
+          (!bottleneck || op.critical_path_ns > bottleneck->critical_path_ns)) {
+        bottleneck = &op;
+        kind = nodes_[i].kind;
+      }
+    }
+    r.bottleneck = bottleneck ? bottleneck->name : std::string();
+    if (r.iterations == 0)
+      r.bound = PipelineBound::Unknown;
+    else if (r.queue_full_stalls > kConsumerBoundThreshold * r.iterations)
+      r.bound = PipelineBound::Consumer;
+    else if (!bottleneck)
+      r.bound = PipelineBound::Unknown;
+    else if (kind == NodeKind::Reader)
+      r.bound = PipelineBound::Reader;
+    else if (kind == NodeKind::Decoder)
+      r.bound = PipelineBound::Decoder;
+    else
+      r.bound = PipelineBound::Processing;
+  }
+
+  void ResetWindow() {
+    current_ = {};
+    current_.operators.resize(num_ops_);
+    for (int i = 0; i < static_cast<int>(nodes_.size()); i++) {
+      if (op_index_[i] >= 0)
+        current_.operators[op_index_[i]].name = nodes_[i].name;
+    }
+  }
+
+  std::vector<NodeInfo> nodes_;
+  /** The index of the node's statistics in the report; -1 for the output node */
+  std::vector<int> op_index_;
+  int num_ops_ = 0;
+  int output_ = -1;
+  int window_ = 1;
+  /** The time when the inputs of the node became ready, in the current iteration */
+  std::vector<int64_t> ready_;
+
+  StallReport current_, report_;
+  bool has_report_ = false;
+};
+
+}  // namespace exec2
+}  // namespace dali
+
+#endif  // DALI_PIPELINE_EXECUTOR_EXECUTOR2_STALL_ANALYZER_H_
@@ -0,0 +1,161 @@
+// Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+#include "dali/pipeline/executor/executor2/stall_analyzer.h"
+
+namespace dali {
+namespace exec2 {
+namespace test {
+
+namespace {
+
+using Kind = StallAnalyzer::NodeKind;
+
+/**
+ * reader (0) -> decoder (1) -> resize (2) -> output (4)
+ *    \                                       /
+ *     ----------> labels (3) ---------------
+ */
+std::vector<StallAnalyzer::NodeInfo> TestGraph() {
+  return {
+    { "reader", Kind::Reader, {} },
+    { "decoder", Kind::Decoder, { 0 } },
+    { "resize", Kind::Other, { 1 } },
+    { "labels", Kind::Other, { 0 } },
+    { "output", Kind::Output, { 2, 3 } },
+  };
+}
+
+/** Simulates an iteration where the nodes run back to back, each for the given time */
+std::unique_ptr<IterationProfile> Iteration(int64_t launch, int64_t reader, int64_t decoder,
+                                            int64_t resize, int64_t labels,
+                                            int64_t reader_wait = 0) {
+  auto p = std::make_unique<IterationProfile>(5);
+  p->launch_time = launch;
+  auto run = [&](int node, int64_t start, int64_t duration) {
+    p->nodes[node].start = start;
+    p->nodes[node].end = start + duration;
+    return start + duration;
+  };
+  int64_t r = run(0, launch, reader);
+  p->nodes[0].reader_wait = reader_wait;
+  p->nodes[0].starved = reader_wait > 0;
+  int64_t d = run(1, r, decoder);
+  int64_t rs = run(2, d, resize);
+  int64_t l = run(3, r + 5, labels);  // the labels wait for a thread for a while
+  run(4, std::max(rs, l), 1);
+  p->completion_time = std::max(rs, l) + 1;
+  return p;
+}
+
+}  // namespace
+
+TEST(Exec2StallAnalyzer, CriticalPath) {
+  StallAnalyzer analyzer(TestGraph(), 4);
+  ConsumerTiming c;
+  c.interval = 1000;
+  for (int i = 0; i < 3; i++)
+    analyzer.Observe(*Iteration(i * 1000, 100, 500, 200, 10), c);
+
+  // the window is not complete yet - a partial report is returned
+  auto r = analyzer.Report();
+  EXPECT_EQ(r.iterations, 3);
+  EXPECT_EQ(r.duration_ns, 3000);
+  ASSERT_EQ(r.operators.size(), 4u);
+  EXPECT_EQ(r.bound, PipelineBound::Decoder);
+  EXPECT_EQ(r.bottleneck, "decoder");
+  EXPECT_EQ(r.critical_path_ns, 3 * 800);
+
+  auto &reader = r.operators[0];
+  EXPECT_EQ(reader.name, "reader");
+  EXPECT_EQ(reader.iterations, 3);
+  EXPECT_EQ(reader.busy_ns, 300);
+  EXPECT_EQ(reader.blocked_ns, 0);
+  EXPECT_EQ(reader.idle_ns, 2700);
+  EXPECT_EQ(reader.critical_path_iterations, 3);
+
+  auto &decoder = r.operators[1];
+  EXPECT_EQ(decoder.critical_path_iterations, 3);
+  EXPECT_EQ(decoder.critical_path_ns, 1500);
+
+  auto &labels = r.operators[3];
+  EXPECT_EQ(labels.busy_ns, 30);
+  EXPECT_EQ(labels.blocked_ns, 15);
+  EXPECT_EQ(labels.critical_path_iterations, 0);
+  EXPECT_EQ(labels.critical_path_ns, 0);
+}
+
+TEST(Exec2StallAnalyzer, WindowAndStarvation) {
+  StallAnalyzer analyzer(TestGraph(), 4);
+  ConsumerTiming c;
+  c.interval = 1000;
+  c.wait = 300;
+  c.queue_empty = true;
+  // the reader waits for the data most of the time
+  for (int i = 0; i < 4; i++)
+    analyzer.Observe(*Iteration(i * 1000, 700, 50, 50, 10, 650), c);
+  auto r = analyzer.Report();
+  EXPECT_EQ(r.iterations, 4);
+  EXPECT_EQ(r.bound, PipelineBound::Reader);
+  EXPECT_EQ(r.bottleneck, "reader");
+  EXPECT_EQ(r.queue_empty_stalls, 4);
+  EXPECT_EQ(r.consumer_wait_ns, 1200);
+  EXPECT_EQ(r.reader_starved_iterations, 4);
+  EXPECT_EQ(r.operators[0].starved_iterations, 4);
+  EXPECT_EQ(r.operators[0].starvation_ns, 2600);
+
+  // the next window is in progress - the complete one is reported
+  c = {};
+  c.interval = 1000;
+  c.queue_full = true;
+  for (int i = 0; i < 3; i++)
+    analyzer.Observe(*Iteration(i * 1000, 100, 50, 50, 10), c);
+  EXPECT_EQ(analyzer.Report().bound, PipelineBound::Reader);
+  analyzer.Observe(*Iteration(3000, 100, 50, 50, 10), c);
+  r = analyzer.Report();
+  EXPECT_EQ(r.bound, PipelineBound::Consumer);
+  EXPECT_EQ(r.queue_full_stalls, 4);
+  EXPECT_EQ(r.queue_empty_stalls, 0);
+  EXPECT_EQ(r.reader_starved_iterations, 0);
+}
+
+TEST(Exec2StallAnalyzer, SkippedNodes) {
+  StallAnalyzer analyzer(TestGraph(), 2);
+  auto p = Iteration(0, 100, 500, 200, 10);
+  // e.g. conditional execution - the decoder and resize didn't run
+  p->nodes[1] = {};
+  p->nodes[2] = {};
+  analyzer.Observe(*p, {});
+  auto r = analyzer.Report();
+  EXPECT_EQ(r.operators[1].iterations, 0);
+  EXPECT_EQ(r.operators[3].critical_path_iterations, 1);
+  EXPECT_EQ(r.bottleneck, "reader");
+  EXPECT_EQ(r.bound, PipelineBound::Reader);
+}
+
+TEST(Exec2StallAnalyzer, InvalidArguments) {
+  EXPECT_THROW(StallAnalyzer(TestGraph(), 0), std::invalid_argument);
+  std::vector<StallAnalyzer::NodeInfo> bad = { { "a", Kind::Other, { 1 } } };
+  EXPECT_THROW(StallAnalyzer(bad, 1), std::out_of_range);
+  StallAnalyzer analyzer(TestGraph(), 1);
+  EXPECT_THROW(analyzer.Observe(IterationProfile(3), {}), std::invalid_argument);
+  EXPECT_EQ(analyzer.Report().bound, PipelineBound::Unknown);
+}
+
+}  // namespace test
+}  // namespace exec2
+}  // namespace dali
@@ -27,6 +27,23 @@ namespace dali {
 
 namespace {
 
+exec2::AdaptiveTuningLimits AdaptiveTuningLimitsFromEnv() {
+  auto env_int = [](const char *name, int64_t default_value) -> int64_t {
+    const char *env = getenv(name);
+    if (env) {
+      int64_t value = atoll(env);
+      if (value >= 0)
+        return value;
+    }
+    return default_value;
+  };
+  exec2::AdaptiveTuningLimits limits{};
+  limits.max_queue_depth = env_int("DALI_EXEC2_ADAPTIVE_MAX_QUEUE_DEPTH", limits.max_queue_depth);
+  limits.min_threads = env_int("DALI_EXEC2_ADAPTIVE_MIN_THREADS", limits.min_threads);
+  limits.max_host_memory = env_int("DALI_EXEC2_ADAPTIVE_MAX_HOST_MEMORY_MB", 0) << 20;
+  return limits;
+}
+
 auto MakeExec2Config(int batch_size, int num_thread, int device_id,
                      size_t bytes_per_sample_hint, ExecutorFlags flags,
                      QueueSizes prefetch_queue_depth) {
@@ -90,6 +107,13 @@ auto MakeExec2Config(int batch_size, int num_thread, int device_id,
       cfg.concurrency = exec2::OperatorConcurrency::Backend;
       break;
   }
+  if (Test(flags, ExecutorFlags::AdaptiveTuning))
+    cfg.adaptive_tuning = AdaptiveTuningLimitsFromEnv();
+  // The analysis can also be enabled just by setting the window size
+  const char *window_env = getenv("DALI_EXEC2_STALL_ANALYSIS_WINDOW");
+  int window = window_env ? atoi(window_env) : 0;
+  if (Test(flags, ExecutorFlags::StallAnalysis) || window > 0)
+    cfg.stall_analysis_window = window > 0 ? window : 64;
   return cfg;
 }
 
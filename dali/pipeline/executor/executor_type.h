@@ -30,6 +30,8 @@ enum class ExecutorFlags : int {
   StreamPolicySingle = 1 << 4,
   StreamPolicyPerBackend = 2 << 4,
   StreamPolicyPerOperator = 3 << 4,
+  AdaptiveTuning = 1 << 7,
+  StallAnalysis = 1 << 8,
 };
 
 constexpr ExecutorFlags operator|(ExecutorFlags a, ExecutorFlags b) {
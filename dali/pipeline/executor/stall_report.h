@@ -0,0 +1,105 @@
+// Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DALI_PIPELINE_EXECUTOR_STALL_REPORT_H_
+#define DALI_PIPELINE_EXECUTOR_STALL_REPORT_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace dali {
+
+/** The part of the processing which limits the throughput of the pipeline. */
+enum class PipelineBound : int {
+  Unknown,     //< There's not enough data
+  Consumer,    //< The pipeline is faster than the consumer of its outputs
+  Reader,      //< The readers (I/O)
+  Decoder,     //< The decoders
+  Processing,  //< The remaining operators (e.g. augmentations)
+};
+
+inline const char *PipelineBoundName(PipelineBound bound) {
+  switch (bound) {
+    case PipelineBound::Consumer:
+      return "consumer";
+    case PipelineBound::Reader:
+      return "reader";
+    case PipelineBound::Decoder:
+      return "decoder";
+    case PipelineBound::Processing:
+      return "processing";
+    default:
+      return "unknown";
+  }
+}
+
+/** The statistics of one operator, aggregated over a window of iterations.
+ *
+ * The times are measured on the host, in nanoseconds. For GPU operators, the busy time is
+ * the time it takes to schedule the work.
+ */
+struct OperatorStallStats {
+  std::string name;
+  /** The number of iterations in which the operator ran */
+  int iterations = 0;
+  /** The time spent in the operator's Setup and Run */
+  int64_t busy_ns = 0;
+  /** The time between the inputs becoming ready and the start of the operator.
+   *
+   * The operator was waiting for a worker thread, for its previous iteration or for the consumers
+   * to release its output queue.
+   */
+  int64_t blocked_ns = 0;
+  /** The remaining time in the window */
+  int64_t idle_ns = 0;
+  /** The number of iterations in which the operator was on the critical path */
+  int critical_path_iterations = 0;
+  /** The busy time in the iterations in which the operator was on the critical path */
+  int64_t critical_path_ns = 0;
+  /** Readers only: the number of iterations in which the prefetched data was not ready */
+  int starved_iterations = 0;
+  /** Readers only: the time spent waiting for the prefetching thread; included in busy_ns */
+  int64_t starvation_ns = 0;
+};
+
+/** The analysis of stalls in the pipeline, aggregated over a window of iterations. */
+struct StallReport {
+  /** The number of iterations in the window; 0 if the analysis is not enabled */
+  int iterations = 0;
+  /** The wall time of the window, as seen by the consumer of the outputs */
+  int64_t duration_ns = 0;
+  /** The time the consumer waited for the outputs */
+  int64_t consumer_wait_ns = 0;
+  /** The number of iterations in which the outputs weren't ready when requested */
+  int queue_empty_stalls = 0;
+  /** The number of iterations in which the whole output queue was ready before it was requested.
+   *
+   * The pipeline was waiting for the consumer to free the queue.
+   */
+  int queue_full_stalls = 0;
+  /** The total length of the critical paths of the iterations */
+  int64_t critical_path_ns = 0;
+  /** The number of iterations in which any of the readers was starved */
+  int reader_starved_iterations = 0;
+  /** What limits the throughput */
+  PipelineBound bound = PipelineBound::Unknown;
+  /** The operator which contributed the most to the critical path */
+  std::string bottleneck;
+  std::vector<OperatorStallStats> operators;
+};
+
+}  // namespace dali
+
+#endif  // DALI_PIPELINE_EXECUTOR_STALL_REPORT_H_
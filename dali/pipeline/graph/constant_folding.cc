@@ -0,0 +1,296 @@
+// Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dali/pipeline/graph/constant_folding.h"
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+#include "dali/core/static_switch.h"
+#include "dali/pipeline/operator/builtin/conditional/split_merge.h"
+#include "dali/pipeline/operator/operator.h"
+#include "dali/pipeline/util/thread_pool.h"
+#include "dali/pipeline/workspace/workspace.h"
+
+namespace dali {
+namespace graph {
+
+namespace {
+
+using ConstantValue = std::shared_ptr<TensorList<CPUBackend>>;
+
+/** The maximum number of elements in a sample of a folded output */
+constexpr int64_t kMaxFoldedElements = 1 << 16;
+
+/** The number of samples with which the constant subgraphs are evaluated
+ *
+ * More than one sample is used to detect the operators which produce different samples
+ * from identical inputs.
+ */
+constexpr int kFoldingBatchSize = 2;
+
+/** Checks that all samples in the batch are identical. */
+bool IsUniformBatch(const TensorList<CPUBackend> &tl) {
+  int n = tl.num_samples();
+  if (n == 0)
+    return false;
+  const auto &shape = tl.shape();
+  size_t sample_bytes = shape[0].num_elements() * tl.type_info().size();
+  for (int i = 1; i < n; i++) {
+    if (shape[i] != shape[0])
+      return false;
+    if (std::memcmp(tl.raw_tensor(i), tl.raw_tensor(0), sample_bytes))
+      return false;
+  }
+  return true;
+}
+
+template <typename T>
+std::optional<std::vector<int>> ToIntData(const T *data, int64_t n) {
+  std::vector<int> values(n);
+  for (int64_t i = 0; i < n; i++) {
+    if constexpr (!std::is_same_v<T, bool>) {
+      if (!std::in_range<int>(data[i]))
+        return std::nullopt;
+    }
+    values[i] = static_cast<int>(data[i]);
+  }
+  return values;
+}
+
+template <typename T>
+std::vector<float> ToFloatData(const T *data, int64_t n) {
+  std::vector<float> values(n);
+  for (int64_t i = 0; i < n; i++)
+    values[i] = static_cast<float>(data[i]);
+  return values;
+}
+
+/** Produces a spec of a Constant operator which yields the value, or nothing if it can't. */
+std::optional<OpSpec> MakeConstantSpec(const OpSpec &producer, int output_idx,
+                                       const TensorList<CPUBackend> &value) {
+  if (!IsUniformBatch(value))
+    return std::nullopt;
+  auto sample_shape = value.tensor_shape(0);
+  int64_t n = sample_shape.num_elements();
+  if (n == 0 || n > kMaxFoldedElements)
+    return std::nullopt;
+  for (auto extent : sample_shape)
+    if (extent > std::numeric_limits<int>::max())
+      return std::nullopt;
+
+  OpSpec spec("Constant");
+  spec.AddArg("device", "cpu");
+  DALIDataType type = value.type();
+  bool ok = true;
+  const void *data = value.raw_tensor(0);
+  TYPE_SWITCH(type, type2id, T, (bool, int8_t, uint8_t, int16_t, uint16_t, int32_t, uint32_t,
+                                 int64_t, uint64_t),
+    (
+      auto idata = ToIntData(static_cast<const T *>(data), n);
+      if (idata)
+        spec.AddArg("idata", *idata);
+      else
+        ok = false;
+    ), (  // NOLINT
+      TYPE_SWITCH(type, type2id, T, (float, float16),
+        (spec.AddArg("fdata", ToFloatData(static_cast<const T *>(data), n));),
+        (ok = false;));
+    ));  // NOLINT
+  if (!ok)
+    return std::nullopt;
+
+  std::vector<int> shape(sample_shape.begin(), sample_shape.end());
+  spec.AddArg("shape", shape);
+  spec.AddArg("dtype", type);
+  auto layout = value.GetLayout();
+  if (!layout.empty())
+    spec.AddArg("layout", layout.str());
+
+  for (const char *arg : { "max_batch_size", "num_threads", "device_id" }) {
+    int v;
+    if (producer.TryGetArgument(v, arg))
+      spec.AddArg(arg, v);
+  }
+  bool checkpointing = false;
+  if (producer.TryGetArgument(checkpointing, "checkpointing"))
+    spec.AddArg("checkpointing", checkpointing);
+  spec.AddOutput(producer.OutputName(output_idx), StorageDevice::CPU);
+  return spec;
+}
+
+/** The context for constant folding */
+class ConstantFolder {
+ public:
+  void Run(OpGraph &graph, OptimizationStats *stats) {
+    for (auto &node : graph.OpNodes()) {
+      if (IsConstantSource(node))
+        Evaluate(node);
+      else if (IsFoldable(node) && HasConstantInputs(node) && Evaluate(node))
+        folded_.insert(&node);
+    }
+    if (folded_.empty())
+      return;
+
+    OpGraph::Builder builder;
+    int constant_nodes = 0;
+    for (auto &node : graph.OpNodes()) {
+      if (!folded_.count(&node)) {
+        builder.Add(node.instance_name, node.spec);
+        continue;
+      }
+      for (int o = 0; o < static_cast<int>(node.outputs.size()); o++) {
+        auto *out = node.outputs[o];
+        if (!IsUsedOutsideFolded(*out))
+          continue;
+        builder.Add(FoldedInstanceName(graph, node, o), std::move(*constant_specs_[out]));
+        constant_nodes++;
+      }
+    }
+    for (auto output_name : graph.Outputs())
+      builder.AddOutput(std::string(output_name));
+
+    graph = {};
+    graph = std::move(builder).GetGraph(true);
+
+    if (stats) {
+      stats->folded_ops += folded_.size();
+      stats->constant_nodes += constant_nodes;
+    }
+  }
+
+ private:
+  static bool IsConstantSource(const OpNode &node) {
+    return node.op_type == OpType::CPU && node.spec.SchemaName() == "Constant";
+  }
+
+  static bool IsFoldable(const OpNode &node) {
+    if (node.op_type != OpType::CPU || node.inputs.empty())
+      return false;
+    auto &spec = node.spec;
+    auto &schema = spec.GetSchemaOrDefault();
+    return !schema.IsDefault() &&
+           !schema.IsStateful() &&
+           !schema.HasRandomSeedArg() &&
+           !schema.IsNoPrune() &&
+           schema.IsSerializable() &&
+           !IsSplitOrMerge(schema) &&
+           spec.SchemaName() != "MakeContiguous" &&
+           !spec.GetArgument<bool>("preserve") &&
+           !spec.GetArgument<bool>("preserve_name");
+  }
+
+  bool HasConstantInputs(const OpNode &node) const {
+    for (auto *in : node.inputs)
+      if (!values_.count(in))
+        return false;
+    return true;
+  }
+
+  /** Whether the data node is a pipeline output or is consumed by an operator that's kept. */
+  bool IsUsedOutsideFolded(const DataNode &data) const {
+    if (data.pipeline_output)
+      return true;
+    for (auto &consumer : data.consumers)
+      if (!folded_.count(consumer.op))
+        return true;
+    return false;
+  }
+
+  static std::string FoldedInstanceName(const OpGraph &graph, const OpNode &node, int output_idx) {
+    std::string base = make_string(node.instance_name, "__folded_", output_idx);
+    std::string name = base;
+    for (int i = 1; graph.GetOp(name); i++)
+      name = make_string(base, "_", i);
+    return name;
+  }
+
+  ThreadPool &GetThreadPool() {
+    if (!tp_)
+      tp_ = std::make_unique<OldThreadPool>(1, CPU_ONLY_DEVICE_ID, false, "[DALI][CF]");
+    return *tp_;
+  }
+
+  /** Runs the operator on the constant inputs and stores the values of its outputs.
+   *
+   * @return true, if the operator was successfully evaluated and all of its outputs can be
+   *         replaced with Constant operators
+   */
+  bool Evaluate(const OpNode &node) {
+    std::vector<ConstantValue> outputs;
+    try {
+      auto &spec = node.spec;
+      int batch_size = std::min(kFoldingBatchSize, spec.GetArgument<int>("max_batch_size"));
+      auto op = InstantiateOperator(spec);
+      Workspace ws;
+      ws.SetThreadPool(&GetThreadPool());
+      for (int i = 0; i < spec.NumInput(); i++) {
+        auto &value = values_.at(node.inputs[i]);
+        if (spec.IsArgumentInput(i))
+          ws.AddArgumentInput(spec.ArgumentInputName(i), value);
+        else
+          ws.AddInput(value);
+      }
+      for (int o = 0; o < spec.NumOutput(); o++) {
+        outputs.push_back(std::make_shared<TensorList<CPUBackend>>());
+        ws.AddOutput(outputs.back());
+      }
+      ws.SetBatchSizes(batch_size);
+      std::vector<OutputDesc> output_desc;
+      if (op->Setup(output_desc, ws)) {
+        for (int o = 0; o < spec.NumOutput(); o++)
+          outputs[o]->Resize(output_desc[o].shape, output_desc[o].type,
+                             BatchContiguity::Contiguous);
+      }
+      op->Run(ws);
+    } catch (...) {
+      // Let the error be reported when the pipeline runs
+      return false;
+    }
+
+    std::vector<std::optional<OpSpec>> specs(outputs.size());
+    for (int o = 0; o < static_cast<int>(outputs.size()); o++) {
+      specs[o] = MakeConstantSpec(node.spec, o, *outputs[o]);
+      if (!specs[o])
+        return false;
+    }
+    for (int o = 0; o < static_cast<int>(outputs.size()); o++) {
+      values_[node.outputs[o]] = std::move(outputs[o]);
+      constant_specs_[node.outputs[o]] = std::move(specs[o]);
+    }
+    return true;
+  }
+
+  std::map<const DataNode *, ConstantValue> values_;
+  std::map<const DataNode *, std::optional<OpSpec>> constant_specs_;
+  std::unordered_set<const OpNode *> folded_;
+  std::unique_ptr<ThreadPool> tp_;
+};
+
+}  // namespace
+
+void FoldConstants(OpGraph &graph, OptimizationStats *stats) {
+  ConstantFolder folder;
+  folder.Run(graph, stats);
+}
+
+}  // namespace graph
+}  // namespace dali
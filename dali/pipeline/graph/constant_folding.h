@@ -0,0 +1,65 @@
+// Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DALI_PIPELINE_GRAPH_CONSTANT_FOLDING_H_
+#define DALI_PIPELINE_GRAPH_CONSTANT_FOLDING_H_
+
+#include "dali/pipeline/graph/op_graph2.h"
+#include "dali/pipeline/graph/optimization_stats.h"
+
+namespace dali {
+namespace graph {
+
+/** Evaluates constant subgraphs at build time and replaces them with Constant operators.
+ *
+ * The graph is traversed in topological order. The outputs of CPU `Constant` operators are
+ * constant; an operator whose inputs (positional and argument inputs) are all constant is
+ * evaluated once, on a small batch, and its outputs become constant, too.
+ * The graph is then rewritten - each output of a folded operator which is consumed by
+ * an operator that was not folded is produced by a new `Constant` operator with the same output
+ * name. The subgraphs which are no longer needed are pruned.
+ *
+ * The operators which are not folded:
+ * - GPU and mixed operators
+ * - stateful operators (including random ones) and operators with NoPrune schema
+ * - unserializable operators (e.g. Python functions)
+ * - operators with `preserve` or `preserve_name` argument set
+ * - split/merge (conditional execution) and MakeContiguous
+ *
+ * An operator is folded only if all of its outputs can be represented by a `Constant`:
+ * every sample in the batch is the same, the type is a numeric type other than double,
+ * integer values fit in 32 bits and the size doesn't exceed a limit.
+ * If the evaluation of an operator fails, it's left in the graph, so that the error is reported
+ * when the pipeline is run.
+ *
+ * Example:
+ *
+ * ```
+ * Constant -- c --- Cast(dtype=FLOAT) -- c_float -- Mul --> pipeline_output
+ *                                                  /
+ * ExternalSource -- images ------------------------
+ * ```
+ * becomes
+ * ```
+ * Constant(fdata=...) -- c_float -- Mul --> pipeline_output
+ *                                  /
+ * ExternalSource -- images --------
+ * ```
+ */
+void FoldConstants(OpGraph &graph, OptimizationStats *stats = nullptr);
+
+}  // namespace graph
+}  // namespace dali
+
+#endif  // DALI_PIPELINE_GRAPH_CONSTANT_FOLDING_H_
@@ -0,0 +1,209 @@
+// Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <string>
+#include <utility>
+#include <vector>
+#include "dali/pipeline/graph/constant_folding.h"
+#include "dali/pipeline/graph/unused_outputs.h"
+#include "dali/pipeline/operator/operator.h"
+
+namespace dali {
+namespace graph {
+namespace test {
+
+namespace {
+
+OpSpec CPUSpec(const std::string &schema) {
+  OpSpec spec(schema);
+  spec.AddArg("device", "cpu");
+  spec.AddArg("max_batch_size", 4);
+  spec.AddArg("num_threads", 1);
+  return spec;
+}
+
+OpSpec ConstantSpec(const std::string &output, std::vector<int> data) {
+  OpSpec spec = CPUSpec("Constant");
+  spec.AddArg("idata", data);
+  spec.AddOutput(output, StorageDevice::CPU);
+  return spec;
+}
+
+OpSpec CastSpec(const std::string &input, const std::string &output, DALIDataType type) {
+  OpSpec spec = CPUSpec("Cast");
+  spec.AddArg("dtype", type);
+  spec.AddInput(input, StorageDevice::CPU);
+  spec.AddOutput(output, StorageDevice::CPU);
+  return spec;
+}
+
+/** Adds an operator which consumes the data and something that's not a constant */
+void AddConsumer(OpGraph::Builder &b, const std::string &input) {
+  OpSpec src("dummy_source");
+  src.AddOutput("ext", StorageDevice::CPU);
+  b.Add("src", src);
+
+  OpSpec consumer("dummy");
+  consumer.AddInput(input, StorageDevice::CPU);
+  consumer.AddInput("ext_cpu", StorageDevice::CPU);
+  consumer.AddOutput("out", StorageDevice::CPU);
+  b.Add("consumer", consumer);
+  b.AddOutput("out_cpu");
+}
+
+/** Finds the Constant operator which produces the data node */
+const OpNode *GetProducer(const OpGraph &g, std::string_view data_name) {
+  auto *data = g.GetData(data_name);
+  if (!data)
+    return nullptr;
+  return data->producer.op;
+}
+
+}  // namespace
+
+TEST(ConstantFoldingTest, FoldChain) {
+  OpGraph::Builder b;
+  b.Add("c", ConstantSpec("c", { 1, 2, 200 }));
+  b.Add("to_float", CastSpec("c_cpu", "f", DALI_FLOAT));
+  b.Add("to_u8", CastSpec("f_cpu", "u8", DALI_UINT8));
+  AddConsumer(b, "u8_cpu");
+  OpGraph g = std::move(b).GetGraph(true);
+
+  OptimizationStats stats;
+  FoldConstants(g, &stats);
+  EXPECT_EQ(stats.folded_ops, 2);
+  EXPECT_EQ(stats.constant_nodes, 1);
+  EXPECT_EQ(g.GetOp("c"), nullptr);
+  EXPECT_EQ(g.GetOp("to_float"), nullptr);
+  EXPECT_EQ(g.GetOp("to_u8"), nullptr);
+  ASSERT_EQ(g.OpNodes().size(), 3u);
+
+  auto *folded = GetProducer(g, "u8_cpu");
+  ASSERT_NE(folded, nullptr);
+  EXPECT_EQ(folded->spec.SchemaName(), "Constant");
+  EXPECT_EQ(folded->spec.GetArgument<DALIDataType>("dtype"), DALI_UINT8);
+  EXPECT_EQ(folded->spec.GetRepeatedArgument<int>("idata"), std::vector<int>({ 1, 2, 200 }));
+  EXPECT_EQ(folded->spec.GetRepeatedArgument<int>("shape"), std::vector<int>({ 3 }));
+  EXPECT_EQ(folded->spec.GetArgument<int>("max_batch_size"), 4);
+  ASSERT_EQ(folded->outputs.size(), 1u);
+  ASSERT_EQ(folded->outputs[0]->consumers.size(), 1u);
+  EXPECT_EQ(folded->outputs[0]->consumers[0].op, g.GetOp("consumer"));
+
+  // the spec of the inserted Constant is valid
+  auto op = InstantiateOperator(folded->spec);
+  EXPECT_NE(op, nullptr);
+}
+
+TEST(ConstantFoldingTest, FloatAndShapes) {
+  OpGraph::Builder b;
+  b.Add("c", ConstantSpec("c", { 1, 2, 3, 4, 5, 6 }));
+  b.Add("to_float", CastSpec("c_cpu", "f", DALI_FLOAT));
+  OpSpec shapes = CPUSpec("Shapes");
+  shapes.AddArg("dtype", DALI_INT64);
+  shapes.AddInput("c_cpu", StorageDevice::CPU);
+  shapes.AddOutput("shape", StorageDevice::CPU);
+  b.Add("shapes", shapes);
+  OpSpec consumer("dummy");
+  consumer.AddInput("f_cpu", StorageDevice::CPU);
+  consumer.AddInput("shape_cpu", StorageDevice::CPU);
+  consumer.AddInput("c_cpu", StorageDevice::CPU);
+  consumer.AddOutput("out", StorageDevice::CPU);
+  b.Add("consumer", consumer);
+  b.AddOutput("out_cpu");
+  OpGraph g = std::move(b).GetGraph(true);
+
+  OptimizationStats stats;
+  FoldConstants(g, &stats);
+  EXPECT_EQ(stats.folded_ops, 2);
+  EXPECT_EQ(stats.constant_nodes, 2);
+  // the original constant is still used
+  EXPECT_NE(g.GetOp("c"), nullptr);
+
+  auto *f = GetProducer(g, "f_cpu");
+  ASSERT_NE(f, nullptr);
+  EXPECT_EQ(f->spec.SchemaName(), "Constant");
+  EXPECT_EQ(f->spec.GetArgument<DALIDataType>("dtype"), DALI_FLOAT);
+  EXPECT_EQ(f->spec.GetRepeatedArgument<float>("fdata"),
+            std::vector<float>({ 1, 2, 3, 4, 5, 6 }));
+
+  auto *s = GetProducer(g, "shape_cpu");
+  ASSERT_NE(s, nullptr);
+  EXPECT_EQ(s->spec.SchemaName(), "Constant");
+  EXPECT_EQ(s->spec.GetArgument<DALIDataType>("dtype"), DALI_INT64);
+  EXPECT_EQ(s->spec.GetRepeatedArgument<int>("idata"), std::vector<int>({ 6 }));
+}
+
+TEST(ConstantFoldingTest, NotFoldable) {
+  OpGraph::Builder b;
+  b.Add("c", ConstantSpec("c", { 1, 2, 3 }));
+  OpSpec preserved = CastSpec("c_cpu", "f", DALI_FLOAT);
+  preserved.AddArg("preserve", true);
+  b.Add("preserved", preserved);
+  OpSpec gpu_cast("Cast");
+  gpu_cast.AddArg("device", "gpu");
+  gpu_cast.AddArg("dtype", DALI_FLOAT);
+  gpu_cast.AddInput("c_cpu", StorageDevice::CPU);
+  gpu_cast.AddOutput("g", StorageDevice::GPU);
+  b.Add("gpu_cast", gpu_cast);
+  b.AddOutput("f_cpu");
+  b.AddOutput("g_gpu");
+  OpGraph g = std::move(b).GetGraph(true);
+
+  OptimizationStats stats;
+  FoldConstants(g, &stats);
+  EXPECT_EQ(stats.folded_ops, 0);
+  EXPECT_EQ(stats.constant_nodes, 0);
+  EXPECT_EQ(g.OpNodes().size(), 3u);
+  EXPECT_NE(g.GetOp("preserved"), nullptr);
+  EXPECT_NE(g.GetOp("gpu_cast"), nullptr);
+}
+
+TEST(UnusedOutputsTest, MarkUnusedOutputs) {
+  OpGraph::Builder b;
+  OpSpec src("dummy_source");
+  src.AddOutput("seq", StorageDevice::CPU);
+  b.Add("src", src);
+  OpSpec extract = CPUSpec("ElementExtract");
+  extract.AddArg("element_map", std::vector<int>{ 0, 1, 2 });
+  extract.AddInput("seq_cpu", StorageDevice::CPU);
+  extract.AddOutput("e0", StorageDevice::CPU);
+  extract.AddOutput("e1", StorageDevice::CPU);
+  extract.AddOutput("e2", StorageDevice::CPU);
+  b.Add("extract", extract);
+  OpSpec consumer("dummy");
+  consumer.AddInput("e1_cpu", StorageDevice::CPU);
+  consumer.AddOutput("out", StorageDevice::CPU);
+  b.Add("consumer", consumer);
+  b.AddOutput("out_cpu");
+  OpGraph g = std::move(b).GetGraph(true);
+
+  OptimizationStats stats;
+  MarkUnusedOutputs(g, &stats);
+  EXPECT_EQ(stats.unused_outputs, 2);
+  EXPECT_EQ(stats.ops_with_unused_outputs, 1);
+  auto *node = g.GetOp("extract");
+  ASSERT_NE(node, nullptr);
+  EXPECT_EQ(node->spec.GetRepeatedArgument<int>("_unused_outputs"), std::vector<int>({ 0, 2 }));
+  EXPECT_FALSE(g.GetOp("consumer")->spec.HasArgument("_unused_outputs"));
+
+  auto op = InstantiateOperator(node->spec);
+  EXPECT_FALSE(op->IsOutputUsed(0));
+  EXPECT_TRUE(op->IsOutputUsed(1));
+  EXPECT_FALSE(op->IsOutputUsed(2));
+}
+
+}  // namespace test
+}  // namespace graph
+}  // namespace dali
@@ -0,0 +1,40 @@
+// Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DALI_PIPELINE_GRAPH_OPTIMIZATION_STATS_H_
+#define DALI_PIPELINE_GRAPH_OPTIMIZATION_STATS_H_
+
+namespace dali {
+namespace graph {
+
+/** The work eliminated by the graph optimization passes in one build of a pipeline. */
+struct OptimizationStats {
+  /** The number of operators merged with identical ones by common subgraph elimination */
+  int cse_merged_ops = 0;
+  /** The number of operators evaluated at build time and replaced with constants */
+  int folded_ops = 0;
+  /** The number of Constant operators inserted in place of the folded subgraphs */
+  int constant_nodes = 0;
+  /** The number of operator outputs which are not consumed by anything */
+  int unused_outputs = 0;
+  /** The number of operators which were told that some of their outputs are unused */
+  int ops_with_unused_outputs = 0;
+  /** Whether the optimized graph was taken from the build cache instead of being computed */
+  bool cached = false;
+};
+
+}  // namespace graph
+}  // namespace dali
+
+#endif  // DALI_PIPELINE_GRAPH_OPTIMIZATION_STATS_H_
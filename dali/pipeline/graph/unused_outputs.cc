@@ -0,0 +1,43 @@
+// Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dali/pipeline/graph/unused_outputs.h"
+#include <vector>
+
+namespace dali {
+namespace graph {
+
+void MarkUnusedOutputs(OpGraph &graph, OptimizationStats *stats) {
+  for (auto &node : graph.OpNodes()) {
+    std::vector<int> unused;
+    for (int o = 0; o < static_cast<int>(node.outputs.size()); o++) {
+      auto *out = node.outputs[o];
+      if (out && !out->pipeline_output && out->consumers.empty())
+        unused.push_back(o);
+    }
+    if (unused.empty()) {
+      if (node.spec.HasArgument("_unused_outputs"))
+        node.spec.SetArg("_unused_outputs", unused);
+      continue;
+    }
+    if (stats) {
+      stats->unused_outputs += unused.size();
+      stats->ops_with_unused_outputs++;
+    }
+    node.spec.SetArg("_unused_outputs", unused);
+  }
+}
+
+}  // namespace graph
+}  // namespace dali
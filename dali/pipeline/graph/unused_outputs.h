@@ -0,0 +1,38 @@
+// Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DALI_PIPELINE_GRAPH_UNUSED_OUTPUTS_H_
+#define DALI_PIPELINE_GRAPH_UNUSED_OUTPUTS_H_
+
+#include "dali/pipeline/graph/op_graph2.h"
+#include "dali/pipeline/graph/optimization_stats.h"
+
+namespace dali {
+namespace graph {
+
+/** Tells the operators which of their outputs are not used.
+ *
+ * An output is unused if it's neither consumed by another operator nor a pipeline output.
+ * The indices of such outputs are stored in the internal `_unused_outputs` argument of the
+ * operator's spec, from which they're available through `OperatorBase::IsOutputUsed`.
+ * The operators may then skip producing these outputs.
+ *
+ * This pass should run after all the passes that modify the structure of the graph.
+ */
+void MarkUnusedOutputs(OpGraph &graph, OptimizationStats *stats = nullptr);
+
+}  // namespace graph
+}  // namespace dali
+
+#endif  // DALI_PIPELINE_GRAPH_UNUSED_OUTPUTS_H_
@@ -24,6 +24,7 @@
 #include "dali/core/geom/geom_utils.h"
 #include "dali/pipeline/data/tensor.h"
 #include "dali/pipeline/data/views.h"
+#include "dali/pipeline/operator/arg_slot.h"
 #include "dali/pipeline/operator/argument.h"
 #include "dali/pipeline/operator/op_spec.h"
 
@@ -94,9 +95,9 @@ class ArgValue {
   using TV = TensorView<StorageCPU, const T, ndim>;
 
   ArgValue(std::string arg_name, const OpSpec &spec)
-      : arg_name_(std::move(arg_name)) {
+      : arg_name_(std::move(arg_name)), arg_input_(arg_name_, spec) {
     has_explicit_const_ = spec.HasArgument(arg_name_);
-    has_arg_input_ = spec.HasTensorArgument(arg_name_);
+    has_arg_input_ = arg_input_.IsDefined();
     assert(!(has_explicit_const_ && has_arg_input_));
 
     ReadConstant(spec, false);  // not raising errors here
@@ -150,7 +151,7 @@ class ArgValue {
     assert(!(flags & ArgValue_EnforceUniform) || is_uniform(expected_shape));
     assert(expected_shape.num_samples() == nsamples);
     if (has_arg_input_) {
-      auto &inp = ws.ArgumentInput(arg_name_);
+      auto &inp = arg_input_.Get(ws);
       if (inp.sample_dim() == 0 && ndim != 0) {
         DALI_ENFORCE(inp.num_samples() == nsamples, make_string(
           "Unexpected number of samples for argument \"", arg_name_, "\". Expected ", nsamples,
@@ -235,7 +236,7 @@ class ArgValue {
                const TensorShape<ndim> &expected_shape,
                ArgValueFlags flags = ArgValue_Default) {
     if (has_arg_input_) {
-      auto &inp = ws.ArgumentInput(arg_name_);
+      auto &inp = arg_input_.Get(ws);
       if (inp.sample_dim() == 0 && ndim != 0) {
         DALI_ENFORCE(inp.num_samples() == nsamples, make_string(
           "Unexpected number of samples for argument \"", arg_name_, "\". Expected ", nsamples,
@@ -318,7 +319,7 @@ class ArgValue {
                ArgValueFlags flags = ArgValue_Default,
                ShapeFromSizeFn &&shape_from_size = {}) {
     if (has_arg_input_) {
-      auto &inp = ws.ArgumentInput(arg_name_);
+      auto &inp = arg_input_.Get(ws);
       DALI_ENFORCE(inp.num_samples() == nsamples, make_string(
         "Unexpected number of samples for argument \"", arg_name_, "\". Expected ", nsamples,
         ", got ", inp.num_samples()));
@@ -435,6 +436,7 @@ class ArgValue {
   }
 
   std::string arg_name_;
+  ArgInputRef arg_input_;  // resolved once, at construction
 
   std::vector<T> data_;  // stores scalar data
   std::vector<std::vector<T>> broadcast_data_;  // storage for broadcasting data from inputs
@@ -0,0 +1,213 @@
+// Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DALI_PIPELINE_OPERATOR_ARG_SLOT_H_
+#define DALI_PIPELINE_OPERATOR_ARG_SLOT_H_
+
+#include <string>
+#include <utility>
+#include <vector>
+#include "dali/core/error_handling.h"
+#include "dali/core/tensor_shape_print.h"
+#include "dali/pipeline/operator/op_spec.h"
+#include "dali/pipeline/workspace/workspace.h"
+
+namespace dali {
+
+/**
+ * @brief A reference to an argument input, resolved when the operator is constructed.
+ *
+ * The position of the input in the workspace is remembered, so that, in the steady state,
+ * the input is found with an index and a name check instead of a map lookup.
+ */
+class ArgInputRef {
+ public:
+  ArgInputRef() = default;
+
+  ArgInputRef(std::string name, const OpSpec &spec) : name_(std::move(name)) {
+    if (spec.HasTensorArgument(name_)) {
+      // the executor adds the argument inputs to the workspace in the order of the spec
+      ws_idx_ = spec.ArgumentInputIdx(name_) - spec.NumRegularInput();
+    }
+  }
+
+  /**
+   * @brief true if the argument is provided as an argument input
+   */
+  bool IsDefined() const {
+    return ws_idx_ >= 0;
+  }
+
+  const std::string &name() const {
+    return name_;
+  }
+
+  /**
+   * @brief Gets the argument input from the workspace
+   *
+   * If the workspace lists its argument inputs in a different order, the name is looked up
+   * once and the new position is remembered for the subsequent calls.
+   */
+  const TensorList<CPUBackend> &Get(const ArgumentWorkspace &ws) {
+    assert(IsDefined());
+    if (ws_idx_ >= ws.NumArgumentInput() || ws.ArgumentInputName(ws_idx_) != name_)
+      ws_idx_ = ws.ArgumentInputIdx(name_);
+    return ws.ArgumentInput(ws_idx_);
+  }
+
+ private:
+  std::string name_;
+  int ws_idx_ = -1;
+};
+
+/**
+ * @brief A handle to a scalar argument, which can take a different value for each sample.
+ *
+ * The handle is created in the operator's constructor, where the source of the value is resolved.
+ * Then, the values for the whole batch are acquired with a single call per iteration - the type
+ * and shape of an argument input are validated once per batch, rather than once per sample.
+ *
+ * An argument input can be either a batch of scalars (or single-element tensors) or a single
+ * tensor containing one value for each sample.
+ * Constant arguments (explicit or default) are broadcast to all samples.
+ *
+ * @tparam T the type of the argument; argument inputs must match it exactly.
+ */
+template <typename T>
+class ArgSlot {
+ public:
+  ArgSlot() = default;
+
+  ArgSlot(std::string name, const OpSpec &spec) : input_(std::move(name), spec) {
+    if (!input_.IsDefined()) {
+      has_explicit_const_ = spec.HasArgument(input_.name());
+      if (has_explicit_const_) {
+        constant_ = spec.GetArgument<T>(input_.name());  // raises an error on type mismatch
+        has_constant_value_ = true;
+      } else {
+        has_constant_value_ = spec.TryGetArgument<T>(constant_, input_.name());
+      }
+    }
+  }
+
+  const std::string &name() const {
+    return input_.name();
+  }
+
+  /**
+   * @brief true if there is a value available (explicit or default)
+   */
+  bool HasValue() const {
+    return HasArgumentInput() || has_constant_value_;
+  }
+
+  /**
+   * @brief true if there is a value explicitly provided (constant or argument input)
+   */
+  bool HasExplicitValue() const {
+    return HasArgumentInput() || has_explicit_const_;
+  }
+
+  /**
+   * @brief true if there is an argument input
+   */
+  bool HasArgumentInput() const {
+    return input_.IsDefined();
+  }
+
+  explicit operator bool() const {
+    return HasValue();
+  }
+
+  /**
+   * @brief Acquires the values for a batch of `nsamples` samples
+   *
+   * @return the per-sample values; the reference stays valid until the next call to Acquire.
+   */
+  const std::vector<T> &Acquire(const ArgumentWorkspace &ws, int nsamples) {
+    DALI_ENFORCE(nsamples >= 0,
+                 make_string("Invalid batch size. Expected nonnegative, actual: ", nsamples));
+    if (!HasArgumentInput()) {
+      DALI_ENFORCE(has_constant_value_, make_string(
+          "Argument \"", name(), "\" is not defined and it has no default value."));
+      values_.assign(nsamples, constant_);
+      return values_;
+    }
+
+    const auto &inp = input_.Get(ws);
+    DALI_ENFORCE(IsType<T>(inp.type()), make_string(
+        "Unexpected type of argument \"", name(), "\". Expected ",
+        TypeTable::GetTypeName<T>(), " and got ", inp.type()));
+    const auto &shape = inp.shape();
+    int n = shape.num_samples();
+    values_.resize(nsamples);
+    if (n == 1 && nsamples != 1) {
+      DALI_ENFORCE(shape.num_elements() == nsamples, make_string(
+          "Argument \"", name(), "\" must be a batch of ", nsamples,
+          " scalars or a single tensor with ", nsamples, " elements. Got:\n", shape));
+      const T *data = static_cast<const T *>(inp.raw_tensor(0));
+      for (int i = 0; i < nsamples; i++)
+        values_[i] = data[i];
+    } else {
+      bool valid_shape = n == nsamples;
+      for (int i = 0; i < n && valid_shape && shape.sample_dim() > 0; i++)
+        valid_shape = volume(shape.tensor_shape_span(i)) == 1;
+      DALI_ENFORCE(valid_shape, make_string(
+          "Unexpected shape of argument \"", name(), "\". Expected batch of ", nsamples,
+          " scalars or a batch of tensors containing one element per sample. Got:\n", shape));
+      for (int i = 0; i < nsamples; i++)
+        values_[i] = *static_cast<const T *>(inp.raw_tensor(i));
+    }
+    return values_;
+  }
+
+  /**
+   * @brief Acquires the values for a batch of `nsamples` samples or, if the argument was not
+   *        provided explicitly, broadcasts `default_value` (the schema default is not used).
+   */
+  const std::vector<T> &Acquire(const ArgumentWorkspace &ws, int nsamples,
+                                const T &default_value) {
+    if (HasExplicitValue())
+      return Acquire(ws, nsamples);
+    values_.assign(nsamples, default_value);
+    return values_;
+  }
+
+  /**
+   * @brief The values from the last call to Acquire
+   */
+  const std::vector<T> &values() const {
+    return values_;
+  }
+
+  const T &operator[](int sample_idx) const {
+    assert(sample_idx >= 0 && sample_idx < static_cast<int>(values_.size()));
+    return values_[sample_idx];
+  }
+
+  int size() const {
+    return values_.size();
+  }
+
+ private:
+  ArgInputRef input_;
+  T constant_{};
+  bool has_explicit_const_ = false;
+  bool has_constant_value_ = false;
+  std::vector<T> values_;
+};
+
+}  // namespace dali
+
+#endif  // DALI_PIPELINE_OPERATOR_ARG_SLOT_H_
@@ -0,0 +1,163 @@
+// Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dali/pipeline/operator/arg_slot.h"
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+#include "dali/pipeline/operator/op_spec.h"
+#include "dali/pipeline/workspace/workspace.h"
+
+namespace dali {
+
+DALI_SCHEMA(ArgSlotTestOp)
+  .DocStr(R"(Dummy op schema)")
+  .AddOptionalArg<float>("scalar", R"(dummy float argument)", 0.5f, true)
+  .AddOptionalArg<float>("other", R"(dummy float argument)", 0.0f, true)
+  .AddOptionalArg<float>("no_default", R"(dummy float argument)", nullptr, true);
+
+namespace {
+
+constexpr int kNumSamples = 5;
+
+std::shared_ptr<TensorList<CPUBackend>> MakeScalarBatch(const TensorListShape<> &shape,
+                                                        float offset = 0) {
+  auto tl = std::make_shared<TensorList<CPUBackend>>();
+  tl->set_pinned(false);
+  tl->Resize(shape, DALI_FLOAT);
+  float value = offset;
+  for (int i = 0; i < tl->num_samples(); i++) {
+    float *data = tl->mutable_tensor<float>(i);
+    for (int j = 0; j < volume(shape[i]); j++)
+      data[j] = value++;
+  }
+  return tl;
+}
+
+}  // namespace
+
+TEST(ArgSlot, Default) {
+  OpSpec spec("ArgSlotTestOp");
+  ArgumentWorkspace ws;
+  ArgSlot<float> arg("scalar", spec);
+  EXPECT_TRUE(arg.HasValue());
+  EXPECT_FALSE(arg.HasExplicitValue());
+  EXPECT_FALSE(arg.HasArgumentInput());
+  auto &values = arg.Acquire(ws, kNumSamples);
+  EXPECT_EQ(values, std::vector<float>(kNumSamples, 0.5f));
+  // the fallback value takes precedence over the schema default
+  EXPECT_EQ(arg.Acquire(ws, 3, 2.0f), std::vector<float>(3, 2.0f));
+}
+
+TEST(ArgSlot, Constant) {
+  OpSpec spec("ArgSlotTestOp");
+  spec.AddArg("scalar", 42.0f);
+  ArgumentWorkspace ws;
+  ArgSlot<float> arg("scalar", spec);
+  EXPECT_TRUE(arg.HasExplicitValue());
+  EXPECT_FALSE(arg.HasArgumentInput());
+  EXPECT_EQ(arg.Acquire(ws, kNumSamples), std::vector<float>(kNumSamples, 42.0f));
+  EXPECT_EQ(arg.Acquire(ws, 2, 2.0f), std::vector<float>(2, 42.0f));
+  EXPECT_EQ(arg.Acquire(ws, kNumSamples + 1), std::vector<float>(kNumSamples + 1, 42.0f));
+  EXPECT_EQ(arg.size(), kNumSamples + 1);
+}
+
+TEST(ArgSlot, NoValue) {
+  OpSpec spec("ArgSlotTestOp");
+  ArgumentWorkspace ws;
+  ArgSlot<float> arg("no_default", spec);
+  EXPECT_FALSE(arg.HasValue());
+  EXPECT_THROW(arg.Acquire(ws, kNumSamples), std::runtime_error);
+  EXPECT_EQ(arg.Acquire(ws, kNumSamples, 1.0f), std::vector<float>(kNumSamples, 1.0f));
+}
+
+TEST(ArgSlot, ArgumentInput) {
+  OpSpec spec("ArgSlotTestOp");
+  spec.AddArgumentInput("scalar", "scalar");
+  ArgumentWorkspace ws;
+  ws.AddArgumentInput("scalar", MakeScalarBatch(uniform_list_shape(kNumSamples, {1})));
+  ArgSlot<float> arg("scalar", spec);
+  EXPECT_TRUE(arg.HasArgumentInput());
+  auto &values = arg.Acquire(ws, kNumSamples);
+  ASSERT_EQ(values.size(), static_cast<size_t>(kNumSamples));
+  for (int i = 0; i < kNumSamples; i++) {
+    EXPECT_EQ(values[i], i);
+    EXPECT_EQ(arg[i], i);
+  }
+  // the fallback is not used when there's an argument input
+  EXPECT_EQ(arg.Acquire(ws, kNumSamples, -1.0f)[2], 2.0f);
+}
+
+TEST(ArgSlot, ArgumentInputScalars) {
+  OpSpec spec("ArgSlotTestOp");
+  spec.AddArgumentInput("scalar", "scalar");
+  ArgumentWorkspace ws;
+  ws.AddArgumentInput("scalar", MakeScalarBatch(uniform_list_shape(kNumSamples, TensorShape<>{})));
+  ArgSlot<float> arg("scalar", spec);
+  auto &values = arg.Acquire(ws, kNumSamples);
+  for (int i = 0; i < kNumSamples; i++)
+    EXPECT_EQ(values[i], i);
+}
+
+TEST(ArgSlot, ArgumentInputSingleTensor) {
+  OpSpec spec("ArgSlotTestOp");
+  spec.AddArgumentInput("scalar", "scalar");
+  ArgumentWorkspace ws;
+  ws.AddArgumentInput("scalar", MakeScalarBatch(uniform_list_shape(1, {kNumSamples})));
+  ArgSlot<float> arg("scalar", spec);
+  auto &values = arg.Acquire(ws, kNumSamples);
+  for (int i = 0; i < kNumSamples; i++)
+    EXPECT_EQ(values[i], i);
+}
+
+TEST(ArgSlot, ArgumentInputInvalid) {
+  OpSpec spec("ArgSlotTestOp");
+  spec.AddArgumentInput("scalar", "scalar");
+  ArgumentWorkspace ws;
+  ws.AddArgumentInput("scalar", MakeScalarBatch(uniform_list_shape(kNumSamples, {2})));
+  ArgSlot<float> arg("scalar", spec);
+  EXPECT_THROW(arg.Acquire(ws, kNumSamples), std::runtime_error);
+
+  ws.SetArgumentInput(0, MakeScalarBatch(uniform_list_shape(kNumSamples - 1, {1})));
+  EXPECT_THROW(arg.Acquire(ws, kNumSamples), std::runtime_error);
+
+  ws.SetArgumentInput(0, MakeScalarBatch(uniform_list_shape(kNumSamples, {1})));
+  ArgSlot<int> wrong_type("scalar", spec);
+  EXPECT_THROW(wrong_type.Acquire(ws, kNumSamples), std::runtime_error);
+}
+
+TEST(ArgSlot, WorkspaceOrder) {
+  OpSpec spec("ArgSlotTestOp");
+  spec.AddArgumentInput("scalar", "scalar");
+  spec.AddArgumentInput("other", "other");
+  ArgSlot<float> scalar("scalar", spec), other("other", spec);
+
+  // same order as in the spec
+  ArgumentWorkspace ws1;
+  ws1.AddArgumentInput("scalar", MakeScalarBatch(uniform_list_shape(kNumSamples, {1}), 0));
+  ws1.AddArgumentInput("other", MakeScalarBatch(uniform_list_shape(kNumSamples, {1}), 100));
+  // different order
+  ArgumentWorkspace ws2;
+  ws2.AddArgumentInput("other", MakeScalarBatch(uniform_list_shape(kNumSamples, {1}), 300));
+  ws2.AddArgumentInput("scalar", MakeScalarBatch(uniform_list_shape(kNumSamples, {1}), 200));
+
+  for (int iter = 0; iter < 2; iter++) {
+    EXPECT_EQ(scalar.Acquire(ws1, kNumSamples)[1], 1);
+    EXPECT_EQ(other.Acquire(ws1, kNumSamples)[1], 101);
+    EXPECT_EQ(scalar.Acquire(ws2, kNumSamples)[1], 201);
+    EXPECT_EQ(other.Acquire(ws2, kNumSamples)[1], 301);
+  }
+}
+
+}  // namespace dali
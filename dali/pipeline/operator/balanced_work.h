@@ -0,0 +1,228 @@
+// Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DALI_PIPELINE_OPERATOR_BALANCED_WORK_H_
+#define DALI_PIPELINE_OPERATOR_BALANCED_WORK_H_
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+#include "dali/core/common.h"
+#include "dali/core/format.h"
+#include "dali/pipeline/util/thread_pool_interface.h"
+#include "dali/pipeline/workspace/workspace.h"
+
+namespace dali {
+
+/**
+ * @brief Estimates the time needed to process a work item, given its size
+ *
+ * The cost is modeled as `per_item + per_unit * size`, where the size is expressed in units
+ * chosen by the operator - typically, the number of elements. The estimate is used as
+ * the priority of the work item in the thread pool, so that the largest items are picked up
+ * first.
+ *
+ * The model can be calibrated with the measured processing times of the work items.
+ * The measurements are accumulated with exponential decay, so the model follows slow changes
+ * in the data. Until calibrated, the cost is `per_unit * size`, with the initial `per_unit`.
+ */
+class SampleCostModel {
+ public:
+  SampleCostModel() = default;
+
+  /**
+   * @param per_unit  the initial cost of one unit of work item size
+   * @param per_item  the initial fixed cost of a work item
+   */
+  explicit SampleCostModel(double per_unit, double per_item = 0)
+  : per_unit_(per_unit), per_item_(per_item) {}
+
+  /// @brief Returns the estimated cost of a work item with given size, in nanoseconds if calibrated
+  double Estimate(int64_t size) const {
+    return per_item_ + per_unit_ * size;
+  }
+
+  /// @brief Adds a measurement; the model is not updated until `Calibrate` is called
+  void Record(int64_t size, double time_ns) {
+    double x = size;
+    n_ += 1;
+    sx_ += x;
+    sy_ += time_ns;
+    sxx_ += x * x;
+    sxy_ += x * time_ns;
+  }
+
+  /**
+   * @brief Updates the model with the measurements recorded so far
+   *
+   * The coefficients are obtained with least squares fit, constrained to non-negative values.
+   * The accumulated measurements are then decayed by `decay`.
+   */
+  void Calibrate(double decay = 0.9) {
+    if (n_ == 0 || sx_ <= 0)
+      return;
+    double var = sxx_ * n_ - sx_ * sx_;
+    double per_unit = 0, per_item = 0;
+    if (var > 1e-6 * sxx_ * n_) {
+      per_unit = (sxy_ * n_ - sx_ * sy_) / var;
+      per_item = (sy_ - per_unit * sx_) / n_;
+    }
+    if (per_unit <= 0 || per_item < 0) {
+      // degenerate or inconsistent data - attribute all the time to the size
+      per_unit = sy_ / sx_;
+      per_item = 0;
+    }
+    per_unit_ = per_unit;
+    per_item_ = per_item;
+    calibrated_ = true;
+    n_ *= decay;
+    sx_ *= decay;
+    sy_ *= decay;
+    sxx_ *= decay;
+    sxy_ *= decay;
+  }
+
+  bool IsCalibrated() const { return calibrated_; }
+  double PerUnit() const { return per_unit_; }
+  double PerItem() const { return per_item_; }
+
+ private:
+  double per_unit_ = 1, per_item_ = 0;
+  bool calibrated_ = false;
+  double n_ = 0, sx_ = 0, sy_ = 0, sxx_ = 0, sxy_ = 0;
+};
+
+/**
+ * @brief Schedules work items in a thread pool, ordered by the estimated cost
+ *
+ * The work items are submitted with a size, which the cost model converts into the priority -
+ * the most expensive items are started first, which shortens the time the batch takes when
+ * the sizes of the samples vary a lot.
+ * The work items are timed; after RunAll, the timings are used to calibrate the cost model and
+ * to calculate the thread imbalance.
+ *
+ * The class satisfies the ExecutionEngine concept used by the CPU kernels' `Schedule` functions,
+ * with the priority interpreted as the size of the work item.
+ *
+ * The object is meant to be created for one batch; the cost model should outlive it.
+ */
+class BalancedWork {
+ public:
+  BalancedWork(ThreadPool &tp, SampleCostModel &model) : tp_(tp), model_(model) {
+    busy_ns_.resize(std::max(tp_.NumThreads(), 0) + 1);
+  }
+
+  /**
+   * @brief Adds a work item of a given size.
+   *
+   * @param work  a callable with a signature `void(int thread_idx)`
+   * @param size  the size of the work item, in units used by the cost model
+   */
+  template <typename Work>
+  void AddWork(Work &&work, int64_t size = 0) {
+    int idx = timings_.size();
+    timings_.push_back({ size, 0 });
+    tp_.AddWork([this, idx, work = std::forward<Work>(work)](int thread_idx) {
+      auto start = std::chrono::steady_clock::now();
+      work(thread_idx);
+      auto end = std::chrono::steady_clock::now();
+      int64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+      timings_[idx].time_ns = ns;
+      busy_ns_[ThreadSlot(thread_idx)].ns += ns;
+    }, std::llround(model_.Estimate(size)));
+  }
+
+  /**
+   * @brief Runs the work, waits for it to complete and updates the statistics
+   */
+  void RunAll() {
+    tp_.RunAll();
+    for (auto &t : timings_)
+      model_.Record(t.size, t.time_ns);
+    model_.Calibrate();
+    num_items_ = timings_.size();
+    timings_.clear();
+    imbalance_ = CalculateImbalance();
+    for (auto &b : busy_ns_)
+      b.ns = 0;
+  }
+
+  int NumThreads() const {
+    return tp_.NumThreads();
+  }
+
+  /**
+   * @brief The fraction of the thread time, during the last RunAll, which was lost waiting for
+   *        the busiest thread.
+   *
+   * The value is `1 - mean(busy) / max(busy)`, where `busy` is the time spent by a thread in the
+   * work items. 0 means perfect balance; with one busy thread out of N, it's `1 - 1/N`.
+   */
+  double Imbalance() const {
+    return imbalance_;
+  }
+
+  /**
+   * @brief Reports the imbalance of the last RunAll as an operator trace `thread_imbalance`
+   */
+  void ReportImbalance(Workspace &ws) const {
+    if (!ws.GetIterationData() || num_items_ == 0)
+      return;
+    ws.SetOperatorTrace("thread_imbalance", make_string(imbalance_));
+  }
+
+ private:
+  int ThreadSlot(int thread_idx) const {
+    // the work can also be executed by a non-pool thread, which has no valid index
+    int num_threads = busy_ns_.size() - 1;
+    return thread_idx >= 0 && thread_idx < num_threads ? thread_idx : num_threads;
+  }
+
+  double CalculateImbalance() const {
+    int num_threads = std::max<int>(busy_ns_.size() - 1, 1);
+    int64_t max_busy = 0, total_busy = 0;
+    for (auto &b : busy_ns_) {
+      max_busy = std::max(max_busy, b.ns);
+      total_busy += b.ns;
+    }
+    if (max_busy == 0)
+      return 0;
+    return std::max(1.0 - static_cast<double>(total_busy) / (max_busy * num_threads), 0.0);
+  }
+
+  struct Timing {
+    int64_t size;
+    int64_t time_ns;
+  };
+
+  /// Per-thread counter, padded to avoid false sharing
+  struct alignas(64) BusyTime {
+    int64_t ns = 0;
+  };
+
+  ThreadPool &tp_;
+  SampleCostModel &model_;
+  std::vector<Timing> timings_;
+  std::vector<BusyTime> busy_ns_;
+  int num_items_ = 0;
+  double imbalance_ = 0;
+};
+
+}  // namespace dali
+
+#endif  // DALI_PIPELINE_OPERATOR_BALANCED_WORK_H_
@@ -0,0 +1,83 @@
+// Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include "dali/pipeline/operator/balanced_work.h"
+#include "dali/pipeline/util/thread_pool.h"
+
+namespace dali {
+namespace test {
+
+TEST(SampleCostModel, Calibrate) {
+  SampleCostModel model;
+  EXPECT_FALSE(model.IsCalibrated());
+  EXPECT_EQ(model.Estimate(1000), 1000);
+  for (int size : { 100, 200, 400, 800 })
+    model.Record(size, 100 + 10 * size);
+  model.Calibrate();
+  EXPECT_TRUE(model.IsCalibrated());
+  EXPECT_NEAR(model.PerUnit(), 10, 1e-6);
+  EXPECT_NEAR(model.PerItem(), 100, 1e-6);
+  EXPECT_NEAR(model.Estimate(1000), 10100, 1e-3);
+}
+
+TEST(SampleCostModel, CalibrateUniformSizes) {
+  SampleCostModel model;
+  model.Record(100, 1000);
+  model.Record(100, 3000);
+  model.Calibrate();
+  EXPECT_NEAR(model.PerUnit(), 20, 1e-6);
+  EXPECT_EQ(model.PerItem(), 0);
+}
+
+TEST(BalancedWork, LargestFirst) {
+  // only one thread to ensure deterministic order
+  OldThreadPool tp(1, 0, false, "BalancedWork test");
+  SampleCostModel model;
+  BalancedWork work(tp, model);
+  std::vector<int> order;
+  std::vector<int> sizes = { 10, 1000, 1, 100 };
+  for (int i = 0; i < static_cast<int>(sizes.size()); i++)
+    work.AddWork([&, i](int) { order.push_back(i); }, sizes[i]);
+  work.RunAll();
+  EXPECT_EQ(order, (std::vector<int>{ 1, 3, 0, 2 }));
+  EXPECT_TRUE(model.IsCalibrated());
+  EXPECT_EQ(work.Imbalance(), 0);  // one thread is always balanced
+}
+
+TEST(BalancedWork, Imbalance) {
+  OldThreadPool tp(2, 0, false, "BalancedWork test");
+  SampleCostModel model;
+  BalancedWork work(tp, model);
+  work.AddWork([](int) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  }, 1);
+  work.RunAll();
+  // one thread did all the work, the other one was idle
+  EXPECT_NEAR(work.Imbalance(), 0.5, 1e-6);
+
+  for (int i = 0; i < 2; i++) {
+    work.AddWork([](int) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }, 1);
+  }
+  work.RunAll();
+  EXPECT_LT(work.Imbalance(), 0.2);
+}
+
+}  // namespace test
+}  // namespace dali
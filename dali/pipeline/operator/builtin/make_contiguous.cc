@@ -12,11 +12,28 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <utility>
+#include <vector>
 #include "dali/core/nvtx.h"
 #include "dali/pipeline/operator/builtin/make_contiguous.h"
 
 namespace dali {
 
+bool MakeContiguousCPU::SetupImpl(std::vector<OutputDesc> &output_desc, const Workspace &ws) {
+  {
+    std::lock_guard<std::mutex> g(alloc_mtx_);
+    current_alloc_ = output_alloc_;
+  }
+  bool resize = MakeContiguousBase<CPUBackend>::SetupImpl(output_desc, ws);
+  // With a custom allocator, the output is allocated in RunImpl
+  return resize && !current_alloc_;
+}
+
+void MakeContiguousCPU::SetOutputAllocator(AllocFunc allocate) {
+  std::lock_guard<std::mutex> g(alloc_mtx_);
+  output_alloc_ = std::move(allocate);
+}
+
 void MakeContiguousCPU::RunImpl(Workspace &ws) {
   auto &input = ws.Input<CPUBackend>(0);
   auto &output = ws.Output<CPUBackend>(0);
@@ -26,8 +43,13 @@ void MakeContiguousCPU::RunImpl(Workspace &ws) {
     output.ShareData(input);
   } else {
     int batch_size = input.num_samples();
-    output.SetLayout(input.GetLayout());
     auto shapes = input.shape();
+    if (current_alloc_) {
+      size_t bytes = shapes.num_elements() * input.type_info().size();
+      output.ShareData(current_alloc_(bytes), bytes, false, shapes, input.type(),
+                       output.device_id(), AccessOrder::host());
+    }
+    output.SetLayout(input.GetLayout());
 
     auto &thread_pool = ws.GetThreadPool();
     for (int sample_id = 0; sample_id < batch_size; ++sample_id) {
@@ -76,6 +98,13 @@ bool IsPassThrough(const OperatorBase &op) {
   DALI_FAIL("This operation should be called only on MakeContiguous Operators.");
 }
 
+void SetMakeContiguousOutputAllocator(OperatorBase &op, MakeContiguousCPU::AllocFunc allocate) {
+  auto *make_contiguous_cpu = dynamic_cast<MakeContiguousCPU *>(&op);
+  DALI_ENFORCE(make_contiguous_cpu,
+               "This operation should be called only on CPU MakeContiguous Operators.");
+  make_contiguous_cpu->SetOutputAllocator(std::move(allocate));
+}
+
 bool SetMakeContiguousMode(OperatorBase &op, MakeContiguousMode mode) {
   if (auto *make_contiguous_cpu = dynamic_cast<MakeContiguousBase<CPUBackend> *>(&op)) {
     make_contiguous_cpu->SetMode(mode);
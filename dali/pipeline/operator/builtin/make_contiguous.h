@@ -16,6 +16,9 @@
 #define DALI_PIPELINE_OPERATOR_BUILTIN_MAKE_CONTIGUOUS_H_
 
 #include <algorithm>
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <vector>
 #include <utility>
 
@@ -130,12 +133,33 @@ class MakeContiguousMixed : public MakeContiguousBase<MixedBackend> {
 
 class MakeContiguousCPU : public MakeContiguousBase<CPUBackend> {
  public:
+  /** Allocates the memory for the whole output batch; the returned pointer owns the memory. */
+  using AllocFunc = std::function<std::shared_ptr<uint8_t>(size_t)>;
+
   inline explicit MakeContiguousCPU(const OpSpec &spec) :
       MakeContiguousBase<CPUBackend>(spec) {}
 
+  bool SetupImpl(std::vector<OutputDesc> &output_desc, const Workspace &ws) override;
+
   using Operator<CPUBackend>::RunImpl;
   void RunImpl(Workspace &ws) override;
+
+  /**
+   * @brief Sets the function which allocates the output, when it's copied.
+   *
+   * The passed-through outputs still share the input. The function can be set while the
+   * pipeline is running - it's used starting with the next iteration.
+   * An empty function restores the default allocation.
+   */
+  void SetOutputAllocator(AllocFunc allocate);
+
   DISABLE_COPY_MOVE_ASSIGN(MakeContiguousCPU);
+
+ private:
+  std::mutex alloc_mtx_;
+  AllocFunc output_alloc_;
+  // The allocation function used in the current iteration - set in Setup.
+  AllocFunc current_alloc_;
 };
 
 /**
@@ -155,6 +179,12 @@ bool IsPassThrough(const OperatorBase &make_contiguous);
  */
 bool SetMakeContiguousMode(OperatorBase &make_contiguous, MakeContiguousMode mode);
 
+/**
+ * @brief Call the MakeContiguousCPU::SetOutputAllocator, invalid for other operators.
+ */
+void SetMakeContiguousOutputAllocator(OperatorBase &make_contiguous,
+                                      MakeContiguousCPU::AllocFunc allocate);
+
 
 }  // namespace dali
 
@@ -106,11 +106,72 @@ std::vector<curandState> SnapshotSerializer::Deserialize(const std::string &data
 }
 
 
+namespace {
+
+using ProtoBufferState = dali_proto::ReaderStateSnapshot::LoaderBufferState;
+using ProtoBufferedSample = dali_proto::ReaderStateSnapshot::BufferedSample;
+
+void SerializeSample(ProtoBufferedSample *proto, const LoaderBufferState::Sample &sample) {
+  proto->set_idx(sample.idx);
+  proto->mutable_pos()->set_epoch(sample.pos.epoch);
+  proto->mutable_pos()->set_index(sample.pos.index);
+}
+
+LoaderBufferState::Sample DeserializeSample(const ProtoBufferedSample &proto) {
+  return {proto.idx(), {proto.pos().epoch(), proto.pos().index()}};
+}
+
+void SerializeBufferState(ProtoBufferState *proto, const LoaderBufferState &state) {
+  proto->set_rng(SerializeToString(state.rng));
+  proto->set_consumer_epoch(state.consumer_epoch);
+  proto->set_virtual_shard_id(state.virtual_shard_id);
+  proto->set_returned_sample_counter(state.returned_sample_counter);
+  proto->set_read_sample_counter(state.read_sample_counter);
+  proto->set_total_read_sample_counter(state.total_read_sample_counter);
+  for (auto &shard : state.shards) {
+    proto->add_shards(shard.first);
+    proto->add_shards(shard.second);
+  }
+  for (auto &sample : state.buffer)
+    SerializeSample(proto->add_buffer(), sample);
+  if (state.last_sample)
+    SerializeSample(proto->mutable_last_sample(), *state.last_sample);
+  proto->mutable_next_read()->set_epoch(state.next_read.epoch);
+  proto->mutable_next_read()->set_index(state.next_read.index);
+}
+
+LoaderBufferState DeserializeBufferState(const ProtoBufferState &proto) {
+  LoaderBufferState state;
+  state.rng = DeserializeFromString<std::default_random_engine>(proto.rng());
+  state.consumer_epoch = proto.consumer_epoch();
+  state.virtual_shard_id = proto.virtual_shard_id();
+  state.returned_sample_counter = proto.returned_sample_counter();
+  state.read_sample_counter = proto.read_sample_counter();
+  state.total_read_sample_counter = proto.total_read_sample_counter();
+  DALI_ENFORCE(proto.shards_size() % 2 == 0,
+               "Failed to deserialize loader state snapshot: invalid shard boundaries.");
+  for (int i = 0; i < proto.shards_size(); i += 2)
+    state.shards.emplace_back(proto.shards(i), proto.shards(i + 1));
+  state.buffer.reserve(proto.buffer_size());
+  for (int i = 0; i < proto.buffer_size(); i++)
+    state.buffer.push_back(DeserializeSample(proto.buffer(i)));
+  if (proto.has_last_sample())
+    state.last_sample = DeserializeSample(proto.last_sample());
+  state.next_read = {proto.next_read().epoch(), proto.next_read().index()};
+  return state;
+}
+
+}  // namespace
+
 std::string SnapshotSerializer::Serialize(const LoaderStateSnapshot &snapshot) {
   dali_proto::ReaderStateSnapshot proto_snapshot;
   proto_snapshot.mutable_loader_state()->set_rng(SerializeToString(snapshot.rng));
   proto_snapshot.mutable_loader_state()->set_current_epoch(snapshot.current_epoch);
   proto_snapshot.mutable_loader_state()->set_age(snapshot.age);
+  if (snapshot.buffer_state) {
+    SerializeBufferState(proto_snapshot.mutable_loader_state()->mutable_buffer_state(),
+                         *snapshot.buffer_state);
+  }
   return proto_snapshot.SerializeAsString();
 }
 
@@ -119,11 +180,14 @@ LoaderStateSnapshot SnapshotSerializer::Deserialize(const std::string &data) {
   dali_proto::ReaderStateSnapshot proto_snapshot;
   DALI_ENFORCE(proto_snapshot.ParseFromString(data),
                "Failed to deserialize loader state snapshot from protobuf.");
-  return LoaderStateSnapshot {
+  LoaderStateSnapshot snapshot {
     DeserializeFromString<std::default_random_engine>(proto_snapshot.loader_state().rng()),
     proto_snapshot.loader_state().current_epoch(),
     proto_snapshot.loader_state().age(),
   };
+  if (proto_snapshot.loader_state().has_buffer_state())
+    snapshot.buffer_state = DeserializeBufferState(proto_snapshot.loader_state().buffer_state());
+  return snapshot;
 }
 
 }  // namespace dali
@@ -61,6 +61,51 @@ TEST_F(SnapshotSerializerTest, LoaderStateSnapshot) {
   EXPECT_EQ(snapshot.rng, deserialized.rng);
   EXPECT_EQ(snapshot.current_epoch, deserialized.current_epoch);
   EXPECT_EQ(snapshot.age, deserialized.age);
+  EXPECT_FALSE(deserialized.buffer_state.has_value());
+}
+
+TEST_F(SnapshotSerializerTest, LoaderStateSnapshotWithBuffer) {
+  LoaderBufferState buffer_state;
+  buffer_state.rng = std::default_random_engine(42);
+  buffer_state.consumer_epoch = 3;
+  buffer_state.virtual_shard_id = 1;
+  buffer_state.returned_sample_counter = 17;
+  buffer_state.read_sample_counter = 27;
+  buffer_state.total_read_sample_counter = 1234;
+  buffer_state.shards = {{10, 20}, {20, 30}};
+  for (int i = 0; i < 10; i++)
+    buffer_state.buffer.push_back({20 + i, {i < 5 ? 3 : 4, 100 + i}});
+  buffer_state.last_sample = LoaderBufferState::Sample{9, {3, 99}};
+  buffer_state.next_read = {4, 105};
+  LoaderStateSnapshot snapshot = {std::default_random_engine(123), 3, 17, buffer_state};
+
+  std::string serialized = SnapshotSerializer().Serialize(snapshot);
+  auto deserialized = SnapshotSerializer().Deserialize<LoaderStateSnapshot>(serialized);
+
+  EXPECT_EQ(snapshot.rng, deserialized.rng);
+  EXPECT_EQ(snapshot.current_epoch, deserialized.current_epoch);
+  EXPECT_EQ(snapshot.age, deserialized.age);
+  ASSERT_TRUE(deserialized.buffer_state.has_value());
+  auto &restored = *deserialized.buffer_state;
+  EXPECT_EQ(buffer_state.rng, restored.rng);
+  EXPECT_EQ(buffer_state.consumer_epoch, restored.consumer_epoch);
+  EXPECT_EQ(buffer_state.virtual_shard_id, restored.virtual_shard_id);
+  EXPECT_EQ(buffer_state.returned_sample_counter, restored.returned_sample_counter);
+  EXPECT_EQ(buffer_state.read_sample_counter, restored.read_sample_counter);
+  EXPECT_EQ(buffer_state.total_read_sample_counter, restored.total_read_sample_counter);
+  EXPECT_EQ(buffer_state.shards, restored.shards);
+  ASSERT_EQ(buffer_state.buffer.size(), restored.buffer.size());
+  for (size_t i = 0; i < buffer_state.buffer.size(); i++) {
+    EXPECT_EQ(buffer_state.buffer[i].idx, restored.buffer[i].idx);
+    EXPECT_EQ(buffer_state.buffer[i].pos.epoch, restored.buffer[i].pos.epoch);
+    EXPECT_EQ(buffer_state.buffer[i].pos.index, restored.buffer[i].pos.index);
+  }
+  ASSERT_TRUE(restored.last_sample.has_value());
+  EXPECT_EQ(restored.last_sample->idx, 9);
+  EXPECT_EQ(restored.last_sample->pos.epoch, 3);
+  EXPECT_EQ(restored.last_sample->pos.index, 99);
+  EXPECT_EQ(restored.next_read.epoch, 4);
+  EXPECT_EQ(restored.next_read.index, 105);
 }
 
 }  // namespace dali
@@ -73,9 +73,13 @@ void GetPerSampleArgument(std::vector<T> &output, const std::string &argument_na
         make_string("`", argument_name, "` must be a 1xN or Nx1 (N = ", batch_size,
                     ") tensor list. Got: ", shape));
 
+      DALI_ENFORCE(IsType<T>(arg.type()), make_string(
+          "Unexpected type of argument \"", argument_name, "\". Expected ",
+          TypeTable::GetTypeName<T>(), " and got ", arg.type()));
       output.resize(batch_size);
       for (int i = 0; i < batch_size; i++) {
-        output[i] = arg.template tensor<T>(i)[0];
+        // the type is checked once for the whole batch
+        output[i] = *static_cast<const T *>(arg.raw_tensor(i));
       }
     }
   } else {
@@ -15,6 +15,9 @@
 #ifndef DALI_PIPELINE_OPERATOR_EAGER_OPERATOR_H_
 #define DALI_PIPELINE_OPERATOR_EAGER_OPERATOR_H_
 
+#include <algorithm>
+#include <cstdio>
+#include <list>
 #include <memory>
 #include <shared_mutex>
 #include <string>
@@ -52,6 +55,30 @@ std::shared_ptr<TensorList<Backend>> AsContiguousOutput(std::shared_ptr<TensorLi
   }
 }
 
+/**
+ * @brief Checks whether the memory of the batch is referenced only by the batch itself.
+ *
+ * The samples obtained from a batch (e.g. by indexing or with AsTensor) share its allocation
+ * through unsafe_sample_owner and can outlive the batch object, so the reference count of the
+ * batch object alone is not enough to tell whether the memory can be overwritten.
+ */
+template <typename Backend>
+bool IsAllocationExclusive(TensorList<Backend> &tl) {
+  if (tl.shares_data())
+    return false;
+  int num_samples = tl.num_samples();
+  if (tl.IsContiguous()) {
+    // The buffer and each of the samples hold one reference
+    auto &owner = unsafe_owner(tl);
+    return owner.use_count() <= 1 + num_samples;
+  }
+  for (int i = 0; i < num_samples; i++) {
+    if (unsafe_sample_owner(tl, i).use_count() > 1)
+      return false;
+  }
+  return true;
+}
+
 template <typename Backend>
 struct Backend2Types {};
 
@@ -192,6 +219,8 @@ class DLL_PUBLIC EagerOperator {
   int max_batch_size_;
   size_t num_outputs_;
   Workspace ws_;
+  std::vector<std::shared_ptr<WSInputType>> input_buffers_;
+  std::vector<std::shared_ptr<WSOutputType>> output_buffers_;
   OpSpec op_spec_;
   std::string name_;
   std::unique_ptr<OperatorBase> op_;
@@ -262,9 +291,12 @@ EagerOperator<Backend>::RunImpl(
   DALI_ENFORCE(batch_size <= max_batch_size_,
                make_string("Expected batch size lower or equal to max batch size. Requested: ",
                            batch_size, " > ", max_batch_size_));
-  // Convert and add inputs to the workspace.
+  // Convert and add inputs to the workspace. The wrappers are reused between the calls.
+  input_buffers_.resize(inputs.size());
   for (size_t in_idx = 0; in_idx < inputs.size(); ++in_idx) {
-    auto tensor_in = std::make_shared<WSInputType>();
+    auto &tensor_in = input_buffers_[in_idx];
+    if (!tensor_in)
+      tensor_in = std::make_shared<WSInputType>();
     tensor_in->ShareData(*inputs[in_idx]);
     int cur_batch_size = tensor_in->num_samples();
 
@@ -297,8 +329,13 @@ EagerOperator<Backend>::RunImpl(
   std::vector<OutputDesc> output_desc{};
   std::vector<std::shared_ptr<TensorList<OutBackend>>> outputs(num_outputs_);
 
+  output_buffers_.resize(num_outputs_);
   for (size_t i = 0; i < num_outputs_; ++i) {
-    auto tensor_out = std::make_shared<WSOutputType>();
+    auto &tensor_out = output_buffers_[i];
+    // The output buffer from the previous call can be reused (along with its allocation)
+    // only if neither the buffer nor any view of its memory is held by the caller.
+    if (!tensor_out || tensor_out.use_count() > 1 || !IsAllocationExclusive(*tensor_out))
+      tensor_out = std::make_shared<WSOutputType>();
     if (ws_.has_stream()) {
       tensor_out->set_order(ws_.stream());
     }
@@ -320,6 +357,9 @@ EagerOperator<Backend>::RunImpl(
   for (size_t i = 0; i < num_outputs_; ++i) {
     outputs[i] = AsContiguousOutput<OutBackend>(ws_.template OutputPtr<OutBackend>(i));
   }
+  // Don't keep the caller's data alive until the next call
+  for (auto &tensor_in : input_buffers_)
+    tensor_in->Reset();
   if (!IsSplitOrMerge(op_spec_.GetSchema())) {
     for (size_t i = 0; i < outputs.size(); ++i) {
       int cur_batch_size = outputs[i]->num_samples();
@@ -335,6 +375,214 @@ EagerOperator<Backend>::RunImpl(
 template <typename Backend>
 std::shared_mutex EagerOperator<Backend>::shared_thread_pool_mutex_{};
 
+/**
+ * @brief Caches eager operator instances, so that the calls with the same operator configuration
+ *        and inputs of the same kind reuse the operator and its buffers.
+ *
+ * The instances are keyed by the schema, the values of the (non-tensor) arguments, the names of
+ * the argument inputs and the signature (type, number of dimensions and layout) of the inputs.
+ * Only the operators which don't carry any state between the calls can be cached (see IsCacheable);
+ * PipelineDebug keeps a separate instance per logical id for all the others.
+ *
+ * When the capacity is exceeded, the least recently used instance is evicted.
+ * The cache is not thread-safe; the returned operators are valid until the next call to Get.
+ */
+template <typename Backend>
+class DLL_PUBLIC EagerOperatorCache {
+  using InBackend = typename Backend2Types<Backend>::InBackend;
+  using OutBackend = typename Backend2Types<Backend>::OutBackend;
+
+ public:
+  /**
+   * @param capacity    maximum number of cached instances
+   * @param num_threads number of threads reported to the operators;
+   *                    if negative, the size of the shared thread pool is used
+   */
+  DLL_PUBLIC explicit EagerOperatorCache(int capacity = 256, int num_threads = -1)
+      : capacity_(capacity), num_threads_(num_threads) {
+    DALI_ENFORCE(capacity > 0, "The capacity of the operator cache must be positive.");
+  }
+
+  /**
+   * @brief Computes the part of the key which depends only on the spec.
+   *
+   * The result can be stored and passed to Get, so that the arguments are not serialized
+   * in each call.
+   */
+  DLL_PUBLIC static std::string SpecKey(const OpSpec &spec) {
+    std::vector<std::string> args;
+    for (auto &arg : spec.Arguments()) {
+      args.push_back(arg->ToString());
+      AppendExactValue(args.back(), *arg);
+    }
+    std::sort(args.begin(), args.end());
+    std::vector<std::string_view> arg_inputs;
+    for (auto &arg_input : spec.ArgumentInputs())
+      arg_inputs.push_back(arg_input.first);
+    std::sort(arg_inputs.begin(), arg_inputs.end());
+
+    std::string key = spec.SchemaName();
+    for (auto &arg : args) {
+      key += '\n';
+      key += arg;
+    }
+    for (auto &arg_input : arg_inputs) {
+      key += "\ninput:";
+      key += arg_input;
+    }
+    return key;
+  }
+
+  /**
+   * @brief Tells whether the instances of the operator can be shared between independent calls.
+   *
+   * An instance which carries state between the calls cannot be shared: apart from the
+   * explicitly stateful operators, this applies to random operators (their generator state
+   * advances with each call) and to the operators without inputs, such as readers, which keep
+   * their position in the data set. Evicting and recreating such an instance would also
+   * silently reset its state.
+   */
+  DLL_PUBLIC static bool IsCacheable(const OpSchema &schema) {
+    return !schema.IsStateful() &&
+           !schema.HasRandomSeedArg() &&
+           !schema.IsNoPrune() &&
+           schema.MaxNumInput() > 0;
+  }
+
+  /**
+   * @brief Returns an operator instance for given spec and inputs, creating it if necessary.
+   */
+  DLL_PUBLIC EagerOperator<Backend> &Get(
+      const OpSpec &spec, const std::string &spec_key,
+      const std::vector<std::shared_ptr<TensorList<InBackend>>> &inputs,
+      const std::unordered_map<std::string, std::shared_ptr<TensorList<CPUBackend>>> &kwargs) {
+    key_.assign(spec_key);
+    AppendSignature(key_, spec, inputs, kwargs);
+    auto it = index_.find(key_);
+    if (it != index_.end()) {
+      hits_++;
+      lru_.splice(lru_.begin(), lru_, it->second);
+      return *lru_.front().op;
+    }
+
+    DALI_ENFORCE(IsCacheable(spec.GetSchema()), make_string(
+        "Operator ", spec.SchemaName(), " keeps state between the calls and its instances cannot "
+        "be cached."));
+    misses_++;
+    std::unique_ptr<EagerOperator<Backend>> op;
+    if (num_threads_ < 0)
+      op = std::make_unique<EagerOperator<Backend>>(spec);
+    else
+      op = std::make_unique<EagerOperator<Backend>>(spec, spec.SchemaName(), num_threads_);
+    lru_.push_front({ key_, std::move(op) });
+    index_.emplace(key_, lru_.begin());
+    while (static_cast<int>(lru_.size()) > capacity_) {
+      index_.erase(lru_.back().key);
+      lru_.pop_back();
+    }
+    return *lru_.front().op;
+  }
+
+  DLL_PUBLIC EagerOperator<Backend> &Get(
+      const OpSpec &spec,
+      const std::vector<std::shared_ptr<TensorList<InBackend>>> &inputs,
+      const std::unordered_map<std::string, std::shared_ptr<TensorList<CPUBackend>>> &kwargs) {
+    return Get(spec, SpecKey(spec), inputs, kwargs);
+  }
+
+  /**
+   * @brief Runs an operator, reusing a cached instance if possible.
+   *
+   * @param run_args the remaining arguments of EagerOperator::Run (thread pool or CUDA stream,
+   *                 batch size)
+   */
+  template <typename... RunArgs>
+  DLL_PUBLIC std::vector<std::shared_ptr<TensorList<OutBackend>>> Run(
+      const OpSpec &spec, const std::string &spec_key,
+      const std::vector<std::shared_ptr<TensorList<InBackend>>> &inputs,
+      const std::unordered_map<std::string, std::shared_ptr<TensorList<CPUBackend>>> &kwargs,
+      RunArgs &&...run_args) {
+    return Get(spec, spec_key, inputs, kwargs).Run(inputs, kwargs,
+                                                   std::forward<RunArgs>(run_args)...);
+  }
+
+  DLL_PUBLIC int size() const {
+    return lru_.size();
+  }
+
+  DLL_PUBLIC int64_t hits() const {
+    return hits_;
+  }
+
+  DLL_PUBLIC int64_t misses() const {
+    return misses_;
+  }
+
+  DLL_PUBLIC void Clear() {
+    index_.clear();
+    lru_.clear();
+  }
+
+ private:
+  /**
+   * @brief Appends the exact values of floating point arguments, which ToString rounds.
+   */
+  static void AppendExactValue(std::string &key, const Argument &arg) {
+    auto append = [&](float value) {
+      char buf[32];
+      snprintf(buf, sizeof(buf), " %a", value);
+      key += buf;
+    };
+    if (auto *scalar = dynamic_cast<const ArgumentInst<float> *>(&arg)) {
+      append(scalar->Get());
+    } else if (auto *vec = dynamic_cast<const ArgumentInst<std::vector<float>> *>(&arg)) {
+      for (float value : vec->Get())
+        append(value);
+    }
+  }
+
+  template <typename InputBackend>
+  static void AppendTensorSignature(std::string &key, const TensorList<InputBackend> &tl) {
+    key += std::to_string(static_cast<int>(tl.type()));
+    key += ':';
+    key += std::to_string(tl.sample_dim());
+    key += ':';
+    key += tl.GetLayout().c_str();
+  }
+
+  static void AppendSignature(
+      std::string &key, const OpSpec &spec,
+      const std::vector<std::shared_ptr<TensorList<InBackend>>> &inputs,
+      const std::unordered_map<std::string, std::shared_ptr<TensorList<CPUBackend>>> &kwargs) {
+    for (auto &input : inputs) {
+      key += '|';
+      AppendTensorSignature(key, *input);
+    }
+    // the order of the argument inputs in the spec is deterministic, unlike that of the map
+    for (auto &arg_input : spec.ArgumentInputs()) {
+      auto it = kwargs.find(arg_input.first);
+      if (it == kwargs.end())
+        continue;
+      key += '|';
+      key += arg_input.first;
+      key += '=';
+      AppendTensorSignature(key, *it->second);
+    }
+  }
+
+  struct Entry {
+    std::string key;
+    std::unique_ptr<EagerOperator<Backend>> op;
+  };
+
+  int capacity_;
+  int num_threads_;
+  std::list<Entry> lru_;
+  std::unordered_map<std::string, typename std::list<Entry>::iterator> index_;
+  std::string key_;  // reused to avoid allocations
+  int64_t hits_ = 0, misses_ = 0;
+};
+
 }  // namespace dali
 
 #endif  // DALI_PIPELINE_OPERATOR_EAGER_OPERATOR_H_
@@ -0,0 +1,237 @@
+// Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dali/pipeline/operator/eager_operator.h"
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "dali/pipeline/pipeline_debug.h"
+#include "dali/pipeline/util/thread_pool.h"
+
+namespace dali {
+namespace test {
+
+namespace {
+
+constexpr int kBatchSize = 4;
+
+using Kwargs = std::unordered_map<std::string, std::shared_ptr<TensorList<CPUBackend>>>;
+
+/** A spec without max_batch_size, which is filled by PipelineDebug */
+OpSpec DebugCastSpec(DALIDataType dtype) {
+  return OpSpec("Cast")
+      .AddArg("device", "cpu")
+      .AddArg("dtype", dtype)
+      .AddInput("data", StorageDevice::CPU)
+      .AddOutput("out", StorageDevice::CPU);
+}
+
+OpSpec CastSpec(DALIDataType dtype) {
+  return DebugCastSpec(dtype).AddArg("max_batch_size", kBatchSize);
+}
+
+std::shared_ptr<TensorList<CPUBackend>> MakeInput(int value, DALIDataType type = DALI_INT32) {
+  auto tl = std::make_shared<TensorList<CPUBackend>>();
+  tl->set_pinned(false);
+  tl->Resize(uniform_list_shape(kBatchSize, TensorShape<>{16}), type,
+             BatchContiguity::Contiguous);
+  for (int i = 0; i < kBatchSize; i++) {
+    for (int j = 0; j < 16; j++) {
+      if (type == DALI_UINT8)
+        tl->mutable_tensor<uint8_t>(i)[j] = value + i;
+      else
+        tl->mutable_tensor<int32_t>(i)[j] = value + i;
+    }
+  }
+  return tl;
+}
+
+void CheckValues(const float *data, int64_t n, float expected) {
+  for (int64_t j = 0; j < n; j++)
+    ASSERT_EQ(data[j], expected) << " at index " << j;
+}
+
+}  // namespace
+
+class EagerOperatorTest : public ::testing::Test {
+ protected:
+  OldThreadPool tp_{1, CPU_ONLY_DEVICE_ID, false, "EagerOperatorTest"};
+};
+
+TEST_F(EagerOperatorTest, ReusesReleasedOutput) {
+  EagerOperator<CPUBackend> op(CastSpec(DALI_FLOAT), "Cast", 1);
+  auto out = op.Run({MakeInput(1)}, {}, &tp_, kBatchSize);
+  const void *data = contiguous_raw_data(*out[0]);
+  out.clear();
+  out = op.Run({MakeInput(2)}, {}, &tp_, kBatchSize);
+  EXPECT_EQ(contiguous_raw_data(*out[0]), data);
+  CheckValues(out[0]->tensor<float>(0), 16, 2);
+}
+
+TEST_F(EagerOperatorTest, HeldOutputSurvives) {
+  EagerOperator<CPUBackend> op(CastSpec(DALI_FLOAT), "Cast", 1);
+  auto out1 = op.Run({MakeInput(1)}, {}, &tp_, kBatchSize);
+  auto out2 = op.Run({MakeInput(10)}, {}, &tp_, kBatchSize);
+  EXPECT_NE(contiguous_raw_data(*out1[0]), contiguous_raw_data(*out2[0]));
+  for (int i = 0; i < kBatchSize; i++) {
+    CheckValues(out1[0]->tensor<float>(i), 16, 1 + i);
+    CheckValues(out2[0]->tensor<float>(i), 16, 10 + i);
+  }
+}
+
+TEST_F(EagerOperatorTest, SampleViewSurvives) {
+  EagerOperator<CPUBackend> op(CastSpec(DALI_FLOAT), "Cast", 1);
+  auto out = op.Run({MakeInput(1)}, {}, &tp_, kBatchSize);
+  // This is how the samples of a batch are exposed to Python
+  Tensor<CPUBackend> sample;
+  auto &owner = unsafe_sample_owner(*out[0], 2);
+  sample.ShareData(owner, 16 * sizeof(float), false, TensorShape<>{16}, DALI_FLOAT,
+                   CPU_ONLY_DEVICE_ID);
+  out.clear();  // only the sample is held
+  out = op.Run({MakeInput(10)}, {}, &tp_, kBatchSize);
+  CheckValues(sample.data<float>(), 16, 3);
+  CheckValues(out[0]->tensor<float>(2), 16, 12);
+}
+
+TEST_F(EagerOperatorTest, AsTensorViewSurvives) {
+  EagerOperator<CPUBackend> op(CastSpec(DALI_FLOAT), "Cast", 1);
+  auto out = op.Run({MakeInput(1)}, {}, &tp_, kBatchSize);
+  Tensor<CPUBackend> view = out[0]->AsTensor();
+  out.clear();  // only the view is held
+  out = op.Run({MakeInput(10)}, {}, &tp_, kBatchSize);
+  ASSERT_EQ(view.shape(), TensorShape<>(kBatchSize, 16));
+  for (int i = 0; i < kBatchSize; i++)
+    CheckValues(view.data<float>() + i * 16, 16, 1 + i);
+}
+
+TEST_F(EagerOperatorTest, CacheHit) {
+  EagerOperatorCache<CPUBackend> cache(4, 1);
+  auto spec = CastSpec(DALI_FLOAT);
+  auto key = EagerOperatorCache<CPUBackend>::SpecKey(spec);
+  EXPECT_EQ(EagerOperatorCache<CPUBackend>::SpecKey(CastSpec(DALI_FLOAT)), key);
+
+  auto in = MakeInput(1);
+  auto *op = &cache.Get(spec, key, {in}, {});
+  EXPECT_EQ(cache.misses(), 1);
+  EXPECT_EQ(&cache.Get(spec, {in}, {}), op);
+  EXPECT_EQ(cache.hits(), 1);
+
+  for (int iter = 0; iter < 3; iter++) {
+    auto out = cache.Run(spec, key, {MakeInput(iter)}, Kwargs{}, &tp_, kBatchSize);
+    ASSERT_EQ(out.size(), 1u);
+    CheckValues(out[0]->tensor<float>(1), 16, iter + 1);
+  }
+  EXPECT_EQ(cache.hits(), 4);
+  EXPECT_EQ(cache.misses(), 1);
+  EXPECT_EQ(cache.size(), 1);
+
+  // A different kind of input requires a new instance
+  cache.Run(spec, key, {MakeInput(1, DALI_UINT8)}, Kwargs{}, &tp_, kBatchSize);
+  EXPECT_EQ(cache.misses(), 2);
+  EXPECT_EQ(cache.size(), 2);
+}
+
+TEST_F(EagerOperatorTest, CacheSpecChange) {
+  EagerOperatorCache<CPUBackend> cache(2, 1);
+  auto float_spec = CastSpec(DALI_FLOAT);
+  auto int_spec = CastSpec(DALI_INT16);
+  EXPECT_NE(EagerOperatorCache<CPUBackend>::SpecKey(float_spec),
+            EagerOperatorCache<CPUBackend>::SpecKey(int_spec));
+
+  auto in = MakeInput(5);
+  auto out_f = cache.Run(float_spec, cache.SpecKey(float_spec), {in}, Kwargs{}, &tp_, kBatchSize);
+  auto out_i = cache.Run(int_spec, cache.SpecKey(int_spec), {in}, Kwargs{}, &tp_, kBatchSize);
+  EXPECT_EQ(cache.misses(), 2);
+  EXPECT_EQ(cache.hits(), 0);
+  EXPECT_EQ(out_f[0]->type(), DALI_FLOAT);
+  EXPECT_EQ(out_i[0]->type(), DALI_INT16);
+  CheckValues(out_f[0]->tensor<float>(0), 16, 5);
+  EXPECT_EQ(out_i[0]->tensor<int16_t>(3)[0], 8);
+
+  // Evicts the least recently used (float) instance
+  cache.Run(CastSpec(DALI_UINT8), cache.SpecKey(CastSpec(DALI_UINT8)), {in}, Kwargs{}, &tp_,
+            kBatchSize);
+  EXPECT_EQ(cache.size(), 2);
+  cache.Run(float_spec, cache.SpecKey(float_spec), {in}, Kwargs{}, &tp_, kBatchSize);
+  EXPECT_EQ(cache.misses(), 4);
+
+  // Stateful operators cannot be shared
+  auto random_spec = OpSpec("CoinFlip")
+      .AddArg("device", "cpu")
+      .AddArg("max_batch_size", kBatchSize)
+      .AddOutput("out", StorageDevice::CPU);
+  EXPECT_FALSE(EagerOperatorCache<CPUBackend>::IsCacheable(random_spec.GetSchema()));
+  EXPECT_THROW(cache.Get(random_spec, {}, {}), std::exception);
+}
+
+TEST_F(EagerOperatorTest, DebugPipelineSharesStatelessOperators) {
+  PipelineDebug pipe(kBatchSize, 1, CPU_ONLY_DEVICE_ID);
+  auto spec = DebugCastSpec(DALI_FLOAT);
+  std::vector<int> ids = {0, 1};
+  pipe.AddMultipleOperators(spec, ids);
+
+  auto out0 = pipe.RunOperator<CPUBackend>(0, {MakeInput(1)}, {});
+  auto out1 = pipe.RunOperator<CPUBackend>(1, {MakeInput(7)}, {});
+  // The outputs of the shared instance are still held - they must not be overwritten
+  CheckValues(out0[0]->tensor<float>(0), 16, 1);
+  CheckValues(out1[0]->tensor<float>(0), 16, 7);
+  Tensor<CPUBackend> view = out1[0]->AsTensor();
+  out0.clear();
+  out1.clear();
+  auto out2 = pipe.RunOperator<CPUBackend>(1, {MakeInput(20)}, {});
+  auto out3 = pipe.RunOperator<CPUBackend>(0, {MakeInput(30)}, {});
+  CheckValues(view.data<float>(), 16, 7);
+  CheckValues(out2[0]->tensor<float>(0), 16, 20);
+  CheckValues(out3[0]->tensor<float>(0), 16, 30);
+}
+
+TEST_F(EagerOperatorTest, DebugPipelineKeepsSeededOperatorsSeparate) {
+  PipelineDebug pipe(kBatchSize, 1, CPU_ONLY_DEVICE_ID);
+  auto spec = OpSpec("random__Uniform")
+      .AddArg("device", "cpu")
+      .AddArg("seed", 42)
+      .AddArg("shape", std::vector<int>{16})
+      .AddOutput("out", StorageDevice::CPU);
+  EXPECT_FALSE(EagerOperatorCache<CPUBackend>::IsCacheable(spec.GetSchema()));
+  std::vector<int> ids = {0, 1};
+  pipe.AddMultipleOperators(spec, ids);
+
+  auto to_vector = [](const TensorList<CPUBackend> &tl) {
+    std::vector<float> v;
+    for (int i = 0; i < tl.num_samples(); i++) {
+      auto *data = tl.tensor<float>(i);
+      v.insert(v.end(), data, data + tl.tensor_shape(i).num_elements());
+    }
+    return v;
+  };
+
+  // As in a regular pipeline, identically seeded instances produce the same sequence,
+  // independently of each other.
+  auto a0 = to_vector(*pipe.RunOperator<CPUBackend>(0, {}, {}, kBatchSize)[0]);
+  auto a1 = to_vector(*pipe.RunOperator<CPUBackend>(0, {}, {}, kBatchSize)[0]);
+  auto b0 = to_vector(*pipe.RunOperator<CPUBackend>(1, {}, {}, kBatchSize)[0]);
+  auto a2 = to_vector(*pipe.RunOperator<CPUBackend>(0, {}, {}, kBatchSize)[0]);
+  auto b1 = to_vector(*pipe.RunOperator<CPUBackend>(1, {}, {}, kBatchSize)[0]);
+  auto b2 = to_vector(*pipe.RunOperator<CPUBackend>(1, {}, {}, kBatchSize)[0]);
+  EXPECT_NE(a0, a1);
+  EXPECT_NE(a1, a2);
+  EXPECT_EQ(a0, b0);
+  EXPECT_EQ(a1, b1);
+  EXPECT_EQ(a2, b2);
+}
+
+}  // namespace test
+}  // namespace dali
@@ -99,6 +99,11 @@ OpSchema::OpSchema(DefaultSchemaTag) : name_(""), default_(true) {
 This disables merging this operator with another one with a different name.)",
                  false);
 
+  AddInternalArg("_unused_outputs", R"(The indices of the outputs which are not used in the pipeline.
+The operator may skip producing them.)",
+                 std::vector<int>{});
+  arguments_["_unused_outputs"].ignore_cmp = true;
+
   AddOptionalArg<int>("seed", R"code(Random seed.
 If not provided, it will be populated based on the global seed of the pipeline.)code",
                  nullptr);
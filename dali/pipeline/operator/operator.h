@@ -81,6 +81,8 @@ class DLL_PUBLIC OperatorBase {
         max_batch_size_(spec.GetArgument<int>("max_batch_size")) {
     DALI_ENFORCE(num_threads_ > 0, "Invalid value for argument num_threads.");
     DALI_ENFORCE(max_batch_size_ > 0, "Invalid value for argument max_batch_size.");
+    if (spec.HasArgument("_unused_outputs"))
+      unused_outputs_ = spec.GetRepeatedArgument<int>("_unused_outputs");
   }
 
   virtual ~OperatorBase() = default;
@@ -150,6 +152,17 @@ class DLL_PUBLIC OperatorBase {
     return spec_;
   }
 
+  /**
+   * @brief Whether the output is consumed by anything in the pipeline.
+   *
+   * The operator may skip computing the outputs which are not used. It must still produce
+   * a batch with a valid shape (e.g. with empty samples) in their place.
+   */
+  bool IsOutputUsed(int output_idx) const {
+    return std::find(unused_outputs_.begin(), unused_outputs_.end(), output_idx) ==
+           unused_outputs_.end();
+  }
+
   DISABLE_COPY_MOVE_ASSIGN(OperatorBase);
 
   template<typename T>
@@ -168,6 +181,10 @@ class DLL_PUBLIC OperatorBase {
     }
   }
 
+  bool HasDiagnostic(const std::string &name) const {
+    return diagnostics_.count(name) != 0;
+  }
+
   template<typename T>
   void RegisterDiagnostic(std::string name, T *val) {
     using namespace std;  // NOLINT
@@ -247,6 +264,8 @@ class DLL_PUBLIC OperatorBase {
   const OpSpec spec_;
   int num_threads_;
   int max_batch_size_;
+  /** The indices of the outputs which are not used in the pipeline */
+  std::vector<int> unused_outputs_;
 
   std::unordered_map<std::string, std::any> diagnostics_;
 };
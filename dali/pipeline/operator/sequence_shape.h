@@ -229,6 +229,9 @@ std::shared_ptr<BatchType> expanded_like(const BatchType &batch) {
 /**
  * @brief Utility to set shared samples in tensor vector from slices of samples of
  * another tensor vector.
+ *
+ * The samples are non-owning views. All of them alias a single control block with no deleter,
+ * so that setting a sample does not allocate.
  */
 template <typename Backend>
 struct TensorListBuilder {
@@ -236,9 +239,9 @@ struct TensorListBuilder {
 
   void SetNext(const SliceView &view) {
     assert(NextSampleIdx() < tv_.num_samples());
-    std::shared_ptr<void> ptr(view.ptr, [](void *) {});  // no deleter
-    tv_.SetSample(next_++, ptr, view.type_size * volume(view.shape), tv_.is_pinned(), view.shape,
-                  tv_.type(), tv_.device_id(), tv_.order(), tv_.GetLayout());
+    std::shared_ptr<void> ptr(no_owner_, view.ptr);
+    tv_.SetSample(next_++, std::move(ptr), view.type_size * volume(view.shape), tv_.is_pinned(),
+                  view.shape, tv_.type(), tv_.device_id(), tv_.order(), tv_.GetLayout());
   }
 
   int NextSampleIdx() const {
@@ -247,19 +250,34 @@ struct TensorListBuilder {
 
  private:
   TensorList<Backend> &tv_;
+  std::shared_ptr<void> no_owner_{nullptr, [](void *) {}};  // no deleter
   int next_ = 0;
 };
 
+/**
+ * @brief Prepares `expanded_batch` to hold `num_expanded_samples` views into the samples of `batch`.
+ *
+ * If the expanded batch already has the matching type, dimensionality and layout (as is the case
+ * when the same batch is expanded in consecutive iterations), it is reused as is - the samples
+ * are overwritten by the builder, without recreating the per-sample structures.
+ */
 template <typename Backend>
 TensorListBuilder<Backend> tv_builder_like(TensorList<Backend> &expanded_batch,
                                            const TensorList<Backend> &batch,
                                            int num_expanded_samples, int ndims_to_unfold = 0) {
   assert(batch.sample_dim() >= ndims_to_unfold);
-  expanded_batch.Reset();
-  expanded_batch.SetSize(num_expanded_samples);
-  expanded_batch.set_sample_dim(batch.sample_dim() - ndims_to_unfold);
-  expanded_batch.set_type(batch.type());
-  expanded_batch.SetLayout(unfolded_sample_layout(batch, ndims_to_unfold));
+  int sample_dim = batch.sample_dim() - ndims_to_unfold;
+  auto layout = unfolded_sample_layout(batch, ndims_to_unfold);
+  if (expanded_batch.IsContiguous() || expanded_batch.type() != batch.type() ||
+      expanded_batch.sample_dim() != sample_dim || expanded_batch.GetLayout() != layout) {
+    expanded_batch.Reset();
+    expanded_batch.SetSize(num_expanded_samples);
+    expanded_batch.set_sample_dim(sample_dim);
+    expanded_batch.set_type(batch.type());
+    expanded_batch.SetLayout(layout);
+  } else {
+    expanded_batch.SetSize(num_expanded_samples);
+  }
   return {expanded_batch};
 }
 
@@ -266,6 +266,21 @@ TYPED_TEST(SequenceShapeUnfoldTest, UnfoldVarExtents3ItersNoLayout) {
   this->TestUnfolding(*expanded_batch, batch, 3);
 }
 
+TYPED_TEST(SequenceShapeUnfoldTest, Unfold1ExtentReuse) {
+  // the expanded batch is reused when the type, dimensionality and layout don't change
+  auto [batch, expanded_batch] = this->CreateTestBatch(DALI_UINT8, false, "FXY");
+  this->TestUnfolding(*expanded_batch, batch, 1);
+  batch.Resize({{2, 2, 6}}, DALI_UINT8);
+  batch.SetLayout("FXY");
+  this->TestUnfolding(*expanded_batch, batch, 1);
+  EXPECT_TRUE(expanded_batch->shares_data());
+  batch.Resize({{30, 2, 6}, {13, 4, 11}, {13, 4, 11}}, DALI_UINT8);
+  batch.SetLayout("FXY");
+  this->TestUnfolding(*expanded_batch, batch, 1);
+  batch.SetLayout("FYX");
+  this->TestUnfolding(*expanded_batch, batch, 1);
+}
+
 TYPED_TEST(SequenceShapeUnfoldTest, Unfold2ExtentsEmptyLayout) {
   auto [batch, expanded_batch] = this->CreateTestBatch(DALI_UINT8, false, "");
   this->TestUnfolding(*expanded_batch, batch, 2);
@@ -24,6 +24,7 @@
 
 #include "dali/core/device_guard.h"
 #include "dali/core/mm/default_resources.h"
+#include "dali/pipeline/build_cache.h"
 #include "dali/pipeline/dali.pb.h"
 #include "dali/pipeline/executor/executor_factory.h"
 #include "dali/pipeline/operator/argument.h"
@@ -31,9 +32,12 @@
 #include "dali/pipeline/operator/error_reporting.h"
 #include "dali/pipeline/operator/name_utils.h"
 #include "dali/pipeline/graph/graph2dot.h"
+#include "dali/pipeline/graph/constant_folding.h"
 #include "dali/pipeline/graph/cse.h"
 #include "dali/pipeline/graph/node_meta.h"
+#include "dali/pipeline/graph/unused_outputs.h"
 #include "dali/pipeline/operator/builtin/input_operator.h"
+#include "dali/pipeline/operator/builtin/make_contiguous.h"
 
 #ifdef DALI_DEBUG_SERIALIZE
 #include <google/protobuf/util/json_util.h>
@@ -120,6 +124,37 @@ bool IsCSEEnabled() {
   return enabled;
 }
 
+bool IsConstantFoldingEnabled() {
+  static const bool enabled = []() {
+    if (!IsGraphOptimizationEnabled())
+      return false;
+    if (const char *env = getenv("DALI_ENABLE_CONSTANT_FOLDING"))
+      return atoi(env) != 0;
+    else  // enabled by default
+      return true;
+  }();
+  return enabled;
+}
+
+bool IsUnusedOutputMarkingEnabled() {
+  static const bool enabled = []() {
+    if (!IsGraphOptimizationEnabled())
+      return false;
+    if (const char *env = getenv("DALI_MARK_UNUSED_OUTPUTS"))
+      return atoi(env) != 0;
+    else  // enabled by default
+      return true;
+  }();
+  return enabled;
+}
+
+/** Describes the enabled graph optimizations; the optimized graphs are cached per settings. */
+std::string GraphOptimizationSettings() {
+  return make_string("cse=", IsCSEEnabled(),
+                     ";cf=", IsConstantFoldingEnabled(),
+                     ";uo=", IsUnusedOutputMarkingEnabled());
+}
+
 }  // namespace
 
 Pipeline::Pipeline(int max_batch_size, int num_threads, int device_id, int64_t seed,
@@ -656,9 +691,17 @@ void Pipeline::Build(std::vector<PipelineOutputDesc> output_descs) {
     }
   }
 
-  // Graph optimization goes here
-  if (IsCSEEnabled())
-    graph::EliminateCommonSubgraphs(graph_);
+  // Graph optimization goes here - only this part is cached; the lowering and the stream
+  // assignment (in executor_->Build) are repeated for every pipeline.
+  auto &build_cache = BuildCache::instance();
+  std::string cache_key;
+  if (build_cache.Enabled())
+    cache_key = BuildCache::Key(graph_, GraphOptimizationSettings());
+  if (cache_key.empty() || !build_cache.Load(cache_key, graph_, graph_opt_stats_)) {
+    OptimizeGraph();
+    if (!cache_key.empty())
+      build_cache.Store(cache_key, graph_, graph_opt_stats_);
+  }
 
   graph::ComputeDataNodeMetadata(graph_);
 
@@ -674,6 +717,20 @@ void Pipeline::Build(std::vector<PipelineOutputDesc> output_descs) {
 }
 
 
+void Pipeline::OptimizeGraph() {
+  graph_opt_stats_ = {};
+  if (IsCSEEnabled()) {
+    int num_ops = graph_.OpNodes().size();
+    graph::EliminateCommonSubgraphs(graph_);
+    graph_opt_stats_.cse_merged_ops = num_ops - graph_.OpNodes().size();
+  }
+  if (IsConstantFoldingEnabled())
+    graph::FoldConstants(graph_, &graph_opt_stats_);
+  if (IsUnusedOutputMarkingEnabled())
+    graph::MarkUnusedOutputs(graph_, &graph_opt_stats_);
+}
+
+
 void Pipeline::SetOutputDescs(const vector<std::pair<string, string>> &output_names) {
   DALI_ENFORCE(
       output_descs_.empty(),
@@ -918,6 +975,21 @@ OperatorBase *Pipeline::GetOperator(std::string_view name) {
   return executor_->GetOperator(name);
 }
 
+void Pipeline::SetCPUOutputAllocator(std::function<std::shared_ptr<uint8_t>(size_t)> allocate) {
+  DALI_ENFORCE(built_,
+               "\"Build()\" must be called prior to calling \"SetCPUOutputAllocator()\".");
+  for (auto &name : graph_.Outputs()) {
+    auto *data = graph_.GetData(name);
+    if (!data || data->device != StorageDevice::CPU || !data->producer.op)
+      continue;
+    auto &producer = *data->producer.op;
+    if (producer.spec.SchemaName() != "MakeContiguous" || producer.op_type != OpType::CPU)
+      continue;
+    if (auto *op = executor_->GetOperator(producer.instance_name))
+      SetMakeContiguousOutputAllocator(*op, allocate);
+  }
+}
+
 const graph::OpNode *Pipeline::GetInputOperatorNode(std::string_view name) {
   auto it = input_operators_.find(name);
   if (it != input_operators_.end())
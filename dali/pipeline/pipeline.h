@@ -30,12 +30,14 @@
 #include <vector>
 
 #include "dali/core/common.h"
+#include "dali/core/exec/timeline.h"
 #include "dali/pipeline/data/backend.h"
 #include "dali/pipeline/data/tensor.h"
 #include "dali/pipeline/data/tensor_list.h"
 #include "dali/pipeline/executor/executor.h"
 #include "dali/pipeline/executor/queue_metadata.h"
 #include "dali/pipeline/graph/op_graph2.h"
+#include "dali/pipeline/graph/optimization_stats.h"
 #include "dali/pipeline/pipeline_output_desc.h"
 #include "dali/pipeline/operator/builtin/input_operator.h"
 #include "dali/pipeline/operator/checkpointing/checkpoint.h"
@@ -258,6 +260,18 @@ class DLL_PUBLIC Pipeline {
    */
   DLL_PUBLIC OperatorBase *GetOperator(std::string_view instance_name);
 
+  /**
+   * @brief Sets the function which allocates the CPU outputs of the pipeline.
+   *
+   * The function is used by the operators which make the CPU outputs contiguous, when they
+   * copy the data. An output which is passed through (because its producer already returns
+   * a contiguous batch) or which doesn't come from such an operator (e.g. it was folded to
+   * a constant) is not allocated with this function.
+   * The function takes the size of the whole batch and returns a pointer owning the memory.
+   * It's used starting with the next iteration that begins after this call.
+   */
+  DLL_PUBLIC void SetCPUOutputAllocator(std::function<std::shared_ptr<uint8_t>(size_t)> allocate);
+
   /**
    * @brief Returns an input graph node with a given name
    */
@@ -379,6 +393,55 @@ class DLL_PUBLIC Pipeline {
     }
   }
 
+  /**
+   * @brief Starts recording the CPU-side timeline of the execution
+   *
+   * The timeline is process-wide - it contains the activity of all pipelines.
+   * The events recorded previously are discarded.
+   *
+   * @param sampling_period only every sampling_period-th iteration is recorded
+   */
+  DLL_PUBLIC void StartTimeline(int sampling_period = 1) {
+    auto &tracer = TimelineTracer::instance();
+    tracer.Stop();
+    tracer.Clear();
+    tracer.Start(sampling_period);
+  }
+
+  /**
+   * @brief Stops recording the timeline; the recorded events can still be obtained.
+   */
+  DLL_PUBLIC void StopTimeline() {
+    TimelineTracer::instance().Stop();
+  }
+
+  /**
+   * @brief Returns the recorded timeline as JSON in Chrome trace format
+   */
+  DLL_PUBLIC std::string GetTimeline() const {
+    return TimelineTracer::instance().ExportChromeTrace();
+  }
+
+  /**
+   * @brief Obtains the analysis of the stalls and the critical path of the pipeline
+   *
+   * The analysis must be enabled with ExecutorFlags::StallAnalysis; otherwise, the report is empty.
+   */
+  DLL_PUBLIC StallReport GetStallReport() {
+    if (executor_) {
+      return executor_->GetStallReport();
+    } else {
+      return {};
+    }
+  }
+
+  /**
+   * @brief Returns the work eliminated by the graph optimizations in the last build
+   */
+  DLL_PUBLIC const graph::OptimizationStats &GetGraphOptimizationStats() const {
+    return graph_opt_stats_;
+  }
+
   DLL_PUBLIC QueueSizes GetQueueSizes() const {
     return *params_.prefetch_queue_depths;
   }
@@ -626,6 +689,9 @@ class DLL_PUBLIC Pipeline {
 
   void PropagateMemoryHint(graph::OpNode &node);
 
+  /** Runs the graph optimization passes on graph_ and records their statistics. */
+  void OptimizeGraph();
+
   inline void AddToOpSpecs(std::string_view inst_name, const OpSpec &spec, int logical_id);
 
   int GetNextLogicalId();
@@ -731,6 +797,7 @@ class DLL_PUBLIC Pipeline {
   std::unique_ptr<ExecutorBase> executor_;
   graph::OpGraph graph_;
   graph::OpGraph::Builder graph_builder_;
+  graph::OptimizationStats graph_opt_stats_;
   std::map<string, EdgeMeta> edge_names_;
 
   struct OpDefinition {
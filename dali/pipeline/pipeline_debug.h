@@ -18,6 +18,7 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "dali/core/cuda_stream_pool.h"
@@ -28,6 +29,9 @@ namespace dali {
 
 /**
  * @brief Debug mode pipeline keeping operators, thread pool and CUDA stream.
+ *
+ * Stateless CPU operators are not bound to their logical ids - the calls with the same
+ * configuration and kind of inputs share an instance from an EagerOperatorCache.
  */
 class DLL_PUBLIC PipelineDebug {
   template <typename Backend>
@@ -42,7 +46,8 @@ class DLL_PUBLIC PipelineDebug {
       : max_batch_size_(max_batch_size),
         device_id_(device_id),
         num_threads_(num_threads),
-        thread_pool_(num_threads, device_id, set_affinity, "Debug pipeline") {
+        thread_pool_(num_threads, device_id, set_affinity, "Debug pipeline"),
+        cpu_operator_cache_(kOperatorCacheCapacity, num_threads) {
     if (device_id != CPU_ONLY_DEVICE_ID) {
       DeviceGuard g(device_id);
       cuda_stream_ = CUDAStreamPool::instance().Get(device_id);
@@ -85,17 +90,31 @@ class DLL_PUBLIC PipelineDebug {
     if (device == "gpu") {
       gpu_operators_.insert({logical_id, EagerOperator<GPUBackend>(spec, name, num_threads_)});
     } else if (device == "cpu") {
-      cpu_operators_.insert({logical_id, EagerOperator<CPUBackend>(spec, name, num_threads_)});
+      if (EagerOperatorCache<CPUBackend>::IsCacheable(spec.GetSchema())) {
+        auto key = EagerOperatorCache<CPUBackend>::SpecKey(spec);
+        cached_cpu_operators_.insert({logical_id, CachedOperator{spec, std::move(key)}});
+      } else {
+        cpu_operators_.insert({logical_id, EagerOperator<CPUBackend>(spec, name, num_threads_)});
+      }
     } else if (device == "mixed") {
       mixed_operators_.insert({logical_id, EagerOperator<MixedBackend>(spec, name, num_threads_)});
     }
   }
 
+  static constexpr int kOperatorCacheCapacity = 256;
+
+  struct CachedOperator {
+    OpSpec spec;
+    std::string key;  // see EagerOperatorCache::SpecKey
+  };
+
   int max_batch_size_;
   int device_id_;
   int num_threads_;
   CUDAStreamLease cuda_stream_;
   OldThreadPool thread_pool_;
+  EagerOperatorCache<CPUBackend> cpu_operator_cache_;
+  std::unordered_map<int, CachedOperator> cached_cpu_operators_;
   std::unordered_map<int, EagerOperator<CPUBackend>> cpu_operators_;
   std::unordered_map<int, EagerOperator<GPUBackend>> gpu_operators_;
   std::unordered_map<int, EagerOperator<MixedBackend>> mixed_operators_;
@@ -106,6 +125,11 @@ std::vector<std::shared_ptr<TensorList<CPUBackend>>> PipelineDebug::RunOperator<
     int logical_id, const std::vector<std::shared_ptr<TensorList<CPUBackend>>> &inputs,
     const std::unordered_map<std::string, std::shared_ptr<TensorList<CPUBackend>>> &kwargs,
     int batch_size) {
+  auto cached = cached_cpu_operators_.find(logical_id);
+  if (cached != cached_cpu_operators_.end()) {
+    auto &[spec, key] = cached->second;
+    return cpu_operator_cache_.Run(spec, key, inputs, kwargs, &thread_pool_, batch_size);
+  }
   auto op = cpu_operators_.find(logical_id);
   DALI_ENFORCE(op != cpu_operators_.end(), "Failed to acquire CPU Operator in PipelineDebug.");
   return op->second.Run(inputs, kwargs, &thread_pool_, batch_size);
@@ -47,6 +47,8 @@ struct PipelineParams {
       } else {
         auto flags = executor_flags.value();
         flags = flags | (p.executor_flags.value() & ExecutorFlags::SetAffinity);
+        flags = flags | (p.executor_flags.value() & ExecutorFlags::AdaptiveTuning);
+        flags = flags | (p.executor_flags.value() & ExecutorFlags::StallAnalysis);
         // Treat stream policy and concurency as separate optional entries, keeping the original
         // values if the respective submasks are not set.
         if ((p.executor_flags.value() & ExecutorFlags::StreamPolicyMask)
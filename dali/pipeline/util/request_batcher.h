@@ -0,0 +1,325 @@
+// Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DALI_PIPELINE_UTIL_REQUEST_BATCHER_H_
+#define DALI_PIPELINE_UTIL_REQUEST_BATCHER_H_
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "dali/core/common.h"
+#include "dali/core/error_handling.h"
+
+namespace dali {
+
+/**
+ * @brief The latency budget of continuous batching.
+ */
+struct RequestBatchingPolicy {
+  /**
+   * @brief The maximum number of samples in a batch - typically, the pipeline's max_batch_size.
+   *
+   * A batch is launched as soon as the next request wouldn't fit in it.
+   */
+  int max_batch_size = 1;
+  /**
+   * @brief The maximum time the oldest request can wait for the batch to be launched.
+   */
+  std::chrono::microseconds max_wait{0};
+};
+
+/**
+ * @brief Latency and throughput of the requests processed with a RequestBatcher.
+ *
+ * The times are in microseconds.
+ */
+struct RequestBatchingStats {
+  int64_t num_requests = 0;
+  int64_t num_batches = 0;
+  int64_t num_samples = 0;
+  int64_t num_completed_samples = 0;
+  /** The number of batches launched because they were full (rather than on timeout) */
+  int64_t num_full_batches = 0;
+  /** The time from the submission of a request to the launch of its batch */
+  double mean_queue_delay = 0, max_queue_delay = 0;
+  /**
+   * The time from the submission of a request to the completion of its batch.
+   * The mean and max cover all the requests; the percentiles - the most recent
+   * RequestBatcher::kLatencyWindow requests.
+   */
+  double mean_latency = 0, p50_latency = 0, p99_latency = 0, max_latency = 0;
+  /** Completed samples per second, from the first submission to the last completion */
+  double throughput = 0;
+
+  double mean_batch_size() const {
+    return num_batches ? static_cast<double>(num_samples) / num_batches : 0;
+  }
+};
+
+/**
+ * @brief Groups the requests, each of which consists of a few samples, into batches, as
+ *        prescribed by a latency budget.
+ *
+ * The requests are submitted by any number of threads. The thread that drives the pipeline
+ * waits for a batch and is woken up when either the batch is full or the oldest request in it
+ * has waited for `max_wait`. Then, it concatenates the requests' samples, feeds them to the
+ * pipeline's input operator and runs an iteration - there's no need to wait for a full batch.
+ * The outputs of each request are the samples [first_sample, first_sample + num_samples) of
+ * the pipeline outputs (see daliPipelineOutputsGetSamples).
+ * The C API exposes this mode with daliPipelineSubmitRequest and daliPipelineRunBatched.
+ *
+ * The requests are never split between batches and are batched in the order of submission.
+ *
+ * @tparam Request a user-defined description of the request (e.g. its id and input data)
+ */
+template <typename Request>
+class RequestBatcher {
+ public:
+  using clock = std::chrono::steady_clock;
+
+  /** The number of the most recent latencies from which the percentiles are calculated */
+  static constexpr int kLatencyWindow = 4096;
+
+  struct Entry {
+    Request request;
+    int num_samples = 0;
+    /** The index of the first sample of the request in the batch */
+    int first_sample = 0;
+    clock::time_point submitted;
+  };
+
+  struct Batch {
+    std::vector<Entry> requests;
+    int num_samples = 0;
+    clock::time_point launched;
+    /** If true, the batch was launched because it was full; otherwise - on timeout */
+    bool full = false;
+  };
+
+  explicit RequestBatcher(RequestBatchingPolicy policy) : policy_(policy) {
+    DALI_ENFORCE(policy.max_batch_size > 0, make_string(
+        "The maximum batch size must be positive. Got: ", policy.max_batch_size));
+    DALI_ENFORCE(policy.max_wait.count() >= 0, "The maximum wait time cannot be negative.");
+  }
+
+  DISABLE_COPY_MOVE_ASSIGN(RequestBatcher);
+
+  /**
+   * @brief Submits a request consisting of `num_samples` samples.
+   *
+   * @param submitted the time of the submission; it can be specified explicitly when the
+   *                  request has been waiting elsewhere before.
+   */
+  void Submit(Request request, int num_samples, clock::time_point submitted = clock::now()) {
+    DALI_ENFORCE(num_samples > 0 && num_samples <= policy_.max_batch_size, make_string(
+        "A request must contain between 1 and ", policy_.max_batch_size, " samples. Got: ",
+        num_samples));
+    {
+      std::lock_guard<std::mutex> lock(mtx_);
+      DALI_ENFORCE(!stopped_, "Cannot submit requests after the batcher has been stopped.");
+      pending_.push_back({ std::move(request), num_samples, 0, submitted });
+      pending_samples_ += num_samples;
+      if (stats_first_submitted_ == clock::time_point() || submitted < stats_first_submitted_)
+        stats_first_submitted_ = submitted;
+    }
+    cv_.notify_one();
+  }
+
+  /**
+   * @brief Waits until a batch is due and returns it.
+   *
+   * @return The next batch or an empty optional, if the batcher was stopped and all pending
+   *         requests have been returned.
+   */
+  std::optional<Batch> WaitForBatch() {
+    std::unique_lock<std::mutex> lock(mtx_);
+    for (;;) {
+      auto now = clock::now();
+      if (IsDue(now))
+        return FormBatch(now);
+      if (pending_.empty()) {
+        if (stopped_)
+          return std::nullopt;
+        cv_.wait(lock);
+      } else {
+        cv_.wait_until(lock, Deadline());
+      }
+    }
+  }
+
+  /**
+   * @brief Returns a batch if one is due at the time `now`; doesn't block.
+   */
+  std::optional<Batch> TryGetBatch(clock::time_point now = clock::now()) {
+    std::lock_guard<std::mutex> lock(mtx_);
+    if (!IsDue(now))
+      return std::nullopt;
+    return FormBatch(now);
+  }
+
+  /**
+   * @brief The time at which the oldest pending request exceeds its wait budget, if any.
+   */
+  std::optional<clock::time_point> NextDeadline() const {
+    std::lock_guard<std::mutex> lock(mtx_);
+    if (pending_.empty())
+      return std::nullopt;
+    return Deadline();
+  }
+
+  /**
+   * @brief Records the completion of the batch (e.g. when its outputs are ready), for statistics.
+   */
+  void Complete(const Batch &batch, clock::time_point completed = clock::now()) {
+    std::lock_guard<std::mutex> lock(mtx_);
+    for (auto &entry : batch.requests)
+      RecordLatency(Microseconds(completed - entry.submitted));
+    stats_.num_completed_samples += batch.num_samples;
+    if (completed > stats_last_completed_)
+      stats_last_completed_ = completed;
+  }
+
+  /**
+   * @brief Makes the pending requests due immediately and stops accepting new ones.
+   */
+  void Stop() {
+    {
+      std::lock_guard<std::mutex> lock(mtx_);
+      stopped_ = true;
+    }
+    cv_.notify_all();
+  }
+
+  bool IsStopped() const {
+    std::lock_guard<std::mutex> lock(mtx_);
+    return stopped_;
+  }
+
+  const RequestBatchingPolicy &Policy() const {
+    return policy_;
+  }
+
+  int NumPendingSamples() const {
+    std::lock_guard<std::mutex> lock(mtx_);
+    return pending_samples_;
+  }
+
+  RequestBatchingStats GetStats() const {
+    std::lock_guard<std::mutex> lock(mtx_);
+    RequestBatchingStats stats = stats_;
+    if (stats.num_requests > 0)
+      stats.mean_queue_delay = queue_delay_sum_ / stats.num_requests;
+    if (num_latencies_ > 0) {
+      std::vector<double> window = latencies_;
+      auto percentile = [&](double p) {
+        auto nth = window.begin() + std::min<size_t>(window.size() - 1, p * window.size());
+        std::nth_element(window.begin(), nth, window.end());
+        return *nth;
+      };
+      stats.mean_latency = latency_sum_ / num_latencies_;
+      stats.p50_latency = percentile(0.5);
+      stats.p99_latency = percentile(0.99);
+      stats.max_latency = max_latency_;
+      double duration = Microseconds(stats_last_completed_ - stats_first_submitted_);
+      if (duration > 0)
+        stats.throughput = stats.num_completed_samples * 1e+6 / duration;
+    }
+    return stats;
+  }
+
+  void ResetStats() {
+    std::lock_guard<std::mutex> lock(mtx_);
+    stats_ = {};
+    queue_delay_sum_ = 0;
+    latencies_.clear();
+    latency_sum_ = 0;
+    max_latency_ = 0;
+    num_latencies_ = 0;
+    stats_first_submitted_ = {};
+    stats_last_completed_ = {};
+  }
+
+ private:
+  static double Microseconds(clock::duration d) {
+    return std::chrono::duration<double, std::micro>(d).count();
+  }
+
+  /** Accumulates the latency and stores it in the window, overwriting the oldest one */
+  void RecordLatency(double latency) {
+    if (latencies_.size() < static_cast<size_t>(kLatencyWindow))
+      latencies_.push_back(latency);
+    else
+      latencies_[num_latencies_ % kLatencyWindow] = latency;
+    num_latencies_++;
+    latency_sum_ += latency;
+    max_latency_ = std::max(max_latency_, latency);
+  }
+
+  clock::time_point Deadline() const {
+    return pending_.front().submitted + policy_.max_wait;
+  }
+
+  bool IsDue(clock::time_point now) const {
+    if (pending_.empty())
+      return false;
+    return stopped_ || pending_samples_ >= policy_.max_batch_size || now >= Deadline();
+  }
+
+  Batch FormBatch(clock::time_point now) {
+    Batch batch;
+    batch.launched = now;
+    while (!pending_.empty() &&
+           batch.num_samples + pending_.front().num_samples <= policy_.max_batch_size) {
+      auto &entry = batch.requests.emplace_back(std::move(pending_.front()));
+      pending_.pop_front();
+      entry.first_sample = batch.num_samples;
+      batch.num_samples += entry.num_samples;
+      double delay = Microseconds(now - entry.submitted);
+      queue_delay_sum_ += delay;
+      stats_.max_queue_delay = std::max(stats_.max_queue_delay, delay);
+    }
+    pending_samples_ -= batch.num_samples;
+    batch.full = batch.num_samples == policy_.max_batch_size || !pending_.empty();
+    stats_.num_requests += batch.requests.size();
+    stats_.num_samples += batch.num_samples;
+    stats_.num_batches++;
+    if (batch.full)
+      stats_.num_full_batches++;
+    return batch;
+  }
+
+  RequestBatchingPolicy policy_;
+  mutable std::mutex mtx_;
+  std::condition_variable cv_;
+  std::deque<Entry> pending_;
+  int pending_samples_ = 0;
+  bool stopped_ = false;
+
+  RequestBatchingStats stats_;
+  double queue_delay_sum_ = 0;
+  std::vector<double> latencies_;  // a circular buffer of the last kLatencyWindow latencies
+  double latency_sum_ = 0, max_latency_ = 0;
+  int64_t num_latencies_ = 0;
+  clock::time_point stats_first_submitted_{}, stats_last_completed_{};
+};
+
+}  // namespace dali
+
+#endif  // DALI_PIPELINE_UTIL_REQUEST_BATCHER_H_
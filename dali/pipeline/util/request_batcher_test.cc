@@ -0,0 +1,250 @@
+// Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "dali/pipeline/util/request_batcher.h"
+
+namespace dali {
+
+namespace test {
+
+namespace {
+
+using Batcher = RequestBatcher<int>;
+using clock = Batcher::clock;
+using std::chrono::microseconds;
+
+/**
+ * @brief Generates the arrival times and sizes of requests arriving as a Poisson process.
+ */
+struct PoissonRequestGenerator {
+  PoissonRequestGenerator(double requests_per_second, int max_request_size, int seed)
+      : interval_dist(requests_per_second / 1e+6), size_dist(1, max_request_size), rng(seed) {}
+
+  /** The time until the next arrival */
+  microseconds NextInterval() {
+    return microseconds(static_cast<int64_t>(interval_dist(rng)));
+  }
+
+  int NextSize() {
+    return size_dist(rng);
+  }
+
+  std::exponential_distribution<double> interval_dist;
+  std::uniform_int_distribution<int> size_dist;
+  std::mt19937_64 rng;
+};
+
+/**
+ * @brief Checks that all the requests were batched, in order, without exceeding the limits.
+ */
+void CheckBatches(const std::vector<Batcher::Batch> &batches, int num_requests,
+                  const RequestBatchingPolicy &policy) {
+  int next_request = 0;
+  for (auto &batch : batches) {
+    ASSERT_FALSE(batch.requests.empty());
+    EXPECT_LE(batch.num_samples, policy.max_batch_size);
+    int first_sample = 0;
+    for (auto &entry : batch.requests) {
+      EXPECT_EQ(entry.request, next_request++);
+      EXPECT_EQ(entry.first_sample, first_sample);
+      first_sample += entry.num_samples;
+    }
+    EXPECT_EQ(first_sample, batch.num_samples);
+  }
+  EXPECT_EQ(next_request, num_requests);
+}
+
+/**
+ * @brief Simulates the arrival of requests, with a driver that launches each batch as soon as
+ *        it's due. The time is simulated, so the results are deterministic.
+ */
+std::vector<Batcher::Batch> SimulatePoisson(Batcher &batcher, PoissonRequestGenerator &gen,
+                                            int num_requests) {
+  std::vector<Batcher::Batch> batches;
+  auto now = clock::time_point() + std::chrono::seconds(1);
+  auto launch_due = [&](clock::time_point until) {
+    for (;;) {
+      auto deadline = batcher.NextDeadline();
+      auto t = deadline && *deadline < until ? *deadline : until;
+      auto batch = batcher.TryGetBatch(t);
+      if (!batch)
+        break;
+      batcher.Complete(*batch, t);
+      batches.push_back(std::move(*batch));
+    }
+  };
+  for (int i = 0; i < num_requests; i++) {
+    auto arrival = now + gen.NextInterval();
+    launch_due(arrival);
+    now = arrival;
+    batcher.Submit(i, gen.NextSize(), now);
+    launch_due(now);
+  }
+  batcher.Stop();
+  launch_due(now);
+  return batches;
+}
+
+}  // namespace
+
+TEST(RequestBatcher, FullBatch) {
+  Batcher batcher({ 8, microseconds(1000000) });
+  auto t0 = clock::now();
+  batcher.Submit(0, 3, t0);
+  batcher.Submit(1, 4, t0);
+  EXPECT_FALSE(batcher.TryGetBatch(t0));
+  batcher.Submit(2, 2, t0);  // doesn't fit - the first two requests make a full batch
+  auto batch = batcher.TryGetBatch(t0);
+  ASSERT_TRUE(batch);
+  EXPECT_TRUE(batch->full);
+  EXPECT_EQ(batch->num_samples, 7);
+  ASSERT_EQ(batch->requests.size(), 2u);
+  EXPECT_EQ(batch->requests[1].first_sample, 3);
+  EXPECT_EQ(batcher.NumPendingSamples(), 2);
+  EXPECT_FALSE(batcher.TryGetBatch(t0));
+}
+
+TEST(RequestBatcher, Timeout) {
+  Batcher batcher({ 8, microseconds(500) });
+  auto t0 = clock::now();
+  batcher.Submit(0, 1, t0);
+  batcher.Submit(1, 2, t0 + microseconds(300));
+  EXPECT_FALSE(batcher.TryGetBatch(t0 + microseconds(499)));
+  ASSERT_EQ(batcher.NextDeadline(), t0 + microseconds(500));
+  auto batch = batcher.TryGetBatch(t0 + microseconds(500));
+  ASSERT_TRUE(batch);
+  EXPECT_FALSE(batch->full);
+  EXPECT_EQ(batch->num_samples, 3);
+  EXPECT_FALSE(batcher.NextDeadline());
+
+  auto stats = batcher.GetStats();
+  EXPECT_EQ(stats.num_batches, 1);
+  EXPECT_EQ(stats.num_requests, 2);
+  EXPECT_EQ(stats.max_queue_delay, 500);
+  EXPECT_EQ(stats.mean_queue_delay, 350);
+}
+
+TEST(RequestBatcher, LatencyWindow) {
+  // The percentiles are calculated from the recent requests only; the mean and max - from all
+  Batcher batcher({ 1, microseconds(0) });
+  auto t0 = clock::now();
+  auto run = [&](int n, microseconds latency) {
+    for (int i = 0; i < n; i++) {
+      batcher.Submit(i, 1, t0);
+      auto batch = batcher.TryGetBatch(t0);
+      ASSERT_TRUE(batch);
+      batcher.Complete(*batch, t0 + latency);
+    }
+  };
+  run(Batcher::kLatencyWindow, microseconds(1000));
+  auto stats = batcher.GetStats();
+  EXPECT_EQ(stats.p50_latency, 1000);
+  EXPECT_EQ(stats.p99_latency, 1000);
+
+  run(Batcher::kLatencyWindow, microseconds(10));
+  stats = batcher.GetStats();
+  EXPECT_EQ(stats.p50_latency, 10);
+  EXPECT_EQ(stats.p99_latency, 10);
+  EXPECT_EQ(stats.max_latency, 1000);
+  EXPECT_NEAR(stats.mean_latency, 505, 1e-6);
+
+  batcher.ResetStats();
+  run(1, microseconds(20));
+  stats = batcher.GetStats();
+  EXPECT_EQ(stats.p99_latency, 20);
+  EXPECT_EQ(stats.max_latency, 20);
+}
+
+TEST(RequestBatcher, InvalidRequest) {
+  Batcher batcher({ 4, microseconds(100) });
+  EXPECT_THROW(batcher.Submit(0, 0), std::runtime_error);
+  EXPECT_THROW(batcher.Submit(0, 5), std::runtime_error);
+  batcher.Stop();
+  EXPECT_THROW(batcher.Submit(0, 1), std::runtime_error);
+}
+
+TEST(RequestBatcher, PoissonLowRate) {
+  // The requests are sparse - the batches are launched on timeout and the latency is bounded
+  RequestBatchingPolicy policy{ 32, microseconds(2000) };
+  Batcher batcher(policy);
+  PoissonRequestGenerator gen(1000, 4, 1234);
+  const int num_requests = 2000;
+  auto batches = SimulatePoisson(batcher, gen, num_requests);
+  CheckBatches(batches, num_requests, policy);
+  auto stats = batcher.GetStats();
+  EXPECT_EQ(stats.num_requests, num_requests);
+  EXPECT_LE(stats.max_queue_delay, policy.max_wait.count());
+  EXPECT_LT(stats.num_full_batches, stats.num_batches / 10);
+  // about 2 requests arrive within the wait budget
+  EXPECT_GT(stats.mean_batch_size(), 3);
+  EXPECT_LT(stats.mean_batch_size(), 12);
+}
+
+TEST(RequestBatcher, PoissonHighRate) {
+  // The requests arrive faster than the wait budget - most batches are full
+  RequestBatchingPolicy policy{ 32, microseconds(2000) };
+  Batcher batcher(policy);
+  PoissonRequestGenerator gen(100000, 4, 4321);
+  const int num_requests = 20000;
+  auto batches = SimulatePoisson(batcher, gen, num_requests);
+  CheckBatches(batches, num_requests, policy);
+  auto stats = batcher.GetStats();
+  EXPECT_LE(stats.max_queue_delay, policy.max_wait.count());
+  EXPECT_GT(stats.num_full_batches, stats.num_batches * 9 / 10);
+  EXPECT_GT(stats.mean_batch_size(), 28);
+  // the batches are completed immediately, so the latency is the queueing delay
+  EXPECT_NEAR(stats.mean_latency, stats.mean_queue_delay, 1e-6);
+  EXPECT_LE(stats.p50_latency, stats.p99_latency);
+  EXPECT_LE(stats.p99_latency, stats.max_latency);
+  // the throughput keeps up with the arrival rate: ~250k samples/s
+  EXPECT_GT(stats.throughput, 200000);
+  EXPECT_LT(stats.throughput, 300000);
+}
+
+TEST(RequestBatcher, PoissonThreaded) {
+  // Real time: a producer thread submits the requests, the driver waits for the batches
+  RequestBatchingPolicy policy{ 16, microseconds(1000) };
+  Batcher batcher(policy);
+  const int num_requests = 500;
+  std::thread producer([&]() {
+    PoissonRequestGenerator gen(20000, 4, 42);
+    for (int i = 0; i < num_requests; i++) {
+      std::this_thread::sleep_for(gen.NextInterval());
+      batcher.Submit(i, gen.NextSize());
+    }
+    batcher.Stop();
+  });
+  std::vector<Batcher::Batch> batches;
+  while (auto batch = batcher.WaitForBatch()) {
+    batcher.Complete(*batch);
+    batches.push_back(std::move(*batch));
+  }
+  producer.join();
+  CheckBatches(batches, num_requests, policy);
+  auto stats = batcher.GetStats();
+  EXPECT_EQ(stats.num_requests, num_requests);
+  EXPECT_EQ(stats.num_completed_samples, stats.num_samples);
+  // a generous bound - the driver may be woken up late on a busy machine
+  EXPECT_LT(stats.max_queue_delay, policy.max_wait.count() + 100000);
+}
+
+}  // namespace test
+
+}  // namespace dali
@@ -24,12 +24,14 @@
 #include "dali/core/cuda_error.h"
 #include "dali/core/device_guard.h"
 #include "dali/core/nvtx.h"
+#include "dali/core/exec/timeline.h"
 
 namespace dali {
 
 OldThreadPool::OldThreadPool(int num_thread, int device_id, bool set_affinity, const char* name)
-    : threads_(num_thread) {
+    : threads_(num_thread), active_threads_(num_thread) {
   DALI_ENFORCE(num_thread > 0, "Thread pool must have non-zero size");
+  timeline_name_ = TimelineTracer::instance().Intern(make_string("[DALI][TP]", name, " job"));
 #if NVML_ENABLED
   // We use NVML only for setting thread affinity
   if (device_id != CPU_ONLY_DEVICE_ID && set_affinity) {
@@ -51,6 +53,11 @@ OldThreadPool::~OldThreadPool() {
   std::unique_lock lock(queue_lock_);
   running_ = false;
   lock.unlock();
+  // Wake up the parked threads
+  {
+    std::lock_guard active_lock(active_mutex_);
+  }
+  active_changed_.notify_all();
   // Each thread will lower the semaphore by at most 1
   queue_semaphore_.release(threads_.size());
 
@@ -121,6 +128,17 @@ int OldThreadPool::NumThreads() const {
   return threads_.size();
 }
 
+void OldThreadPool::SetActiveThreads(int num_active) {
+  DALI_ENFORCE(num_active > 0 && num_active <= NumThreads(), make_string(
+      "The number of active threads must be between 1 and ", NumThreads(), ". Got: ",
+      num_active));
+  {
+    std::lock_guard lock(active_mutex_);
+    active_threads_.store(num_active, std::memory_order_relaxed);
+  }
+  active_changed_.notify_all();
+}
+
 std::vector<std::thread::id> OldThreadPool::GetThreadIds() const {
   std::vector<std::thread::id> tids;
   tids.reserve(threads_.size());
@@ -158,6 +176,15 @@ void OldThreadPool::ThreadMain(int thread_id, int device_id, bool set_affinity,
   }
 
   while (running_) {
+    if (thread_id >= active_threads_.load(std::memory_order_relaxed)) {
+      // This thread is parked - the work is processed by the remaining ones
+      std::unique_lock active_lock(active_mutex_);
+      active_changed_.wait(active_lock, [&]() {
+        return thread_id < active_threads_.load(std::memory_order_relaxed) || !running_;
+      });
+      continue;
+    }
+
     // Wait for something to do
     queue_semaphore_.acquire();
 
@@ -177,6 +204,7 @@ void OldThreadPool::ThreadMain(int thread_id, int device_id, bool set_affinity,
     // WaitForWork is called, we will check for any errors
     // in the threads and return an error if one occured.
     try {
+      TimelineScope timeline_scope(timeline_name_, TimelineCategory::ThreadPool);
       work(thread_id);
     } catch (...) {
       tl_errors_[thread_id].push(std::current_exception());
@@ -77,6 +77,19 @@ class DLL_PUBLIC OldThreadPool : public ThreadPool {
 
   std::vector<std::thread::id> GetThreadIds() const override;
 
+  /**
+   * @brief Limits the number of threads which pick up work
+   *
+   * The remaining threads are parked until they're activated again. NumThreads still reports
+   * the total number of threads, so the work can be partitioned as usual - it's just processed
+   * by fewer threads. A thread that's already waiting for work may still pick up one more job.
+   */
+  void SetActiveThreads(int num_active);
+
+  int NumActiveThreads() const {
+    return active_threads_.load(std::memory_order_relaxed);
+  }
+
   DISABLE_COPY_MOVE_ASSIGN(OldThreadPool);
 
  private:
@@ -102,6 +115,13 @@ class DLL_PUBLIC OldThreadPool : public ThreadPool {
   std::mutex completed_mutex_;
   std::condition_variable completed_;
 
+  std::atomic_int active_threads_{0};
+  std::mutex active_mutex_;
+  std::condition_variable active_changed_;
+
+  /** The name of the jobs in the timeline */
+  int timeline_name_ = 0;
+
   // Stored errors for each thread
   vector<std::queue<std::exception_ptr>> tl_errors_;
 #if NVML_ENABLED
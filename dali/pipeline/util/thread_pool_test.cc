@@ -15,6 +15,8 @@
 #include "dali/pipeline/util/thread_pool.h"
 #include <gtest/gtest.h>
 #include <atomic>
+#include <chrono>
+#include <thread>
 
 namespace dali {
 
@@ -59,6 +61,41 @@ TEST(ThreadPool, AddWorkWithPriority) {
 }
 
 
+TEST(ThreadPool, ActiveThreads) {
+  OldThreadPool tp(4, 0, false, "OldThreadPool test");
+  EXPECT_EQ(tp.NumActiveThreads(), 4);
+  tp.SetActiveThreads(2);
+  EXPECT_EQ(tp.NumThreads(), 4);
+  // let the parked threads notice the change - otherwise they can pick up one more job
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  std::atomic<int> count{0};
+  std::atomic<bool> inactive_thread_used{false};
+  for (int i = 0; i < 64; i++) {
+    tp.AddWork([&](int thread_id) {
+      if (thread_id >= 2)
+        inactive_thread_used = true;
+      count++;
+    });
+  }
+  tp.RunAll();
+  EXPECT_EQ(count, 64);
+  EXPECT_FALSE(inactive_thread_used);
+
+  tp.SetActiveThreads(4);
+  std::atomic<int> mask{0};
+  for (int i = 0; i < 64; i++) {
+    tp.AddWork([&](int thread_id) {
+      mask |= 1 << thread_id;
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    });
+  }
+  tp.RunAll();
+  EXPECT_NE(mask & 0xc, 0) << "The reactivated threads should pick up some work";
+
+  EXPECT_THROW(tp.SetActiveThreads(0), std::exception);
+  EXPECT_THROW(tp.SetActiveThreads(5), std::exception);
+}
+
 TEST(ThreadPool, CheckName) {
   const char given_thread_pool_name[] = "OldThreadPool test";
   const char full_thread_pool_name[] = "[DALI][TP0]OldThreadPool test";
@@ -42,6 +42,10 @@ using operator_trace_map_t = std::map<
 
 class Checkpoint;
 
+namespace exec2 {
+struct IterationProfile;
+}  // namespace exec2
+
 class OperatorTraces {
  public:
   /** Gets operator traces for a single operator.
@@ -102,6 +106,9 @@ struct IterationData {
 
   OperatorTraces operator_traces;
   std::shared_ptr<Checkpoint> checkpoint;
+
+  /** The timing of the operators; present when the executor analyzes stalls. */
+  std::shared_ptr<exec2::IterationProfile> profile;
 };
 
 using SharedIterData = std::shared_ptr<IterationData>;
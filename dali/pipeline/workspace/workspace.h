@@ -82,6 +82,13 @@ class ArgumentWorkspace {
     return *argument_inputs_[it->second].cpu;
   }
 
+  int ArgumentInputIdx(std::string_view arg_name) const {
+    auto it = argument_input_idxs_.find(arg_name);
+    if (it == argument_input_idxs_.end())
+      throw invalid_key(make_string("Argument \"", arg_name, "\" not found."));
+    return it->second;
+  }
+
   const std::string &ArgumentInputName(int idx) const {
     DALI_ENFORCE_VALID_INDEX(idx, NumArgumentInput());
     return argument_inputs_[idx].name;
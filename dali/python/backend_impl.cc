@@ -2051,6 +2051,34 @@ py::dict ExecutorMetaToDict(const ExecutorMetaMap &meta) {
   return d;
 }
 
+py::dict StallReportToDict(const StallReport &report) {
+  py::dict d;
+  d["iterations"] = report.iterations;
+  d["duration_ns"] = report.duration_ns;
+  d["consumer_wait_ns"] = report.consumer_wait_ns;
+  d["queue_empty_stalls"] = report.queue_empty_stalls;
+  d["queue_full_stalls"] = report.queue_full_stalls;
+  d["critical_path_ns"] = report.critical_path_ns;
+  d["reader_starved_iterations"] = report.reader_starved_iterations;
+  d["bound"] = PipelineBoundName(report.bound);
+  d["bottleneck"] = report.bottleneck;
+  py::dict operators;
+  for (const auto &op : report.operators) {
+    py::dict op_dict;
+    op_dict["iterations"] = op.iterations;
+    op_dict["busy_ns"] = op.busy_ns;
+    op_dict["blocked_ns"] = op.blocked_ns;
+    op_dict["idle_ns"] = op.idle_ns;
+    op_dict["critical_path_iterations"] = op.critical_path_iterations;
+    op_dict["critical_path_ns"] = op.critical_path_ns;
+    op_dict["starved_iterations"] = op.starved_iterations;
+    op_dict["starvation_ns"] = op.starvation_ns;
+    operators[op.name.c_str()] = op_dict;
+  }
+  d["operators"] = operators;
+  return d;
+}
+
 void ExposePipelineDebug(py::module &m) {
   py::class_<PipelineDebug>(m, "PipelineDebug")
       .def(py::init([](int batch_size, int num_threads, int device_id, bool set_affinity = false) {
@@ -2110,6 +2138,8 @@ void ExposePipelineParams(py::module &m) {
   py::enum_<ExecutorFlags>(m, "_ExecutorFlags")
     .value("NoFlags", ExecutorFlags::None)
     .value("SetAffinity", ExecutorFlags::SetAffinity)
+    .value("AdaptiveTuning", ExecutorFlags::AdaptiveTuning)
+    .value("StallAnalysis", ExecutorFlags::StallAnalysis)
     .value("StreamPolicyMask", ExecutorFlags::StreamPolicyMask)
     .value("StreamPolicyPerOperator", ExecutorFlags::StreamPolicyPerOperator)
     .value("StreamPolicyPerBackend", ExecutorFlags::StreamPolicyPerBackend)
@@ -2237,6 +2267,22 @@ void ExposePipeline(py::module &m) {
           auto ret = p->GetExecutorMeta();
           return ExecutorMetaToDict(ret);
         })
+    .def("stall_report",
+        [](Pipeline *p) {
+          return StallReportToDict(p->GetStallReport());
+        })
+    .def("graph_optimization_stats",
+        [](Pipeline *p) {
+          auto &stats = p->GetGraphOptimizationStats();
+          py::dict d;
+          d["cse_merged_ops"] = stats.cse_merged_ops;
+          d["folded_ops"] = stats.folded_ops;
+          d["constant_nodes"] = stats.constant_nodes;
+          d["unused_outputs"] = stats.unused_outputs;
+          d["ops_with_unused_outputs"] = stats.ops_with_unused_outputs;
+          d["cached"] = stats.cached;
+          return d;
+        })
     .def("SetOutputDescs",
         [](Pipeline *p, const std::vector<OutputDesc>& outputs) {
           std::vector<PipelineOutputDesc> out_desc;
@@ -642,6 +642,70 @@ class Pipeline(object):
         self.build()
         return self._pipe.executor_statistics()
 
+    def stall_report(self):
+        """Returns the analysis of the stalls and the critical path of the pipeline.
+
+        The analysis is enabled by setting the ``DALI_EXEC2_STALL_ANALYSIS_WINDOW`` environment
+        variable to the number of iterations over which the statistics are aggregated. The report
+        describes the most recent complete window (or the current one, before the first window is
+        complete). The times are measured on the host, in nanoseconds.
+
+        The returned dictionary contains the following keys:
+
+            * ``iterations`` - the number of iterations in the window; 0 if the analysis is
+              not enabled.
+            * ``duration_ns`` - the wall time of the window, as seen by the consumer.
+            * ``consumer_wait_ns`` - the time the consumer waited for the outputs.
+            * ``queue_empty_stalls`` - the number of iterations whose outputs were not ready
+              when requested.
+            * ``queue_full_stalls`` - the number of iterations in which all queued outputs were
+              ready before they were requested - the pipeline waited for the consumer.
+            * ``critical_path_ns`` - the total length of the critical paths of the iterations.
+            * ``reader_starved_iterations`` - the number of iterations in which a reader had to
+              wait for its prefetching thread.
+            * ``bound`` - what limits the throughput: ``"reader"``, ``"decoder"``,
+              ``"processing"``, ``"consumer"`` or ``"unknown"``.
+            * ``bottleneck`` - the name of the operator which contributed the most to the
+              critical path.
+            * ``operators`` - a dictionary of per-operator statistics, with the keys
+              ``iterations``, ``busy_ns``, ``blocked_ns``, ``idle_ns``,
+              ``critical_path_iterations``, ``critical_path_ns``, ``starved_iterations`` and
+              ``starvation_ns``.
+
+        .. note::
+            The stall analysis is available only when ``exec_dynamic=True``.
+        """
+        self.build()
+        return self._pipe.stall_report()
+
+    def graph_optimization_stats(self):
+        """Returns the work eliminated by the graph optimizations when the pipeline was built.
+
+        The returned dictionary contains the following keys:
+
+            * ``cse_merged_ops`` - the number of operators merged with identical ones by
+              common subgraph elimination.
+            * ``folded_ops`` - the number of operators with constant inputs which were evaluated
+              at build time.
+            * ``constant_nodes`` - the number of constants which replaced the folded operators.
+            * ``unused_outputs`` - the number of operator outputs which are not used; the
+              operators may skip producing them.
+            * ``ops_with_unused_outputs`` - the number of operators with unused outputs.
+            * ``cached`` - whether the optimized graph was taken from the build cache.
+
+        The optimizations can be disabled with the ``DALI_OPTIMIZE_GRAPH``,
+        ``DALI_ENABLE_CSE``, ``DALI_ENABLE_CONSTANT_FOLDING`` and ``DALI_MARK_UNUSED_OUTPUTS``
+        environment variables.
+
+        The optimized graphs can be cached, so that building the same pipeline again (e.g. after
+        deserializing it in another process) skips the optimizations. The cache is enabled with
+        ``DALI_BUILD_CACHE=1`` (in memory) or ``DALI_BUILD_CACHE_DIR=<path>`` (in memory and
+        in the given directory). Only pipelines with a fixed seed and without Python operators
+        are cached.
+        """
+        self.build()
+        return self._pipe.graph_optimization_stats()
+
     def external_source_shm_statistics(self):
         """Returns parallel external source's statistics regarding shared memory consumption.
         The returned dictionary contains following keys:
@@ -498,6 +498,83 @@ def test_webdataset_reader(
     )
 
 
+@params(
+    ("file", 0, 4, 0, 1, False, False, 1),
+    ("file", 3, 5, 1, 3, True, True, 2),
+    ("tfrecord", 2, 6, 2, 3, False, True, None),
+    ("tfrecord", 1, 8, 0, 2, True, False, 3),
+    ("mxnet", 4, 3, 1, 2, False, False, 2),
+    ("webdataset", 3, 4, 2, 4, True, True, 1),
+)
+def test_global_shuffle_reader(
+    reader,
+    num_epochs,
+    batch_size,
+    shard_id,
+    num_shards,
+    random_shuffle,
+    pad_last_batch,
+    iters_into_epoch,
+):
+    common = dict(
+        pad_last_batch=pad_last_batch,
+        random_shuffle=random_shuffle,
+        shard_id=shard_id,
+        num_shards=num_shards,
+        global_shuffle=True,
+    )
+    if reader == "file":
+        check_reader_checkpointing(
+            fn.readers.file,
+            num_epochs,
+            batch_size,
+            iters_into_epoch,
+            file_root=images_dir,
+            **common,
+        )
+    elif reader == "tfrecord":
+        tfrecord_dir = os.path.join(data_root, "db", "tfrecord")
+
+        def tfrecord_wrapper(*args, **kwargs):
+            return fn.readers.tfrecord(*args, **kwargs)["image/encoded"]
+
+        check_reader_checkpointing(
+            tfrecord_wrapper,
+            num_epochs,
+            batch_size,
+            iters_into_epoch,
+            path=os.path.join(tfrecord_dir, "train"),
+            index_path=os.path.join(tfrecord_dir, "train.idx"),
+            features={"image/encoded": tfrec.FixedLenFeature((), tfrec.string, "")},
+            **common,
+        )
+    elif reader == "mxnet":
+        recordio_dir = os.path.join(data_root, "db", "recordio")
+        check_reader_checkpointing(
+            fn.readers.mxnet,
+            num_epochs,
+            batch_size,
+            iters_into_epoch,
+            path=os.path.join(recordio_dir, "train.rec"),
+            index_path=os.path.join(recordio_dir, "train.idx"),
+            **common,
+        )
+    else:
+        tar_file_paths = [
+            os.path.join(get_dali_extra_path(), f"db/webdataset/MNIST/devel-{i}.tar")
+            for i in range(3)
+        ]
+        check_reader_checkpointing(
+            fn.readers.webdataset,
+            num_epochs,
+            batch_size,
+            iters_into_epoch,
+            paths=tar_file_paths,
+            ext=["jpg", "cls"],
+            **common,
+        )
+
+
 @params(
     (0, 1, 0, 1, False, False, False, False, None),
     (5, 2, 1, 2, False, False, False, True, 1),
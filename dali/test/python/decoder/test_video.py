@@ -582,6 +582,42 @@ def test_video_decoder_no_padding(device, batch_size, filenames, stride, sequenc
         compare_videos(ref, actual)
 
 
+@params(
+    *[
+        (batch_size, codec_threads, thread_type)
+        for batch_size in [1, 3]
+        for codec_threads, thread_type in [(0, "frame_slice"), (4, "frame"), (2, "slice")]
+    ],
+)
+def test_video_decoder_codec_threads(batch_size, codec_threads, thread_type):
+    batch = []
+    for i in range(batch_size):
+        with open(cfr_files[i % len(cfr_files)], "rb") as f:
+            batch.append(np.frombuffer(f.read(), dtype=np.uint8))
+
+    def get_batch():
+        return batch
+
+    @pipeline_def
+    def test_pipeline():
+        encoded = fn.external_source(source=get_batch, device="cpu")
+        reference = fn.decoders.video(encoded, device="cpu", start_frame=3, stride=2)
+        decoded = fn.decoders.video(
+            encoded,
+            device="cpu",
+            start_frame=3,
+            stride=2,
+            codec_threads=codec_threads,
+            codec_thread_type=thread_type,
+        )
+        return (reference, decoded)
+
+    pipe = test_pipeline(batch_size=batch_size, num_threads=4, device_id=None)
+    out_ref, out = pipe.run()
+    for i in range(batch_size):
+        compare_videos(out_ref.at(i), out.at(i))
+
+
 @params("cpu", "mixed")
 def test_incompatible_args(device):
     skip_if_m60()
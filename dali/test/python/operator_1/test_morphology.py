@@ -86,8 +86,8 @@ def reference_pipe(data_src, layout, ksize_src, anchor_src, border_mode, morph_t
 
 
 @dali.pipeline_def(num_threads=NUM_THREADS, device_id=DEV_ID)
-def morphology_pipe(data_src, layout, ksize_src, anchor_src, border_mode, morph_type):
-    img = fn.external_source(source=data_src, batch=True, layout=layout, device="gpu")
+def morphology_pipe(data_src, layout, ksize_src, anchor_src, border_mode, morph_type, device):
+    img = fn.external_source(source=data_src, batch=True, layout=layout, device=device)
     ksize = fn.external_source(source=ksize_src)
     anchor = fn.external_source(source=anchor_src)
     if morph_type == "dilate":
@@ -123,18 +123,24 @@ def anchor_src(bs, seed):
 
 
 @params(
-    ("dilate", 32, "HWC", np.uint8, 3, 9, "constant"),
-    ("dilate", 32, "CHW", np.float32, 1, 4, "constant"),
-    ("dilate", 32, "HWC", np.uint16, 1, 5, "reflect"),
-    ("dilate", 4, "FHWC", np.float32, 3, 5, "reflect_101"),
-    ("dilate", 4, "FCHW", np.uint8, 4, 9, "replicate"),
-    ("erode", 32, "HWC", np.uint8, 3, 9, "constant"),
-    ("erode", 32, "CHW", np.float32, 1, 4, "constant"),
-    ("erode", 32, "HWC", np.uint16, 1, 5, "reflect"),
-    ("erode", 4, "FHWC", np.float32, 3, 5, "reflect_101"),
-    ("erode", 4, "FCHW", np.uint8, 4, 9, "replicate"),
+    *[
+        (device,) + case
+        for device in ("cpu", "gpu")
+        for case in [
+            ("dilate", 32, "HWC", np.uint8, 3, 9, "constant"),
+            ("dilate", 32, "CHW", np.float32, 1, 4, "constant"),
+            ("dilate", 32, "HWC", np.uint16, 1, 5, "reflect"),
+            ("dilate", 4, "FHWC", np.float32, 3, 5, "reflect_101"),
+            ("dilate", 4, "FCHW", np.uint8, 4, 9, "replicate"),
+            ("erode", 32, "HWC", np.uint8, 3, 9, "constant"),
+            ("erode", 32, "CHW", np.float32, 1, 4, "constant"),
+            ("erode", 32, "HWC", np.uint16, 1, 5, "reflect"),
+            ("erode", 4, "FHWC", np.float32, 3, 5, "reflect_101"),
+            ("erode", 4, "FCHW", np.uint8, 4, 9, "replicate"),
+        ]
+    ]
 )
-def test_dilate_vs_ocv(morph_type, bs, layout, dtype, channels, max_ksize, border_mode):
+def test_dilate_vs_ocv(device, morph_type, bs, layout, dtype, channels, max_ksize, border_mode):
     cdim = layout.find("C")
     min_shape = [64 for c in layout]
     min_shape[cdim] = channels
@@ -174,6 +180,7 @@ def test_dilate_vs_ocv(morph_type, bs, layout, dtype, channels, max_ksize, borde
         anchor_src=anchor1,
         border_mode=border_mode,
         morph_type=morph_type,
+        device=device,
         batch_size=bs,
         prefetch_queue_depth=1,
     )
@@ -66,7 +66,7 @@ def _cv_remap(img, mapx, mapy):
 
 
 @pipeline_def
-def remap_pipe(remap_op, maps_data, img_size):
+def remap_pipe(remap_op, maps_data, img_size, device="gpu"):
     """
     Returns either a reference pipeline or a pipeline under test.
 
@@ -76,6 +76,7 @@ def remap_pipe(remap_op, maps_data, img_size):
     :param remap_op: 'dali' or 'cv'.
     :param maps_data: List of ndarrays, which contains data for the remap parameters (maps).
     :param img_size: Shape of the remap parameters, but without the channels value (only spatial).
+    :param device: Device of the DALI operator under test.
     :return: DALI Pipeline
     """
     img, _ = fn.readers.file(file_root=data_dir)
@@ -83,12 +84,14 @@ def remap_pipe(remap_op, maps_data, img_size):
     img = fn.resize(img, size=img_size)
     mapx, mapy = fn.external_source(source=maps_data, batch=True, cycle=True, num_outputs=2)
     if remap_op == "dali":
+        if device == "gpu":
+            img, mapx, mapy = img.gpu(), mapx.gpu(), mapy.gpu()
         return fn.experimental.remap(
-            img.gpu(),
-            mapx.gpu(),
-            mapy.gpu(),
+            img,
+            mapx,
+            mapy,
             interp=DALIInterpType.INTERP_NN,
-            device="gpu",
+            device=device,
             pixel_origin="center",
         )
     elif remap_op == "cv":
@@ -107,10 +110,18 @@ class RemapTest(unittest.TestCase):
             "device_id": 0,
         }
 
-    @params("identity", "xflip", "yflip", "xyflip", "random")
-    def test_remap(self, map_mode):
+    @params(
+        *[
+            (map_mode, device)
+            for device in ("cpu", "gpu")
+            for map_mode in ("identity", "xflip", "yflip", "xyflip", "random")
+        ]
+    )
+    def test_remap(self, map_mode, device):
         maps = [update_map(mode=map_mode, shape=self.img_size, nimages=self.batch_size)]
-        dpipe = remap_pipe("dali", maps, self.img_size, **self.common_dali_pipe_params)
+        dpipe = remap_pipe(
+            "dali", maps, self.img_size, device=device, **self.common_dali_pipe_params
+        )
         cpipe = remap_pipe(
             "cv",
             maps,
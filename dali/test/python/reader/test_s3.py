@@ -0,0 +1,121 @@
+# Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import os
+import socket
+import tempfile
+
+import numpy as np
+import nvidia.dali.fn as fn
+from nvidia.dali import pipeline_def
+
+from nose_utils import SkipTest
+
+# The S3 client and the range reader options are read once per process, so the environment
+# must be set up before any S3 file is opened. Small blocks and parts make sure that the test
+# data exercises the block cache and the parallel multi-part reads.
+os.environ.setdefault("AWS_ACCESS_KEY_ID", "testing")
+os.environ.setdefault("AWS_SECRET_ACCESS_KEY", "testing")
+os.environ.setdefault("AWS_DEFAULT_REGION", "us-east-1")
+os.environ["DALI_S3_BLOCK_SIZE"] = "4096"
+os.environ["DALI_S3_CACHE_BLOCKS"] = "4"
+os.environ["DALI_S3_PART_SIZE"] = "65536"
+os.environ["DALI_S3_MAX_PARALLEL_PARTS"] = "4"
+
+g_bucket = "dali-test"
+g_server = None
+g_tmpdir = None
+g_files = {}
+g_arrays = {}
+
+
+def _free_port():
+    with socket.socket() as s:
+        s.bind(("127.0.0.1", 0))
+        return s.getsockname()[1]
+
+
+def setUpModule():
+    global g_server, g_tmpdir
+    try:
+        import boto3
+        from moto.server import ThreadedMotoServer
+    except ImportError:
+        raise SkipTest("moto[server] and boto3 are required to run S3 tests")
+
+    port = _free_port()
+    g_server = ThreadedMotoServer(ip_address="127.0.0.1", port=port)
+    g_server.start()
+    endpoint = f"http://127.0.0.1:{port}"
+    os.environ["AWS_ENDPOINT_URL"] = endpoint
+
+    s3 = boto3.client("s3", endpoint_url=endpoint)
+    s3.create_bucket(Bucket=g_bucket)
+    rng = np.random.default_rng(1234)
+    # sizes below a block, spanning blocks and large enough to be read in parallel parts
+    for i, size in enumerate([1, 100, 4095, 4097, 10000, 131072, 300001]):
+        name = f"files/{i}/file_{i}.bin"
+        data = rng.integers(0, 256, size, dtype=np.uint8).tobytes()
+        s3.put_object(Bucket=g_bucket, Key=name, Body=data)
+        g_files[name] = data
+
+    g_tmpdir = tempfile.TemporaryDirectory()
+    for i, shape in enumerate([(10,), (100, 3), (256, 256, 3), (1000, 100)]):
+        arr = rng.random(shape, dtype=np.float32)
+        name = f"arrays/arr_{i}.npy"
+        local_path = os.path.join(g_tmpdir.name, f"arr_{i}.npy")
+        np.save(local_path, arr)
+        s3.upload_file(local_path, g_bucket, name)
+        g_arrays[name] = arr
+
+
+def tearDownModule():
+    if g_server is not None:
+        g_server.stop()
+    if g_tmpdir is not None:
+        g_tmpdir.cleanup()
+
+
+def test_file_reader_s3():
+    names = sorted(g_files.keys())
+
+    @pipeline_def(batch_size=len(names), num_threads=3, device_id=None)
+    def pipe():
+        data, _ = fn.readers.file(
+            files=[f"s3://{g_bucket}/{name}" for name in names], shuffle_after_epoch=False
+        )
+        return data
+
+    p = pipe()
+    p.build()
+    for _ in range(2):
+        (out,) = p.run()
+        for i, name in enumerate(names):
+            assert np.array(out[i]).tobytes() == g_files[name], name
+
+
+def test_numpy_reader_s3():
+    names = sorted(g_arrays.keys())
+
+    @pipeline_def(batch_size=1, num_threads=3, device_id=None)
+    def pipe():
+        return fn.readers.numpy(
+            files=[f"s3://{g_bucket}/{name}" for name in names], shuffle_after_epoch=False
+        )
+
+    p = pipe()
+    p.build()
+    for name in names:
+        (out,) = p.run()
+        np.testing.assert_array_equal(np.array(out[0]), g_arrays[name])
@@ -928,3 +928,80 @@ def test_mxnet_shuffle_after_epoch_different_seeds_first_epoch():
         epoch1_b = _collect_mxnet_epoch(pipe2)
         assert epoch1_a != epoch1_b, "Different seeds must differ in the first epoch"
         assert sorted(epoch1_a) == sorted(epoch1_b), "Both seeds must cover all samples"
+
+
+# ────────────────────────────────────────────────────────────────────────────
+#  global_shuffle tests
+# ────────────────────────────────────────────────────────────────────────────
+
+
+def _global_shuffle_reader(reader, **kwargs):
+    if reader == "file":
+        return fn.readers.file(
+            file_root=os.path.join(get_dali_extra_path(), "db", "single", "jpeg"), **kwargs
+        )[0]
+    if reader == "tfrecord":
+        return fn.readers.tfrecord(
+            path=_tfrecord,
+            index_path=_tfrecord_idx,
+            features={"image/encoded": tfrec.FixedLenFeature((), tfrec.string, "")},
+            **kwargs,
+        )["image/encoded"]
+    if reader == "mxnet":
+        return fn.readers.mxnet(path=_mxnet_rec, index_path=_mxnet_idx, **kwargs)[0]
+    assert reader == "webdataset"
+    return fn.readers.webdataset(paths=_wds_tars[:1], ext=["jpg"], **kwargs)
+
+
+def _global_shuffle_pipe(reader, num_shards=1, shard_id=0, **kwargs):
+    from nvidia.dali import pipeline_def
+
+    @pipeline_def(batch_size=1, num_threads=1, device_id=None, prefetch_queue_depth=1)
+    def _pipe():
+        return _global_shuffle_reader(
+            reader, num_shards=num_shards, shard_id=shard_id, name="Reader", **kwargs
+        )
+
+    return _pipe()
+
+
+def _collect_source_info_epoch(pipe):
+    """Run one full epoch of the pipeline's shard and return the source info of the samples."""
+    meta = pipe.reader_meta("Reader")
+    size, num_shards, shard_id = meta["epoch_size"], meta["number_of_shards"], meta["shard_id"]
+    shard_size = size * (shard_id + 1) // num_shards - size * shard_id // num_shards
+    return [pipe.run()[0][0].source_info() for _ in range(shard_size)]
+
+
+def check_global_shuffle_coverage(reader, num_shards):
+    pipes = [
+        _global_shuffle_pipe(reader, num_shards, s, global_shuffle=True)
+        for s in range(num_shards)
+    ]
+    ref = _collect_source_info_epoch(_global_shuffle_pipe(reader))
+    epochs = []
+    for _ in range(2):
+        epoch = [_collect_source_info_epoch(p) for p in pipes]
+        merged = [info for shard in epoch for info in shard]
+        assert sorted(merged) == sorted(ref), "Each epoch must cover the dataset exactly once"
+        assert merged != ref, "global_shuffle must change the order of the samples"
+        epochs.append(epoch)
+    assert epochs[0] != epochs[1], "Each epoch should have a different order"
+    # the shards keep their sizes, but not the samples
+    for shard in range(num_shards):
+        assert len(epochs[0][shard]) == len(epochs[1][shard])
+        assert sorted(epochs[0][shard]) != sorted(epochs[1][shard])
+
+
+def test_global_shuffle_coverage():
+    for reader in ["file", "tfrecord", "mxnet", "webdataset"]:
+        yield check_global_shuffle_coverage, reader, 2
+
+
+def test_global_shuffle_seed():
+    def collect(seed):
+        pipe = _global_shuffle_pipe("file", global_shuffle=True, shuffle_after_epoch_seed=seed)
+        return _collect_source_info_epoch(pipe)
+
+    assert collect(123) == collect(123)
+    assert collect(123) != collect(321)
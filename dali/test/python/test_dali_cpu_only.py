@@ -1464,6 +1464,36 @@ def test_warp_perspective():
     check_single_input(fn.experimental.warp_perspective, matrix=np.eye(3))
 
 
+def test_median_blur_cpu():
+    check_single_input(fn.experimental.median_blur, window_size=5)
+
+
+def test_dilate_cpu():
+    check_single_input(fn.experimental.dilate, mask_size=[5, 3])
+
+
+def test_erode_cpu():
+    check_single_input(fn.experimental.erode, mask_size=[5, 3])
+
+
+def test_remap_cpu():
+    def get_maps():
+        h, w = test_data_shape[:2]
+        mapx = np.random.uniform(0, w, size=(h, w)).astype(np.float32)
+        mapy = np.random.uniform(0, h, size=(h, w)).astype(np.float32)
+        return [mapx] * batch_size, [mapy] * batch_size
+
+    pipe = Pipeline(batch_size=batch_size, num_threads=4, device_id=None)
+    with pipe:
+        data = fn.external_source(source=get_data, layout="HWC")
+        mapx, mapy = fn.external_source(source=get_maps, num_outputs=2)
+        processed = fn.experimental.remap(data, mapx, mapy)
+    pipe.set_outputs(processed)
+    pipe.build()
+    for _ in range(3):
+        pipe.run()
+
+
 tested_methods = [
     "_conditional.merge",
     "_conditional.split",
@@ -1645,6 +1675,10 @@ tested_methods = [
     "numba.fn.experimental.numba_function",
     "dl_tensor_python_function",
     "experimental.warp_perspective",
+    "experimental.median_blur",
+    "experimental.dilate",
+    "experimental.erode",
+    "experimental.remap",
     "audio_resample",
     "experimental.decoders.hidden.video",
     "experimental.decoders.video",
@@ -1677,11 +1711,7 @@ excluded_methods = [
     "filter",  # not supported for CPU
     "decoders.inflate",  # not supported for CPU
     "experimental.inflate",  # not supported for CPU
-    "experimental.remap",  # operator is GPU-only
     "experimental.readers.fits",  # lacking test files in DALI_EXTRA
-    "experimental.median_blur",  # not supported for CPU
-    "experimental.dilate",  # not supported for CPU
-    "experimental.erode",  # not supported for CPU
     "experimental.resize",  # not supported for CPU
     "plugin.video.decoder",  # not supported for CPU
 ]
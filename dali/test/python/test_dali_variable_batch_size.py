@@ -387,9 +387,9 @@ ops_image_custom_args = [
         fn.multi_paste,
         {"in_ids": np.zeros([31], dtype=np.int32), "output_size": [300, 300, 3]},
     ),
-    (fn.experimental.median_blur, {"devices": ["gpu"]}),
-    (fn.experimental.dilate, {"devices": ["gpu"]}),
-    (fn.experimental.erode, {"devices": ["gpu"]}),
+    (fn.experimental.median_blur, {"devices": ["cpu", "gpu"]}),
+    (fn.experimental.dilate, {"devices": ["cpu", "gpu"]}),
+    (fn.experimental.erode, {"devices": ["cpu", "gpu"]}),
     (
         fn.experimental.warp_perspective,
         {"matrix": np.eye(3), "devices": ["gpu", "cpu"]},
@@ -869,7 +869,7 @@ def test_remap():
         return input, mapx, mapy
 
     input_data = [get_data(random.randint(5, 31)) for _ in range(13)]
-    check_pipeline(input_data, pipeline_fn=pipe, devices=["gpu"])
+    check_pipeline(input_data, pipeline_fn=pipe, devices=["cpu", "gpu"])
 
 
 def test_random_bbox_crop_op():
@@ -16,6 +16,7 @@
 #define DALI_UTIL_FILE_H_
 
 #include <cstdio>
+#include <functional>
 #include <streambuf>
 #include <memory>
 #include <string>
@@ -91,6 +92,10 @@ class DLL_PUBLIC FileStream : public InputStream {
                                           Options opts = {false, false, false},
                                           std::optional<size_t> size = std::nullopt);
 
+  /** A function with the signature of `Open`, e.g. to inject a custom stream in the readers */
+  using OpenFunc = std::function<std::unique_ptr<FileStream>(
+      const std::string &uri, Options opts, std::optional<size_t> size)>;
+
   virtual void Close() = 0;
   virtual bool CanMemoryMap() { return false; }
   virtual shared_ptr<void> Get(size_t n_bytes) {
@@ -0,0 +1,296 @@
+// Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dali/util/range_reader.h"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <thread>
+#include <utility>
+#include "dali/core/error_handling.h"
+#include "dali/core/format.h"
+
+namespace dali {
+
+namespace {
+
+template <typename T>
+void ReadEnv(const char *name, T &value) {
+  if (const char *env = std::getenv(name)) {
+    auto parsed = std::strtoll(env, nullptr, 10);
+    DALI_ENFORCE(parsed >= 0, make_string("Invalid value of ", name, ": ", env));
+    value = static_cast<T>(parsed);
+  }
+}
+
+}  // namespace
+
+BlockCache::BlockCache(size_t block_size, int max_blocks)
+    : block_size_(block_size), max_blocks_(max_blocks) {
+  DALI_ENFORCE(block_size > 0, "The block size must be positive.");
+  DALI_ENFORCE(max_blocks > 0, "The block cache must hold at least one block.");
+}
+
+std::string BlockCache::Key(const std::string &object, int64_t block) {
+  return make_string(object, '#', block);
+}
+
+BlockCache::BlockData BlockCache::Acquire(const std::string &object, int64_t block) {
+  auto key = Key(object, block);
+  std::unique_lock<std::mutex> lock(mtx_);
+  for (;;) {
+    auto it = block_index_.find(key);
+    if (it != block_index_.end()) {
+      blocks_.splice(blocks_.begin(), blocks_, it->second);
+      return it->second->data;
+    }
+    if (pending_.insert(key).second)
+      return nullptr;  // the caller fetches the block
+    fetched_cv_.wait(lock);
+  }
+}
+
+void BlockCache::Put(const std::string &object, int64_t block, BlockData data) {
+  auto key = Key(object, block);
+  {
+    std::lock_guard<std::mutex> g(mtx_);
+    pending_.erase(key);
+    if (!block_index_.count(key)) {
+      // The evicted blocks may still be used by the readers which acquired them
+      while (static_cast<int>(blocks_.size()) >= max_blocks_) {
+        block_index_.erase(blocks_.back().key);
+        blocks_.pop_back();
+      }
+      blocks_.push_front({key, std::move(data)});
+      block_index_.emplace(std::move(key), blocks_.begin());
+    }
+  }
+  fetched_cv_.notify_all();
+}
+
+void BlockCache::Abandon(const std::string &object, int64_t block) {
+  {
+    std::lock_guard<std::mutex> g(mtx_);
+    pending_.erase(Key(object, block));
+  }
+  fetched_cv_.notify_all();
+}
+
+bool BlockCache::IsSequential(const std::string &object, size_t offset, size_t n) {
+  std::lock_guard<std::mutex> g(mtx_);
+  // A read which starts close to where the previous one ended - given the slack for small
+  // gaps (e.g. headers) and for the reads issued concurrently, slightly out of order.
+  size_t slack = std::min(n, block_size_);
+  auto it = last_read_end_.find(object);
+  bool sequential = it != last_read_end_.end() &&
+                    offset + slack >= it->second && offset <= it->second + slack;
+  if (it == last_read_end_.end()) {
+    // Forget the old objects - one-shot reads of many objects are common
+    if (last_read_end_.size() >= kMaxTrackedObjects)
+      last_read_end_.clear();
+    last_read_end_.emplace(object, offset + n);
+  } else {
+    it->second = offset + n;
+  }
+  return sequential;
+}
+
+int64_t BlockCache::NumBlocks() const {
+  std::lock_guard<std::mutex> g(mtx_);
+  return blocks_.size();
+}
+
+RangeReader::Options RangeReader::Options::FromEnv() {
+  Options opts;
+  opts.detect_sequential = true;
+  ReadEnv("DALI_S3_BLOCK_SIZE", opts.block_size);
+  ReadEnv("DALI_S3_CACHE_BLOCKS", opts.max_cached_blocks);
+  ReadEnv("DALI_S3_DETECT_SEQUENTIAL", opts.detect_sequential);
+  ReadEnv("DALI_S3_PART_SIZE", opts.part_size);
+  ReadEnv("DALI_S3_MAX_PARALLEL_PARTS", opts.max_parallel_parts);
+  return opts;
+}
+
+RangeReader::RangeReader(FetchFunc fetch, size_t object_size, const Options &opts,
+                         std::shared_ptr<BlockCache> cache, std::string object)
+    : fetch_(std::move(fetch)), object_size_(object_size), opts_(opts),
+      cache_(std::move(cache)), object_(std::move(object)) {
+  if (cache_)
+    opts_.block_size = cache_->BlockSize();
+  else if (opts_.CacheEnabled())
+    cache_ = std::make_shared<BlockCache>(opts_.block_size, opts_.max_cached_blocks);
+  else
+    opts_.block_size = 0;
+  if (opts_.part_size == 0)
+    opts_.max_parallel_parts = 1;
+}
+
+size_t RangeReader::Read(void *buf, size_t n, size_t offset) {
+  if (offset >= object_size_)
+    return 0;
+  n = std::min(n, object_size_ - offset);
+  if (n == 0)
+    return 0;
+  auto *out = static_cast<uint8_t *>(buf);
+
+  if (opts_.max_parallel_parts > 1 && n >= 2 * opts_.part_size)
+    return ReadParallel(out, n, offset);
+
+  // Reads larger than a block are unlikely to be followed by reads of adjacent data
+  // (e.g. whole files) - they go directly to the destination.
+  if (cache_ && n <= opts_.block_size) {
+    if (!opts_.detect_sequential || cache_->IsSequential(object_, offset, n))
+      return ReadCached(out, n, offset);
+  }
+  return Fetch(out, n, offset);
+}
+
+size_t RangeReader::Fetch(void *buf, size_t n, size_t offset) {
+  num_requests_++;
+  return fetch_(buf, n, offset);
+}
+
+void RangeReader::FetchBlocks(int64_t first, int64_t last,
+                              std::vector<BlockCache::BlockData> &out) {
+  int64_t b = first;
+  try {
+    size_t start = first * opts_.block_size;
+    size_t end = std::min<size_t>(last * opts_.block_size, object_size_);
+    std::vector<uint8_t> staging(end - start);
+    size_t bytes_read = Fetch(staging.data(), end - start, start);
+    for (; b < last; b++) {
+      size_t block_start = (b - first) * opts_.block_size;
+      if (block_start >= bytes_read)
+        break;
+      size_t block_end = std::min(block_start + opts_.block_size, bytes_read);
+      auto data = std::make_shared<const std::vector<uint8_t>>(
+          staging.begin() + block_start, staging.begin() + block_end);
+      cache_->Put(object_, b, data);
+      out[b - first] = std::move(data);
+    }
+  } catch (...) {
+    for (; b < last; b++)
+      cache_->Abandon(object_, b);
+    throw;
+  }
+  // the object ended prematurely
+  for (; b < last; b++)
+    cache_->Abandon(object_, b);
+}
+
+size_t RangeReader::ReadCached(uint8_t *buf, size_t n, size_t offset) {
+  int64_t first = offset / opts_.block_size;
+  int64_t last = (offset + n - 1) / opts_.block_size + 1;
+
+  // Acquire all the blocks first - the ones already cached are held, so they can't be evicted
+  // while the missing ones are fetched. Then, fetch each contiguous run of missing blocks with
+  // a single request.
+  std::vector<BlockCache::BlockData> blocks(last - first);
+  std::vector<bool> missing(last - first);
+  int64_t b = first;
+  try {
+    for (; b < last; b++) {
+      blocks[b - first] = cache_->Acquire(object_, b);
+      missing[b - first] = blocks[b - first] == nullptr;
+    }
+  } catch (...) {
+    for (int64_t i = first; i < b; i++) {
+      if (missing[i - first])
+        cache_->Abandon(object_, i);
+    }
+    throw;
+  }
+
+  for (b = first; b < last;) {
+    if (!missing[b - first]) {
+      b++;
+      continue;
+    }
+    int64_t run_end = b + 1;
+    while (run_end < last && missing[run_end - first])
+      run_end++;
+    std::vector<BlockCache::BlockData> run(run_end - b);
+    try {
+      FetchBlocks(b, run_end, run);
+    } catch (...) {
+      for (int64_t i = run_end; i < last; i++) {
+        if (missing[i - first])
+          cache_->Abandon(object_, i);
+      }
+      throw;
+    }
+    for (int64_t i = b; i < run_end; i++)
+      blocks[i - first] = std::move(run[i - b]);
+    b = run_end;
+  }
+
+  size_t copied = 0;
+  for (b = first; b < last; b++) {
+    const auto &data = blocks[b - first];
+    if (!data)
+      break;  // the object ended prematurely
+    size_t block_offset = b * opts_.block_size;
+    size_t from = offset + copied - block_offset;
+    if (from >= data->size())
+      break;
+    size_t len = std::min(data->size() - from, n - copied);
+    std::memcpy(buf + copied, data->data() + from, len);
+    copied += len;
+    if (data->size() < opts_.block_size)
+      break;
+  }
+  return copied;
+}
+
+size_t RangeReader::ReadParallel(uint8_t *buf, size_t n, size_t offset) {
+  int64_t num_parts = (n + opts_.part_size - 1) / opts_.part_size;
+  int num_threads = std::min<int64_t>(num_parts, opts_.max_parallel_parts);
+  std::vector<size_t> part_read(num_parts, 0);
+  std::vector<std::exception_ptr> errors(num_threads);
+  num_requests_ += num_parts;
+
+  auto worker = [&](int tid) {
+    try {
+      for (int64_t p = tid; p < num_parts; p += num_threads) {
+        size_t part_offset = p * opts_.part_size;
+        size_t part_size = std::min(opts_.part_size, n - part_offset);
+        part_read[p] = fetch_(buf + part_offset, part_size, offset + part_offset);
+      }
+    } catch (...) {
+      errors[tid] = std::current_exception();
+    }
+  };
+  std::vector<std::thread> threads;
+  threads.reserve(num_threads - 1);
+  for (int t = 1; t < num_threads; t++)
+    threads.emplace_back(worker, t);
+  worker(0);
+  for (auto &t : threads)
+    t.join();
+  for (auto &err : errors) {
+    if (err)
+      std::rethrow_exception(err);
+  }
+
+  size_t total = 0;
+  for (int64_t p = 0; p < num_parts; p++) {
+    total += part_read[p];
+    if (part_read[p] < std::min(opts_.part_size, n - p * opts_.part_size))
+      break;
+  }
+  return total;
+}
+
+}  // namespace dali
@@ -0,0 +1,192 @@
+// Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DALI_UTIL_RANGE_READER_H_
+#define DALI_UTIL_RANGE_READER_H_
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include "dali/core/api_helper.h"
+
+namespace dali {
+
+/**
+ * @brief A thread-safe LRU cache of fixed-size, block-aligned chunks of remote objects.
+ *
+ * The cache can be shared by all the readers of an object (and of many objects), so that
+ * the readers which open a new stream for every record still benefit from the blocks fetched
+ * when reading the previous records. A block which is being fetched by one reader is waited for
+ * by the others instead of being fetched again.
+ */
+class DLL_PUBLIC BlockCache {
+ public:
+  /** The contents of a block; may be shorter than the block size at the end of the object. */
+  using BlockData = std::shared_ptr<const std::vector<uint8_t>>;
+
+  BlockCache(size_t block_size, int max_blocks);
+
+  size_t BlockSize() const {
+    return block_size_;
+  }
+
+  /**
+   * @brief Returns a cached block or, if it's missing, nullptr - the caller is then responsible
+   *        for fetching the block and passing it to `Put` (or calling `Abandon` on failure).
+   *
+   * If the block is being fetched by another caller, waits for it.
+   * The blocks needed for a single read must be acquired in ascending order.
+   */
+  BlockData Acquire(const std::string &object, int64_t block);
+
+  /** Stores a block acquired with `Acquire`. */
+  void Put(const std::string &object, int64_t block, BlockData data);
+
+  /** Gives up fetching a block acquired with `Acquire` - another caller can try again. */
+  void Abandon(const std::string &object, int64_t block);
+
+  /**
+   * @brief Records a read of `n` bytes at `offset`; returns true if it continues the previous
+   *        read of the object, i.e. starts within `n` bytes from where that read ended.
+   */
+  bool IsSequential(const std::string &object, size_t offset, size_t n);
+
+  int64_t NumBlocks() const;
+
+ private:
+  static std::string Key(const std::string &object, int64_t block);
+
+  struct Block {
+    std::string key;
+    BlockData data;
+  };
+  using BlockList = std::list<Block>;
+
+  /** The number of objects whose last read is tracked by IsSequential */
+  static constexpr size_t kMaxTrackedObjects = 4096;
+
+  const size_t block_size_;
+  const int max_blocks_;
+  mutable std::mutex mtx_;
+  std::condition_variable fetched_cv_;
+  BlockList blocks_;  // most recently used first
+  std::unordered_map<std::string, BlockList::iterator> block_index_;
+  std::unordered_set<std::string> pending_;
+  std::unordered_map<std::string, size_t> last_read_end_;
+};
+
+/**
+ * @brief Serves byte-range reads of a remote object, minimizing the number of requests.
+ *
+ * Every request to an object store (e.g. an S3 range GET) has a considerable latency,
+ * regardless of its size. Readers which touch many small records in a large object
+ * would pay that latency for every record. This class sits between the stream and the
+ * actual request (`fetch`) and:
+ *  - serves reads no larger than a block from a BlockCache; the blocks missing from the cache
+ *    are fetched with a single request, so a series of small adjacent reads costs one request
+ *    per block - also when the reads are issued by different readers sharing the cache,
+ *  - optionally (`detect_sequential`) reads isolated small ranges directly, without rounding
+ *    them up to whole blocks, which would only inflate the traffic for random accesses,
+ *  - splits large reads into parts which are requested in parallel and go directly to
+ *    the destination buffer, bypassing the cache.
+ *
+ * The object is assumed to be immutable for the lifetime of the cache.
+ * The reader itself is not thread-safe, but `fetch` must be, as it's called from multiple
+ * threads when reading the parts of a large read.
+ */
+class DLL_PUBLIC RangeReader {
+ public:
+  /**
+   * @brief Reads up to `n` bytes at `offset` into `buf`; returns the number of bytes read.
+   */
+  using FetchFunc = std::function<size_t(void *buf, size_t n, size_t offset)>;
+
+  struct Options {
+    /** Size of a cached block; 0 disables the cache. */
+    size_t block_size = 256 << 10;
+    /** Maximum number of blocks kept in the cache; values below 2 disable the cache. */
+    int max_cached_blocks = 64;
+    /**
+     * If true, a small read goes through the cache only if it continues a recent read of
+     * the object; otherwise, only the requested range is fetched.
+     */
+    bool detect_sequential = false;
+    /** Size of a part of a large read. Reads of at least 2 parts are done in parallel. */
+    size_t part_size = 8 << 20;
+    /** Maximum number of parts fetched concurrently; 1 disables parallel reads. */
+    int max_parallel_parts = 8;
+
+    bool CacheEnabled() const {
+      return block_size > 0 && max_cached_blocks >= 2;
+    }
+
+    /**
+     * @brief Default options, adjusted with the environment variables
+     *        DALI_S3_BLOCK_SIZE, DALI_S3_CACHE_BLOCKS, DALI_S3_DETECT_SEQUENTIAL,
+     *        DALI_S3_PART_SIZE and DALI_S3_MAX_PARALLEL_PARTS.
+     *
+     * Unlike in the default-constructed options, `detect_sequential` is enabled by default.
+     */
+    static Options FromEnv();
+  };
+
+  /**
+   * @param cache   The block cache, possibly shared with other readers; if null and the cache
+   *                is enabled in `opts`, the reader creates a private one.
+   * @param object  The identifier of the object in the cache (e.g. its URI).
+   */
+  RangeReader(FetchFunc fetch, size_t object_size, const Options &opts,
+              std::shared_ptr<BlockCache> cache = nullptr, std::string object = {});
+
+  /**
+   * @brief Reads up to `n` bytes at `offset`, clamped to the object size.
+   */
+  size_t Read(void *buf, size_t n, size_t offset);
+
+  /** The number of calls to `fetch` issued so far. */
+  int64_t NumRequests() const {
+    return num_requests_;
+  }
+
+  /** The number of blocks in the cache (of all the objects which share it). */
+  int64_t NumCachedBlocks() const {
+    return cache_ ? cache_->NumBlocks() : 0;
+  }
+
+ private:
+  size_t Fetch(void *buf, size_t n, size_t offset);
+  size_t ReadCached(uint8_t *buf, size_t n, size_t offset);
+  size_t ReadParallel(uint8_t *buf, size_t n, size_t offset);
+  /** Fetches blocks [first, last) with a single request and puts them in the cache. */
+  void FetchBlocks(int64_t first, int64_t last, std::vector<BlockCache::BlockData> &out);
+
+  FetchFunc fetch_;
+  size_t object_size_;
+  Options opts_;
+  std::shared_ptr<BlockCache> cache_;
+  std::string object_;
+  int64_t num_requests_ = 0;
+};
+
+}  // namespace dali
+
+#endif  // DALI_UTIL_RANGE_READER_H_
@@ -0,0 +1,273 @@
+// Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include "dali/util/range_reader.h"
+
+namespace dali {
+
+namespace {
+
+/**
+ * @brief Simulates an object in a remote store, counting the requests
+ */
+class FakeObject {
+ public:
+  explicit FakeObject(size_t size, std::chrono::microseconds latency = {})
+      : latency_(latency) {
+    data_.resize(size);
+    for (size_t i = 0; i < size; i++)
+      data_[i] = static_cast<uint8_t>(i * 13 + i / 251);
+  }
+
+  RangeReader::FetchFunc Fetcher() {
+    return [this](void *buf, size_t n, size_t offset) -> size_t {
+      requests_++;
+      int cur = ++in_flight_;
+      int prev_max = max_in_flight_;
+      while (cur > prev_max && !max_in_flight_.compare_exchange_weak(prev_max, cur)) {}
+      if (latency_.count())
+        std::this_thread::sleep_for(latency_);
+      --in_flight_;
+      if (offset >= data_.size())
+        return 0;
+      n = std::min(n, data_.size() - offset);
+      std::memcpy(buf, data_.data() + offset, n);
+      return n;
+    };
+  }
+
+  void Check(const std::vector<uint8_t> &out, size_t n, size_t offset) const {
+    for (size_t i = 0; i < n; i++)
+      ASSERT_EQ(out[i], data_[offset + i]) << " at offset " << offset + i;
+  }
+
+  size_t size() const { return data_.size(); }
+
+  int requests() const { return requests_; }
+
+  int max_in_flight() const { return max_in_flight_; }
+
+ private:
+  std::vector<uint8_t> data_;
+  std::chrono::microseconds latency_;
+  std::atomic_int requests_{0}, in_flight_{0}, max_in_flight_{0};
+};
+
+RangeReader::Options TestOptions() {
+  RangeReader::Options opts;
+  opts.block_size = 4096;
+  opts.max_cached_blocks = 4;
+  opts.part_size = 16384;
+  opts.max_parallel_parts = 4;
+  return opts;
+}
+
+}  // namespace
+
+TEST(RangeReaderTest, SmallSequentialReads) {
+  FakeObject obj(100000);
+  RangeReader reader(obj.Fetcher(), obj.size(), TestOptions());
+  const size_t kRecord = 100;
+  std::vector<uint8_t> out(kRecord);
+  size_t offset = 0;
+  int num_reads = 0;
+  while (offset < obj.size()) {
+    size_t n = reader.Read(out.data(), kRecord, offset);
+    ASSERT_EQ(n, std::min(kRecord, obj.size() - offset));
+    obj.Check(out, n, offset);
+    offset += n;
+    num_reads++;
+  }
+  EXPECT_EQ(reader.Read(out.data(), kRecord, offset), 0u);
+  // one request per block instead of one per read
+  int num_blocks = (obj.size() + 4095) / 4096;
+  EXPECT_EQ(obj.requests(), num_blocks);
+  EXPECT_EQ(reader.NumRequests(), num_blocks);
+  EXPECT_LT(obj.requests(), num_reads / 10);
+}
+
+TEST(RangeReaderTest, CoalescesMissingBlocks) {
+  FakeObject obj(64 << 10);
+  RangeReader reader(obj.Fetcher(), obj.size(), TestOptions());
+  std::vector<uint8_t> out(6 * 4096);
+
+  // a read spanning 2 blocks - one request
+  ASSERT_EQ(reader.Read(out.data(), 4000, 100), 4000u);
+  ASSERT_EQ(reader.Read(out.data(), 4000, 3000), 4000u);
+  obj.Check(out, 4000, 3000);
+  EXPECT_EQ(obj.requests(), 1);
+  EXPECT_EQ(reader.NumCachedBlocks(), 2);
+
+  // block 1 is cached, block 2 is fetched
+  ASSERT_EQ(reader.Read(out.data(), 4096, 4096 + 2000), 4096u);
+  obj.Check(out, 4096, 4096 + 2000);
+  EXPECT_EQ(obj.requests(), 2);
+  EXPECT_EQ(reader.NumCachedBlocks(), 3);
+
+  // blocks 4 and 5 missing
+  ASSERT_EQ(reader.Read(out.data(), 4096, 4 * 4096 + 5), 4096u);
+  obj.Check(out, 4096, 4 * 4096 + 5);
+  EXPECT_EQ(obj.requests(), 3);
+  EXPECT_EQ(reader.NumCachedBlocks(), 4);
+
+  // a read larger than a block goes directly to the object
+  ASSERT_EQ(reader.Read(out.data(), out.size(), 8 * 4096), out.size());
+  obj.Check(out, out.size(), 8 * 4096);
+  EXPECT_EQ(obj.requests(), 4);
+  EXPECT_EQ(reader.NumCachedBlocks(), 4);
+}
+
+TEST(RangeReaderTest, LRUEviction) {
+  FakeObject obj(64 << 10);
+  RangeReader reader(obj.Fetcher(), obj.size(), TestOptions());
+  std::vector<uint8_t> out(10);
+  for (int b = 0; b < 4; b++)
+    reader.Read(out.data(), out.size(), b * 4096);
+  EXPECT_EQ(obj.requests(), 4);
+  reader.Read(out.data(), out.size(), 0);  // block 0 is now the most recently used
+  reader.Read(out.data(), out.size(), 4 * 4096);  // evicts block 1
+  EXPECT_EQ(obj.requests(), 5);
+  reader.Read(out.data(), out.size(), 0);
+  EXPECT_EQ(obj.requests(), 5);
+  reader.Read(out.data(), out.size(), 4096);
+  EXPECT_EQ(obj.requests(), 6);
+  obj.Check(out, out.size(), 4096);
+}
+
+TEST(RangeReaderTest, ParallelParts) {
+  FakeObject obj(1 << 20, std::chrono::microseconds(2000));
+  RangeReader reader(obj.Fetcher(), obj.size(), TestOptions());
+  std::vector<uint8_t> out(10 * 16384 + 123);
+  size_t offset = 12345;
+  ASSERT_EQ(reader.Read(out.data(), out.size(), offset), out.size());
+  obj.Check(out, out.size(), offset);
+  EXPECT_EQ(obj.requests(), 11);
+  EXPECT_GT(obj.max_in_flight(), 1);
+  EXPECT_LE(obj.max_in_flight(), 4);
+  EXPECT_EQ(reader.NumCachedBlocks(), 0);
+
+  // clamped at the end of the object
+  offset = obj.size() - 3 * 16384;
+  ASSERT_EQ(reader.Read(out.data(), out.size(), offset), 3 * 16384u);
+  obj.Check(out, 3 * 16384, offset);
+}
+
+TEST(RangeReaderTest, CacheDisabled) {
+  FakeObject obj(10000);
+  auto opts = TestOptions();
+  opts.block_size = 0;
+  RangeReader reader(obj.Fetcher(), obj.size(), opts);
+  std::vector<uint8_t> out(100);
+  for (int i = 0; i < 10; i++) {
+    ASSERT_EQ(reader.Read(out.data(), out.size(), i * 100), out.size());
+    obj.Check(out, out.size(), i * 100);
+  }
+  EXPECT_EQ(obj.requests(), 10);
+}
+
+TEST(RangeReaderTest, ErrorPropagation) {
+  auto fetch = [](void *, size_t, size_t offset) -> size_t {
+    if (offset >= 32768)
+      throw std::runtime_error("Access denied");
+    return 0;
+  };
+  RangeReader reader(fetch, 1 << 20, TestOptions());
+  std::vector<uint8_t> out(8 * 16384);
+  EXPECT_THROW(reader.Read(out.data(), out.size(), 0), std::runtime_error);
+  EXPECT_THROW(reader.Read(out.data(), 100, 65536), std::runtime_error);
+  EXPECT_EQ(reader.NumCachedBlocks(), 0);
+}
+
+TEST(RangeReaderTest, SharedCache) {
+  FakeObject obj(64 << 10);
+  auto opts = TestOptions();
+  auto cache = std::make_shared<BlockCache>(opts.block_size, opts.max_cached_blocks);
+  const size_t kRecord = 1000;
+  std::vector<uint8_t> out(kRecord);
+  // A new reader for every record, like the loaders with deferred reads do
+  for (size_t offset = 0; offset + kRecord <= 4 * 4096; offset += kRecord) {
+    RangeReader reader(obj.Fetcher(), obj.size(), opts, cache, "object");
+    ASSERT_EQ(reader.Read(out.data(), kRecord, offset), kRecord);
+    obj.Check(out, kRecord, offset);
+  }
+  // one request per block, not per record
+  EXPECT_EQ(obj.requests(), 4);
+  EXPECT_EQ(cache->NumBlocks(), 4);
+
+  // the blocks of another object are not mixed up
+  FakeObject obj2(64 << 10);
+  RangeReader reader2(obj2.Fetcher(), obj2.size(), opts, cache, "object2");
+  ASSERT_EQ(reader2.Read(out.data(), kRecord, 0), kRecord);
+  EXPECT_EQ(obj2.requests(), 1);
+}
+
+TEST(RangeReaderTest, SharedCacheConcurrentReaders) {
+  FakeObject obj(64 << 10, std::chrono::microseconds(2000));
+  auto opts = TestOptions();
+  auto cache = std::make_shared<BlockCache>(opts.block_size, opts.max_cached_blocks);
+  const size_t kRecord = 512;
+  const int kNumRecords = 4 * 4096 / kRecord;
+  std::vector<std::thread> threads;
+  std::vector<std::vector<uint8_t>> out(kNumRecords, std::vector<uint8_t>(kRecord));
+  for (int r = 0; r < kNumRecords; r++) {
+    threads.emplace_back([&, r]() {
+      RangeReader reader(obj.Fetcher(), obj.size(), opts, cache, "object");
+      reader.Read(out[r].data(), kRecord, r * kRecord);
+    });
+  }
+  for (auto &t : threads)
+    t.join();
+  for (int r = 0; r < kNumRecords; r++)
+    obj.Check(out[r], kRecord, r * kRecord);
+  // the readers wait for the blocks being fetched by others instead of fetching them again
+  EXPECT_EQ(obj.requests(), 4);
+}
+
+TEST(RangeReaderTest, DetectSequential) {
+  FakeObject obj(64 << 10);
+  auto opts = TestOptions();
+  opts.detect_sequential = true;
+  auto cache = std::make_shared<BlockCache>(opts.block_size, opts.max_cached_blocks);
+  std::vector<uint8_t> out(1000);
+
+  // isolated reads fetch just the requested range
+  for (size_t offset : {40000u, 10000u, 50000u}) {
+    RangeReader reader(obj.Fetcher(), obj.size(), opts, cache, "object");
+    ASSERT_EQ(reader.Read(out.data(), out.size(), offset), out.size());
+    obj.Check(out, out.size(), offset);
+  }
+  EXPECT_EQ(obj.requests(), 3);
+  EXPECT_EQ(cache->NumBlocks(), 0);
+
+  // a read following the previous one goes through the cache - and so do the next ones
+  for (size_t offset = 51000; offset < 51000 + 4 * 1000; offset += 1000) {
+    RangeReader reader(obj.Fetcher(), obj.size(), opts, cache, "object");
+    ASSERT_EQ(reader.Read(out.data(), out.size(), offset), out.size());
+    obj.Check(out, out.size(), offset);
+  }
+  // blocks 12 and 13, fetched when first needed
+  EXPECT_EQ(obj.requests(), 5);
+  EXPECT_EQ(cache->NumBlocks(), 2);
+}
+
+}  // namespace dali
@@ -0,0 +1,75 @@
+// Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dali/util/remote_file.h"
+#include <cassert>
+#include <stdexcept>
+#include <utility>
+
+namespace dali {
+
+RemoteFileStream::RemoteFileStream(const std::string &uri, RangeReader::FetchFunc fetch,
+                                   size_t size, const RangeReader::Options &opts,
+                                   std::shared_ptr<BlockCache> cache)
+    : FileStream(uri) {
+  Init(std::move(fetch), size, opts, std::move(cache));
+}
+
+void RemoteFileStream::Init(RangeReader::FetchFunc fetch, size_t size,
+                            const RangeReader::Options &opts, std::shared_ptr<BlockCache> cache) {
+  size_ = size;
+  reader_ = std::make_unique<RangeReader>(std::move(fetch), size, opts, std::move(cache), path_);
+}
+
+void RemoteFileStream::Close() {
+  // nothing to do here (there's no file open)
+}
+
+void RemoteFileStream::SeekRead(ptrdiff_t pos, int whence) {
+  auto new_pos = pos_;
+  switch (whence) {
+    case SEEK_SET:
+      new_pos = pos;
+      break;
+    case SEEK_CUR:
+      new_pos += pos;
+      break;
+    case SEEK_END:
+      new_pos = size_ + pos;
+      break;
+    default:
+      assert(false);
+  }
+  if (new_pos < 0 || new_pos > static_cast<ptrdiff_t>(size_))
+    throw std::out_of_range("The requested offset points outside of the file.");
+  pos_ = new_pos;
+}
+
+ptrdiff_t RemoteFileStream::TellRead() const {
+  return pos_;
+}
+
+size_t RemoteFileStream::Size() const {
+  return size_;
+}
+
+size_t RemoteFileStream::Read(void *buf, size_t n) {
+  if (n == 0)
+    return 0;
+  size_t bytes_read = reader_->Read(buf, n, pos_);
+  pos_ += bytes_read;
+  return bytes_read;
+}
+
+}  // namespace dali
@@ -0,0 +1,66 @@
+// Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DALI_UTIL_REMOTE_FILE_H_
+#define DALI_UTIL_REMOTE_FILE_H_
+
+#include <cstdio>
+#include <memory>
+#include <string>
+#include "dali/core/api_helper.h"
+#include "dali/util/file.h"
+#include "dali/util/range_reader.h"
+
+namespace dali {
+
+/**
+ * @brief A stream reading an object from a remote store with byte-range requests.
+ *
+ * The reads go through a RangeReader - see there for how the requests are coalesced and split.
+ * Derived classes (e.g. S3FileStream) only provide the function which fetches a range.
+ */
+class DLL_PUBLIC RemoteFileStream : public FileStream {
+ public:
+  /**
+   * @param cache The block cache shared by the streams; see RangeReader.
+   */
+  RemoteFileStream(const std::string &uri, RangeReader::FetchFunc fetch, size_t size,
+                   const RangeReader::Options &opts, std::shared_ptr<BlockCache> cache);
+
+  void Close() override;
+  size_t Read(void *buf, size_t n) override;
+  void SeekRead(ptrdiff_t pos, int whence = SEEK_SET) override;
+  ptrdiff_t TellRead() const override;
+  size_t Size() const override;
+
+  const RangeReader &reader() const {
+    return *reader_;
+  }
+
+ protected:
+  explicit RemoteFileStream(const std::string &uri) : FileStream(uri) {}
+
+  /** Sets up the reader; for the derived classes which need to query the object size first. */
+  void Init(RangeReader::FetchFunc fetch, size_t size, const RangeReader::Options &opts,
+            std::shared_ptr<BlockCache> cache);
+
+ private:
+  ptrdiff_t pos_ = 0;
+  size_t size_ = 0;
+  std::unique_ptr<RangeReader> reader_;
+};
+
+}  // namespace dali
+
+#endif  // DALI_UTIL_REMOTE_FILE_H_
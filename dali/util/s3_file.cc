@@ -14,14 +14,27 @@
 
 #include "dali/util/s3_file.h"
 #include <fnmatch.h>
+#include <utility>
 #include "dali/core/format.h"
 #include "dali/util/s3_client_manager.h"
 #include "dali/util/uri.h"
 namespace dali {
 
+namespace {
+
+/** The block cache shared by all the S3 streams (or null, if disabled) */
+const std::shared_ptr<BlockCache> &SharedBlockCache(const RangeReader::Options &opts) {
+  static const std::shared_ptr<BlockCache> cache =
+      opts.CacheEnabled() ? std::make_shared<BlockCache>(opts.block_size, opts.max_cached_blocks)
+                          : nullptr;
+  return cache;
+}
+
+}  // namespace
+
 S3FileStream::S3FileStream(Aws::S3::S3Client* s3_client, const std::string& uri,
                            std::optional<size_t> size)
-    : FileStream(uri), s3_client_(s3_client) {
+    : RemoteFileStream(uri), s3_client_(s3_client) {
   object_location_ = s3_filesystem::parse_uri(uri);
   if (size.has_value() && size.value() > 0) {
     object_stats_.exists = true;
@@ -29,50 +42,14 @@ S3FileStream::S3FileStream(Aws::S3::S3Client* s3_client, const std::string& uri,
   } else {
     object_stats_ = s3_filesystem::get_stats(s3_client, object_location_);
   }
+  auto fetch = [client = s3_client_, location = object_location_](void* buf, size_t n,
+                                                                   size_t offset) {
+    return s3_filesystem::read_object_contents(client, location, buf, n, offset);
+  };
+  static const RangeReader::Options reader_opts = RangeReader::Options::FromEnv();
+  Init(std::move(fetch), object_stats_.size, reader_opts, SharedBlockCache(reader_opts));
 }
 
 S3FileStream::~S3FileStream() {}
 
-
-void S3FileStream::Close() {
-  // nothing to do here (there's no file open)
-}
-
-void S3FileStream::SeekRead(ptrdiff_t pos, int whence) {
-  auto new_pos = pos_;
-  switch (whence) {
-    case SEEK_SET:
-      new_pos = pos;
-      break;
-    case SEEK_CUR:
-      new_pos += pos;
-      break;
-    case SEEK_END:
-      new_pos = object_stats_.size + pos;
-      break;
-    default:
-      assert(false);
-  }
-  if (new_pos < 0 || new_pos > static_cast<ptrdiff_t>(object_stats_.size))
-    throw std::out_of_range("The requested offset points outside of the file.");
-  pos_ = new_pos;
-}
-
-ssize_t S3FileStream::TellRead() const {
-  return pos_;
-}
-
-size_t S3FileStream::Size() const {
-  return object_stats_.size;
-}
-
-size_t S3FileStream::Read(void* buf, size_t n) {
-  if (n == 0)
-    return 0;
-  size_t bytes_read =
-      s3_filesystem::read_object_contents(s3_client_, object_location_, buf, n, pos_);
-  pos_ += bytes_read;
-  return bytes_read;
-}
-
 }  // namespace dali
@@ -21,27 +21,29 @@
 #include <memory>
 #include <optional>
 #include <string>
-#include "dali/util/file.h"
+#include "dali/util/remote_file.h"
 #include "dali/util/s3_filesystem.h"
 #include "dali/util/uri.h"
 
 namespace dali {
 
-class S3FileStream : public FileStream {
+/**
+ * @brief Reads an S3 object with range GET requests.
+ *
+ * The requests go through a RangeReader: small reads are served from a block cache shared by all
+ * the S3 streams in the process (with adjacent missing blocks coalesced into a single request)
+ * and large reads are split into parts requested in parallel. See RangeReader::Options::FromEnv
+ * for the tuning knobs.
+ */
+class S3FileStream : public RemoteFileStream {
  public:
   explicit S3FileStream(Aws::S3::S3Client* s3_client, const std::string& uri,
                         std::optional<size_t> size = std::nullopt);
-  void Close() override;
-  size_t Read(void* buf, size_t n) override;
-  void SeekRead(ptrdiff_t pos, int whence = SEEK_SET) override;
-  ptrdiff_t TellRead() const override;
-  size_t Size() const override;
 
   ~S3FileStream() override;
 
  private:
   Aws::S3::S3Client* s3_client_ = nullptr;
-  ptrdiff_t pos_ = 0;
   s3_filesystem::S3ObjectLocation object_location_ = {};
   s3_filesystem::S3ObjectStats object_stats_ = {};
 };
@@ -0,0 +1,91 @@
+// Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DALI_CORE_EXEC_DEFERRED_ENGINE_H_
+#define DALI_CORE_EXEC_DEFERRED_ENGINE_H_
+
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace dali {
+
+/**
+ * @brief An ExecutionEngine which collects the work and runs it in RunAll, in reverse order,
+ *        on NumThreads() separate threads.
+ *
+ * Intended for tests: it defers the execution until RunAll and reverses the submission order,
+ * so that the code under test cannot depend on the work running immediately or in order.
+ * The thread index passed to the work items is always in range [0, NumThreads()).
+ */
+class DeferredEngine {
+ public:
+  explicit DeferredEngine(int num_threads = 4) : num_threads_(num_threads) {}
+
+  template <typename FunctionLike>
+  void AddWork(FunctionLike &&f, int64_t priority = 0) {
+    work_.emplace_back(std::forward<FunctionLike>(f));
+  }
+
+  /**
+   * @brief Runs the work collected so far and waits for it to complete.
+   *
+   * If any of the work items throws, one of the exceptions is rethrown.
+   */
+  void RunAll() {
+    std::atomic<int> next{static_cast<int>(work_.size()) - 1};
+    std::exception_ptr error;
+    std::mutex error_mtx;
+    auto thread_func = [&](int thread_idx) {
+      for (int i; (i = next--) >= 0; ) {
+        try {
+          work_[i](thread_idx);
+        } catch (...) {
+          std::lock_guard<std::mutex> g(error_mtx);
+          if (!error)
+            error = std::current_exception();
+        }
+      }
+    };
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads_; t++)
+      threads.emplace_back(thread_func, t);
+    for (auto &t : threads)
+      t.join();
+    work_.clear();
+    if (error)
+      std::rethrow_exception(error);
+  }
+
+  int NumThreads() const noexcept {
+    return num_threads_;
+  }
+
+  int NumWorkItems() const noexcept {
+    return work_.size();
+  }
+
+ private:
+  int num_threads_;
+  std::vector<std::function<void(int)>> work_;
+};
+
+}  // namespace dali
+
+#endif  // DALI_CORE_EXEC_DEFERRED_ENGINE_H_
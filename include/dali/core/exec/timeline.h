@@ -0,0 +1,225 @@
+// Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DALI_CORE_EXEC_TIMELINE_H_
+#define DALI_CORE_EXEC_TIMELINE_H_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "dali/core/api_helper.h"
+
+namespace dali {
+
+/** The kind of activity recorded in the timeline; it's exported as the event's category. */
+enum class TimelineCategory : uint8_t {
+  Executor,
+  Operator,
+  ThreadPool,
+  Reader,
+  Decoder,
+  Other,
+  Count
+};
+
+DLL_PUBLIC const char *TimelineCategoryName(TimelineCategory category);
+
+/** A single (complete) event recorded in the timeline. */
+struct TimelineEvent {
+  /** The start time, in nanoseconds, as returned by TimelineTracer::Now */
+  int64_t start = 0;
+  /** The end time, in nanoseconds, as returned by TimelineTracer::Now */
+  int64_t end = 0;
+  /** An optional argument, e.g. the iteration index; negative values are not exported */
+  int64_t arg = -1;
+  /** The name, as returned by TimelineTracer::Intern */
+  int name = 0;
+  TimelineCategory category = TimelineCategory::Other;
+};
+
+/** A low-overhead tracer of CPU-side activity, which can be exported in Chrome trace format.
+ *
+ * The events are recorded in per-thread ring buffers, without any synchronization between
+ * the threads - only the oldest events are overwritten when a buffer is full.
+ * A thread's buffer is created when the thread records its first event. The buffers of the
+ * threads which have exited are kept for export, but only the kMaxExitedThreadBuffers most
+ * recent ones.
+ * The names of the events are interned up-front, so recording an event doesn't allocate.
+ *
+ * The tracer can be left enabled with sampling: only every `sampling_period`-th iteration
+ * (as announced by the executor with BeginIteration) is recorded. The events which are
+ * associated with an iteration (e.g. operators) are sampled exactly; the remaining ones
+ * (thread pool jobs, reader prefetch, etc.) are recorded while the most recently launched
+ * iteration is sampled.
+ *
+ * The tracer is process-wide - it records the activity of all pipelines.
+ */
+class DLL_PUBLIC TimelineTracer {
+ public:
+  /** The default number of events stored per thread */
+  static constexpr int kDefaultCapacity = 1 << 14;
+
+  /** The number of buffers of the exited threads which are kept when a new thread registers */
+  static constexpr int kMaxExitedThreadBuffers = 16;
+
+  static TimelineTracer &instance();
+
+  /** Starts recording; a non-empty timeline is not cleared.
+   *
+   * @param sampling_period   only every sampling_period-th iteration is recorded
+   * @param capacity          the number of events stored per thread
+   */
+  void Start(int sampling_period = 1, int capacity = kDefaultCapacity);
+
+  /** Stops recording; the events recorded so far can still be exported. */
+  void Stop();
+
+  bool IsEnabled() const {
+    return enabled_.load(std::memory_order_relaxed);
+  }
+
+  /** Whether the events which aren't associated with any iteration are being recorded.
+   *
+   * This function is very cheap and can be used to skip taking timestamps.
+   */
+  static bool IsRecording() {
+    return recording_.load(std::memory_order_relaxed);
+  }
+
+  /** Whether the events of a given iteration are recorded. */
+  bool IsSampled(int64_t iteration) const {
+    return IsEnabled() && iteration % sampling_period_.load(std::memory_order_relaxed) == 0;
+  }
+
+  /** Announces the launch of an iteration - used for sampling. */
+  void BeginIteration(int64_t iteration) {
+    if (IsEnabled())
+      recording_.store(IsSampled(iteration), std::memory_order_relaxed);
+  }
+
+  /** Returns an identifier of the name, to be used in TimelineEvent.
+   *
+   * The same name always gets the same identifier. The function is thread-safe, but it locks
+   * a mutex - the result should be obtained once and stored.
+   */
+  int Intern(std::string_view name);
+
+  /** Records an event in the calling thread's buffer. */
+  void Record(const TimelineEvent &event);
+
+  /** Gives a name to the calling thread; the name is exported along with the events.
+   *
+   * This function doesn't allocate a buffer - the name is stored until an event is recorded.
+   */
+  void SetThisThreadName(std::string_view name);
+
+  /** The current time, in nanoseconds */
+  static int64_t Now() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+  }
+
+  /** Discards the recorded events and the buffers of the threads which have exited. */
+  void Clear();
+
+  /** The number of events currently stored in all buffers */
+  int64_t NumEvents() const;
+
+  /** The number of per-thread buffers, including those of the exited threads */
+  int NumThreadBuffers() const;
+
+  /** Writes the recorded events as a JSON object in Chrome trace format.
+   *
+   * The result can be loaded in chrome://tracing or https://ui.perfetto.dev
+   */
+  void ExportChromeTrace(std::ostream &os) const;
+
+  std::string ExportChromeTrace() const;
+
+ private:
+  TimelineTracer() = default;
+
+  struct ThreadBuffer;
+  /** The calling thread's buffer, which is empty until it's registered */
+  static std::shared_ptr<ThreadBuffer> &ThreadLocalBuffer();
+  /** Returns the calling thread's buffer, registering it if necessary */
+  ThreadBuffer *ThisThreadBuffer();
+  /** Removes the oldest buffers of the exited threads, keeping at most `keep` of them;
+   *  requires buffers_mutex_ to be locked. */
+  void PruneExitedBuffers(int keep);
+
+  static std::atomic<bool> recording_;
+  std::atomic<bool> enabled_{false};
+  std::atomic<int> sampling_period_{1};
+  std::atomic<int> capacity_{kDefaultCapacity};
+  int64_t time_origin_ = 0;
+
+  mutable std::mutex names_mutex_;
+  std::deque<std::string> names_;
+  std::unordered_map<std::string_view, int> name_ids_;
+
+  mutable std::mutex buffers_mutex_;
+  std::vector<std::shared_ptr<ThreadBuffer>> buffers_;
+  int next_thread_id_ = 0;
+};
+
+/** Records the time spent in a scope as a timeline event.
+ *
+ * If the tracer isn't recording when the scope starts, nothing is recorded and the cost is
+ * a single relaxed atomic load.
+ */
+class TimelineScope {
+ public:
+  TimelineScope(int name, TimelineCategory category)
+  : TimelineScope(name, category, -1, TimelineTracer::IsRecording()) {}
+
+  /** Records the scope if the iteration is sampled. */
+  TimelineScope(int name, TimelineCategory category, int64_t iteration)
+  : TimelineScope(name, category, iteration,
+                  TimelineTracer::instance().IsSampled(iteration)) {}
+
+  ~TimelineScope() {
+    if (event_.start) {
+      event_.end = TimelineTracer::Now();
+      TimelineTracer::instance().Record(event_);
+    }
+  }
+
+  TimelineScope(const TimelineScope &) = delete;
+  TimelineScope &operator=(const TimelineScope &) = delete;
+
+ private:
+  TimelineScope(int name, TimelineCategory category, int64_t arg, bool record) {
+    if (record) {
+      event_.name = name;
+      event_.category = category;
+      event_.arg = arg;
+      event_.start = TimelineTracer::Now();
+    }
+  }
+
+  TimelineEvent event_;
+};
+
+}  // namespace dali
+
+#endif  // DALI_CORE_EXEC_TIMELINE_H_
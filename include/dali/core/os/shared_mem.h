@@ -16,6 +16,7 @@
 #define DALI_CORE_OS_SHARED_MEM_H_
 
 #include <stdint.h>
+#include <cstring>
 #include <memory>
 #include <string>
 #include "dali/core/common.h"
@@ -28,7 +29,7 @@ namespace dali {
 using shm_handle_t = int;
 using fd_handle_t = int;
 
-void handle_strerror(int errnum, char *buf, size_t buflen) {
+inline void handle_strerror(int errnum, char *buf, size_t buflen) {
   #if (_POSIX_C_SOURCE >= 200112L) && !_GNU_SOURCE
     DALI_ENFORCE(strerror_r(errnum, buf, buflen) == 0, "Call to strerror_r failed.");
   #else
@@ -298,6 +298,27 @@ typedef enum _DALIExecFlags {
    */
   DALI_EXEC_FLAGS_STREAM_POLICY_PER_OPERATOR = 3 << 4,
 
+  /** Adjust the queue depth and the number of active worker threads at run time.
+   *
+   * The queue depth is increased up to DALI_EXEC2_ADAPTIVE_MAX_QUEUE_DEPTH (default: 4) and
+   * the number of active threads can be reduced down to DALI_EXEC2_ADAPTIVE_MIN_THREADS
+   * (default: 1). DALI_EXEC2_ADAPTIVE_MAX_HOST_MEMORY_MB limits the host memory occupied by
+   * the queued outputs.
+   *
+   * For DALI_EXEC_DYNAMIC only.
+   */
+  DALI_EXEC_FLAGS_ADAPTIVE_TUNING = 1 << 7,
+
+  /** Analyze the critical path and the stalls of the pipeline.
+   *
+   * The statistics are aggregated over windows of DALI_EXEC2_STALL_ANALYSIS_WINDOW iterations
+   * (default: 64). Setting the environment variable also enables the analysis.
+   * See daliPipelineGetStallReport.
+   *
+   * For DALI_EXEC_DYNAMIC only.
+   */
+  DALI_EXEC_FLAGS_STALL_ANALYSIS = 1 << 8,
+
   DALI_EXEC_FLAGS_FORCE_INT32 = 0x7fffffff
 } daliExecFlags_t;
 
@@ -746,6 +767,249 @@ DALI_API daliResult_t daliPipelineOutputsGet(
   daliTensorList_h *out,
   int index);
 
+/** Gets a range of samples of the index-th output.
+ *
+ * The samples are not copied - the returned tensor list shares the data with the output.
+ * This can be used to collect the outputs of individual requests when multiple requests are
+ * batched together in one iteration (continuous batching).
+ *
+ * The handle returned by this function must be released with a call to daliTensorListDecRef.
+ *
+ * Unless the pipeline uses DALI_EXEC_IS_DYNAMIC flag, the returned tensor list must not be used
+ * after the `outputs` handle is destroyed.
+ *
+ * @param outputs      [in]  The pipeline outputs object
+ * @param out          [out] A pointer to a TensorList handle
+ * @param index        [in]  The index of the output
+ * @param first_sample [in]  The index of the first sample in the range
+ * @param num_samples  [in]  The number of samples in the range
+ *
+ * @retval DALI_SUCCESS                   On success
+ * @retval DALI_ERROR_OUT_OF_RANGE        The output index or the sample range is out of range
+ */
+DALI_API daliResult_t daliPipelineOutputsGetSamples(
+  daliPipelineOutputs_h outputs,
+  daliTensorList_h *out,
+  int index,
+  int first_sample,
+  int num_samples);
+
+/****************************************************************************/
+/*** Continuous batching ****************************************************/
+/****************************************************************************/
+
+/** The latency budget of continuous batching */
+typedef struct _DALIContinuousBatchingParams {
+  /** The maximum number of samples in an iteration; if 0, the pipeline's max_batch_size is used */
+  int max_batch_size;
+  /** The maximum time, in microseconds, a request can wait for its iteration to be launched */
+  int64_t max_wait_us;
+} daliContinuousBatchingParams_t;
+
+/** The location of the samples of a request in the pipeline outputs */
+typedef struct _DALIRequestRange {
+  /** The id passed to daliPipelineSubmitRequest */
+  int64_t request_id;
+  /** The index of the first sample of the request in the outputs */
+  int first_sample;
+  /** The number of samples in the request */
+  int num_samples;
+} daliRequestRange_t;
+
+/** The latency and throughput of the requests processed with continuous batching.
+ *
+ * The latency is measured from the submission of a request until the outputs of its
+ * iteration are popped.
+ */
+typedef struct _DALIContinuousBatchingStats {
+  int64_t num_requests;
+  int64_t num_batches;
+  int64_t num_samples;
+  /** The number of batches launched because they were full (rather than on timeout) */
+  int64_t num_full_batches;
+  /** The mean number of samples in an iteration */
+  double mean_batch_size;
+  double mean_queue_delay_us, max_queue_delay_us;
+  double mean_latency_us, p50_latency_us, p99_latency_us, max_latency_us;
+  /** Completed samples per second */
+  double throughput;
+} daliContinuousBatchingStats_t;
+
+/** Enables continuous batching of requests.
+ *
+ * In this mode, the requests, each consisting of a few samples, are submitted with
+ * daliPipelineSubmitRequest. The driver thread calls daliPipelineRunBatched, which waits until
+ * the pending requests fill a batch or the oldest of them has waited for `max_wait_us`, feeds
+ * the samples of the requests to the input operators and runs an iteration with the resulting
+ * batch size. The outputs of the iteration are popped as usual; the sample range of each
+ * request is obtained with daliPipelineOutputsGetRequests.
+ *
+ * Only CPU inputs are supported. The pipeline must be built and must not be run or fed by other
+ * means while continuous batching is used.
+ *
+ * Continuous batching can be enabled again after it has been stopped and all of its requests
+ * have been run (daliPipelineRunBatched reported no requests). The new session has its own
+ * statistics and may use data of a different type or layout than the previous one.
+ *
+ * @param pipeline  [in]  The pipeline
+ * @param params    [in]  The latency budget
+ *
+ * @retval DALI_SUCCESS                   On success
+ * @retval DALI_ERROR_INVALID_ARGUMENT    The parameters are invalid
+ * @retval DALI_ERROR_INVALID_OPERATION   Continuous batching is already enabled, or it was
+ *                                        stopped but some of its requests haven't been run
+ */
+DALI_API daliResult_t daliPipelineEnableContinuousBatching(
+  daliPipeline_h pipeline,
+  const daliContinuousBatchingParams_t *params);
+
+/** Submits a request for processing with continuous batching.
+ *
+ * The request must contain data for each input of the pipeline; all tensor lists must have the
+ * same number of samples, not larger than the batch size limit. The samples are not copied -
+ * the tensor lists are referenced until the request is fed to the pipeline.
+ *
+ * This function can be called from any thread.
+ *
+ * @param pipeline    [in]  The pipeline
+ * @param request_id  [in]  An id of the request, reported by daliPipelineOutputsGetRequests
+ * @param num_inputs  [in]  The number of inputs in the request
+ * @param input_names [in]  The names of the inputs
+ * @param inputs      [in]  The data of the inputs
+ *
+ * @retval DALI_SUCCESS                   On success
+ * @retval DALI_ERROR_INVALID_KEY         An input name is not an input of the pipeline
+ * @retval DALI_ERROR_INVALID_ARGUMENT    The request is incomplete or its data doesn't match
+ *                                        the previous requests
+ * @retval DALI_ERROR_INVALID_OPERATION   Continuous batching is not enabled or it was stopped
+ */
+DALI_API daliResult_t daliPipelineSubmitRequest(
+  daliPipeline_h pipeline,
+  int64_t request_id,
+  int num_inputs,
+  const char *const *input_names,
+  const daliTensorList_h *inputs);
+
+/** Waits for a batch of requests, feeds it to the pipeline and runs an iteration.
+ *
+ * The function blocks until the pending requests fill a batch or the oldest one has waited for
+ * the maximum time. The requests are never split between iterations.
+ *
+ * @param pipeline          [in]  The pipeline
+ * @param out_num_requests  [out] The number of requests in the iteration; 0 if continuous
+ *                                batching was stopped and there are no pending requests -
+ *                                in that case, no iteration is run.
+ */
+DALI_API daliResult_t daliPipelineRunBatched(daliPipeline_h pipeline, int *out_num_requests);
+
+/** Stops accepting new requests; the pending ones are launched without waiting.
+ *
+ * This function can be called from any thread.
+ */
+DALI_API daliResult_t daliPipelineStopContinuousBatching(daliPipeline_h pipeline);
+
+/** Gets the latency and throughput statistics of continuous batching. */
+DALI_API daliResult_t daliPipelineGetContinuousBatchingStats(
+  daliPipeline_h pipeline,
+  daliContinuousBatchingStats_t *out_stats);
+
+/** Gets the requests processed in the iteration which produced the outputs.
+ *
+ * The outputs of a request are obtained with daliPipelineOutputsGetSamples.
+ * If the outputs were not produced with daliPipelineRunBatched, the count is 0.
+ *
+ * @param outputs       [in]  The pipeline outputs object
+ * @param out_requests  [out] The sample ranges of the requests, in the order of submission;
+ *                            valid until the `outputs` handle is destroyed
+ * @param out_count     [out] The number of requests
+ */
+DALI_API daliResult_t daliPipelineOutputsGetRequests(
+  daliPipelineOutputs_h outputs,
+  const daliRequestRange_t **out_requests,
+  int *out_count);
+
+/****************************************************************************/
+/*** Shared memory outputs **************************************************/
+/****************************************************************************/
+
+/** Describes a pipeline output placed in a shared memory arena.
+ *
+ * The samples are stored one after another, starting at `offset`. To access the data,
+ * a consumer process maps the arena, using `arena_handle`, with a size of at least
+ * `offset + size`.
+ */
+typedef struct _DALISharedMemOutput {
+  /** The handle (file descriptor) of the shared memory arena, valid in the producer process.
+   *
+   * The arena doesn't have a name in the file system - the handle is passed to the consumers
+   * e.g. over a Unix domain socket (SCM_RIGHTS) or opened as /proc/<producer pid>/fd/<handle>.
+   * The handle is the same for all outputs of a pipeline.
+   */
+  int arena_handle;
+  /** The size of the arena at the time the output was placed in it.
+   *
+   * The arena can grow, but it never shrinks; a mapping of this size covers the output.
+   */
+  size_t arena_size;
+  /** The offset of the output data in the arena */
+  size_t offset;
+  /** The total size of the output data, in bytes */
+  size_t size;
+  /** The number of samples in the output */
+  int num_samples;
+  /** The number of dimensions of the samples */
+  int ndim;
+  /** The element type */
+  daliDataType_t dtype;
+  /** The layout of the samples; empty string if not specified */
+  const char *layout;
+  /** The shapes of the samples - `num_samples * ndim` extents */
+  const int64_t *shapes;
+  /** The offsets of the samples, relative to `offset` */
+  const size_t *sample_offsets;
+} daliSharedMemOutput_t;
+
+/** Enables placing the CPU outputs of the pipeline in a shared memory arena.
+ *
+ * The arena is created by this call; it's shared by all outputs of the pipeline and grows
+ * when necessary. The CPU outputs of the iterations which begin after this call are allocated
+ * directly in the arena; daliPipelineOutputsGetSharedMem describes their location.
+ * The consumers (e.g. worker processes on the same node) can then read the data directly
+ * from the shared memory.
+ *
+ * The function has no effect if the shared memory outputs are already enabled.
+ *
+ * @param pipeline          [in]  The pipeline
+ * @param initial_capacity  [in]  The initial size of the arena, in bytes
+ */
+DALI_API daliResult_t daliPipelineEnableSharedMemOutputs(
+  daliPipeline_h pipeline,
+  size_t initial_capacity);
+
+/** Places the index-th output in the shared memory arena and gets its location.
+ *
+ * Usually, the output has been allocated in the arena by the pipeline and no copy is made.
+ * Otherwise (e.g. the output is passed through from an operator which returns a contiguous
+ * batch, or the iteration began before the arena was enabled), the output is copied to the arena
+ * on the first call for the given index. Subsequent calls return the same descriptor.
+ * The block of the arena occupied by the output may be released as soon as the `outputs` handle
+ * is destroyed (see daliPipelineOutputsDestroy) - the consumers must finish reading the data
+ * before that. The descriptor is valid until the `outputs` handle is destroyed.
+ *
+ * @param outputs   [in]  The pipeline outputs object
+ * @param out_desc  [out] A pointer to the location where the pointer to the descriptor is stored
+ * @param index     [in]  The index of the output; it must be a CPU output
+ *
+ * @retval DALI_SUCCESS                   On success
+ * @retval DALI_ERROR_OUT_OF_RANGE        The output index is out of range
+ * @retval DALI_ERROR_INVALID_ARGUMENT    The output is not a CPU output
+ * @retval DALI_ERROR_INVALID_OPERATION   The shared memory outputs are not enabled
+ */
+DALI_API daliResult_t daliPipelineOutputsGetSharedMem(
+  daliPipelineOutputs_h outputs,
+  const daliSharedMemOutput_t **out_desc,
+  int index);
+
 /****************************************************************************/
 /*** Checkpointing **********************************************************/
 /****************************************************************************/
@@ -840,6 +1104,136 @@ DALI_API daliResult_t daliCheckpointGetExternalData(
 /** Destroys a checkpoint object */
 DALI_API daliResult_t daliCheckpointDestroy(daliCheckpoint_h checkpoint);
 
+/****************************************************************************/
+/*** Timeline ***************************************************************/
+/****************************************************************************/
+
+/** Starts recording the CPU-side timeline of the execution.
+ *
+ * The timeline contains the time spans of the operators, thread pool jobs, reader prefetching
+ * and decoding, recorded in per-thread buffers. When a buffer is full, the oldest events in it
+ * are overwritten. The events recorded previously are discarded.
+ *
+ * NOTE: The timeline is process-wide - it contains the activity of all pipelines.
+ *
+ * @param pipeline        [in]  The pipeline
+ * @param sampling_period [in]  Only every sampling_period-th iteration is recorded; this allows
+ *                              the recording to stay enabled in long runs at a lower cost.
+ *
+ * @retval DALI_SUCCESS
+ * @retval DALI_ERROR_INVALID_ARGUMENT    The sampling period is not positive.
+ */
+DALI_API daliResult_t daliPipelineStartTimeline(daliPipeline_h pipeline, int sampling_period);
+
+/** Stops recording the timeline.
+ *
+ * The events recorded so far can still be obtained with daliPipelineGetTimeline.
+ */
+DALI_API daliResult_t daliPipelineStopTimeline(daliPipeline_h pipeline);
+
+/** Gets the recorded timeline as JSON in Chrome trace format.
+ *
+ * The result can be loaded in chrome://tracing or https://ui.perfetto.dev
+ * The recording doesn't need to be stopped.
+ *
+ * @param pipeline    [in]  The pipeline
+ * @param out_json    [out] A pointer to the null-terminated JSON string. The string remains
+ *                          valid until the next call to this function or until the pipeline
+ *                          is destroyed.
+ * @param out_size    [out] An optional pointer to the location where the length of the string
+ *                          is stored.
+ */
+DALI_API daliResult_t daliPipelineGetTimeline(
+  daliPipeline_h pipeline,
+  const char **out_json,
+  size_t *out_size);
+
+/****************************************************************************/
+/*** Stall analysis *********************************************************/
+/****************************************************************************/
+
+/** The part of the processing which limits the throughput of the pipeline. */
+typedef enum _DALIPipelineBound {
+  /** There's not enough data */
+  DALI_PIPELINE_BOUND_UNKNOWN = 0,
+  /** The pipeline is faster than the consumer of its outputs */
+  DALI_PIPELINE_BOUND_CONSUMER = 1,
+  /** The readers (I/O) */
+  DALI_PIPELINE_BOUND_READER = 2,
+  /** The decoders */
+  DALI_PIPELINE_BOUND_DECODER = 3,
+  /** The remaining operators (e.g. augmentations) */
+  DALI_PIPELINE_BOUND_PROCESSING = 4,
+
+  DALI_PIPELINE_BOUND_FORCE_INT32 = 0x7fffffff
+} daliPipelineBound_t;
+
+/** The statistics of one operator, aggregated over a window of iterations.
+ *
+ * The times are measured on the host, in nanoseconds. For GPU operators, the busy time is
+ * the time it takes to schedule the work.
+ */
+typedef struct _DALIOperatorStallStats {
+  /** The instance name of the operator */
+  const char *name;
+  /** The number of iterations in which the operator ran */
+  int iterations;
+  /** The time spent in the operator's Setup and Run */
+  int64_t busy_ns;
+  /** The time the operator waited for a thread, its previous iteration or the output queue */
+  int64_t blocked_ns;
+  /** The remaining time in the window */
+  int64_t idle_ns;
+  /** The number of iterations in which the operator was on the critical path */
+  int critical_path_iterations;
+  /** The busy time in the iterations in which the operator was on the critical path */
+  int64_t critical_path_ns;
+  /** Readers only: the number of iterations in which the prefetched data was not ready */
+  int starved_iterations;
+  /** Readers only: the time spent waiting for the prefetching thread */
+  int64_t starvation_ns;
+} daliOperatorStallStats_t;
+
+/** The analysis of stalls in the pipeline, aggregated over a window of iterations. */
+typedef struct _DALIStallReport {
+  /** The number of iterations in the window; 0 if the analysis is not enabled */
+  int iterations;
+  /** The wall time of the window, as seen by the consumer of the outputs */
+  int64_t duration_ns;
+  /** The time the consumer waited for the outputs */
+  int64_t consumer_wait_ns;
+  /** The number of iterations in which the outputs weren't ready when requested */
+  int queue_empty_stalls;
+  /** The number of iterations in which all queued outputs were ready before being requested */
+  int queue_full_stalls;
+  /** The total length of the critical paths of the iterations */
+  int64_t critical_path_ns;
+  /** The number of iterations in which any of the readers was starved */
+  int reader_starved_iterations;
+  /** What limits the throughput */
+  daliPipelineBound_t bound;
+  /** The operator which contributed the most to the critical path; empty if unknown */
+  const char *bottleneck;
+  /** The number of elements in `operators` */
+  int num_operators;
+  const daliOperatorStallStats_t *operators;
+} daliStallReport_t;
+
+/** Gets the analysis of the stalls and the critical path of the pipeline.
+ *
+ * The analysis must be enabled with DALI_EXEC_FLAGS_STALL_ANALYSIS; otherwise, the report
+ * is empty. The report describes the most recent complete window of iterations or, before the
+ * first window is complete, the current one.
+ *
+ * @param pipeline    [in]  The pipeline
+ * @param out_report  [out] A pointer to the location where the pointer to the report is stored.
+ *                          The report remains valid until the next call to this function or until
+ *                          the pipeline is destroyed.
+ */
+DALI_API daliResult_t daliPipelineGetStallReport(
+  daliPipeline_h pipeline,
+  const daliStallReport_t **out_report);
+
 /****************************************************************************/
 /*** Tensor and TensorList API **********************************************/
 /****************************************************************************/